@@ -0,0 +1,490 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OB_ALP_FIXED_PFOR_H_
+#define OB_ALP_FIXED_PFOR_H_
+
+#include "ob_codecs.h"
+#include "lib/utility/ob_macro_utils.h"
+#include "lib/oblog/ob_log_module.h"
+#include "lib/oblog/ob_log.h"
+#include "lib/utility/utility.h"
+#include "lib/codec/ob_simd_fixed_pfor.h"
+
+namespace oceanbase
+{
+namespace common
+{
+
+// the float type whose bit pattern is held by UIntT, 1/2 byte uints have no float type,
+// they are always stored in raw blocks.
+template<typename UIntT>
+struct ObAlpFloatTraits
+{
+  typedef float FloatT;
+  static const bool SUPPORTED = false;
+  static const uint8_t MAX_EXPONENT = 0;
+  static constexpr float MAGIC_NUMBER = 0;
+  static constexpr float ENCODING_LIMIT = 0;
+  OB_INLINE static float exp(const uint8_t e) { return 1; }
+  OB_INLINE static float frac(const uint8_t e) { return 1; }
+};
+
+template<>
+struct ObAlpFloatTraits<uint32_t>
+{
+  typedef float FloatT;
+  static const bool SUPPORTED = true;
+  static const uint8_t MAX_EXPONENT = 10;
+  // x + 2^23 + 2^22 - (2^23 + 2^22) rounds x to the nearest integer if |x| < 2^22
+  static constexpr float MAGIC_NUMBER = 12582912.0f;
+  static constexpr float ENCODING_LIMIT = 4194304.0f;
+  OB_INLINE static float exp(const uint8_t e)
+  {
+    static const float EXP_ARR[MAX_EXPONENT + 1] = {
+      1.0f, 10.0f, 100.0f, 1000.0f, 10000.0f, 100000.0f, 1000000.0f, 10000000.0f,
+      100000000.0f, 1000000000.0f, 10000000000.0f};
+    return EXP_ARR[e];
+  }
+  OB_INLINE static float frac(const uint8_t e)
+  {
+    static const float FRAC_ARR[MAX_EXPONENT + 1] = {
+      1.0f, 0.1f, 0.01f, 0.001f, 0.0001f, 0.00001f, 0.000001f, 0.0000001f,
+      0.00000001f, 0.000000001f, 0.0000000001f};
+    return FRAC_ARR[e];
+  }
+};
+
+template<>
+struct ObAlpFloatTraits<uint64_t>
+{
+  typedef double FloatT;
+  static const bool SUPPORTED = true;
+  static const uint8_t MAX_EXPONENT = 18;
+  // x + 2^52 + 2^51 - (2^52 + 2^51) rounds x to the nearest integer if |x| < 2^51
+  static constexpr double MAGIC_NUMBER = 6755399441055744.0;
+  static constexpr double ENCODING_LIMIT = 2251799813685248.0;
+  OB_INLINE static double exp(const uint8_t e)
+  {
+    static const double EXP_ARR[MAX_EXPONENT + 1] = {
+      1.0, 10.0, 100.0, 1000.0, 10000.0, 100000.0, 1000000.0, 10000000.0, 100000000.0,
+      1000000000.0, 10000000000.0, 100000000000.0, 1000000000000.0, 10000000000000.0,
+      100000000000000.0, 1000000000000000.0, 10000000000000000.0, 100000000000000000.0,
+      1000000000000000000.0};
+    return EXP_ARR[e];
+  }
+  OB_INLINE static double frac(const uint8_t e)
+  {
+    static const double FRAC_ARR[MAX_EXPONENT + 1] = {
+      1.0, 0.1, 0.01, 0.001, 0.0001, 0.00001, 0.000001, 0.0000001, 0.00000001,
+      0.000000001, 0.0000000001, 0.00000000001, 0.000000000001, 0.0000000000001,
+      0.00000000000001, 0.000000000000001, 0.0000000000000001, 0.00000000000000001,
+      0.000000000000000001};
+    return FRAC_ARR[e];
+  }
+};
+
+// ALP(adaptive lossless floating point):
+// most floating point values of a column are decimals with few significant digits, such value v
+// can be restored exactly from the integer n = round(v * 10^e * 10^-f) by n * 10^f * 10^-e.
+// for each block the (e, f) pair with the smallest estimated size is chosen from a sample, then
+// the integers are stored with frame of reference + fixedpfor, values which can not be restored
+// exactly (including nan, inf, -0.0 and non-float bit patterns) are stored as exceptions.
+//
+// block format:
+//   | exponent(1B) | factor(1B) | exception_count(2B) | frame_of_reference(8B) | packed ints |
+//   | exception positions(2B * exception_count) | exception values(sizeof(UIntT) * exception_count) |
+// or if exponent is RAW_BLOCK_EXPONENT:
+//   | exponent(1B) | raw values(sizeof(UIntT) * count) |
+//
+// the input is the uint stream which may be subtracted by base value, so the bit pattern of the
+// floating point value is (in[i] + base).
+class ObAlpFixedPforInner
+{
+public:
+  static const uint64_t BSIZE = 1024;
+  static const uint64_t PFOR_BSIZE = ObSIMDFixedPFor::BlockSize;
+  static const uint64_t SAMPLE_COUNT = 32;
+  static const uint8_t RAW_BLOCK_EXPONENT = UINT8_MAX;
+  static const int64_t BLOCK_HEADER_SIZE = 1 + 1 + 2 + 8;
+
+  template<typename UIntT>
+  OB_INLINE static typename ObAlpFloatTraits<UIntT>::FloatT to_float(const UIntT v, const UIntT base)
+  {
+    typedef typename ObAlpFloatTraits<UIntT>::FloatT FloatT;
+    const UIntT bits = v + base;
+    FloatT f;
+    MEMCPY(&f, &bits, sizeof(FloatT));
+    return f;
+  }
+
+  template<typename UIntT>
+  OB_INLINE static UIntT to_uint(const typename ObAlpFloatTraits<UIntT>::FloatT f, const UIntT base)
+  {
+    UIntT bits;
+    MEMCPY(&bits, &f, sizeof(UIntT));
+    return bits - base;
+  }
+
+  // return false if v can not be restored from the encoded integer
+  template<typename UIntT>
+  OB_INLINE static bool encode_value(
+      const UIntT v, const UIntT base, const uint8_t e, const uint8_t f, int64_t &n)
+  {
+    typedef ObAlpFloatTraits<UIntT> Traits;
+    typedef typename Traits::FloatT FloatT;
+    bool is_exact = false;
+    const FloatT x = to_float<UIntT>(v, base) * Traits::exp(e) * Traits::frac(f);
+    // nan and inf fail the comparison
+    if (x > -Traits::ENCODING_LIMIT && x < Traits::ENCODING_LIMIT) {
+      n = static_cast<int64_t>(x + Traits::MAGIC_NUMBER - Traits::MAGIC_NUMBER);
+      is_exact = (to_uint<UIntT>(decode_value<UIntT>(n, e, f), base) == v);
+    }
+    return is_exact;
+  }
+
+  template<typename UIntT>
+  OB_INLINE static typename ObAlpFloatTraits<UIntT>::FloatT decode_value(
+      const int64_t n, const uint8_t e, const uint8_t f)
+  {
+    typedef ObAlpFloatTraits<UIntT> Traits;
+    typedef typename Traits::FloatT FloatT;
+    return static_cast<FloatT>(n) * Traits::exp(f) * Traits::frac(e);
+  }
+
+  template<typename UIntT>
+  static void choose_exponent_and_factor(
+      const UIntT *in, const uint32_t cnt, const UIntT base, uint8_t &best_e, uint8_t &best_f)
+  {
+    typedef ObAlpFloatTraits<UIntT> Traits;
+    const uint32_t step = MAX(cnt / SAMPLE_COUNT, 1);
+    uint64_t best_cost = UINT64_MAX;
+    best_e = RAW_BLOCK_EXPONENT;
+    best_f = 0;
+    for (uint8_t e = 0; e <= Traits::MAX_EXPONENT; e++) {
+      for (uint8_t f = 0; f <= e; f++) {
+        uint64_t exception_cnt = 0;
+        uint32_t sample_cnt = 0;
+        int64_t min = INT64_MAX;
+        int64_t max = INT64_MIN;
+        int64_t n = 0;
+        for (uint32_t i = 0; i < cnt; i += step, sample_cnt++) {
+          if (encode_value<UIntT>(in[i], base, e, f, n)) {
+            min = MIN(min, n);
+            max = MAX(max, n);
+          } else {
+            exception_cnt++;
+          }
+        }
+        const uint64_t bits = (min > max) ? 0 : gccbits(static_cast<uint64_t>(max - min));
+        const uint64_t cost = sample_cnt * bits + exception_cnt * (sizeof(UIntT) + sizeof(uint16_t)) * CHAR_BIT;
+        if (cost < best_cost) {
+          best_cost = cost;
+          best_e = e;
+          best_f = f;
+        }
+      }
+    }
+  }
+
+  template<typename UIntT>
+  static int encode_raw_block(
+      const UIntT *in, const uint32_t cnt, char *out, const uint64_t out_buf_len, uint64_t &out_pos)
+  {
+    int ret = OB_SUCCESS;
+    const uint64_t size = 1 + cnt * sizeof(UIntT);
+    if (OB_UNLIKELY(out_buf_len - out_pos < size)) {
+      ret = OB_BUF_NOT_ENOUGH;
+      LIB_LOG(WARN, "buf not enough", K(ret), K(out_buf_len), K(out_pos), K(size));
+    } else {
+      *(out + out_pos) = RAW_BLOCK_EXPONENT;
+      MEMCPY(out + out_pos + 1, in, cnt * sizeof(UIntT));
+      out_pos += size;
+    }
+    return ret;
+  }
+
+  template<typename UIntT>
+  static int encode_block(
+      const ObCodec::PFoRPackingType pfor_ptype,
+      const UIntT *in, const uint32_t cnt, const UIntT base,
+      char *out, const uint64_t out_buf_len, uint64_t &out_pos)
+  {
+    int ret = OB_SUCCESS;
+    uint8_t e = RAW_BLOCK_EXPONENT;
+    uint8_t f = 0;
+    if constexpr (ObAlpFloatTraits<UIntT>::SUPPORTED) {
+      choose_exponent_and_factor<UIntT>(in, cnt, base, e, f);
+    }
+
+    if (RAW_BLOCK_EXPONENT == e) {
+      if (OB_FAIL(encode_raw_block<UIntT>(in, cnt, out, out_buf_len, out_pos))) {
+        LIB_LOG(WARN, "fail to encode raw block", K(ret), K(cnt));
+      }
+    } else if constexpr (ObAlpFloatTraits<UIntT>::SUPPORTED) {
+      int64_t encoded[BSIZE];
+      uint16_t exception_pos[BSIZE];
+      uint16_t exception_cnt = 0;
+      int64_t min = INT64_MAX;
+      int64_t max = INT64_MIN;
+      for (uint32_t i = 0; i < cnt; i++) {
+        if (encode_value<UIntT>(in[i], base, e, f, encoded[i])) {
+          min = MIN(min, encoded[i]);
+          max = MAX(max, encoded[i]);
+        } else {
+          exception_pos[exception_cnt++] = static_cast<uint16_t>(i);
+        }
+      }
+      if (min > max) {
+        min = 0;
+        max = 0;
+      }
+      // fill exceptions with frame of reference to keep bit width small
+      for (uint16_t i = 0; i < exception_cnt; i++) {
+        encoded[exception_pos[i]] = min;
+      }
+      UIntT v[BSIZE];
+      for (uint32_t i = 0; i < cnt; i++) {
+        v[i] = static_cast<UIntT>(encoded[i] - min);
+      }
+
+      const uint64_t estimate_size = BLOCK_HEADER_SIZE + (cnt * gccbits(static_cast<uint64_t>(max - min)) + CHAR_BIT - 1) / CHAR_BIT
+          + exception_cnt * (sizeof(uint16_t) + sizeof(UIntT));
+      if (estimate_size >= 1 + cnt * sizeof(UIntT)) {
+        if (OB_FAIL(encode_raw_block<UIntT>(in, cnt, out, out_buf_len, out_pos))) {
+          LIB_LOG(WARN, "fail to encode raw block", K(ret), K(cnt));
+        }
+      } else if (OB_UNLIKELY(out_buf_len - out_pos < BLOCK_HEADER_SIZE)) {
+        ret = OB_BUF_NOT_ENOUGH;
+        LIB_LOG(WARN, "buf not enough", K(ret), K(out_buf_len), K(out_pos));
+      } else {
+        *(out + out_pos) = e;
+        *(out + out_pos + 1) = f;
+        MEMCPY(out + out_pos + 2, &exception_cnt, sizeof(exception_cnt));
+        MEMCPY(out + out_pos + 4, &min, sizeof(min));
+        out_pos += BLOCK_HEADER_SIZE;
+        const uint32_t pfor_cnt = cnt & ~(PFOR_BSIZE - 1);
+        for (uint32_t i = 0; OB_SUCC(ret) && i < pfor_cnt; i += PFOR_BSIZE) {
+          if (OB_FAIL(ObSIMDFixedPFor::__encode_array<UIntT>(pfor_ptype, v + i, PFOR_BSIZE, out, out_buf_len, out_pos))) {
+            LIB_LOG(WARN, "fail to encode array", K(ret), K(out_buf_len), K(out_pos));
+          }
+        }
+        if (OB_SUCC(ret) && cnt > pfor_cnt) {
+          const char *tmp_in = reinterpret_cast<const char *>(v + pfor_cnt);
+          const uint64_t tmp_in_len = (cnt - pfor_cnt) * sizeof(UIntT);
+          if (OB_FAIL(ObSimpleBitPacking::_encode_array<UIntT>(tmp_in, tmp_in_len, out, out_buf_len, out_pos, 0))) {
+            LIB_LOG(WARN, "fail to encode array", K(ret), K(tmp_in_len), K(out_buf_len), K(out_pos));
+          }
+        }
+        if (OB_SUCC(ret)) {
+          const uint64_t exception_size = exception_cnt * (sizeof(uint16_t) + sizeof(UIntT));
+          if (OB_UNLIKELY(out_buf_len - out_pos < exception_size)) {
+            ret = OB_BUF_NOT_ENOUGH;
+            LIB_LOG(WARN, "buf not enough", K(ret), K(out_buf_len), K(out_pos), K(exception_size));
+          } else {
+            MEMCPY(out + out_pos, exception_pos, exception_cnt * sizeof(uint16_t));
+            out_pos += exception_cnt * sizeof(uint16_t);
+            UIntT *exception_out = reinterpret_cast<UIntT *>(out + out_pos);
+            for (uint16_t i = 0; i < exception_cnt; i++) {
+              exception_out[i] = in[exception_pos[i]];
+            }
+            out_pos += exception_cnt * sizeof(UIntT);
+          }
+        }
+      }
+    }
+    return ret;
+  }
+
+  template<typename UIntT>
+  static int encode(
+      const ObCodec::PFoRPackingType pfor_ptype,
+      const char *in, const uint64_t in_len,
+      char *out, const uint64_t out_buf_len, uint64_t &out_pos, const UIntT base)
+  {
+    // performance critical, do not check param(outer has already checked)
+    int ret = OB_SUCCESS;
+    const UIntT *ip = reinterpret_cast<const UIntT *>(in);
+    const uint64_t cnt = in_len / sizeof(UIntT);
+    for (uint64_t i = 0; OB_SUCC(ret) && i < cnt; i += BSIZE) {
+      const uint32_t block_cnt = static_cast<uint32_t>(MIN(BSIZE, cnt - i));
+      if (OB_FAIL(encode_block<UIntT>(pfor_ptype, ip + i, block_cnt, base, out, out_buf_len, out_pos))) {
+        LIB_LOG(WARN, "fail to encode block", K(ret), K(i), K(cnt), K(out_buf_len), K(out_pos));
+      }
+    }
+    return ret;
+  }
+
+  template<typename UIntT>
+  /*OB_INLINE*/ static void decode(
+      const ObCodec::PFoRPackingType pfor_ptype,
+      const char *in,
+      const uint64_t in_len,
+      uint64_t &pos,
+      const uint64_t uint_count,
+      char *out,
+      const uint64_t out_buf_len,
+      uint64_t &out_pos,
+      const UIntT base)
+  {
+    typedef typename ObAlpFloatTraits<UIntT>::FloatT FloatT;
+    UIntT *op = reinterpret_cast<UIntT *>(out + out_pos);
+    UIntT v[BSIZE];
+    char *tmp_out = reinterpret_cast<char *>(v);
+    const uint64_t tmp_out_len = BSIZE * sizeof(UIntT);
+    uint64_t tmp_out_pos = 0;
+
+    for (uint64_t i = 0; i < uint_count; i += BSIZE) {
+      const uint32_t cnt = static_cast<uint32_t>(MIN(BSIZE, uint_count - i));
+      const uint8_t e = *(in + pos);
+      if (RAW_BLOCK_EXPONENT == e) {
+        MEMCPY(op, in + pos + 1, cnt * sizeof(UIntT));
+        pos += 1 + cnt * sizeof(UIntT);
+      } else if constexpr (ObAlpFloatTraits<UIntT>::SUPPORTED) {
+        const uint8_t f = *(in + pos + 1);
+        uint16_t exception_cnt = 0;
+        int64_t min = 0;
+        MEMCPY(&exception_cnt, in + pos + 2, sizeof(exception_cnt));
+        MEMCPY(&min, in + pos + 4, sizeof(min));
+        pos += BLOCK_HEADER_SIZE;
+
+        tmp_out_pos = 0;
+        const uint32_t pfor_cnt = cnt & ~(PFOR_BSIZE - 1);
+        if (pfor_cnt > 0) {
+          ObSIMDFixedPFor::__decode_array<UIntT>(pfor_ptype, in, in_len, pos, pfor_cnt, tmp_out, tmp_out_len, tmp_out_pos);
+        }
+        if (cnt > pfor_cnt) {
+          ObSimpleBitPacking::_decode_array<UIntT>(in, in_len, pos, cnt - pfor_cnt, tmp_out, tmp_out_len, tmp_out_pos, 0);
+        }
+
+        // branchless, can be vectorized by compiler
+        const FloatT fact = ObAlpFloatTraits<UIntT>::exp(f);
+        const FloatT frac = ObAlpFloatTraits<UIntT>::frac(e);
+        for (uint32_t j = 0; j < cnt; j++) {
+          const FloatT d = static_cast<FloatT>(static_cast<int64_t>(v[j]) + min) * fact * frac;
+          op[j] = to_uint<UIntT>(d, base);
+        }
+
+        const uint16_t *exception_pos = reinterpret_cast<const uint16_t *>(in + pos);
+        const UIntT *exception_val = reinterpret_cast<const UIntT *>(in + pos + exception_cnt * sizeof(uint16_t));
+        for (uint16_t j = 0; j < exception_cnt; j++) {
+          op[exception_pos[j]] = exception_val[j];
+        }
+        pos += exception_cnt * (sizeof(uint16_t) + sizeof(UIntT));
+      }
+      op += cnt;
+    }
+    out_pos = reinterpret_cast<char *>(op) - out;
+  }
+};
+
+// alp + frame of reference + fixedpfor, used for float and double stored as uint stream
+class ObAlpFixedPfor : public ObCodec
+{
+public:
+  enum
+  {
+    BlockSize = 1,
+  };
+  ObAlpFixedPfor() : base_value_(0) {}
+  virtual uint32_t get_block_size() { return BlockSize; }
+
+  virtual const char *name() const override { return "ObAlpFixedPfor"; }
+
+  // base value subtracted from the uint stream, needed to restore the floating point bit pattern
+  OB_INLINE void set_base_value(const uint64_t base_value) { base_value_ = base_value; }
+
+  virtual int do_encode(const char *in,
+                        const uint64_t in_len,
+                        char *out,
+                        const uint64_t out_len,
+                        uint64_t &out_pos) override
+  {
+    int ret = OB_SUCCESS;
+    const PFoRPackingType pfor_ptype = get_pfor_packing_type();
+    switch (get_uint_bytes())  {
+      case 1 : {
+        ret = ObAlpFixedPforInner::encode<uint8_t>(pfor_ptype, in, in_len, out, out_len, out_pos, base_value_);
+        break;
+      }
+      case 2 : {
+        ret = ObAlpFixedPforInner::encode<uint16_t>(pfor_ptype, in, in_len, out, out_len, out_pos, base_value_);
+        break;
+      }
+      case 4 : {
+        ret = ObAlpFixedPforInner::encode<uint32_t>(pfor_ptype, in, in_len, out, out_len, out_pos, base_value_);
+        break;
+      }
+      case 8 : {
+        ret = ObAlpFixedPforInner::encode<uint64_t>(pfor_ptype, in, in_len, out, out_len, out_pos, base_value_);
+        break;
+      }
+      default : {
+        ret = OB_NOT_SUPPORTED;
+        break;
+      }
+    }
+    if (OB_FAIL(ret)) {
+      LIB_LOG(WARN, "fail to do_encode", K(ret), K(get_uint_bytes()), KPC(this));
+    }
+    return ret;
+  }
+
+  virtual int do_decode(const char *in,
+                        const uint64_t in_len,
+                        uint64_t &in_pos,
+                        const uint64_t uint_count,
+                        char *out,
+                        const uint64_t out_len,
+                        uint64_t &out_pos) override
+  {
+    int ret = OB_SUCCESS;
+    const PFoRPackingType pfor_ptype = get_pfor_packing_type();
+    switch (get_uint_bytes())  {
+      case 1 : {
+        ObAlpFixedPforInner::decode<uint8_t>(pfor_ptype, in, in_len, in_pos, uint_count, out, out_len, out_pos, base_value_);
+        break;
+      }
+      case 2 : {
+        ObAlpFixedPforInner::decode<uint16_t>(pfor_ptype, in, in_len, in_pos, uint_count, out, out_len, out_pos, base_value_);
+        break;
+      }
+      case 4 : {
+        ObAlpFixedPforInner::decode<uint32_t>(pfor_ptype, in, in_len, in_pos, uint_count, out, out_len, out_pos, base_value_);
+        break;
+      }
+      case 8 : {
+        ObAlpFixedPforInner::decode<uint64_t>(pfor_ptype, in, in_len, in_pos, uint_count, out, out_len, out_pos, base_value_);
+        break;
+      }
+      default : {
+        ret = OB_NOT_SUPPORTED;
+        LIB_LOG(WARN, "not support", K(ret), K(get_uint_bytes()), KPC(this));
+        break;
+      }
+    }
+    return ret;
+  }
+
+  INHERIT_TO_STRING_KV("ObCodec", ObCodec, K_(base_value));
+private:
+  uint64_t base_value_;
+};
+
+} // namespace common
+} // namespace oceanbase
+
+#endif /*  OB_ALP_FIXED_PFOR_H_ */
@@ -293,6 +293,8 @@ STAT_EVENT_ADD_DEF(BACKUP_META_CACHE_HIT, "backup meta cache hit", ObStatClassId
 STAT_EVENT_ADD_DEF(BACKUP_META_CACHE_MISS, "backup meta cache miss", ObStatClassIds::CACHE, 50074, true, true, true)
 STAT_EVENT_ADD_DEF(TRUNCATE_INFO_CACHE_HIT, "truncate info cache hit", ObStatClassIds::CACHE, 50075, true, true, true)
 STAT_EVENT_ADD_DEF(TRUNCATE_INFO_CACHE_MISS, "truncate info cache miss", ObStatClassIds::CACHE, 50076, true, true, true)
+STAT_EVENT_ADD_DEF(AI_FUNC_RESULT_CACHE_HIT, "ai func result cache hit", ObStatClassIds::CACHE, 50077, true, true, true)
+STAT_EVENT_ADD_DEF(AI_FUNC_RESULT_CACHE_MISS, "ai func result cache miss", ObStatClassIds::CACHE, 50078, true, true, true)
 
 // STORAGE
 STAT_EVENT_ADD_DEF(MEMSTORE_LOGICAL_READS, "MEMSTORE_LOGICAL_READS", STORAGE, "MEMSTORE_LOGICAL_READS", true, true, false)
@@ -299,6 +299,24 @@ int knn_search(obvsag::VectorIndexPtr index_handler, uint32_t len, uint32_t *dim
 #endif
 }
 
+int batch_knn_search(obvsag::VectorIndexPtr index_handler, float *query_vectors, int dim,
+                     int64_t query_count, int64_t topk, const float **result_dists,
+                     const int64_t **result_ids, int64_t *result_sizes, int ef_search,
+                     void *invalid, bool reverse_filter, bool is_extra_info_filter,
+                     float valid_ratio, void *allocator, float distance_threshold)
+{
+  INIT_SUCC(ret);
+#ifdef OB_BUILD_CDC_DISABLE_VSAG
+  return ret;
+#else
+  return obvsag::batch_knn_search(index_handler, query_vectors, dim, query_count, topk,
+                                  result_dists, result_ids, result_sizes,
+                                  ef_search, invalid, reverse_filter,
+                                  is_extra_info_filter, allocator, valid_ratio,
+                                  distance_threshold);
+#endif
+}
+
 int fserialize(obvsag::VectorIndexPtr index_handler, std::ostream& out_stream)
 {
     INIT_SUCC(ret);
@@ -134,6 +134,22 @@ int knn_search(obvsag::VectorIndexPtr index_handler, uint32_t len, uint32_t *dim
     void *invalid = nullptr, bool reverse_filter = false,
     bool is_extra_info_filter = false, float valid_ratio = 1.0, void *allocator = nullptr, bool need_extra_info = false);
 
+int batch_knn_search(obvsag::VectorIndexPtr index_handler,
+                     float *query_vectors,
+                     int dim,
+                     int64_t query_count,
+                     int64_t topk,
+                     const float **result_dists,
+                     const int64_t **result_ids,
+                     int64_t *result_sizes,
+                     int ef_search,
+                     void *invalid = NULL,
+                     bool reverse_filter = false,
+                     bool is_extra_info_filter = false,
+                     float valid_ratio = 1.0,
+                     void *allocator = nullptr,
+                     float distance_threshold = FLT_MAX);
+
 int fserialize(obvsag::VectorIndexPtr index_handler, std::ostream& out_stream);
 
 int fdeserialize(obvsag::VectorIndexPtr& index_handler, std::istream& in_stream);
@@ -134,6 +134,12 @@ public:
                  int index_type, FilterInterface *bitmap, bool reverse_filter,
                  bool need_extra_info, const char *&extra_infos,
                  void *&iter_ctx, bool is_last_search, void *allocator);
+  int batch_knn_search(const float *query_vectors, int dim, int64_t query_count,
+                       int64_t topk, const std::string &parameters,
+                       const float **dists, const int64_t **ids,
+                       int64_t *result_sizes, float valid_ratio,
+                       FilterInterface *bitmap, bool reverse_filter,
+                       void *allocator, float distance_threshold = FLT_MAX);
   std::shared_ptr<vsag::Index> &get_index() { return index_; }
   void set_index(std::shared_ptr<vsag::Index> hnsw) { index_ = hnsw; }
   vsag::Allocator *get_allocator() const { return allocator_; }
@@ -405,6 +411,64 @@ int HnswIndexHandler::knn_search(const vsag::DatasetPtr &query, int64_t topk,
   return ret;
 }
 
+// The filter, search param and query dataset are built once and shared by all
+// queries of the batch, only the query vector pointer moves between searches.
+int HnswIndexHandler::batch_knn_search(const float *query_vectors, int dim,
+                                       int64_t query_count, int64_t topk,
+                                       const std::string &parameters,
+                                       const float **dists, const int64_t **ids,
+                                       int64_t *result_sizes, float valid_ratio,
+                                       FilterInterface *bitmap, bool reverse_filter,
+                                       void *allocator, float distance_threshold)
+{
+  int ret = OB_SUCCESS;
+  std::function<bool(int64_t)> vid_filter = [bitmap, reverse_filter](int64_t id) -> bool {
+    if (!reverse_filter) {
+      return bitmap->test(id);
+    } else {
+      return !(bitmap->test(id));
+    }
+  };
+  std::function<bool(const char *)> exinfo_filter = [bitmap, reverse_filter](const char *data) -> bool {
+    if (!reverse_filter) {
+      return bitmap->test(data);
+    } else {
+      return !(bitmap->test(data));
+    }
+  };
+
+  std::shared_ptr<ObVasgFilter> vsag_filter = std::make_shared<ObVasgFilter>(valid_ratio, vid_filter, exinfo_filter);
+  vsag::Allocator *vsag_allocator = nullptr;
+  if (allocator != nullptr) vsag_allocator = static_cast<vsag::Allocator *>(allocator);
+  vsag::SearchParam search_param(false, parameters,
+                                 bitmap == nullptr ? nullptr : vsag_filter,
+                                 vsag_allocator);
+  DatasetPtr query = vsag::Dataset::Make();
+  query->NumElements(1)->Dim(dim)->Owner(false);
+  for (int64_t i = 0; OB_SUCC(ret) && i < query_count; ++i) {
+    query->Float32Vectors(query_vectors + i * dim);
+    tl::expected<std::shared_ptr<vsag::Dataset>, vsag::Error> result = index_->KnnSearch(query, topk, search_param);
+    if (result.has_value()) {
+      result.value()->Owner(false);
+      ids[i] = result.value()->GetIds();
+      dists[i] = result.value()->GetDistances();
+      result_sizes[i] = result.value()->GetDim();
+      if (distance_threshold != FLT_MAX) {
+        // knn result is ordered by distance, keep the prefix within threshold
+        int64_t valid_cnt = 0;
+        while (valid_cnt < result_sizes[i] && dists[i][valid_cnt] <= distance_threshold) {
+          ++valid_cnt;
+        }
+        result_sizes[i] = valid_cnt;
+      }
+    } else {
+      ret = vsag_errcode2ob(result.error().type);
+      LOG_WARN("knn search in batch failed", K(ret), K(i), K(query_count));
+    }
+  }
+  return ret;
+}
+
 void set_log_level(int32_t ob_level_num)
 {
   static std::map<int32_t, int32_t> ob2vsag_log_level = {
@@ -1153,6 +1217,42 @@ int knn_search(VectorIndexPtr &index_handler, float *query_vector,
   return ret;
 }
 
+int batch_knn_search(VectorIndexPtr &index_handler, float *query_vectors,
+                     int dim, int64_t query_count, int64_t topk,
+                     const float **dists, const int64_t **ids,
+                     int64_t *result_sizes, int ef_search, void *invalid,
+                     bool reverse_filter, bool use_extra_info_filter,
+                     void *allocator, float valid_ratio, float distance_threshold)
+{
+  int ret = OB_SUCCESS;
+  if (index_handler == nullptr || query_vectors == nullptr || dists == nullptr
+      || ids == nullptr || result_sizes == nullptr || query_count <= 0) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("[OBVSAG] invalid argument", KP(index_handler), KP(query_vectors), KP(dists),
+             KP(ids), KP(result_sizes), K(query_count));
+  } else {
+    FilterInterface *bitmap = static_cast<FilterInterface *>(invalid);
+    HnswIndexHandler *hnsw = static_cast<HnswIndexHandler *>(index_handler);
+    const IndexType index_type = static_cast<IndexType>(hnsw->get_index_type());
+    char result_param_str[1024]= {0};
+    if (IPIVF_TYPE == index_type) {
+      ret = OB_NOT_SUPPORTED;
+      LOG_WARN("[OBVSAG] batch knn search is not supported for sparse index", K(ret), K(index_type));
+    } else if (OB_FAIL(construct_vsag_search_param(uint8_t(index_type), ef_search, use_extra_info_filter, result_param_str))) {
+      LOG_WARN("[OBVSAG] construct_vsag_search_param fail", K(ret), K(index_type), K(ef_search), K(use_extra_info_filter));
+    } else {
+      const std::string input_json_string(result_param_str);
+      if (OB_FAIL(hnsw->batch_knn_search(query_vectors, dim, query_count, topk, input_json_string,
+                                         dists, ids, result_sizes, valid_ratio, bitmap,
+                                         reverse_filter, allocator, distance_threshold))) {
+        LOG_WARN("[OBVSAG] batch knn search error happend", K(ret), K(index_type), K(query_count),
+                 KCSTRING(result_param_str));
+      }
+    }
+  }
+  return ret;
+}
+
 int knn_search(obvsag::VectorIndexPtr &index_handler, uint32_t len, uint32_t *dims, float *vals, int64_t topk,
     const float *&result_dist, const int64_t *&result_ids, const char *&extra_infos, int64_t &result_size,
     float query_prune_ratio, int64_t n_candidate, void *invalid, bool reverse_filter,
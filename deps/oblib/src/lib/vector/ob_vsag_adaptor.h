@@ -120,6 +120,16 @@ int knn_search(VectorIndexPtr& index_handler,float* query_vector, int dim, int64
                bool need_extra_info, const char*& extra_infos,
                void* invalid = nullptr, bool reverse_filter = false,
                bool use_extra_info_filter = false, void *allocator = nullptr, float valid_ratio = 1, float distance_threshold = FLT_MAX);
+/*
+ * search query_count dense vectors stored contiguously in query_vectors with one shared filter,
+ * dists/ids/result_sizes must hold query_count entries and receive the result of each query
+ */
+int batch_knn_search(VectorIndexPtr& index_handler, float* query_vectors, int dim,
+                     int64_t query_count, int64_t topk,
+                     const float** dists, const int64_t** ids, int64_t* result_sizes,
+                     int ef_search, void* invalid = nullptr, bool reverse_filter = false,
+                     bool use_extra_info_filter = false, void *allocator = nullptr,
+                     float valid_ratio = 1, float distance_threshold = FLT_MAX);
 int knn_search(obvsag::VectorIndexPtr &index_handler, uint32_t len, uint32_t *dims, float *vals, int64_t topk,
     const float *&result_dist, const int64_t *&result_ids, const char *&extra_infos, int64_t &result_size,
     float query_prune_ratio, int64_t n_candidate, void *invalid = nullptr, bool reverse_filter = false,
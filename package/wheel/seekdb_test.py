@@ -24,6 +24,33 @@ sql = '''insert into doc_table values
 cursor.execute(sql)
 conn.commit()
 
+cursor.execute('insert into doc_table(c1, vector, query) values (?, ?, ?)', (7, [2, 2, 1], 'prepared insert'))
+affected_rows = cursor.executemany('insert into doc_table(c1, vector, query) values (?, ?, ?)',
+                                   [(8, [2, 1, 2], 'batch insert'), (9, [2, 2, 2], None)])
+print(affected_rows)
+assert affected_rows == 2
+# many rows reuse one param buffer
+affected_rows = cursor.executemany('insert into doc_table(c1, vector, query) values (?, ?, ?)',
+                                   [(100 + i, [i, i + 1, i + 2], 'row %d' % i) for i in range(1000)])
+assert affected_rows == 1000
+cursor.execute('select count(*) from doc_table where c1 >= 100')
+assert cursor.fetchall()[0][0] == 1000
+# an empty executemany drops the previous result
+assert cursor.executemany('insert into doc_table(c1) values (?)', []) == 0
+try:
+    cursor.fetchall()
+    assert False, 'fetch after empty executemany should fail'
+except RuntimeError:
+    pass
+# only lists of numbers are bound as vectors
+try:
+    cursor.execute('insert into doc_table(c1, query) values (?, ?)', (10, ['a', 'b']))
+    assert False, 'list of strings should be rejected'
+except RuntimeError:
+    pass
+cursor.execute('delete from doc_table where c1 > ?', (6,))
+conn.commit()
+
 sql = '''
     SET @parm = '{
       "query": {
@@ -47,3 +74,27 @@ conn.commit()
 sql = '''SELECT json_pretty(DBMS_HYBRID_SEARCH.SEARCH('doc_table', @parm))'''
 cursor.execute(sql)
 print(cursor.fetchall())
+
+cursor.execute('select c1, vector from doc_table order by c1')
+columns = cursor.fetch_numpy()
+print(columns['c1'], columns['vector'].shape)
+assert columns['c1'].tolist() == [1, 2, 3, 4, 5, 6]
+assert columns['vector'].dtype.name == 'float32' and columns['vector'].shape == (6, 3)
+assert columns['vector'][0].tolist() == [1.0, 2.0, 3.0]
+
+# dtype comes from the result metadata, not from the first row
+cursor.execute('select cast(null as double) as d, c1 from doc_table where c1 < 3 order by c1')
+columns = cursor.fetch_numpy()
+assert columns['d'].dtype.name == 'float64' and columns['d'].mask.all()
+assert columns['c1'].dtype.name == 'int64'
+cursor.execute('select c1, vector from doc_table where c1 > 100')
+columns = cursor.fetch_numpy()
+assert columns['c1'].dtype.name == 'int64' and len(columns['c1']) == 0
+assert columns['vector'].dtype.name == 'float32' and columns['vector'].shape == (0, 3)
+
+# duplicated column names are kept apart
+cursor.execute('select a.c1, b.c1, a.c1 from doc_table a join doc_table b on a.c1 + 1 = b.c1 order by a.c1')
+columns = cursor.fetch_numpy()
+assert list(columns.keys()) == ['c1', 'c1.1', 'c1.2']
+assert columns['c1'].tolist() == [1, 2, 3, 4, 5]
+assert columns['c1.1'].tolist() == [2, 3, 4, 5, 6]
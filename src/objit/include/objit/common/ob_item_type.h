@@ -2950,6 +2950,10 @@ typedef enum ObItemType
   T_FUN_ES_SCORE = 4913, // fulltext index for ES SQL
   T_FUN_ES_MATCH = 4914, // fulltext index for ES SQL
   T_HYBRID_SEARCH_EXPRESSION = 4915,
+  T_COL_SKIP_INDEX_NGRAM_BLOOM_FILTER = 4916,
+  T_COL_SKIP_INDEX_HLL = 4917,
+  T_COL_SKIP_INDEX_VECTOR_BOUND = 4918,
+  T_COL_SKIP_INDEX_BLOOM_FILTER = 4919,
   T_MAX //Attention: add a new type before T_MAX
 } ObItemType;
 
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OCEANBASE_DEPS_OBJIT_INCLUDE_OBJIT_OB_JIT_FILTER_KERNEL_H_
+#define OCEANBASE_DEPS_OBJIT_INCLUDE_OBJIT_OB_JIT_FILTER_KERNEL_H_
+
+#include "lib/container/ob_se_array.h"
+#include "objit/ob_llvm_helper.h"
+
+namespace oceanbase
+{
+namespace jit
+{
+
+enum class ObJitFilterOp : int
+{
+  INVALID = 0,
+  LEAF,
+  ADD,
+  SUB,
+  MUL,
+  EQ,
+  NE,
+  LT,
+  LE,
+  GT,
+  GE,
+  AND,
+  OR,
+  NOT,
+  CASE,          // [when, then]*, [else], a missing else is null
+  INT_TO_DOUBLE,
+  MAX_OP
+};
+
+enum class ObJitValueType : int
+{
+  INT64 = 0,
+  DOUBLE
+};
+
+// node of the expression dag, args of a node must be placed before it
+struct ObJitFilterNode
+{
+  ObJitFilterNode()
+    : op_(ObJitFilterOp::INVALID), type_(ObJitValueType::INT64), leaf_idx_(-1),
+      arg_start_(0), arg_cnt_(0) {}
+  TO_STRING_KV("op", static_cast<int>(op_), "type", static_cast<int>(type_), K_(leaf_idx),
+               K_(arg_start), K_(arg_cnt));
+
+  ObJitFilterOp op_;
+  ObJitValueType type_;
+  // index of the leaf vector for LEAF
+  int64_t leaf_idx_;
+  // args are args[arg_start_, arg_start_ + arg_cnt_) of the args array
+  int64_t arg_start_;
+  int64_t arg_cnt_;
+};
+
+// Values of a leaf, either fixed length values with a null bitmap or an ObDatum array.
+// Row i reads index (i & idx_mask_), so a constant leaf has idx_mask_ 0.
+struct ObJitLeafVector
+{
+  ObJitLeafVector() : data_(nullptr), nulls_(nullptr), datums_(nullptr), idx_mask_(-1) {}
+  TO_STRING_KV(KP_(data), KP_(nulls), KP_(datums), K_(idx_mask));
+
+  const char *data_;
+  // nullptr if there is no null in data_
+  const uint64_t *nulls_;
+  // data_ and nulls_ are ignored if not nullptr
+  const char *datums_;
+  int64_t idx_mask_;
+};
+
+// layout of the datums read by the kernel, given by the sql engine
+struct ObJitDatumLayout
+{
+  ObJitDatumLayout() : size_(0), ptr_offset_(0), desc_offset_(0), null_mask_(0) {}
+  TO_STRING_KV(K_(size), K_(ptr_offset), K_(desc_offset), K_(null_mask));
+
+  int64_t size_;
+  int64_t ptr_offset_;
+  // offset of the 32 bits word of the null flag
+  int64_t desc_offset_;
+  uint32_t null_mask_;
+};
+
+/**
+ * @class ObJitFilterKernel
+ * @brief A batch of filters compiled into one loop.
+ *
+ * @desc:
+ * - All the filters are evaluated for a row in registers, rows rejected by any of them are set
+ *   in the skip bitmap, and run() returns the number of rows left.
+ * - Rows already skipped are not evaluated. A filter passes if it is not null and not 0.
+ * - Integer overflow and out of range or NaN doubles are reported by the expressions as errors
+ *   or with special ordering, the kernel does not mimic them and returns BAIL_OUT instead, the
+ *   caller should evaluate the batch again with the expressions. Rows rejected before bailing
+ *   out stay in skip, that is fine since they are rejected by the filters anyway.
+ * - The code lives in the ObJitFilterModule the kernel is added to, the kernel can be run once
+ *   the module is compiled and as long as the module is alive.
+ */
+class ObJitFilterKernel
+{
+public:
+  typedef int64_t (*KernelFunc)(const ObJitLeafVector *leaves, uint64_t *skip, const int64_t size);
+  static const int64_t BAIL_OUT = -1;
+
+  ObJitFilterKernel() : func_idx_(-1), func_(nullptr) {}
+  ~ObJitFilterKernel() {}
+
+  OB_INLINE int64_t run(const ObJitLeafVector *leaves, uint64_t *skip, const int64_t size) const
+  {
+    return func_(leaves, skip, size);
+  }
+  bool is_compiled() const { return nullptr != func_; }
+
+  TO_STRING_KV(K_(func_idx), KP_(func));
+
+private:
+  friend class ObJitFilterModule;
+  // index of the function in the module, -1 if not added
+  int64_t func_idx_;
+  KernelFunc func_;
+  DISALLOW_COPY_AND_ASSIGN(ObJitFilterKernel);
+};
+
+/**
+ * @class ObJitFilterModule
+ * @brief The filter kernels of a plan in one llvm module and one jit engine.
+ *
+ * @desc:
+ * - add_kernel() generates the loop of a kernel into the module, compile() optimizes and compiles
+ *   all of them at once and resolves the kernels, so a plan pays for one jit engine and one
+ *   backend run however many filters it has.
+ * - A kernel that fails to generate is dropped from the module and left not compiled. If
+ *   compile() fails no kernel is compiled, the callers evaluate the filters with the expressions.
+ * - The compiled code is released with the module, it must outlive the kernels.
+ */
+class ObJitFilterModule
+{
+public:
+  explicit ObJitFilterModule(common::ObIAllocator &allocator)
+    : helper_(allocator), kernels_(), is_compiled_(false) {}
+  ~ObJitFilterModule() {}
+
+  int add_kernel(const common::ObIArray<ObJitFilterNode> &nodes,
+                 const common::ObIArray<int64_t> &args,
+                 const common::ObIArray<int64_t> &roots,
+                 const int64_t leaf_cnt,
+                 const ObJitDatumLayout &datum_layout,
+                 ObJitFilterKernel &kernel);
+  int compile();
+  int64_t get_kernel_cnt() const { return kernels_.count(); }
+  bool is_compiled() const { return is_compiled_; }
+
+  TO_STRING_KV("kernel_cnt", kernels_.count(), K_(is_compiled));
+
+private:
+  ObLLVMHelper helper_;
+  common::ObSEArray<ObJitFilterKernel *, 4> kernels_;
+  bool is_compiled_;
+  DISALLOW_COPY_AND_ASSIGN(ObJitFilterModule);
+};
+
+} // namespace jit
+} // namespace oceanbase
+
+#endif /* OCEANBASE_DEPS_OBJIT_INCLUDE_OBJIT_OB_JIT_FILTER_KERNEL_H_ */
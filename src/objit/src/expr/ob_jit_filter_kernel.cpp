@@ -0,0 +1,659 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define USING_LOG_PREFIX JIT
+
+#include "objit/ob_jit_filter_kernel.h"
+#include "core/jit_context.h"
+#include "llvm/IR/Intrinsics.h"
+#include "llvm/IR/MDBuilder.h"
+#include "llvm/IR/Verifier.h"
+#include "lib/container/ob_se_array.h"
+
+#define OB_JIT_FILTER_MALLOC_GUARD \
+  lib::ObMallocHookAttrGuard malloc_guard(ObMemAttr(MTL_ID() == OB_INVALID_TENANT_ID ? OB_SYS_TENANT_ID : MTL_ID(), "SqlJit"), false)
+
+namespace oceanbase
+{
+using namespace common;
+namespace jit
+{
+
+namespace
+{
+
+// functions of the module are named by the index of the kernel
+static const char *FILTER_FUNC_NAME_FORMAT = "ob_jit_filter_%ld";
+static const int64_t FILTER_FUNC_NAME_LEN = 64;
+
+// value of a node in the current row, null_ is a i1
+struct ObJitRowValue
+{
+  ObJitRowValue() : val_(nullptr), null_(nullptr) {}
+  ObJitRowValue(llvm::Value *val, llvm::Value *null) : val_(val), null_(null) {}
+  TO_STRING_KV(KP_(val), KP_(null));
+
+  llvm::Value *val_;
+  llvm::Value *null_;
+};
+
+// loop invariant fields of a leaf vector
+struct ObJitLeafState
+{
+  ObJitLeafState()
+    : data_(nullptr), nulls_(nullptr), has_nulls_(nullptr), datums_(nullptr),
+      is_uniform_(nullptr), idx_mask_(nullptr) {}
+  TO_STRING_KV(KP_(data), KP_(nulls), KP_(has_nulls), KP_(datums), KP_(is_uniform), KP_(idx_mask));
+
+  llvm::Value *data_;
+  // points to a zero word if there is no null
+  llvm::Value *nulls_;
+  llvm::Value *has_nulls_;
+  llvm::Value *datums_;
+  llvm::Value *is_uniform_;
+  llvm::Value *idx_mask_;
+};
+
+class ObJitFilterIRGen
+{
+public:
+  ObJitFilterIRGen(core::JitContext &jc,
+                   const char *func_name,
+                   const ObIArray<ObJitFilterNode> &nodes,
+                   const ObIArray<int64_t> &args,
+                   const ObIArray<int64_t> &roots,
+                   const int64_t leaf_cnt,
+                   const ObJitDatumLayout &datum_layout)
+    : ctx_(jc.get_context()), builder_(jc.get_builder()), module_(jc.get_module()),
+      func_name_(func_name), nodes_(nodes), args_(args), roots_(roots), leaf_cnt_(leaf_cnt),
+      datum_layout_(datum_layout), func_(nullptr), bail_bb_(nullptr), zero_(nullptr),
+      row_idx_(nullptr) {}
+  int generate();
+  // nullptr if generate() fails before creating the function
+  llvm::Function *get_func() const { return func_; }
+
+private:
+  int init_leaves(llvm::Value *leaves);
+  int gen_leaf(const ObJitFilterNode &node, ObJitRowValue &value);
+  int gen_node(const ObJitFilterNode &node, ObJitRowValue &value);
+  int gen_arith(const ObJitFilterNode &node, ObJitRowValue &value);
+  int gen_cmp(const ObJitFilterNode &node, ObJitRowValue &value);
+  int gen_logic(const ObJitFilterNode &node, ObJitRowValue &value);
+  int gen_case(const ObJitFilterNode &node, ObJitRowValue &value);
+  const ObJitRowValue &arg(const ObJitFilterNode &node, const int64_t i) const
+  {
+    return values_.at(args_.at(node.arg_start_ + i));
+  }
+  llvm::Type *get_type(const ObJitValueType type)
+  {
+    return ObJitValueType::DOUBLE == type ? builder_.getDoubleTy() : builder_.getInt64Ty();
+  }
+  llvm::Value *is_true(const ObJitRowValue &v)
+  {
+    return builder_.CreateAnd(builder_.CreateNot(v.null_),
+                              builder_.CreateICmpNE(v.val_, builder_.getInt64(0)));
+  }
+  llvm::Value *gep_bytes(llvm::Value *base, llvm::Value *offset, llvm::Type *type)
+  {
+    llvm::Value *addr = builder_.CreateGEP(builder_.getInt8Ty(), base, offset);
+    return builder_.CreateBitCast(addr, type->getPointerTo());
+  }
+  // rows almost never bail out, branch to bail_bb_ as the unlikely way
+  void bail_if(llvm::Value *cond, llvm::Value *null);
+
+private:
+  llvm::LLVMContext &ctx_;
+  llvm::IRBuilder<> &builder_;
+  llvm::Module &module_;
+  const char *func_name_;
+  const ObIArray<ObJitFilterNode> &nodes_;
+  const ObIArray<int64_t> &args_;
+  const ObIArray<int64_t> &roots_;
+  const int64_t leaf_cnt_;
+  const ObJitDatumLayout &datum_layout_;
+  llvm::Function *func_;
+  llvm::BasicBlock *bail_bb_;
+  llvm::Value *zero_;
+  llvm::Value *row_idx_;
+  ObSEArray<ObJitLeafState, 16> leaves_;
+  ObSEArray<ObJitRowValue, 64> values_;
+};
+
+int ObJitFilterIRGen::generate()
+{
+  int ret = OB_SUCCESS;
+  llvm::Type *int64_type = builder_.getInt64Ty();
+  llvm::Type *int64_ptr_type = int64_type->getPointerTo();
+  llvm::Type *arg_types[] = { builder_.getInt8PtrTy(), int64_ptr_type, int64_type };
+  llvm::FunctionType *func_type = llvm::FunctionType::get(int64_type, arg_types, false);
+  llvm::ArrayType *zero_type = llvm::ArrayType::get(int64_type, 1);
+  if (OB_ISNULL(func_ = llvm::Function::Create(func_type, llvm::Function::ExternalLinkage,
+                                               func_name_, module_))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to create function", K(ret));
+  } else {
+    llvm::GlobalVariable *zero = new llvm::GlobalVariable(
+        module_, zero_type, true, llvm::GlobalValue::PrivateLinkage,
+        llvm::ConstantAggregateZero::get(zero_type), "zero");
+    zero_ = builder_.CreateBitCast(zero, int64_ptr_type);
+    llvm::Function::arg_iterator arg_iter = func_->arg_begin();
+    llvm::Value *leaves = &*arg_iter++;
+    llvm::Value *skip = &*arg_iter++;
+    llvm::Value *size = &*arg_iter++;
+    llvm::BasicBlock *entry_bb = llvm::BasicBlock::Create(ctx_, "entry", func_);
+    llvm::BasicBlock *loop_bb = llvm::BasicBlock::Create(ctx_, "loop", func_);
+    llvm::BasicBlock *body_bb = llvm::BasicBlock::Create(ctx_, "body", func_);
+    llvm::BasicBlock *latch_bb = llvm::BasicBlock::Create(ctx_, "latch", func_);
+    llvm::BasicBlock *exit_bb = llvm::BasicBlock::Create(ctx_, "exit", func_);
+    bail_bb_ = llvm::BasicBlock::Create(ctx_, "bail", func_);
+
+    builder_.SetInsertPoint(entry_bb);
+    if (OB_FAIL(init_leaves(leaves))) {
+      LOG_WARN("failed to init leaves", K(ret));
+    } else {
+      builder_.CreateCondBr(builder_.CreateICmpSGT(size, builder_.getInt64(0)), loop_bb, exit_bb);
+
+      // loop: test the skip bit of the row
+      builder_.SetInsertPoint(loop_bb);
+      llvm::PHINode *idx = builder_.CreatePHI(int64_type, 2, "i");
+      llvm::PHINode *cnt = builder_.CreatePHI(int64_type, 2, "cnt");
+      idx->addIncoming(builder_.getInt64(0), entry_bb);
+      cnt->addIncoming(builder_.getInt64(0), entry_bb);
+      llvm::Value *word_ptr = builder_.CreateGEP(int64_type, skip,
+                                                 builder_.CreateLShr(idx, builder_.getInt64(6)));
+      llvm::Value *word = builder_.CreateLoad(int64_type, word_ptr);
+      llvm::Value *bit = builder_.CreateShl(builder_.getInt64(1),
+                                            builder_.CreateAnd(idx, builder_.getInt64(63)));
+      llvm::Value *skipped = builder_.CreateICmpNE(builder_.CreateAnd(word, bit),
+                                                   builder_.getInt64(0));
+      builder_.CreateCondBr(skipped, latch_bb, body_bb);
+
+      // body: evaluate the filters of the row
+      builder_.SetInsertPoint(body_bb);
+      row_idx_ = idx;
+      for (int64_t i = 0; OB_SUCC(ret) && i < nodes_.count(); ++i) {
+        ObJitRowValue value;
+        if (OB_FAIL(gen_node(nodes_.at(i), value))) {
+          LOG_WARN("failed to generate node", K(ret), K(i), K(nodes_.at(i)));
+        } else if (OB_FAIL(values_.push_back(value))) {
+          LOG_WARN("failed to push back value", K(ret));
+        }
+      }
+      if (OB_SUCC(ret)) {
+        llvm::Value *pass = builder_.getTrue();
+        for (int64_t i = 0; i < roots_.count(); ++i) {
+          pass = builder_.CreateAnd(pass, is_true(values_.at(roots_.at(i))));
+        }
+        builder_.CreateStore(builder_.CreateSelect(pass, word, builder_.CreateOr(word, bit)),
+                             word_ptr);
+        llvm::Value *body_cnt = builder_.CreateAdd(cnt, builder_.CreateZExt(pass, int64_type));
+        llvm::BasicBlock *body_end_bb = builder_.GetInsertBlock();
+        builder_.CreateBr(latch_bb);
+
+        // latch
+        builder_.SetInsertPoint(latch_bb);
+        llvm::PHINode *latch_cnt = builder_.CreatePHI(int64_type, 2, "latch_cnt");
+        latch_cnt->addIncoming(cnt, loop_bb);
+        latch_cnt->addIncoming(body_cnt, body_end_bb);
+        llvm::Value *next_idx = builder_.CreateAdd(idx, builder_.getInt64(1));
+        idx->addIncoming(next_idx, latch_bb);
+        cnt->addIncoming(latch_cnt, latch_bb);
+        builder_.CreateCondBr(builder_.CreateICmpSLT(next_idx, size), loop_bb, exit_bb);
+
+        builder_.SetInsertPoint(exit_bb);
+        llvm::PHINode *res = builder_.CreatePHI(int64_type, 2, "res");
+        res->addIncoming(builder_.getInt64(0), entry_bb);
+        res->addIncoming(latch_cnt, latch_bb);
+        builder_.CreateRet(res);
+
+        builder_.SetInsertPoint(bail_bb_);
+        builder_.CreateRet(builder_.getInt64(ObJitFilterKernel::BAIL_OUT));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObJitFilterIRGen::init_leaves(llvm::Value *leaves)
+{
+  int ret = OB_SUCCESS;
+  llvm::Type *int8_ptr_type = builder_.getInt8PtrTy();
+  llvm::Type *int64_type = builder_.getInt64Ty();
+  llvm::Type *int64_ptr_type = int64_type->getPointerTo();
+  for (int64_t i = 0; OB_SUCC(ret) && i < leaf_cnt_; ++i) {
+    ObJitLeafState leaf;
+    const int64_t base = i * sizeof(ObJitLeafVector);
+    leaf.data_ = builder_.CreateLoad(int8_ptr_type,
+        gep_bytes(leaves, builder_.getInt64(base + offsetof(ObJitLeafVector, data_)), int8_ptr_type));
+    llvm::Value *nulls = builder_.CreateLoad(int64_ptr_type,
+        gep_bytes(leaves, builder_.getInt64(base + offsetof(ObJitLeafVector, nulls_)), int64_ptr_type));
+    leaf.datums_ = builder_.CreateLoad(int8_ptr_type,
+        gep_bytes(leaves, builder_.getInt64(base + offsetof(ObJitLeafVector, datums_)), int8_ptr_type));
+    leaf.idx_mask_ = builder_.CreateLoad(int64_type,
+        gep_bytes(leaves, builder_.getInt64(base + offsetof(ObJitLeafVector, idx_mask_)), int64_type));
+    leaf.has_nulls_ = builder_.CreateIsNotNull(nulls);
+    leaf.nulls_ = builder_.CreateSelect(leaf.has_nulls_, nulls, zero_);
+    leaf.is_uniform_ = builder_.CreateIsNotNull(leaf.datums_);
+    if (OB_FAIL(leaves_.push_back(leaf))) {
+      LOG_WARN("failed to push back leaf", K(ret));
+    }
+  }
+  return ret;
+}
+
+void ObJitFilterIRGen::bail_if(llvm::Value *cond, llvm::Value *null)
+{
+  llvm::BasicBlock *cont_bb = llvm::BasicBlock::Create(ctx_, "cont", func_);
+  llvm::MDBuilder md_builder(ctx_);
+  // errors of null rows are not raised by the expressions either
+  builder_.CreateCondBr(builder_.CreateAnd(cond, builder_.CreateNot(null)), bail_bb_, cont_bb,
+                        md_builder.createBranchWeights(1, 1 << 20));
+  builder_.SetInsertPoint(cont_bb);
+}
+
+int ObJitFilterIRGen::gen_leaf(const ObJitFilterNode &node, ObJitRowValue &value)
+{
+  int ret = OB_SUCCESS;
+  const ObJitLeafState &leaf = leaves_.at(node.leaf_idx_);
+  llvm::Type *type = get_type(node.type_);
+  llvm::Type *int64_type = builder_.getInt64Ty();
+  llvm::Type *int8_ptr_type = builder_.getInt8PtrTy();
+  llvm::Value *idx = builder_.CreateAnd(row_idx_, leaf.idx_mask_);
+  llvm::BasicBlock *uniform_bb = llvm::BasicBlock::Create(ctx_, "uniform", func_);
+  llvm::BasicBlock *fixed_bb = llvm::BasicBlock::Create(ctx_, "fixed", func_);
+  llvm::BasicBlock *join_bb = llvm::BasicBlock::Create(ctx_, "join", func_);
+  builder_.CreateCondBr(leaf.is_uniform_, uniform_bb, fixed_bb);
+
+  // ObDatum array, the payload of a null datum may be invalid
+  builder_.SetInsertPoint(uniform_bb);
+  llvm::Value *datum = builder_.CreateGEP(builder_.getInt8Ty(), leaf.datums_,
+      builder_.CreateMul(idx, builder_.getInt64(datum_layout_.size_)));
+  llvm::Value *ptr = builder_.CreateAlignedLoad(int8_ptr_type,
+      gep_bytes(datum, builder_.getInt64(datum_layout_.ptr_offset_), int8_ptr_type),
+      llvm::MaybeAlign(1));
+  llvm::Value *desc = builder_.CreateAlignedLoad(builder_.getInt32Ty(),
+      gep_bytes(datum, builder_.getInt64(datum_layout_.desc_offset_), builder_.getInt32Ty()),
+      llvm::MaybeAlign(1));
+  llvm::Value *uniform_null = builder_.CreateICmpNE(
+      builder_.CreateAnd(desc, builder_.getInt32(datum_layout_.null_mask_)), builder_.getInt32(0));
+  llvm::Value *payload = builder_.CreateSelect(uniform_null,
+                                               builder_.CreateBitCast(zero_, int8_ptr_type), ptr);
+  llvm::Value *uniform_val = builder_.CreateAlignedLoad(
+      type, builder_.CreateBitCast(payload, type->getPointerTo()), llvm::MaybeAlign(1));
+  builder_.CreateBr(join_bb);
+
+  // fixed length values and null bitmap
+  builder_.SetInsertPoint(fixed_bb);
+  llvm::Value *fixed_val = builder_.CreateAlignedLoad(type,
+      builder_.CreateGEP(type, builder_.CreateBitCast(leaf.data_, type->getPointerTo()), idx),
+      llvm::MaybeAlign(1));
+  llvm::Value *word_idx = builder_.CreateSelect(leaf.has_nulls_,
+      builder_.CreateLShr(idx, builder_.getInt64(6)), builder_.getInt64(0));
+  llvm::Value *word = builder_.CreateLoad(int64_type,
+                                          builder_.CreateGEP(int64_type, leaf.nulls_, word_idx));
+  llvm::Value *fixed_null = builder_.CreateTrunc(
+      builder_.CreateLShr(word, builder_.CreateAnd(idx, builder_.getInt64(63))),
+      builder_.getInt1Ty());
+  builder_.CreateBr(join_bb);
+
+  builder_.SetInsertPoint(join_bb);
+  llvm::PHINode *val = builder_.CreatePHI(type, 2);
+  llvm::PHINode *null = builder_.CreatePHI(builder_.getInt1Ty(), 2);
+  val->addIncoming(uniform_val, uniform_bb);
+  val->addIncoming(fixed_val, fixed_bb);
+  null->addIncoming(uniform_null, uniform_bb);
+  null->addIncoming(fixed_null, fixed_bb);
+  value = ObJitRowValue(val, null);
+  return ret;
+}
+
+int ObJitFilterIRGen::gen_arith(const ObJitFilterNode &node, ObJitRowValue &value)
+{
+  int ret = OB_SUCCESS;
+  const ObJitRowValue &left = arg(node, 0);
+  const ObJitRowValue &right = arg(node, 1);
+  llvm::Value *null = builder_.CreateOr(left.null_, right.null_);
+  llvm::Value *val = nullptr;
+  if (ObJitValueType::INT64 == node.type_) {
+    llvm::Intrinsic::ID id = ObJitFilterOp::ADD == node.op_ ? llvm::Intrinsic::sadd_with_overflow
+        : (ObJitFilterOp::SUB == node.op_ ? llvm::Intrinsic::ssub_with_overflow
+                                          : llvm::Intrinsic::smul_with_overflow);
+    llvm::Value *res = builder_.CreateBinaryIntrinsic(id, left.val_, right.val_);
+    val = builder_.CreateExtractValue(res, 0);
+    bail_if(builder_.CreateExtractValue(res, 1), null);
+  } else {
+    val = ObJitFilterOp::ADD == node.op_ ? builder_.CreateFAdd(left.val_, right.val_)
+        : (ObJitFilterOp::SUB == node.op_ ? builder_.CreateFSub(left.val_, right.val_)
+                                          : builder_.CreateFMul(left.val_, right.val_));
+    // the expressions raise out of range for inf and nan
+    llvm::Value *abs_val = builder_.CreateUnaryIntrinsic(llvm::Intrinsic::fabs, val);
+    llvm::Value *finite = builder_.CreateFCmpOLT(
+        abs_val, llvm::ConstantFP::getInfinity(builder_.getDoubleTy()));
+    bail_if(builder_.CreateNot(finite), null);
+  }
+  value = ObJitRowValue(val, null);
+  return ret;
+}
+
+int ObJitFilterIRGen::gen_cmp(const ObJitFilterNode &node, ObJitRowValue &value)
+{
+  int ret = OB_SUCCESS;
+  const ObJitRowValue &left = arg(node, 0);
+  const ObJitRowValue &right = arg(node, 1);
+  const bool is_double = left.val_->getType()->isDoubleTy();
+  llvm::Value *null = builder_.CreateOr(left.null_, right.null_);
+  llvm::CmpInst::Predicate pred = llvm::CmpInst::BAD_ICMP_PREDICATE;
+  switch (node.op_) {
+    case ObJitFilterOp::EQ:
+      pred = is_double ? llvm::CmpInst::FCMP_OEQ : llvm::CmpInst::ICMP_EQ;
+      break;
+    case ObJitFilterOp::NE:
+      pred = is_double ? llvm::CmpInst::FCMP_ONE : llvm::CmpInst::ICMP_NE;
+      break;
+    case ObJitFilterOp::LT:
+      pred = is_double ? llvm::CmpInst::FCMP_OLT : llvm::CmpInst::ICMP_SLT;
+      break;
+    case ObJitFilterOp::LE:
+      pred = is_double ? llvm::CmpInst::FCMP_OLE : llvm::CmpInst::ICMP_SLE;
+      break;
+    case ObJitFilterOp::GT:
+      pred = is_double ? llvm::CmpInst::FCMP_OGT : llvm::CmpInst::ICMP_SGT;
+      break;
+    case ObJitFilterOp::GE:
+      pred = is_double ? llvm::CmpInst::FCMP_OGE : llvm::CmpInst::ICMP_SGE;
+      break;
+    default:
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected compare op", K(ret), K(node));
+  }
+  if (OB_SUCC(ret)) {
+    if (is_double) {
+      // nan is ordered as the largest double by the expressions
+      bail_if(builder_.CreateFCmpUNO(left.val_, right.val_), null);
+    }
+    llvm::Value *res = builder_.CreateCmp(pred, left.val_, right.val_);
+    value = ObJitRowValue(builder_.CreateZExt(res, builder_.getInt64Ty()), null);
+  }
+  return ret;
+}
+
+int ObJitFilterIRGen::gen_logic(const ObJitFilterNode &node, ObJitRowValue &value)
+{
+  int ret = OB_SUCCESS;
+  if (ObJitFilterOp::NOT == node.op_) {
+    const ObJitRowValue &child = arg(node, 0);
+    llvm::Value *res = builder_.CreateICmpEQ(child.val_, builder_.getInt64(0));
+    value = ObJitRowValue(builder_.CreateZExt(res, builder_.getInt64Ty()), child.null_);
+  } else {
+    // three-valued: AND is false if any arg is false, OR is true if any arg is true, otherwise
+    // the result is null if any arg is null
+    const bool is_and = ObJitFilterOp::AND == node.op_;
+    llvm::Value *decided = builder_.getFalse();
+    llvm::Value *has_null = builder_.getFalse();
+    for (int64_t i = 0; i < node.arg_cnt_; ++i) {
+      const ObJitRowValue &child = arg(node, i);
+      llvm::Value *cmp = is_and ? builder_.CreateICmpEQ(child.val_, builder_.getInt64(0))
+                                : builder_.CreateICmpNE(child.val_, builder_.getInt64(0));
+      decided = builder_.CreateOr(decided, builder_.CreateAnd(builder_.CreateNot(child.null_), cmp));
+      has_null = builder_.CreateOr(has_null, child.null_);
+    }
+    llvm::Value *res = is_and ? builder_.CreateNot(decided) : decided;
+    value = ObJitRowValue(builder_.CreateZExt(res, builder_.getInt64Ty()),
+                          builder_.CreateAnd(builder_.CreateNot(decided), has_null));
+  }
+  return ret;
+}
+
+int ObJitFilterIRGen::gen_case(const ObJitFilterNode &node, ObJitRowValue &value)
+{
+  int ret = OB_SUCCESS;
+  const int64_t pair_cnt = node.arg_cnt_ / 2;
+  llvm::Value *val = nullptr;
+  llvm::Value *null = nullptr;
+  if (node.arg_cnt_ % 2 == 1) {
+    val = arg(node, node.arg_cnt_ - 1).val_;
+    null = arg(node, node.arg_cnt_ - 1).null_;
+  } else {
+    val = llvm::Constant::getNullValue(get_type(node.type_));
+    null = builder_.getTrue();
+  }
+  // the first matched when wins, select from the last pair
+  for (int64_t i = pair_cnt - 1; i >= 0; --i) {
+    llvm::Value *match = is_true(arg(node, 2 * i));
+    val = builder_.CreateSelect(match, arg(node, 2 * i + 1).val_, val);
+    null = builder_.CreateSelect(match, arg(node, 2 * i + 1).null_, null);
+  }
+  value = ObJitRowValue(val, null);
+  return ret;
+}
+
+int ObJitFilterIRGen::gen_node(const ObJitFilterNode &node, ObJitRowValue &value)
+{
+  int ret = OB_SUCCESS;
+  switch (node.op_) {
+    case ObJitFilterOp::LEAF:
+      ret = gen_leaf(node, value);
+      break;
+    case ObJitFilterOp::ADD:
+    case ObJitFilterOp::SUB:
+    case ObJitFilterOp::MUL:
+      ret = gen_arith(node, value);
+      break;
+    case ObJitFilterOp::EQ:
+    case ObJitFilterOp::NE:
+    case ObJitFilterOp::LT:
+    case ObJitFilterOp::LE:
+    case ObJitFilterOp::GT:
+    case ObJitFilterOp::GE:
+      ret = gen_cmp(node, value);
+      break;
+    case ObJitFilterOp::AND:
+    case ObJitFilterOp::OR:
+    case ObJitFilterOp::NOT:
+      ret = gen_logic(node, value);
+      break;
+    case ObJitFilterOp::CASE:
+      ret = gen_case(node, value);
+      break;
+    case ObJitFilterOp::INT_TO_DOUBLE:
+      value = ObJitRowValue(builder_.CreateSIToFP(arg(node, 0).val_, builder_.getDoubleTy()),
+                            arg(node, 0).null_);
+      break;
+    default:
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected op", K(ret), K(node));
+  }
+  return ret;
+}
+
+// args must be placed before the node and be typed as the op requires
+int check_nodes(const ObIArray<ObJitFilterNode> &nodes,
+                const ObIArray<int64_t> &args,
+                const ObIArray<int64_t> &roots,
+                const int64_t leaf_cnt)
+{
+  int ret = OB_SUCCESS;
+  for (int64_t i = 0; OB_SUCC(ret) && i < nodes.count(); ++i) {
+    const ObJitFilterNode &node = nodes.at(i);
+    const bool is_int = ObJitValueType::INT64 == node.type_;
+    bool valid = node.arg_cnt_ >= 0 && node.arg_start_ >= 0
+        && node.arg_start_ + node.arg_cnt_ <= args.count();
+    for (int64_t j = 0; valid && j < node.arg_cnt_; ++j) {
+      const int64_t arg_idx = args.at(node.arg_start_ + j);
+      valid = arg_idx >= 0 && arg_idx < i;
+    }
+    if (valid) {
+      #define ARG_TYPE(j) (nodes.at(args.at(node.arg_start_ + (j))).type_)
+      switch (node.op_) {
+        case ObJitFilterOp::LEAF:
+          valid = 0 == node.arg_cnt_ && node.leaf_idx_ >= 0 && node.leaf_idx_ < leaf_cnt;
+          break;
+        case ObJitFilterOp::ADD:
+        case ObJitFilterOp::SUB:
+        case ObJitFilterOp::MUL:
+          valid = 2 == node.arg_cnt_ && node.type_ == ARG_TYPE(0) && node.type_ == ARG_TYPE(1);
+          break;
+        case ObJitFilterOp::EQ:
+        case ObJitFilterOp::NE:
+        case ObJitFilterOp::LT:
+        case ObJitFilterOp::LE:
+        case ObJitFilterOp::GT:
+        case ObJitFilterOp::GE:
+          valid = is_int && 2 == node.arg_cnt_ && ARG_TYPE(0) == ARG_TYPE(1);
+          break;
+        case ObJitFilterOp::AND:
+        case ObJitFilterOp::OR:
+          valid = is_int && node.arg_cnt_ >= 2;
+          for (int64_t j = 0; valid && j < node.arg_cnt_; ++j) {
+            valid = ObJitValueType::INT64 == ARG_TYPE(j);
+          }
+          break;
+        case ObJitFilterOp::NOT:
+          valid = is_int && 1 == node.arg_cnt_ && ObJitValueType::INT64 == ARG_TYPE(0);
+          break;
+        case ObJitFilterOp::CASE:
+          valid = node.arg_cnt_ >= 2;
+          for (int64_t j = 0; valid && j < node.arg_cnt_; ++j) {
+            valid = (j % 2 == 0 && j + 1 < node.arg_cnt_) ? ObJitValueType::INT64 == ARG_TYPE(j)
+                                                          : node.type_ == ARG_TYPE(j);
+          }
+          break;
+        case ObJitFilterOp::INT_TO_DOUBLE:
+          valid = !is_int && 1 == node.arg_cnt_ && ObJitValueType::INT64 == ARG_TYPE(0);
+          break;
+        default:
+          valid = false;
+      }
+      #undef ARG_TYPE
+    }
+    if (!valid) {
+      ret = OB_INVALID_ARGUMENT;
+      LOG_WARN("invalid node", K(ret), K(i), K(node));
+    }
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < roots.count(); ++i) {
+    if (roots.at(i) < 0 || roots.at(i) >= nodes.count()
+        || ObJitValueType::INT64 != nodes.at(roots.at(i)).type_) {
+      ret = OB_INVALID_ARGUMENT;
+      LOG_WARN("invalid root", K(ret), K(i), K(roots.at(i)));
+    }
+  }
+  return ret;
+}
+
+} // namespace
+
+int ObJitFilterModule::add_kernel(const ObIArray<ObJitFilterNode> &nodes,
+                                  const ObIArray<int64_t> &args,
+                                  const ObIArray<int64_t> &roots,
+                                  const int64_t leaf_cnt,
+                                  const ObJitDatumLayout &datum_layout,
+                                  ObJitFilterKernel &kernel)
+{
+  int ret = OB_SUCCESS;
+  OB_JIT_FILTER_MALLOC_GUARD;
+  char func_name[FILTER_FUNC_NAME_LEN];
+  if (OB_UNLIKELY(is_compiled_ || -1 != kernel.func_idx_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("module is compiled or kernel is added", K(ret), K_(is_compiled), K(kernel));
+  } else if (OB_UNLIKELY(nodes.empty() || roots.empty() || leaf_cnt <= 0
+                         || datum_layout.size_ <= 0 || 0 == datum_layout.null_mask_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(nodes.count()), K(roots.count()), K(leaf_cnt),
+             K(datum_layout));
+  } else if (OB_FAIL(check_nodes(nodes, args, roots, leaf_cnt))) {
+    LOG_WARN("failed to check nodes", K(ret));
+  } else if (nullptr == helper_.get_jc() && OB_FAIL(helper_.init())) {
+    // the jit engine is set up with the first kernel
+    LOG_WARN("failed to init llvm helper", K(ret));
+  } else if (OB_ISNULL(helper_.get_jc())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("jit context is null", K(ret));
+  } else if (OB_FAIL(databuff_printf(func_name, sizeof(func_name), FILTER_FUNC_NAME_FORMAT,
+                                     kernels_.count()))) {
+    LOG_WARN("failed to print function name", K(ret));
+  } else {
+    core::JitContext &jc = *helper_.get_jc();
+    ObJitFilterIRGen ir_gen(jc, func_name, nodes, args, roots, leaf_cnt, datum_layout);
+    if (OB_FAIL(ir_gen.generate())) {
+      LOG_WARN("failed to generate filter kernel", K(ret));
+    } else if (llvm::verifyFunction(*ir_gen.get_func())) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("failed to verify filter kernel", K(ret), K(func_name));
+    } else if (OB_FAIL(kernels_.push_back(&kernel))) {
+      LOG_WARN("failed to push back kernel", K(ret));
+    } else {
+      kernel.func_idx_ = kernels_.count() - 1;
+    }
+    if (OB_FAIL(ret) && nullptr != ir_gen.get_func()) {
+      // keep the other kernels of the module
+      jc.get_builder().ClearInsertionPoint();
+      ir_gen.get_func()->eraseFromParent();
+    }
+  }
+  return ret;
+}
+
+int ObJitFilterModule::compile()
+{
+  int ret = OB_SUCCESS;
+  OB_JIT_FILTER_MALLOC_GUARD;
+  char func_name[FILTER_FUNC_NAME_LEN];
+  if (OB_UNLIKELY(is_compiled_)) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("module is compiled", K(ret));
+  } else if (kernels_.empty()) {
+    // nothing to compile
+  } else if (OB_ISNULL(helper_.get_jc())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("jit context is null", K(ret));
+  } else if (OB_FAIL(helper_.verify_module())) {
+    LOG_WARN("failed to verify module", K(ret));
+  } else if (OB_FAIL(helper_.get_jc()->optimize())) {
+    LOG_WARN("failed to optimize module", K(ret));
+  } else if (OB_FAIL(helper_.compile_module(ObPLOptLevel::O1))) {
+    // the module is optimized above, O1 keeps compile_module from optimizing and dumping it
+    LOG_WARN("failed to compile module", K(ret));
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < kernels_.count(); ++i) {
+      uint64_t addr = 0;
+      if (OB_FAIL(databuff_printf(func_name, sizeof(func_name), FILTER_FUNC_NAME_FORMAT, i))) {
+        LOG_WARN("failed to print function name", K(ret));
+      } else if (OB_FAIL(helper_.get_function_address(ObString(func_name), addr))) {
+        LOG_WARN("failed to get function address", K(ret), K(func_name));
+      } else if (OB_UNLIKELY(0 == addr)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("function address is null", K(ret), K(func_name));
+      } else {
+        kernels_.at(i)->func_ = reinterpret_cast<ObJitFilterKernel::KernelFunc>(addr);
+      }
+    }
+    if (OB_FAIL(ret)) {
+      for (int64_t i = 0; i < kernels_.count(); ++i) {
+        kernels_.at(i)->func_ = nullptr;
+      }
+    }
+  }
+  if (OB_SUCC(ret)) {
+    is_compiled_ = true;
+  }
+  // the module is not needed once compiled, and no kernel can be added after a failure
+  helper_.final();
+  return ret;
+}
+
+} // namespace jit
+} // namespace oceanbase
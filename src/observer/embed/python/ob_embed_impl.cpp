@@ -15,7 +15,9 @@
  */
 #define USING_LOG_PREFIX SERVER
 #include <pybind11/stl.h>
+#include <pybind11/numpy.h>
 #include <memory>
+#include <unordered_set>
 #include "observer/embed/python/ob_embed_impl.h"
 #include "observer/ob_server.h"
 #include "rpc/obrpc/ob_net_client.h"
@@ -56,8 +58,12 @@ PYBIND11_MODULE(PYTHON_MODEL_NAME, m) {
 
     pybind11::class_<oceanbase::embed::ObLiteEmbedCursor>(m, "Cursor")
         .def("execute", &oceanbase::embed::ObLiteEmbedCursor::execute, pybind11::call_guard<pybind11::gil_scoped_release>())
+        .def("execute", &oceanbase::embed::ObLiteEmbedCursor::execute_with_params, pybind11::arg("sql"), pybind11::arg("params"))
+        .def("executemany", &oceanbase::embed::ObLiteEmbedCursor::executemany, pybind11::arg("sql"), pybind11::arg("seq_of_params"))
         .def("fetchone", &oceanbase::embed::ObLiteEmbedCursor::fetchone)
         .def("fetchall", &oceanbase::embed::ObLiteEmbedCursor::fetchall)
+        .def("fetch_numpy", &oceanbase::embed::ObLiteEmbedCursor::fetch_numpy)
+        .def("fetch_arrow", &oceanbase::embed::ObLiteEmbedCursor::fetch_arrow)
         .def("close", &oceanbase::embed::ObLiteEmbedCursor::close);
 
     pybind11::object atexit = pybind11::module::import("atexit");
@@ -444,6 +450,79 @@ int ObLiteEmbedConn::execute(const char *sql, uint64_t &affected_rows, int64_t &
 }
 
 
+int ObLiteEmbedConn::prepare(const char *sql, ObPsStmtId &stmt_id, sql::stmt::StmtType &stmt_type,
+                             int64_t &param_cnt, std::string &errmsg)
+{
+  int ret = OB_SUCCESS;
+  ObString sql_string(sql);
+  ObCurTraceId::init(GCTX.self_addr());
+  reset_result();
+  if (OB_NOT_NULL(session_)) {
+    common::ob_setup_tsi_warning_buffer(&session_->get_warnings_buffer());
+  }
+  if (OB_ISNULL(conn_) || OB_ISNULL(session_)) {
+    ret = OB_CONNECT_ERROR;
+    LOG_WARN("conn is empty", KR(ret), KP(conn_), KP(session_));
+  } else if (OB_FAIL(conn_->prepare_statement(OB_SYS_TENANT_ID, sql_string, stmt_id, stmt_type, param_cnt))) {
+    LOG_WARN("prepare sql failed", KR(ret), K(sql));
+  } else {
+    FLOG_INFO("prepare", K(sql), K(stmt_id), K(stmt_type), K(param_cnt));
+  }
+  errmsg = handle_err_msg(ret);
+  if (OB_NOT_NULL(session_)) {
+    session_->reset_warnings_buf();
+  }
+  common::ob_setup_tsi_warning_buffer(NULL);
+  return ret;
+}
+
+int ObLiteEmbedConn::execute_prepared(const ObPsStmtId stmt_id, const sql::stmt::StmtType stmt_type,
+                                      const ParamStore &params, uint64_t &affected_rows,
+                                      int64_t &result_seq, std::string &errmsg)
+{
+  int ret = OB_SUCCESS;
+  lib::ObMemAttr mem_attr(OB_SYS_TENANT_ID, "EmbedAlloc");
+  result_seq = ATOMIC_AAF(&result_seq_, 1);
+  ObCurTraceId::init(GCTX.self_addr());
+  reset_result();
+  if (OB_NOT_NULL(session_)) {
+    common::ob_setup_tsi_warning_buffer(&session_->get_warnings_buffer());
+  }
+  if (OB_ISNULL(conn_) || OB_ISNULL(session_)) {
+    ret = OB_CONNECT_ERROR;
+    LOG_WARN("conn is empty", KR(ret), KP(conn_), KP(session_));
+  } else if (OB_ISNULL(result_ = (common::ObCommonSqlProxy::ReadResult*)ob_malloc(sizeof(common::ObCommonSqlProxy::ReadResult), mem_attr))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("alloc mem failed", KR(ret));
+  } else if (FALSE_IT(new (result_) common::ObCommonSqlProxy::ReadResult())) {
+  } else if (OB_FAIL(conn_->execute_prepared(OB_SYS_TENANT_ID, stmt_id, stmt_type, params, *result_))) {
+    LOG_WARN("execute prepared sql failed", KR(ret), K(stmt_id), K(session_->is_in_transaction()));
+  } else {
+    observer::ObInnerSQLResult& res = static_cast<observer::ObInnerSQLResult&>(*result_->get_result());
+    if (res.result_set().get_stmt_type() == sql::stmt::T_SELECT) {
+      affected_rows = UINT64_MAX;
+    } else {
+      affected_rows = res.result_set().get_affected_rows();
+    }
+  }
+  errmsg = handle_err_msg(ret);
+  if (OB_NOT_NULL(session_)) {
+    session_->reset_warnings_buf();
+  }
+  common::ob_setup_tsi_warning_buffer(NULL);
+  return ret;
+}
+
+void ObLiteEmbedConn::close_prepared(const ObPsStmtId stmt_id)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(conn_) || OB_INVALID_STMT_ID == stmt_id) {
+    // session is released together with the connection
+  } else if (OB_FAIL(conn_->close_prepared(stmt_id))) {
+    LOG_WARN("close prepared sql failed", KR(ret), K(stmt_id));
+  }
+}
+
 ObLiteEmbedCursor ObLiteEmbedConn::cursor()
 {
   std::shared_ptr<ObLiteEmbedConn> conn = shared_from_this();
@@ -474,12 +553,177 @@ uint64_t ObLiteEmbedCursor::execute(const char *sql)
   return affected_rows;
 }
 
+int ObLiteEmbedCursor::prepare_(const char *sql, std::string &errmsg)
+{
+  int ret = OB_SUCCESS;
+  if (OB_INVALID_STMT_ID != ps_stmt_id_ && ps_sql_ == sql) {
+    // reuse the statement prepared by last execution
+  } else {
+    ObPsStmtId stmt_id = OB_INVALID_STMT_ID;
+    sql::stmt::StmtType stmt_type = sql::stmt::T_NONE;
+    int64_t param_cnt = 0;
+    close_prepared_();
+    if (OB_FAIL(embed_conn_->prepare(sql, stmt_id, stmt_type, param_cnt, errmsg))) {
+      LOG_WARN("prepare sql failed", KR(ret), K(sql));
+    } else {
+      ps_sql_ = sql;
+      ps_stmt_id_ = stmt_id;
+      ps_stmt_type_ = stmt_type;
+      ps_param_cnt_ = param_cnt;
+    }
+  }
+  return ret;
+}
+
+int ObLiteEmbedCursor::bind_params_(const pybind11::handle &params, ObIAllocator &allocator,
+                                    ParamStore &param_store, std::string &errmsg)
+{
+  int ret = OB_SUCCESS;
+  param_store.reuse();
+  if (!pybind11::isinstance<pybind11::sequence>(params) || pybind11::isinstance<pybind11::str>(params)) {
+    ret = OB_INVALID_ARGUMENT;
+    errmsg = "parameters must be a sequence";
+  } else {
+    pybind11::sequence seq = pybind11::reinterpret_borrow<pybind11::sequence>(params);
+    const int64_t param_cnt = static_cast<int64_t>(pybind11::len(seq));
+    const ObCollationType cs_type = embed_conn_->get_session()->get_local_collation_connection();
+    if (param_cnt != ps_param_cnt_) {
+      ret = OB_INVALID_ARGUMENT;
+      errmsg = "parameter count mismatch, expected " + std::to_string(ps_param_cnt_)
+               + " but got " + std::to_string(param_cnt);
+    } else if (OB_FAIL(param_store.reserve(param_cnt))) {
+      LOG_WARN("reserve params failed", KR(ret), K(param_cnt));
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < param_cnt; ++i) {
+      ObObjParam param;
+      if (OB_FAIL(ObLiteEmbedUtil::convert_pyobj_to_param(seq[i], cs_type, allocator, param))) {
+        LOG_WARN("convert param failed", KR(ret), K(i));
+        errmsg = "unsupported parameter type at position " + std::to_string(i) + ": "
+                 + std::string(pybind11::str(seq[i].get_type().attr("__name__")));
+      } else if (OB_FAIL(param_store.push_back(param))) {
+        LOG_WARN("push back param failed", KR(ret), K(i));
+      }
+    }
+    if (OB_FAIL(ret) && errmsg.empty()) {
+      errmsg = std::string(ob_errpkt_strerror(ret, false));
+    }
+  }
+  return ret;
+}
+
+void ObLiteEmbedCursor::close_prepared_()
+{
+  if (OB_INVALID_STMT_ID != ps_stmt_id_) {
+    if (embed_conn_) {
+      embed_conn_->close_prepared(ps_stmt_id_);
+    }
+    ps_sql_.clear();
+    ps_stmt_id_ = OB_INVALID_STMT_ID;
+    ps_stmt_type_ = sql::stmt::T_NONE;
+    ps_param_cnt_ = 0;
+  }
+}
+
+uint64_t ObLiteEmbedCursor::execute_with_params(const char *sql, const pybind11::sequence &params)
+{
+  int ret = OB_SUCCESS;
+  uint64_t affected_rows = 0;
+  int64_t result_seq = 0;
+  std::string errmsg;
+  ObArenaAllocator allocator(ObMemAttr(OB_SYS_TENANT_ID, "EmbedParam"));
+  ParamStore param_store((ObWrapperAllocator(allocator)));
+  if (!embed_conn_) {
+    ret = OB_CONNECT_ERROR;
+  } else {
+    pybind11::gil_scoped_release release;
+    ret = prepare_(sql, errmsg);
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(bind_params_(params, allocator, param_store, errmsg))) {
+    LOG_WARN("bind params failed", KR(ret), K(sql));
+  } else {
+    pybind11::gil_scoped_release release;
+    if (OB_FAIL(embed_conn_->execute_prepared(ps_stmt_id_, ps_stmt_type_, param_store,
+                                              affected_rows, result_seq, errmsg))) {
+      LOG_WARN("execute prepared sql failed", KR(ret), K(sql));
+    } else {
+      result_seq_ = result_seq;
+    }
+  }
+  if (OB_FAIL(ret)) {
+    throw std::runtime_error("execute sql failed " + std::to_string(ob_errpkt_errno(ret, false)) + " " + errmsg);
+  }
+  if (embed_conn_->need_autocommit()) {
+    pybind11::gil_scoped_release release;
+    embed_conn_->commit();
+  }
+  return affected_rows;
+}
+
+uint64_t ObLiteEmbedCursor::executemany(const char *sql, const pybind11::iterable &seq_of_params)
+{
+  int ret = OB_SUCCESS;
+  uint64_t total_affected_rows = 0;
+  int64_t result_seq = 0;
+  std::string errmsg;
+  // param values are reused row by row, the param array lives in its own allocator
+  ObArenaAllocator allocator(ObMemAttr(OB_SYS_TENANT_ID, "EmbedParam"));
+  ObArenaAllocator param_allocator(ObMemAttr(OB_SYS_TENANT_ID, "EmbedParamArr"));
+  ParamStore param_store((ObWrapperAllocator(param_allocator)));
+  if (!embed_conn_) {
+    ret = OB_CONNECT_ERROR;
+  } else {
+    // the result of last execution is dropped even if seq_of_params is empty
+    if (result_seq_ > 0 && embed_conn_->get_result_seq() == result_seq_) {
+      embed_conn_->reset_result();
+    }
+    result_seq_ = 0;
+    pybind11::gil_scoped_release release;
+    ret = prepare_(sql, errmsg);
+  }
+  for (pybind11::handle row : seq_of_params) {
+    uint64_t affected_rows = 0;
+    param_store.reuse();
+    allocator.reuse();
+    if (OB_FAIL(ret)) {
+      break;
+    } else if (OB_FAIL(bind_params_(row, allocator, param_store, errmsg))) {
+      LOG_WARN("bind params failed", KR(ret), K(sql));
+    } else {
+      pybind11::gil_scoped_release release;
+      if (OB_FAIL(embed_conn_->execute_prepared(ps_stmt_id_, ps_stmt_type_, param_store,
+                                                affected_rows, result_seq, errmsg))) {
+        LOG_WARN("execute prepared sql failed", KR(ret), K(sql));
+      } else if (UINT64_MAX != affected_rows) {
+        total_affected_rows += affected_rows;
+      }
+    }
+  }
+  if (OB_SUCC(ret)) {
+    result_seq_ = result_seq;
+  }
+  // rows of one executemany are committed or rolled back together in autocommit mode
+  if (embed_conn_ && embed_conn_->need_autocommit()) {
+    pybind11::gil_scoped_release release;
+    if (OB_FAIL(ret)) {
+      embed_conn_->rollback();
+    } else {
+      embed_conn_->commit();
+    }
+  }
+  if (OB_FAIL(ret)) {
+    throw std::runtime_error("execute sql failed " + std::to_string(ob_errpkt_errno(ret, false)) + " " + errmsg);
+  }
+  return total_affected_rows;
+}
+
 void ObLiteEmbedCursor::reset()
 {
   if (embed_conn_ && result_seq_ > 0 &&
       embed_conn_->get_result_seq() == result_seq_) {
     embed_conn_->reset_result();
   }
+  close_prepared_();
   embed_conn_.reset();
   result_seq_ = 0;
 }
@@ -589,6 +833,137 @@ pybind11::object ObLiteEmbedCursor::fetchone()
   return pybind11::tuple(row_data);
 }
 
+int ObLiteEmbedCursor::fetch_columns_(std::vector<ObLiteEmbedColumnBuffer> &columns, int64_t &row_cnt)
+{
+  int ret = OB_SUCCESS;
+  sqlclient::ObMySQLResult* mysql_result = nullptr;
+  ObInnerSQLResult *inner_result = nullptr;
+  row_cnt = 0;
+  if (!embed_conn_) {
+    ret = OB_CONNECT_ERROR;
+  } else if (OB_ISNULL(embed_conn_->get_conn())) {
+    ret = OB_CONNECT_ERROR;
+  } else if (OB_ISNULL(embed_conn_->get_res())) {
+    ret = OB_ERR_NULL_VALUE;
+    LOG_WARN("mysql result empty", KR(ret));
+  } else if (OB_ISNULL(embed_conn_->get_res()->get_result())) {
+    ret = OB_ERR_NULL_VALUE;
+    LOG_WARN("mysql result empty", KR(ret));
+  } else if (result_seq_ == 0 || embed_conn_->get_result_seq() != result_seq_) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("result err", KR(ret), K(result_seq_), K(embed_conn_->get_result_seq()));
+  } else if (FALSE_IT(mysql_result = embed_conn_->get_res()->get_result())) {
+  } else if (FALSE_IT(inner_result = reinterpret_cast<ObInnerSQLResult*>(mysql_result))) {
+  } else if (OB_NOT_NULL(inner_result->result_set().get_cmd())) {
+    // cmd no result
+  } else {
+    const common::ColumnsFieldIArray *fields = inner_result->result_set().get_field_columns();
+    const int64_t column_count = mysql_result->get_column_count();
+    std::unordered_set<std::string> used_names;
+    columns.resize(column_count);
+    for (int64_t i = 0; OB_SUCC(ret) && i < column_count; i++) {
+      ObLiteEmbedColumnBuffer &column = columns[i];
+      if (OB_NOT_NULL(fields) && i < fields->count()) {
+        column.name_.assign(fields->at(i).cname_.ptr(), fields->at(i).cname_.length());
+        // column type comes from the result metadata, so every row and an empty result
+        // agree on the dtype
+        if (OB_FAIL(ObLiteEmbedUtil::get_column_kind(fields->at(i).type_.get_meta(), *inner_result,
+                                                     column.kind_, column.dim_))) {
+          LOG_WARN("get column kind failed", KR(ret), K(i), K(fields->at(i)));
+        }
+      } else {
+        column.name_ = "col" + std::to_string(i);
+      }
+      if (OB_SUCC(ret)) {
+        // duplicated names (e.g. t1.id, t2.id) get a ".n" suffix instead of overwriting each other
+        std::string name = column.name_;
+        for (int64_t n = 1; used_names.count(name) > 0; n++) {
+          name = column.name_ + "." + std::to_string(n);
+        }
+        used_names.insert(name);
+        column.name_ = name;
+      }
+    }
+    while (OB_SUCC(ret)) {
+      ret = mysql_result->next();
+      if (OB_ITER_END == ret) {
+        ret = OB_SUCCESS;
+        break;
+      }
+      for (int64_t i = 0; OB_SUCC(ret) && i < column_count; i++) {
+        ObLiteEmbedColumnBuffer &column = columns[i];
+        if (ObLiteEmbedColumnBuffer::COL_UNKNOWN == column.kind_) {
+          // no field metadata, column type is decided by the first row
+          ObObjMeta obj_meta;
+          if (OB_FAIL(mysql_result->get_type(i, obj_meta))) {
+            LOG_WARN("mysql result get type failed", KR(ret), K(i));
+          } else if (OB_FAIL(ObLiteEmbedUtil::get_column_kind(obj_meta, *inner_result, column.kind_, column.dim_))) {
+            LOG_WARN("get column kind failed", KR(ret), K(i), K(obj_meta));
+          }
+        }
+        if (OB_FAIL(ret)) {
+        } else if (OB_FAIL(ObLiteEmbedUtil::append_column_value(i, *mysql_result, column))) {
+          LOG_WARN("append column value failed", KR(ret), K(i), K(row_cnt));
+        }
+      }
+      row_cnt++;
+    }
+  }
+  return ret;
+}
+
+pybind11::dict ObLiteEmbedCursor::fetch_numpy()
+{
+  int ret = OB_SUCCESS;
+  pybind11::dict res;
+  std::vector<ObLiteEmbedColumnBuffer> columns;
+  int64_t row_cnt = 0;
+  if (OB_FAIL(fetch_columns_(columns, row_cnt))) {
+    LOG_WARN("fetch columns failed", KR(ret));
+    throw std::runtime_error("fetch_numpy failed " + std::to_string(ob_errpkt_errno(ret, false)) + " " + std::string(ob_errpkt_strerror(ret, false)));
+  }
+  for (int64_t i = 0; i < columns.size(); i++) {
+    res[pybind11::str(columns[i].name_)] = ObLiteEmbedUtil::column_to_numpy(columns[i], row_cnt);
+  }
+  return res;
+}
+
+pybind11::object ObLiteEmbedCursor::fetch_arrow()
+{
+  int ret = OB_SUCCESS;
+  pybind11::module pyarrow = pybind11::module::import("pyarrow");
+  pybind11::dict arrow_columns;
+  std::vector<ObLiteEmbedColumnBuffer> columns;
+  int64_t row_cnt = 0;
+  if (OB_FAIL(fetch_columns_(columns, row_cnt))) {
+    LOG_WARN("fetch columns failed", KR(ret));
+    throw std::runtime_error("fetch_arrow failed " + std::to_string(ob_errpkt_errno(ret, false)) + " " + std::string(ob_errpkt_strerror(ret, false)));
+  }
+  for (int64_t i = 0; i < columns.size(); i++) {
+    ObLiteEmbedColumnBuffer &column = columns[i];
+    pybind11::object np_arr = ObLiteEmbedUtil::column_to_numpy(column, row_cnt);
+    pybind11::object arrow_arr;
+    if (ObLiteEmbedColumnBuffer::COL_VECTOR == column.kind_) {
+      // flatten the 2-D array without copy and wrap it as fixed size list
+      pybind11::object np_data = column.null_cnt_ > 0 ? np_arr.attr("data") : np_arr;
+      pybind11::object values = pyarrow.attr("array")(np_data.attr("reshape")(-1));
+      if (column.null_cnt_ > 0) {
+        pybind11::object row_mask = np_arr.attr("mask").attr("any")(pybind11::arg("axis") = 1);
+        arrow_arr = pyarrow.attr("FixedSizeListArray").attr("from_arrays")(
+            values, column.dim_, pybind11::arg("mask") = pyarrow.attr("array")(row_mask));
+      } else {
+        arrow_arr = pyarrow.attr("FixedSizeListArray").attr("from_arrays")(values, column.dim_);
+      }
+    } else if (column.null_cnt_ > 0) {
+      arrow_arr = pyarrow.attr("array")(np_arr.attr("data"), pybind11::arg("mask") = np_arr.attr("mask"));
+    } else {
+      arrow_arr = pyarrow.attr("array")(np_arr);
+    }
+    arrow_columns[pybind11::str(column.name_)] = arrow_arr;
+  }
+  return pyarrow.attr("table")(arrow_columns);
+}
+
 void ObLiteEmbedConn::begin()
 {
   int ret = OB_SUCCESS;
@@ -1030,6 +1405,332 @@ int ObLiteEmbedUtil::convert_result_to_pyobj(const int64_t col_idx, common::sqlc
   return ret;
 }
 
+int ObLiteEmbedUtil::get_column_kind(const ObObjMeta &obj_meta, observer::ObInnerSQLResult &inner_result,
+                                     ObLiteEmbedColumnBuffer::ColumnKind &kind, int64_t &dim)
+{
+  int ret = OB_SUCCESS;
+  kind = ObLiteEmbedColumnBuffer::COL_OBJECT;
+  dim = 0;
+  switch (obj_meta.get_type()) {
+    case ObTinyIntType:
+    case ObSmallIntType:
+    case ObMediumIntType:
+    case ObInt32Type:
+    case ObIntType: {
+      kind = ObLiteEmbedColumnBuffer::COL_INT64;
+      break;
+    }
+    case ObUTinyIntType:
+    case ObUSmallIntType:
+    case ObUMediumIntType:
+    case ObUInt32Type:
+    case ObUInt64Type: {
+      kind = ObLiteEmbedColumnBuffer::COL_UINT64;
+      break;
+    }
+    case ObFloatType:
+    case ObUFloatType: {
+      kind = ObLiteEmbedColumnBuffer::COL_FLOAT;
+      break;
+    }
+    case ObDoubleType:
+    case ObUDoubleType: {
+      kind = ObLiteEmbedColumnBuffer::COL_DOUBLE;
+      break;
+    }
+    case ObCollectionSQLType: {
+      ObSubSchemaValue sub_meta;
+      const uint16_t subschema_id = obj_meta.get_subschema_id();
+      if (OB_FAIL(inner_result.result_set().get_exec_context().get_sqludt_meta_by_subschema_id(subschema_id, sub_meta))) {
+        LOG_WARN("failed to get udt meta", K(ret), K(subschema_id));
+      } else if (sub_meta.type_ == ObSubSchemaType::OB_SUBSCHEMA_COLLECTION_TYPE) {
+        ObSqlCollectionInfo *coll_meta = reinterpret_cast<ObSqlCollectionInfo *>(sub_meta.value_);
+        if (OB_NOT_NULL(coll_meta) && OB_NOT_NULL(coll_meta->collection_meta_)
+            && coll_meta->collection_meta_->is_vector_type()) {
+          ObCollectionArrayType *arr_type = static_cast<ObCollectionArrayType *>(coll_meta->collection_meta_);
+          kind = ObLiteEmbedColumnBuffer::COL_VECTOR;
+          dim = arr_type->dim_cnt_;
+        }
+      }
+      break;
+    }
+    default: {
+      // converted cell by cell as fetchall does
+      break;
+    }
+  }
+  return ret;
+}
+
+int ObLiteEmbedUtil::append_column_value(const int64_t col_idx, common::sqlclient::ObMySQLResult &result,
+                                         ObLiteEmbedColumnBuffer &column)
+{
+  int ret = OB_SUCCESS;
+  ObObj obj;
+  if (ObLiteEmbedColumnBuffer::COL_OBJECT == column.kind_) {
+    ObObjMeta obj_meta;
+    pybind11::object value;
+    if (OB_FAIL(result.get_type(col_idx, obj_meta))) {
+      LOG_WARN("mysql result get type failed", KR(ret), K(col_idx));
+    } else if (OB_FAIL(convert_result_to_pyobj(col_idx, result, obj_meta, value))) {
+      LOG_WARN("convert obobj to value failed ", KR(ret), K(obj_meta));
+    } else {
+      column.objs_.append(value);
+    }
+  } else if (OB_FAIL(result.get_obj(col_idx, obj))) {
+    LOG_WARN("get obj failed", K(ret), K(col_idx));
+  } else {
+    const int64_t elem_size = ObLiteEmbedColumnBuffer::COL_VECTOR == column.kind_ ? sizeof(float) * column.dim_
+                              : (ObLiteEmbedColumnBuffer::COL_FLOAT == column.kind_ ? sizeof(float) : sizeof(int64_t));
+    const int64_t pos = column.data_.size();
+    column.data_.resize(pos + elem_size);
+    char *dst = column.data_.data() + pos;
+    column.nulls_.push_back(obj.is_null());
+    if (obj.is_null()) {
+      column.null_cnt_++;
+      MEMSET(dst, 0, elem_size);
+    } else {
+      switch (column.kind_) {
+        case ObLiteEmbedColumnBuffer::COL_INT64: {
+          *reinterpret_cast<int64_t *>(dst) = obj.get_int();
+          break;
+        }
+        case ObLiteEmbedColumnBuffer::COL_UINT64: {
+          *reinterpret_cast<uint64_t *>(dst) = obj.get_uint64();
+          break;
+        }
+        case ObLiteEmbedColumnBuffer::COL_FLOAT: {
+          *reinterpret_cast<float *>(dst) = obj.get_float();
+          break;
+        }
+        case ObLiteEmbedColumnBuffer::COL_DOUBLE: {
+          *reinterpret_cast<double *>(dst) = obj.get_double();
+          break;
+        }
+        case ObLiteEmbedColumnBuffer::COL_VECTOR: {
+          MTL_SWITCH(OB_SYS_TENANT_ID) {
+            lib::ObMemAttr mem_attr(OB_SYS_TENANT_ID, "EmbedAlloc");
+            ObArenaAllocator allocator(mem_attr);
+            ObString raw_data = obj.get_string();
+            if (OB_FAIL(sql::ObTextStringHelper::read_real_string_data(&allocator, ObLongTextType,
+                                                                       CS_TYPE_BINARY, true, raw_data))) {
+              LOG_WARN("failed to read real string data", K(ret), K(obj));
+            } else if (OB_UNLIKELY(raw_data.length() != elem_size)) {
+              ret = OB_ERR_UNEXPECTED;
+              LOG_WARN("unexpected vector length", K(ret), K(raw_data.length()), K(column.dim_));
+            } else {
+              MEMCPY(dst, raw_data.ptr(), elem_size);
+            }
+          }
+          break;
+        }
+        default: {
+          ret = OB_ERR_UNEXPECTED;
+          LOG_WARN("unexpected column kind", K(ret), K(column.kind_));
+          break;
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+template <typename T>
+static pybind11::object make_owned_numpy_array(std::vector<char> &data, const std::vector<pybind11::ssize_t> &shape)
+{
+  // the numpy array takes the column buffer over, no copy happens here
+  std::vector<char> *holder = new std::vector<char>(std::move(data));
+  pybind11::capsule owner(holder, [](void *p) { delete reinterpret_cast<std::vector<char> *>(p); });
+  return pybind11::array_t<T>(shape, reinterpret_cast<T *>(holder->data()), owner);
+}
+
+pybind11::object ObLiteEmbedUtil::column_to_numpy(ObLiteEmbedColumnBuffer &column, const int64_t row_cnt)
+{
+  pybind11::module numpy = pybind11::module::import("numpy");
+  pybind11::object arr;
+  std::vector<pybind11::ssize_t> shape = {static_cast<pybind11::ssize_t>(row_cnt)};
+  switch (column.kind_) {
+    case ObLiteEmbedColumnBuffer::COL_INT64: {
+      arr = make_owned_numpy_array<int64_t>(column.data_, shape);
+      break;
+    }
+    case ObLiteEmbedColumnBuffer::COL_UINT64: {
+      arr = make_owned_numpy_array<uint64_t>(column.data_, shape);
+      break;
+    }
+    case ObLiteEmbedColumnBuffer::COL_FLOAT: {
+      arr = make_owned_numpy_array<float>(column.data_, shape);
+      break;
+    }
+    case ObLiteEmbedColumnBuffer::COL_DOUBLE: {
+      arr = make_owned_numpy_array<double>(column.data_, shape);
+      break;
+    }
+    case ObLiteEmbedColumnBuffer::COL_VECTOR: {
+      shape.push_back(static_cast<pybind11::ssize_t>(column.dim_));
+      arr = make_owned_numpy_array<float>(column.data_, shape);
+      break;
+    }
+    default: {
+      // COL_UNKNOWN means no field metadata and no rows
+      arr = numpy.attr("array")(column.objs_, pybind11::arg("dtype") = "object");
+      break;
+    }
+  }
+  if (column.null_cnt_ > 0) {
+    pybind11::array_t<bool> mask(static_cast<pybind11::ssize_t>(column.nulls_.size()));
+    bool *mask_ptr = mask.mutable_data();
+    for (int64_t i = 0; i < column.nulls_.size(); i++) {
+      mask_ptr[i] = column.nulls_[i];
+    }
+    pybind11::object full_mask = mask;
+    if (ObLiteEmbedColumnBuffer::COL_VECTOR == column.kind_) {
+      full_mask = numpy.attr("repeat")(mask.attr("reshape")(-1, 1), column.dim_, pybind11::arg("axis") = 1);
+    }
+    arr = numpy.attr("ma").attr("masked_array")(arr, pybind11::arg("mask") = full_mask);
+  }
+  return arr;
+}
+
+// only non-empty sequences of real numbers and numeric numpy arrays are bound as vectors,
+// other lists and tuples are rejected instead of being reinterpreted as float32 data
+static bool is_float_array_pyobj(const pybind11::handle &obj)
+{
+  bool bret = false;
+  if (pybind11::isinstance<pybind11::list>(obj) || pybind11::isinstance<pybind11::tuple>(obj)) {
+    pybind11::sequence seq = pybind11::reinterpret_borrow<pybind11::sequence>(obj);
+    bret = pybind11::len(seq) > 0;
+    for (pybind11::handle item : seq) {
+      if (!bret) {
+        break;
+      } else if (!PyNumber_Check(item.ptr()) || PyBool_Check(item.ptr())
+                 || pybind11::isinstance<pybind11::str>(item)) {
+        bret = false;
+      }
+    }
+  } else if (pybind11::hasattr(obj, "__array_interface__") && pybind11::hasattr(obj, "ndim")
+             && pybind11::hasattr(obj, "dtype") && obj.attr("ndim").cast<int64_t>() > 0) {
+    const std::string kind = pybind11::str(obj.attr("dtype").attr("kind"));
+    bret = ("f" == kind || "i" == kind || "u" == kind);
+  }
+  return bret;
+}
+
+int ObLiteEmbedUtil::convert_pyobj_to_param(const pybind11::handle &obj, const ObCollationType cs_type,
+                                            ObIAllocator &allocator, ObObjParam &param)
+{
+  int ret = OB_SUCCESS;
+  ObString str;
+  param.reset();
+  if (obj.is_none()) {
+    param.set_null();
+  } else if (pybind11::isinstance<pybind11::bool_>(obj)) {
+    param.set_tinyint(obj.cast<bool>() ? 1 : 0);
+  } else if (pybind11::isinstance<pybind11::str>(obj)) {
+    Py_ssize_t len = 0;
+    const char *ptr = PyUnicode_AsUTF8AndSize(obj.ptr(), &len);
+    if (OB_ISNULL(ptr)) {
+      PyErr_Clear();
+      ret = OB_ERR_INCORRECT_STRING_VALUE;
+      LOG_WARN("invalid unicode string", KR(ret));
+    } else if (OB_FAIL(ob_write_string(allocator, ObString(static_cast<int32_t>(len), ptr), str))) {
+      LOG_WARN("copy string failed", KR(ret), K(len));
+    } else {
+      // python strings are always utf8
+      param.set_varchar(str);
+      param.set_collation_type(CHARSET_UTF8MB4 == ObCharset::charset_type_by_coll(cs_type)
+                               ? cs_type : CS_TYPE_UTF8MB4_GENERAL_CI);
+    }
+  } else if (pybind11::isinstance<pybind11::bytes>(obj) || PyByteArray_Check(obj.ptr())) {
+    const char *ptr = nullptr;
+    int64_t len = 0;
+    if (PyByteArray_Check(obj.ptr())) {
+      ptr = PyByteArray_AsString(obj.ptr());
+      len = PyByteArray_Size(obj.ptr());
+    } else {
+      ptr = PyBytes_AsString(obj.ptr());
+      len = PyBytes_Size(obj.ptr());
+    }
+    if (OB_FAIL(ob_write_string(allocator, ObString(static_cast<int32_t>(len), ptr), str))) {
+      LOG_WARN("copy bytes failed", KR(ret), K(len));
+    } else {
+      param.set_varchar(str);
+      param.set_collation_type(CS_TYPE_BINARY);
+    }
+  } else if (is_float_array_pyobj(obj)) {
+    // bound as raw float32 data with binary collation, cast to VECTOR column directly
+    try {
+      pybind11::array_t<float, pybind11::array::c_style | pybind11::array::forcecast> arr =
+          pybind11::array_t<float, pybind11::array::c_style | pybind11::array::forcecast>::ensure(obj);
+      if (!arr || arr.ndim() != 1) {
+        PyErr_Clear();
+        ret = OB_NOT_SUPPORTED;
+        LOG_WARN("only one dimensional float array is supported", KR(ret));
+      } else if (OB_FAIL(ob_write_string(allocator,
+                                         ObString(static_cast<int32_t>(arr.nbytes()),
+                                                  reinterpret_cast<const char *>(arr.data())),
+                                         str))) {
+        LOG_WARN("copy float array failed", KR(ret), "size", arr.nbytes());
+      } else {
+        param.set_varchar(str);
+        param.set_collation_type(CS_TYPE_BINARY);
+      }
+    } catch (pybind11::error_already_set &e) {
+      ret = OB_NOT_SUPPORTED;
+      LOG_WARN("convert float array failed", KR(ret), "err", e.what());
+    }
+  } else if (PyIndex_Check(obj.ptr())) {
+    // python int and numpy integers, values beyond int64 are bound as uint64
+    int overflow = 0;
+    pybind11::object index = pybind11::reinterpret_steal<pybind11::object>(PyNumber_Index(obj.ptr()));
+    long long value = index ? PyLong_AsLongLongAndOverflow(index.ptr(), &overflow) : -1;
+    if (!index || (-1 == value && PyErr_Occurred())) {
+      PyErr_Clear();
+      ret = OB_INVALID_ARGUMENT;
+      LOG_WARN("convert integer failed", KR(ret));
+    } else if (0 == overflow) {
+      param.set_int(value);
+    } else {
+      unsigned long long uvalue = PyLong_AsUnsignedLongLong(index.ptr());
+      if (PyErr_Occurred()) {
+        PyErr_Clear();
+        ret = OB_NUMERIC_OVERFLOW;
+        LOG_WARN("integer out of range", KR(ret));
+      } else {
+        param.set_uint64(uvalue);
+      }
+    }
+  } else if (PyFloat_Check(obj.ptr()) || pybind11::hasattr(obj, "__float__")) {
+    double value = PyFloat_AsDouble(obj.ptr());
+    if (-1.0 == value && PyErr_Occurred()) {
+      PyErr_Clear();
+      ret = OB_INVALID_ARGUMENT;
+      LOG_WARN("convert float failed", KR(ret));
+    } else {
+      param.set_double(value);
+    }
+  } else if (pybind11::isinstance(obj, decimal_class) || pybind11::isinstance(obj, date_class)
+             || pybind11::isinstance(obj, timedelta_class)) {
+    // decimal, date, datetime and timedelta are bound by their string forms and cast by the column type
+    std::string value = pybind11::str(obj);
+    if (OB_FAIL(ob_write_string(allocator, ObString(static_cast<int32_t>(value.length()), value.data()), str))) {
+      LOG_WARN("copy string failed", KR(ret));
+    } else {
+      param.set_varchar(str);
+      param.set_collation_type(CHARSET_UTF8MB4 == ObCharset::charset_type_by_coll(cs_type)
+                               ? cs_type : CS_TYPE_UTF8MB4_GENERAL_CI);
+    }
+  } else {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("unsupported parameter type", KR(ret));
+  }
+  if (OB_SUCC(ret)) {
+    param.set_param_meta();
+    param.set_collation_level(CS_LEVEL_COERCIBLE);
+  }
+  return ret;
+}
+
 int ObLiteEmbedUtil::convert_string_charset(sql::ObSQLSessionInfo &session,
                                              ObIAllocator &allocator,
                                              const ObString &in_str,
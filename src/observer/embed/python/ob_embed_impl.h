@@ -37,6 +37,11 @@ public:
   void rollback();
   ObLiteEmbedCursor cursor();
   int execute(const char* sql, uint64_t &affected_rows, int64_t &result_seq, std::string &errmsg);
+  int prepare(const char* sql, common::ObPsStmtId &stmt_id, sql::stmt::StmtType &stmt_type, int64_t &param_cnt,
+              std::string &errmsg);
+  int execute_prepared(const common::ObPsStmtId stmt_id, const sql::stmt::StmtType stmt_type, const common::ParamStore &params,
+                       uint64_t &affected_rows, int64_t &result_seq, std::string &errmsg);
+  void close_prepared(const common::ObPsStmtId stmt_id);
   void reset();
   void reset_result();
   int64_t get_result_seq() { return result_seq_; }
@@ -51,20 +56,66 @@ private:
   sql::ObSQLSessionInfo* session_;
 };
 
+// Column buffer used by the columnar fetch interfaces, numeric and vector cells are written
+// into one contiguous buffer per column, other types fall back to python objects.
+struct ObLiteEmbedColumnBuffer
+{
+  enum ColumnKind
+  {
+    COL_UNKNOWN = 0,
+    COL_INT64,
+    COL_UINT64,
+    COL_FLOAT,
+    COL_DOUBLE,
+    COL_VECTOR,
+    COL_OBJECT
+  };
+  ObLiteEmbedColumnBuffer() : kind_(COL_UNKNOWN), dim_(0), null_cnt_(0), data_(), nulls_(), objs_() {}
+  ColumnKind kind_;
+  int64_t dim_;   // dimension of vector column
+  int64_t null_cnt_;
+  std::string name_;
+  std::vector<char> data_;
+  std::vector<bool> nulls_;
+  pybind11::list objs_;
+};
+
 class ObLiteEmbedCursor
 {
 public:
-  ObLiteEmbedCursor() : embed_conn_(), result_seq_(0) {}
+  ObLiteEmbedCursor()
+    : embed_conn_(), result_seq_(0), ps_sql_(), ps_stmt_id_(common::OB_INVALID_STMT_ID),
+      ps_stmt_type_(sql::stmt::T_NONE), ps_param_cnt_(0) {}
   ~ObLiteEmbedCursor() { reset(); }
   uint64_t execute(const char* sql);
+  // execute sql with '?' placeholders through the ps cache, the statement is prepared once
+  // and reused while the cursor executes the same sql
+  uint64_t execute_with_params(const char* sql, const pybind11::sequence &params);
+  // bind and execute every row of seq_of_params with one prepared statement, returns the total
+  // affected rows. in autocommit mode all rows are committed together.
+  uint64_t executemany(const char* sql, const pybind11::iterable &seq_of_params);
   pybind11::object fetchone();
   std::vector<pybind11::tuple> fetchall();
+  // fetch all remaining rows as {column name: numpy array}, VECTOR columns are 2-D float32 arrays
+  pybind11::dict fetch_numpy();
+  // fetch all remaining rows as a pyarrow.Table, VECTOR columns are FixedSizeList<float32>
+  pybind11::object fetch_arrow();
   void reset();
   void close() { reset(); }
   friend ObLiteEmbedCursor ObLiteEmbedConn::cursor();
+private:
+  int fetch_columns_(std::vector<ObLiteEmbedColumnBuffer> &columns, int64_t &row_cnt);
+  int prepare_(const char* sql, std::string &errmsg);
+  int bind_params_(const pybind11::handle &params, common::ObIAllocator &allocator, common::ParamStore &param_store,
+                   std::string &errmsg);
+  void close_prepared_();
 private:
   std::shared_ptr<ObLiteEmbedConn> embed_conn_;
   int64_t result_seq_;
+  std::string ps_sql_;
+  common::ObPsStmtId ps_stmt_id_;
+  sql::stmt::StmtType ps_stmt_type_;
+  int64_t ps_param_cnt_;
 };
 
 class ObLiteEmbed
@@ -85,6 +136,15 @@ class ObLiteEmbedUtil
 {
 public:
   static int convert_result_to_pyobj(const int64_t col_idx, common::sqlclient::ObMySQLResult &result,ObObjMeta &type, pybind11::object &val);
+  static int get_column_kind(const ObObjMeta &obj_meta, observer::ObInnerSQLResult &inner_result,
+                             ObLiteEmbedColumnBuffer::ColumnKind &kind, int64_t &dim);
+  static int append_column_value(const int64_t col_idx, common::sqlclient::ObMySQLResult &result,
+                                 ObLiteEmbedColumnBuffer &column);
+  static pybind11::object column_to_numpy(ObLiteEmbedColumnBuffer &column, const int64_t row_cnt);
+  // float arrays (numpy arrays, lists and tuples of numbers) are bound as binary float32 data,
+  // which is cast to VECTOR without formatting and parsing a text literal
+  static int convert_pyobj_to_param(const pybind11::handle &obj, const common::ObCollationType cs_type,
+                                    common::ObIAllocator &allocator, common::ObObjParam &param);
   static int convert_collection_to_string(ObObj &obj, ObObjMeta &obj_meta, observer::ObInnerSQLResult &inner_result,
       ObIAllocator &allocator, ObString &res_str);
   // Convert string charset using session's character_set_results
@@ -76,6 +76,107 @@ private:
   ObString sql_;
 };
 
+class ObInnerSQLConnection::ObPsPrepareExecutor : public sqlclient::ObIExecutor
+{
+public:
+  explicit ObPsPrepareExecutor(const ObString &sql)
+    : sql_(sql), stmt_id_(OB_INVALID_STMT_ID), stmt_type_(stmt::T_NONE), param_cnt_(0) {}
+
+  virtual ~ObPsPrepareExecutor() {}
+
+  virtual int execute(sql::ObSql &engine, sql::ObSqlCtx &ctx, sql::ObResultSet &res)
+  {
+    int ret = OB_SUCCESS;
+    ObString dup_sql;
+    SQL_INFO_GUARD(sql_, ObString(OB_MAX_SQL_ID_LENGTH, ctx.sql_id_));
+    ctx.is_prepare_protocol_ = true;
+    ctx.is_prepare_stage_ = true;
+    if (OB_FAIL(ob_write_string(res.get_mem_pool(), sql_, dup_sql, true /*c_style*/))) {
+      LOG_WARN("deep copy sql failed", K(ret));
+    } else {
+      res.get_session().store_query_string(dup_sql);
+      ret = engine.stmt_prepare(dup_sql, ctx, res, false /*is_inner_sql*/);
+    }
+    return ret;
+  }
+
+  virtual int process_result(sql::ObResultSet &res) override
+  {
+    int ret = OB_SUCCESS;
+    stmt_id_ = res.get_statement_id();
+    stmt_type_ = res.get_stmt_type();
+    param_cnt_ = OB_ISNULL(res.get_param_fields()) ? 0 : res.get_param_fields()->count();
+    if (OB_INVALID_STMT_ID == stmt_id_) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("invalid statement id after prepare", K(ret), K_(sql));
+    }
+    return ret;
+  }
+
+  ObPsStmtId get_stmt_id() const { return stmt_id_; }
+  stmt::StmtType get_stmt_type() const { return stmt_type_; }
+  int64_t get_param_cnt() const { return param_cnt_; }
+
+  INHERIT_TO_STRING_KV("ObIExecutor", ObIExecutor, K_(sql), K_(stmt_id), K_(stmt_type), K_(param_cnt));
+
+private:
+  ObString sql_;
+  ObPsStmtId stmt_id_;
+  stmt::StmtType stmt_type_;
+  int64_t param_cnt_;
+};
+
+class ObInnerSQLConnection::ObPsExecuteExecutor : public sqlclient::ObIExecutor
+{
+public:
+  ObPsExecuteExecutor(const ObPsStmtId stmt_id,
+                      const stmt::StmtType stmt_type,
+                      const ParamStore &params)
+    : stmt_id_(stmt_id), stmt_type_(stmt_type), params_(params) {}
+
+  virtual ~ObPsExecuteExecutor() {}
+
+  virtual int execute(sql::ObSql &engine, sql::ObSqlCtx &ctx, sql::ObResultSet &res)
+  {
+    int ret = OB_SUCCESS;
+    // Deep copy params, because they may be destroyed before result iteration.
+    ObIAllocator &alloc = res.get_mem_pool();
+    ParamStore *dup_params = NULL;
+    void *mem = NULL;
+    ctx.is_prepare_protocol_ = true;
+    ctx.is_prepare_stage_ = false;
+    if (OB_ISNULL(mem = alloc.alloc(sizeof(ParamStore)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("allocate memory failed", K(ret));
+    } else if (FALSE_IT(dup_params = new (mem) ParamStore(ObWrapperAllocator(alloc)))) {
+    } else if (OB_FAIL(dup_params->reserve(params_.count()))) {
+      LOG_WARN("reserve params failed", K(ret), "count", params_.count());
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < params_.count(); ++i) {
+      ObObjParam param = params_.at(i);
+      if (OB_FAIL(deep_copy_obj(alloc, params_.at(i), param))) {
+        LOG_WARN("deep copy param failed", K(ret), K(i));
+      } else if (OB_FAIL(dup_params->push_back(param))) {
+        LOG_WARN("push back param failed", K(ret), K(i));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      res.set_ps_protocol();
+      ret = engine.stmt_execute(stmt_id_, stmt_type_, *dup_params, ctx, res, false /*is_inner_sql*/);
+    }
+    return ret;
+  }
+
+  virtual int process_result(sql::ObResultSet &) override { return OB_SUCCESS; }
+
+  INHERIT_TO_STRING_KV("ObIExecutor", ObIExecutor, K_(stmt_id), K_(stmt_type), "param_cnt", params_.count());
+
+private:
+  ObPsStmtId stmt_id_;
+  stmt::StmtType stmt_type_;
+  const ParamStore &params_;
+};
+
 ObInnerSQLConnection::TimeoutGuard::TimeoutGuard(ObInnerSQLConnection &conn)
   : conn_(conn)
 {
@@ -1971,6 +2072,83 @@ int ObInnerSQLConnection::execute(
   return ret;
 }
 
+int ObInnerSQLConnection::prepare_statement(const uint64_t tenant_id,
+                                            const ObString &sql,
+                                            ObPsStmtId &stmt_id,
+                                            stmt::StmtType &stmt_type,
+                                            int64_t &param_cnt)
+{
+  int ret = OB_SUCCESS;
+  ObPsPrepareExecutor executor(sql);
+  if (!inited_) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("connection not inited", K(ret));
+  } else if (sql.empty() || OB_INVALID_ID == tenant_id) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(sql), K(tenant_id));
+  } else if (!is_local_execute(GCONF.cluster_id, tenant_id)) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("prepare statement on remote tenant is not supported", K(ret), K(tenant_id));
+  } else if (OB_FAIL(execute(tenant_id, executor))) {
+    LOG_WARN("prepare statement failed", K(ret), K(tenant_id), K(sql));
+  } else {
+    stmt_id = executor.get_stmt_id();
+    stmt_type = executor.get_stmt_type();
+    param_cnt = executor.get_param_cnt();
+  }
+  return ret;
+}
+
+int ObInnerSQLConnection::execute_prepared(const uint64_t tenant_id,
+                                           const ObPsStmtId stmt_id,
+                                           const stmt::StmtType stmt_type,
+                                           const ParamStore &params,
+                                           ObISQLClient::ReadResult &res)
+{
+  int ret = OB_SUCCESS;
+  FLTSpanGuard(inner_execute_read);
+  ObInnerSQLReadContext *read_ctx = NULL;
+  ObPsExecuteExecutor executor(stmt_id, stmt_type, params);
+  if (!inited_) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("connection not inited", K(ret));
+  } else if (OB_INVALID_STMT_ID == stmt_id || OB_INVALID_ID == tenant_id) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(stmt_id), K(tenant_id));
+  } else if (!is_local_execute(GCONF.cluster_id, tenant_id)) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("execute prepared statement on remote tenant is not supported", K(ret), K(tenant_id));
+  } else if (FALSE_IT(res.reuse())) {
+  } else if (OB_FAIL(switch_tenant(tenant_id))) {
+    LOG_WARN("switch tenant_id failed", K(ret), K(tenant_id));
+  } else if (OB_FAIL(res.create_handler(read_ctx, *this))) {
+    LOG_WARN("create result handler failed", K(ret));
+  } else if (OB_FAIL(read_ctx->get_result().init(true /*local_execute*/))) {
+    LOG_WARN("init result set", K(ret));
+  } else if (FALSE_IT(read_ctx->get_result().result_set().set_user_sql(true))) {
+  } else if (OB_FAIL(query(executor, read_ctx->get_result(), &read_ctx->get_vt_iter_factory()))) {
+    LOG_WARN("execute prepared statement failed", K(ret), K(tenant_id), K(executor));
+  } else {
+    ref_ctx_ = read_ctx;
+  }
+  return ret;
+}
+
+int ObInnerSQLConnection::close_prepared(const ObPsStmtId stmt_id)
+{
+  int ret = OB_SUCCESS;
+  if (!inited_) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("connection not inited", K(ret));
+  } else if (OB_INVALID_STMT_ID == stmt_id) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(stmt_id));
+  } else if (OB_FAIL(get_session().close_ps_stmt(stmt_id))) {
+    LOG_WARN("close ps stmt failed", K(ret), K(stmt_id));
+  }
+  return ret;
+}
+
 int ObInnerSQLConnection::switch_tenant(const uint64_t tenant_id)
 {
   int ret = OB_SUCCESS;
@@ -138,6 +138,8 @@ public:
 
 public:
   class ObSqlQueryExecutor;
+  class ObPsPrepareExecutor;
+  class ObPsExecuteExecutor;
 
   ObInnerSQLConnection();
   virtual ~ObInnerSQLConnection();
@@ -258,6 +260,19 @@ public:
 
   virtual int execute(const uint64_t tenant_id, sqlclient::ObIExecutor &executor) override;
 
+  // prepare/execute through the ps cache of the session, only local execution is supported.
+  int prepare_statement(const uint64_t tenant_id,
+                        const ObString &sql,
+                        common::ObPsStmtId &stmt_id,
+                        sql::stmt::StmtType &stmt_type,
+                        int64_t &param_cnt);
+  int execute_prepared(const uint64_t tenant_id,
+                       const common::ObPsStmtId stmt_id,
+                       const sql::stmt::StmtType stmt_type,
+                       const common::ParamStore &params,
+                       common::ObISQLClient::ReadResult &res);
+  int close_prepared(const common::ObPsStmtId stmt_id);
+
   int forward_request(const uint64_t tenant_id,
                       const int64_t op_type,
                       const ObString &sql,
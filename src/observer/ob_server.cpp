@@ -74,6 +74,7 @@
 #include "storage/backup/ob_backup_meta_cache.h"
 #include "lib/stat/ob_diagnostic_info_container.h"
 #include "storage/fts/dict/ob_ft_cache.h"
+#include "share/ai_service/ob_ai_func_result_cache.h"
 #include "common/ob_target_specific.h"
 #include "storage/fts/dict/ob_gen_dic_loader.h"
 #include "plugin/sys/ob_plugin_mgr.h"
@@ -493,6 +494,8 @@ int ObServer::init(const ObServerOptions &opts, const ObPLogWriterCfg &log_cfg)
       LOG_ERROR("init backup meta cache failed", KR(ret));
     } else if (OB_FAIL(ObDictCache::get_instance().init("dict_cache"))) {
       LOG_ERROR("init dict cache failed", KR(ret));
+    } else if (OB_FAIL(ObAIFuncResultCache::get_instance().init("ai_func_result_cache"))) {
+      LOG_ERROR("init ai func result cache failed", KR(ret));
     } else if (OB_FAIL(ObActiveSessHistList::get_instance().init())) {
       LOG_ERROR("init ASH failed", KR(ret));
 #ifndef OB_BUILD_LITE
@@ -798,6 +801,10 @@ void ObServer::destroy()
     ObDictCache::get_instance().destroy();
     FLOG_INFO("dict cache destroyed");
 
+    FLOG_INFO("begin to destroy ai func result cache");
+    ObAIFuncResultCache::get_instance().destroy();
+    FLOG_INFO("ai func result cache destroyed");
+
     FLOG_INFO("begin to destroy log block mgr");
     log_block_mgr_.destroy();
     FLOG_INFO("log block mgr destroy");
@@ -104,6 +104,7 @@
 #include "sql/ob_sql_ccl_rule_manager.h"
 #include "sql/dtl/ob_dtl_interm_result_manager.h"
 #include "observer/omt/ob_tenant_ai_service.h"
+#include "share/vector_index/ob_vector_index_snapshot_image.h"
 
 using namespace oceanbase;
 using namespace oceanbase::lib;
@@ -1599,6 +1600,10 @@ void ObMultiTenant::remove_tenant()
       LOG_WARN("failed to delete_tenant_usage_stat", K(ret), K(tenant_id));
     }
   }
+  if (OB_SUCC(ret)) {
+    // local vector index snapshot images are only a load cache, failing to remove them is not fatal
+    ObVecIdxSnapImageUtil::remove_tenant_images(tenant_id);
+  }
 
   if (OB_SUCC(ret)) {
     // only report event when ret = success
@@ -237,6 +237,8 @@ int ObInfoSchemaKvCacheTable::set_diagnose_info(ObKVCacheInst *inst, ObDiagnoseT
     inst->status_.total_miss_cnt_ = GLOBAL_EVENT_GET(ObStatEventIds::BACKUP_INDEX_CACHE_MISS);
   } else if (0 == strcmp(inst->status_.config_->cache_name_,"BACKUP_META_CACHE")) {
     inst->status_.total_miss_cnt_ = GLOBAL_EVENT_GET(ObStatEventIds::BACKUP_META_CACHE_MISS);
+  } else if (0 == strcmp(inst->status_.config_->cache_name_,"ai_func_result_cache")) {
+    inst->status_.total_miss_cnt_ = GLOBAL_EVENT_GET(ObStatEventIds::AI_FUNC_RESULT_CACHE_MISS);
   }
 
   return ret;
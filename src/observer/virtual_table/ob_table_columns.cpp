@@ -573,7 +573,7 @@ int ObTableColumns::fill_row_cells(const ObTableSchema &table_schema,
         } else {/*do nothing*/}
 
         if (OB_SUCC(ret) && column_schema.get_skip_index_attr().has_skip_index()) {
-          const int64_t max_skip_index_print_size = sizeof(" SKIP_INDEX(MIN_MAX, SUM)");
+          const int64_t max_skip_index_print_size = sizeof(" SKIP_INDEX(MIN_MAX, SUM, NGRAM_BLOOM_FILTER, HLL, VECTOR_BOUND, BLOOM_FILTER)");
           const int64_t extra_print_buf_size = extra_val.length() + max_skip_index_print_size;
           char *buf = nullptr;
           int64_t pos = 0;
@@ -614,6 +614,46 @@ int ObTableColumns::fill_row_cells(const ObTableSchema &table_schema,
               }
             }
 
+            if (OB_SUCC(ret) && column_schema.get_skip_index_attr().has_ngram_bloom_filter()) {
+              if (first_skip_idx_attr_printed && OB_FAIL(databuff_printf(buf, extra_print_buf_size, pos, ", "))) {
+                LOG_WARN("fail to print buf", K(ret));
+              } else if (OB_FAIL(databuff_printf(buf, extra_print_buf_size, pos, "NGRAM_BLOOM_FILTER"))) {
+                LOG_WARN("failed to print buf", K(ret));
+              } else {
+                first_skip_idx_attr_printed = true;
+              }
+            }
+
+            if (OB_SUCC(ret) && column_schema.get_skip_index_attr().has_hll()) {
+              if (first_skip_idx_attr_printed && OB_FAIL(databuff_printf(buf, extra_print_buf_size, pos, ", "))) {
+                LOG_WARN("fail to print buf", K(ret));
+              } else if (OB_FAIL(databuff_printf(buf, extra_print_buf_size, pos, "HLL"))) {
+                LOG_WARN("failed to print buf", K(ret));
+              } else {
+                first_skip_idx_attr_printed = true;
+              }
+            }
+
+            if (OB_SUCC(ret) && column_schema.get_skip_index_attr().has_vector_bound()) {
+              if (first_skip_idx_attr_printed && OB_FAIL(databuff_printf(buf, extra_print_buf_size, pos, ", "))) {
+                LOG_WARN("fail to print buf", K(ret));
+              } else if (OB_FAIL(databuff_printf(buf, extra_print_buf_size, pos, "VECTOR_BOUND"))) {
+                LOG_WARN("failed to print buf", K(ret));
+              } else {
+                first_skip_idx_attr_printed = true;
+              }
+            }
+
+            if (OB_SUCC(ret) && column_schema.get_skip_index_attr().has_bloom_filter()) {
+              if (first_skip_idx_attr_printed && OB_FAIL(databuff_printf(buf, extra_print_buf_size, pos, ", "))) {
+                LOG_WARN("fail to print buf", K(ret));
+              } else if (OB_FAIL(databuff_printf(buf, extra_print_buf_size, pos, "BLOOM_FILTER"))) {
+                LOG_WARN("failed to print buf", K(ret));
+              } else {
+                first_skip_idx_attr_printed = true;
+              }
+            }
+
             if (OB_SUCC(ret)) {
               if (OB_FAIL(databuff_printf(buf, extra_print_buf_size, pos, ")"))) {
                 LOG_WARN("failed to print buf", K(ret));
@@ -127,6 +127,16 @@ public:
   int64_t max_ngram_size_;
 };
 
+struct ObFTToken final
+{
+  ObFTToken() : word_(nullptr), word_len_(0), char_cnt_(0), word_freq_(0) {}
+  TO_STRING_KV(KP_(word), K_(word_len), K_(char_cnt), K_(word_freq));
+  const char *word_;
+  int64_t word_len_;
+  int64_t char_cnt_;
+  int64_t word_freq_;
+};
+
 class ObITokenIterator
 {
 public:
@@ -137,6 +147,31 @@ public:
       int64_t &word_len,
       int64_t &char_cnt,
       int64_t &word_freq) = 0;
+  /**
+   * get at most capacity tokens in one call, OB_ITER_END is returned only if there is no token left.
+   * The default one calls get_next_token for each token, a parser may override it to emit a batch
+   * without a virtual call per token.
+   */
+  virtual int get_next_tokens(ObFTToken *tokens, const int64_t capacity, int64_t &count)
+  {
+    int ret = common::OB_SUCCESS;
+    count = 0;
+    if (OB_ISNULL(tokens) || OB_UNLIKELY(capacity <= 0)) {
+      ret = common::OB_INVALID_ARGUMENT;
+    } else {
+      while (OB_SUCC(ret) && count < capacity) {
+        ObFTToken &token = tokens[count];
+        if (OB_FAIL(get_next_token(token.word_, token.word_len_, token.char_cnt_, token.word_freq_))) {
+        } else {
+          ++count;
+        }
+      }
+      if (OB_ITER_END == ret && count > 0) {
+        ret = common::OB_SUCCESS;
+      }
+    }
+    return ret;
+  }
   DECLARE_PURE_VIRTUAL_TO_STRING;
 };
 
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define USING_LOG_PREFIX SHARE
+
+#include "share/ai_service/ob_ai_func_result_cache.h"
+#include "share/config/ob_server_config.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace share
+{
+
+void ObAIFuncResultCacheKey::append_param(const ObString &param)
+{
+  const int64_t param_length = param.length();
+  param_hash_ = murmurhash(&param_length, sizeof(param_length), param_hash_);
+  param_hash_ = murmurhash(param.ptr(), param.length(), param_hash_);
+}
+
+void ObAIFuncResultCacheKey::append_input(const ObString &input)
+{
+  const int64_t input_length = input.length();
+  input_hash_ = murmurhash(&input_length, sizeof(input_length), input_hash_);
+  input_check_hash_ = murmurhash(&input_length, sizeof(input_length), input_check_hash_);
+  input_hash_ = murmurhash(input.ptr(), input.length(), input_hash_);
+  input_check_hash_ = murmurhash(input.ptr(), input.length(), input_check_hash_);
+  input_length_ += input.length();
+}
+
+bool ObAIFuncResultCacheKey::operator==(const ObIKVCacheKey &other) const
+{
+  const ObAIFuncResultCacheKey &other_key = reinterpret_cast<const ObAIFuncResultCacheKey &>(other);
+  return tenant_id_ == other_key.tenant_id_
+         && func_type_ == other_key.func_type_
+         && param_hash_ == other_key.param_hash_
+         && input_hash_ == other_key.input_hash_
+         && input_check_hash_ == other_key.input_check_hash_
+         && input_length_ == other_key.input_length_;
+}
+
+uint64_t ObAIFuncResultCacheKey::hash() const
+{
+  uint64_t hash_val = 0;
+  hash_val = murmurhash(&tenant_id_, sizeof(tenant_id_), hash_val);
+  hash_val = murmurhash(&func_type_, sizeof(func_type_), hash_val);
+  hash_val = murmurhash(&param_hash_, sizeof(param_hash_), hash_val);
+  hash_val = murmurhash(&input_hash_, sizeof(input_hash_), hash_val);
+  return hash_val;
+}
+
+int ObAIFuncResultCacheKey::deep_copy(char *buf, const int64_t buf_len, ObIKVCacheKey *&key) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(buf) || OB_UNLIKELY(buf_len < size())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(buf), K(buf_len), K(size()));
+  } else {
+    key = new (buf) ObAIFuncResultCacheKey(*this);
+  }
+  return ret;
+}
+
+int ObAIFuncResultCacheValue::deep_copy(char *buf, const int64_t buf_len, ObIKVCacheValue *&value) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(buf) || OB_UNLIKELY(buf_len < size())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(buf), K(buf_len), K(size()));
+  } else {
+    char *result_buf = buf + sizeof(*this);
+    MEMCPY(result_buf, result_.ptr(), result_.length());
+    value = new (buf) ObAIFuncResultCacheValue(ObString(result_.length(), result_buf));
+  }
+  return ret;
+}
+
+bool ObAIFuncResultCache::is_enabled()
+{
+  return GCONF._enable_ai_func_result_cache;
+}
+
+int ObAIFuncResultCache::get_result(const ObAIFuncResultCacheKey &key,
+                                    ObIAllocator &allocator,
+                                    ObString &result)
+{
+  int ret = OB_SUCCESS;
+  const ObAIFuncResultCacheValue *value = nullptr;
+  ObKVCacheHandle handle;
+  if (OB_UNLIKELY(!key.is_valid())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(key));
+  } else if (OB_FAIL(get(key, value, handle))) {
+    if (OB_ENTRY_NOT_EXIST == ret) {
+      EVENT_INC(ObStatEventIds::AI_FUNC_RESULT_CACHE_MISS);
+    } else {
+      LOG_WARN("fail to get ai func result from cache", K(ret), K(key));
+    }
+  } else if (OB_ISNULL(value)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("cache value is null", K(ret), K(key));
+  } else if (OB_FAIL(ob_write_string(allocator, value->get_result(), result))) {
+    LOG_WARN("fail to copy cached result", K(ret), K(key));
+  } else {
+    EVENT_INC(ObStatEventIds::AI_FUNC_RESULT_CACHE_HIT);
+  }
+  return ret;
+}
+
+int ObAIFuncResultCache::put_result(const ObAIFuncResultCacheKey &key, const ObString &result)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!key.is_valid() || result.empty())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(key), K(result.length()));
+  } else if (result.length() > MAX_RESULT_LENGTH) {
+    LOG_DEBUG("ai func result is too large to cache", K(key), K(result.length()));
+  } else if (OB_FAIL(put(key, ObAIFuncResultCacheValue(result), true /*overwrite*/))) {
+    LOG_WARN("fail to put ai func result into cache", K(ret), K(key));
+  }
+  return ret;
+}
+
+} // namespace share
+} // namespace oceanbase
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OCEANBASE_SHARE_AI_SERVICE_OB_AI_FUNC_RESULT_CACHE_H_
+#define OCEANBASE_SHARE_AI_SERVICE_OB_AI_FUNC_RESULT_CACHE_H_
+
+#include "lib/hash_func/murmur_hash.h"
+#include "lib/string/ob_string.h"
+#include "share/cache/ob_kv_storecache.h"
+#include "share/cache/ob_kvcache_struct.h"
+#include "share/ai_service/ob_ai_service_struct.h"
+
+namespace oceanbase
+{
+namespace share
+{
+// Results of AI_EMBED / AI_RERANK calls, so that repeated queries over the same documents do not
+// call the remote model again. AI_COMPLETE is not cached: its output is sampled and callers expect
+// a fresh answer on every call. The key only keeps hashes: the model params
+// (ai model, request model name, endpoint url and request config) and the inputs (the text, or the
+// query and each document of a rerank) are each hashed with their lengths prefixed, the inputs
+// with two independent seeds together with their total length, so the key has a fixed size
+// whatever the length of the input. The hit and miss counts of the cache are shown in
+// GV$OB_KVCACHE as "ai_func_result_cache".
+class ObAIFuncResultCacheKey : public common::ObIKVCacheKey
+{
+public:
+  ObAIFuncResultCacheKey()
+      : tenant_id_(common::OB_INVALID_TENANT_ID), func_type_(-1), param_hash_(0),
+        input_hash_(0), input_check_hash_(INPUT_CHECK_SEED), input_length_(0)
+  {}
+  ObAIFuncResultCacheKey(const uint64_t tenant_id, const int64_t func_type)
+      : tenant_id_(tenant_id), func_type_(func_type), param_hash_(0),
+        input_hash_(0), input_check_hash_(INPUT_CHECK_SEED), input_length_(0)
+  {}
+  ~ObAIFuncResultCacheKey() override {}
+  void append_param(const common::ObString &param);
+  void append_input(const common::ObString &input);
+  bool operator==(const ObIKVCacheKey &other) const override;
+  uint64_t hash() const override;
+  uint64_t get_tenant_id() const override { return tenant_id_; }
+  int64_t size() const override { return sizeof(*this); }
+  int deep_copy(char *buf, const int64_t buf_len, ObIKVCacheKey *&key) const override;
+  bool is_valid() const
+  {
+    return common::OB_INVALID_TENANT_ID != tenant_id_ && is_cacheable_func_type(func_type_)
+           && input_length_ > 0;
+  }
+  // only deterministic functions, the same input always gives the same result
+  static bool is_cacheable_func_type(const int64_t func_type)
+  {
+    return EndpointType::DENSE_EMBEDDING == func_type || EndpointType::RERANK == func_type;
+  }
+  TO_STRING_KV(K_(tenant_id), K_(func_type), K_(param_hash), K_(input_hash), K_(input_check_hash),
+               K_(input_length));
+
+private:
+  static const uint64_t INPUT_CHECK_SEED = 0x9E3779B97F4A7C15;
+  uint64_t tenant_id_;
+  int64_t func_type_;
+  uint64_t param_hash_;
+  uint64_t input_hash_;
+  uint64_t input_check_hash_;
+  int64_t input_length_;
+};
+
+class ObAIFuncResultCacheValue : public common::ObIKVCacheValue
+{
+public:
+  ObAIFuncResultCacheValue() : result_() {}
+  explicit ObAIFuncResultCacheValue(const common::ObString &result) : result_(result) {}
+  ~ObAIFuncResultCacheValue() override {}
+  int64_t size() const override { return sizeof(*this) + result_.length(); }
+  int deep_copy(char *buf, const int64_t buf_len, ObIKVCacheValue *&value) const override;
+  const common::ObString &get_result() const { return result_; }
+  TO_STRING_KV(K(result_.length()));
+
+private:
+  common::ObString result_;
+};
+
+class ObAIFuncResultCache
+    : public common::ObKVCache<ObAIFuncResultCacheKey, ObAIFuncResultCacheValue>
+{
+public:
+  // larger results are not cached, they would wash out many small ones
+  static const int64_t MAX_RESULT_LENGTH = 512 * 1024; // 512KB
+
+  ObAIFuncResultCache() {}
+  virtual ~ObAIFuncResultCache() {}
+  static ObAIFuncResultCache &get_instance()
+  {
+    static ObAIFuncResultCache cache;
+    return cache;
+  }
+  static bool is_enabled();
+  // get the cached result and deep copy it with allocator, return OB_ENTRY_NOT_EXIST if missed
+  int get_result(const ObAIFuncResultCacheKey &key,
+                 common::ObIAllocator &allocator,
+                 common::ObString &result);
+  int put_result(const ObAIFuncResultCacheKey &key, const common::ObString &result);
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObAIFuncResultCache);
+};
+
+} // namespace share
+} // namespace oceanbase
+
+#endif // OCEANBASE_SHARE_AI_SERVICE_OB_AI_FUNC_RESULT_CACHE_H_
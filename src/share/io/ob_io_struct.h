@@ -393,7 +393,7 @@ private:
 };
 
 // each device has several channels, including async channels and sync channels.
-// this interface better in ObIODevice and can be replaced by io_uring.
+// this interface better in ObIODevice. ObLocalDevice may run the io contexts on io_uring, see ObLocalIOUring.
 class ObDeviceChannel final
 {
 public:
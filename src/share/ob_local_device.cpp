@@ -920,7 +920,12 @@ int ObLocalDevice::io_setup(
     int sys_ret = 0;
     ObLocalIOContext *local_context = nullptr;
     local_context = new (buf) ObLocalIOContext();
-    if (0 != (sys_ret = ::io_setup(max_events, &(local_context->io_context_)))) {
+    if (GCONF._enable_io_uring) {
+      setup_io_uring(max_events, *local_context);
+    }
+    if (nullptr != local_context->uring_) {
+      io_context = local_context;
+    } else if (0 != (sys_ret = ::io_setup(max_events, &(local_context->io_context_)))) {
       // libaio on error it returns a negated error number (the negative of one of the values listed in ERRORS)
       ret = ObIODeviceLocalFileOp::convert_sys_errno(-sys_ret);
       SHARE_LOG(WARN, "Fail to setup io context, ", K(ret), K(sys_ret), KERRMSG);
@@ -935,6 +940,35 @@ int ObLocalDevice::io_setup(
   return ret;
 }
 
+void ObLocalDevice::setup_io_uring(const uint32_t max_events, ObLocalIOContext &io_context)
+{
+  int ret = OB_SUCCESS;
+  void *buf = nullptr;
+  ObLocalIOUring *uring = nullptr;
+  const int64_t sqpoll_idle_ms = GCONF._io_uring_sqpoll_idle_time / 1000;
+  if (OB_ISNULL(buf = allocator_.alloc(sizeof(ObLocalIOUring)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    SHARE_LOG(WARN, "Fail to allocate memory, ", K(ret));
+  } else if (FALSE_IT(uring = new (buf) ObLocalIOUring())) {
+  } else if (OB_FAIL(uring->init(max_events, sqpoll_idle_ms))) {
+    SHARE_LOG(WARN, "Fail to init io_uring, ", K(ret), K(max_events), K(sqpoll_idle_ms));
+  } else if (block_fd_ >= 0 && OB_FAIL(uring->register_file(block_fd_))) {
+    SHARE_LOG(WARN, "Fail to register block file to io_uring, ", K(ret), K_(block_fd));
+  } else {
+    io_context.uring_ = uring;
+    SHARE_LOG(INFO, "io context runs on io_uring", KPC(uring));
+  }
+  if (OB_FAIL(ret)) {
+    // keep on libaio
+    if (nullptr != uring) {
+      uring->~ObLocalIOUring();
+    }
+    if (nullptr != buf) {
+      allocator_.free(buf);
+    }
+  }
+}
+
 int ObLocalDevice::io_destroy(common::ObIOContext *io_context)
 {
   int ret = OB_SUCCESS;
@@ -953,6 +987,11 @@ int ObLocalDevice::io_destroy(common::ObIOContext *io_context)
   } else if (OB_ISNULL(local_io_context = static_cast<ObLocalIOContext *> (io_context))) {
     ret = OB_ERR_UNEXPECTED;
     SHARE_LOG(WARN, "local io context is null", K(ret), KP(io_context));
+  } else if (nullptr != local_io_context->uring_) {
+    local_io_context->uring_->~ObLocalIOUring();
+    allocator_.free(local_io_context->uring_);
+    local_io_context->uring_ = nullptr;
+    allocator_.free(io_context);
   } else {
     int sys_ret = 0;
     if ((sys_ret = ::io_destroy(local_io_context->io_context_)) != 0) {
@@ -1068,6 +1107,12 @@ int ObLocalDevice::io_submit(
   } else if (OB_ISNULL(local_io_context = static_cast<ObLocalIOContext *> (io_context))) {
     ret = OB_ERR_UNEXPECTED;
     SHARE_LOG(WARN, "local io context pointer is null", K(ret), KP(io_context));
+  } else if (nullptr != local_io_context->uring_) {
+    ret = local_io_context->uring_->submit(local_iocb->iocb_);
+    time_guard.click("LocalDevice_submit");
+    if (OB_FAIL(ret)) {
+      SHARE_LOG(WARN, "Fail to submit io_uring, ", K(ret), KPC(local_io_context->uring_));
+    }
   } else {
     iocbp = &(local_iocb->iocb_);
     int submit_ret = ::io_submit(local_io_context->io_context_, 1, &iocbp);
@@ -1107,6 +1152,10 @@ int ObLocalDevice::io_cancel(
   } else if (OB_ISNULL(local_io_context = static_cast<ObLocalIOContext *> (io_context))) {
     ret = OB_ERR_UNEXPECTED;
     SHARE_LOG(WARN, "local io context pointer is null", K(ret), KP(io_context));
+  } else if (nullptr != local_io_context->uring_) {
+    // a request on io_uring can not be taken back, the caller waits for its completion
+    ret = OB_NOT_SUPPORTED;
+    SHARE_LOG(DEBUG, "io_uring doesn't support cancel, ", K(ret));
   } else {
     int sys_ret = 0;
     if ((sys_ret = ::io_cancel(local_io_context->io_context_, &(local_iocb->iocb_), &local_event)) < 0) {
@@ -1145,6 +1194,22 @@ int ObLocalDevice::io_getevents(
   } else if (OB_ISNULL(local_io_context = static_cast<ObLocalIOContext *> (io_context))) {
     ret = OB_ERR_UNEXPECTED;
     SHARE_LOG(WARN, "local io context pointer is null", K(ret), KP(io_context));
+  } else if (nullptr != local_io_context->uring_) {
+    int64_t complete_cnt = 0;
+    {
+      oceanbase::lib::Thread::WaitGuard guard(oceanbase::lib::Thread::WAIT_FOR_IO_EVENT);
+      common::ObBKGDSessInActiveGuard inactive_guard;
+      ret = local_io_context->uring_->get_events(min_nr,
+                                                 local_io_events->max_event_cnt_,
+                                                 local_io_events->io_events_,
+                                                 timeout,
+                                                 complete_cnt);
+    }
+    if (OB_FAIL(ret)) {
+      SHARE_LOG(WARN, "Fail to get io_uring events, ", K(ret), KPC(local_io_context->uring_));
+    } else {
+      local_io_events->complete_io_cnt_ = complete_cnt;
+    }
   } else {
     int sys_ret = 0;
     {
@@ -20,6 +20,7 @@
 #include <libaio.h>
 #include "lib/allocator/ob_vslice_alloc.h"
 #include "common/storage/ob_io_device.h"
+#include "share/ob_local_io_uring.h"
 
 namespace oceanbase {
 namespace share {
@@ -43,7 +44,7 @@ private:
 class ObLocalIOContext : public common::ObIOContext
 {
 public:
-  ObLocalIOContext() : io_context_() {}
+  ObLocalIOContext() : io_context_(), uring_(nullptr) {}
   virtual ~ObLocalIOContext() {}
   virtual ObIOContextType get_type() const override
   {
@@ -52,6 +53,8 @@ public:
 private:
   friend class ObLocalDevice;
   io_context_t io_context_;
+  // not null if the context runs on io_uring instead of libaio
+  ObLocalIOUring *uring_;
 };
 
 class ObLocalIOEvents : public common::ObIOEvents
@@ -223,6 +226,8 @@ private:
   int resize_block_file(const int64_t new_size);
   int64_t get_block_file_offset(const common::ObIOFd &fd, const int64_t offset);
   int try_punch_hole(const int64_t block_index);
+  // moves the io context onto io_uring, leaves it on libaio if the ring can not be set up
+  void setup_io_uring(const uint32_t max_events, ObLocalIOContext &io_context);
 
 private:
   bool is_inited_;
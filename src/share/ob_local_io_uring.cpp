@@ -0,0 +1,491 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define USING_LOG_PREFIX SHARE
+
+#include "ob_local_io_uring.h"
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "lib/atomic/ob_atomic.h"
+#include "share/ob_io_device_helper.h"
+
+#ifndef __NR_io_uring_setup
+#define __NR_io_uring_setup 425
+#endif
+#ifndef __NR_io_uring_enter
+#define __NR_io_uring_enter 426
+#endif
+#ifndef __NR_io_uring_register
+#define __NR_io_uring_register 427
+#endif
+
+namespace oceanbase {
+namespace share {
+
+// io_uring kernel ABI, see include/uapi/linux/io_uring.h
+struct ObIOUringSQE
+{
+  uint8_t opcode_;
+  uint8_t flags_;
+  uint16_t ioprio_;
+  int32_t fd_;
+  uint64_t off_;
+  uint64_t addr_;
+  uint32_t len_;
+  uint32_t rw_flags_;
+  uint64_t user_data_;
+  uint16_t buf_index_;
+  uint16_t personality_;
+  int32_t file_index_;
+  uint64_t pad_[2];
+};
+
+struct ObIOUringCQE
+{
+  uint64_t user_data_;
+  int32_t res_;
+  uint32_t flags_;
+};
+
+struct ObIOUringSQRingOffsets
+{
+  uint32_t head_;
+  uint32_t tail_;
+  uint32_t ring_mask_;
+  uint32_t ring_entries_;
+  uint32_t flags_;
+  uint32_t dropped_;
+  uint32_t array_;
+  uint32_t resv1_;
+  uint64_t resv2_;
+};
+
+struct ObIOUringCQRingOffsets
+{
+  uint32_t head_;
+  uint32_t tail_;
+  uint32_t ring_mask_;
+  uint32_t ring_entries_;
+  uint32_t overflow_;
+  uint32_t cqes_;
+  uint32_t flags_;
+  uint32_t resv1_;
+  uint64_t resv2_;
+};
+
+struct ObIOUringParams
+{
+  uint32_t sq_entries_;
+  uint32_t cq_entries_;
+  uint32_t flags_;
+  uint32_t sq_thread_cpu_;
+  uint32_t sq_thread_idle_;
+  uint32_t features_;
+  uint32_t wq_fd_;
+  uint32_t resv_[3];
+  ObIOUringSQRingOffsets sq_off_;
+  ObIOUringCQRingOffsets cq_off_;
+};
+
+struct ObIOUringTimespec
+{
+  int64_t tv_sec_;
+  int64_t tv_nsec_;
+};
+
+struct ObIOUringGetEventsArg
+{
+  uint64_t sigmask_;
+  uint32_t sigmask_sz_;
+  uint32_t pad_;
+  uint64_t ts_;
+};
+
+STATIC_ASSERT(64 == sizeof(ObIOUringSQE), "io_uring sqe size mismatch");
+STATIC_ASSERT(16 == sizeof(ObIOUringCQE), "io_uring cqe size mismatch");
+STATIC_ASSERT(120 == sizeof(ObIOUringParams), "io_uring params size mismatch");
+STATIC_ASSERT(24 == sizeof(ObIOUringGetEventsArg), "io_uring getevents arg size mismatch");
+
+static const uint8_t IORING_OP_READ_CODE = 22;
+static const uint8_t IORING_OP_WRITE_CODE = 23;
+static const uint8_t IOSQE_FIXED_FILE_FLAG = 1U << 0;
+static const uint32_t IORING_SETUP_SQPOLL_FLAG = 1U << 1;
+static const uint32_t IORING_SQ_NEED_WAKEUP_FLAG = 1U << 0;
+static const uint32_t IORING_ENTER_GETEVENTS_FLAG = 1U << 0;
+static const uint32_t IORING_ENTER_SQ_WAKEUP_FLAG = 1U << 1;
+static const uint32_t IORING_ENTER_EXT_ARG_FLAG = 1U << 3;
+static const uint32_t IORING_FEAT_SINGLE_MMAP_FLAG = 1U << 0;
+static const uint32_t IORING_FEAT_EXT_ARG_FLAG = 1U << 8;
+static const uint32_t IORING_REGISTER_FILES_CODE = 2;
+static const int64_t IORING_OFF_SQ_RING_OFFSET = 0;
+static const int64_t IORING_OFF_CQ_RING_OFFSET = 0x8000000LL;
+static const int64_t IORING_OFF_SQES_OFFSET = 0x10000000LL;
+
+ObLocalIOUring::ObLocalIOUring()
+  : is_inited_(false),
+    ring_fd_(-1),
+    sq_ring_ptr_(nullptr),
+    sq_ring_size_(0),
+    cq_ring_ptr_(nullptr),
+    cq_ring_size_(0),
+    sqes_(nullptr),
+    sqes_size_(0),
+    sq_head_(nullptr),
+    sq_tail_(nullptr),
+    sq_mask_(nullptr),
+    sq_flags_(nullptr),
+    sq_array_(nullptr),
+    cq_head_(nullptr),
+    cq_tail_(nullptr),
+    cq_mask_(nullptr),
+    cqes_(nullptr),
+    sq_entries_(0),
+    cq_entries_(0),
+    pending_cnt_(0),
+    registered_fd_(-1),
+    is_sqpoll_(false),
+    submit_lock_(common::ObLatchIds::LOCAL_DEVICE_LOCK),
+    reap_lock_(common::ObLatchIds::LOCAL_DEVICE_LOCK)
+{
+}
+
+int ObLocalIOUring::init(const uint32_t entries, const int64_t sqpoll_idle_ms)
+{
+  int ret = OB_SUCCESS;
+  ObIOUringParams params;
+  MEMSET(&params, 0, sizeof(params));
+  if (OB_UNLIKELY(is_inited_)) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("init twice", K(ret));
+  } else if (OB_UNLIKELY(0 == entries || sqpoll_idle_ms < 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(entries), K(sqpoll_idle_ms));
+  } else {
+    if (sqpoll_idle_ms > 0) {
+      params.flags_ |= IORING_SETUP_SQPOLL_FLAG;
+      params.sq_thread_idle_ = static_cast<uint32_t>(sqpoll_idle_ms);
+    }
+    if ((ring_fd_ = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params))) < 0) {
+      ret = ObIODeviceLocalFileOp::convert_sys_errno(errno);
+      LOG_WARN("fail to setup io_uring", K(ret), K(entries), K(sqpoll_idle_ms), KERRMSG);
+    } else if (OB_UNLIKELY(0 == (params.features_ & IORING_FEAT_EXT_ARG_FLAG))) {
+      ret = OB_NOT_SUPPORTED;
+      LOG_WARN("io_uring of the kernel does not support timeout of io_uring_enter", K(ret),
+               "features", params.features_);
+    } else if (OB_FAIL(map_rings(&params))) {
+      LOG_WARN("fail to map io_uring rings", K(ret));
+    } else {
+      sq_entries_ = params.sq_entries_;
+      cq_entries_ = params.cq_entries_;
+      is_sqpoll_ = sqpoll_idle_ms > 0;
+      pending_cnt_ = 0;
+      is_inited_ = true;
+    }
+  }
+  if (OB_FAIL(ret)) {
+    destroy();
+  }
+  return ret;
+}
+
+int ObLocalIOUring::map_rings(const void *params_ptr)
+{
+  int ret = OB_SUCCESS;
+  const ObIOUringParams &params = *static_cast<const ObIOUringParams *>(params_ptr);
+  const bool single_mmap = 0 != (params.features_ & IORING_FEAT_SINGLE_MMAP_FLAG);
+  sq_ring_size_ = params.sq_off_.array_ + params.sq_entries_ * sizeof(uint32_t);
+  cq_ring_size_ = params.cq_off_.cqes_ + params.cq_entries_ * sizeof(ObIOUringCQE);
+  if (single_mmap) {
+    sq_ring_size_ = MAX(sq_ring_size_, cq_ring_size_);
+    cq_ring_size_ = sq_ring_size_;
+  }
+  sqes_size_ = params.sq_entries_ * sizeof(ObIOUringSQE);
+  void *ptr = nullptr;
+  if (MAP_FAILED == (ptr = ::mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE,
+                                  MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING_OFFSET))) {
+    ret = ObIODeviceLocalFileOp::convert_sys_errno(errno);
+    LOG_WARN("fail to map io_uring submission queue", K(ret), K_(sq_ring_size), KERRMSG);
+  } else if (FALSE_IT(sq_ring_ptr_ = ptr)) {
+  } else if (single_mmap) {
+    cq_ring_ptr_ = sq_ring_ptr_;
+  } else if (MAP_FAILED == (ptr = ::mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE,
+                                         MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING_OFFSET))) {
+    ret = ObIODeviceLocalFileOp::convert_sys_errno(errno);
+    LOG_WARN("fail to map io_uring completion queue", K(ret), K_(cq_ring_size), KERRMSG);
+  } else {
+    cq_ring_ptr_ = ptr;
+  }
+  if (OB_FAIL(ret)) {
+  } else if (MAP_FAILED == (ptr = ::mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE,
+                                         MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES_OFFSET))) {
+    ret = ObIODeviceLocalFileOp::convert_sys_errno(errno);
+    LOG_WARN("fail to map io_uring submission queue entries", K(ret), K_(sqes_size), KERRMSG);
+  } else {
+    char *sq_ring = static_cast<char *>(sq_ring_ptr_);
+    char *cq_ring = static_cast<char *>(cq_ring_ptr_);
+    sqes_ = static_cast<ObIOUringSQE *>(ptr);
+    sq_head_ = reinterpret_cast<uint32_t *>(sq_ring + params.sq_off_.head_);
+    sq_tail_ = reinterpret_cast<uint32_t *>(sq_ring + params.sq_off_.tail_);
+    sq_mask_ = reinterpret_cast<uint32_t *>(sq_ring + params.sq_off_.ring_mask_);
+    sq_flags_ = reinterpret_cast<uint32_t *>(sq_ring + params.sq_off_.flags_);
+    sq_array_ = reinterpret_cast<uint32_t *>(sq_ring + params.sq_off_.array_);
+    cq_head_ = reinterpret_cast<uint32_t *>(cq_ring + params.cq_off_.head_);
+    cq_tail_ = reinterpret_cast<uint32_t *>(cq_ring + params.cq_off_.tail_);
+    cq_mask_ = reinterpret_cast<uint32_t *>(cq_ring + params.cq_off_.ring_mask_);
+    cqes_ = reinterpret_cast<ObIOUringCQE *>(cq_ring + params.cq_off_.cqes_);
+  }
+  return ret;
+}
+
+void ObLocalIOUring::destroy()
+{
+  if (nullptr != sqes_) {
+    ::munmap(sqes_, sqes_size_);
+    sqes_ = nullptr;
+  }
+  if (nullptr != cq_ring_ptr_ && cq_ring_ptr_ != sq_ring_ptr_) {
+    ::munmap(cq_ring_ptr_, cq_ring_size_);
+  }
+  cq_ring_ptr_ = nullptr;
+  if (nullptr != sq_ring_ptr_) {
+    ::munmap(sq_ring_ptr_, sq_ring_size_);
+    sq_ring_ptr_ = nullptr;
+  }
+  if (ring_fd_ >= 0) {
+    ::close(ring_fd_);
+    ring_fd_ = -1;
+  }
+  sq_ring_size_ = 0;
+  cq_ring_size_ = 0;
+  sqes_size_ = 0;
+  sq_head_ = nullptr;
+  sq_tail_ = nullptr;
+  sq_mask_ = nullptr;
+  sq_flags_ = nullptr;
+  sq_array_ = nullptr;
+  cq_head_ = nullptr;
+  cq_tail_ = nullptr;
+  cq_mask_ = nullptr;
+  cqes_ = nullptr;
+  sq_entries_ = 0;
+  cq_entries_ = 0;
+  pending_cnt_ = 0;
+  registered_fd_ = -1;
+  is_sqpoll_ = false;
+  is_inited_ = false;
+}
+
+int ObLocalIOUring::register_file(const int fd)
+{
+  int ret = OB_SUCCESS;
+  int32_t fds[1] = {fd};
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_UNLIKELY(fd < 0 || registered_fd_ >= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(fd), K_(registered_fd));
+  } else if (0 != ::syscall(__NR_io_uring_register, ring_fd_, IORING_REGISTER_FILES_CODE, fds, 1)) {
+    ret = ObIODeviceLocalFileOp::convert_sys_errno(errno);
+    LOG_WARN("fail to register file to io_uring", K(ret), K(fd), KERRMSG);
+  } else {
+    registered_fd_ = fd;
+  }
+  return ret;
+}
+
+int ObLocalIOUring::enter(const uint32_t to_submit,
+                          const uint32_t min_complete,
+                          const uint32_t flags,
+                          const void *arg,
+                          const size_t arg_size,
+                          int &sys_ret)
+{
+  sys_ret = static_cast<int>(::syscall(__NR_io_uring_enter, ring_fd_, to_submit, min_complete,
+                                       flags, arg, arg_size));
+  if (sys_ret < 0) {
+    sys_ret = -errno;
+  }
+  // callers convert sys_ret themselves, since some errnos are expected, e.g. ETIME
+  return sys_ret < 0 ? OB_IO_ERROR : OB_SUCCESS;
+}
+
+int ObLocalIOUring::flush_pending()
+{
+  int ret = OB_SUCCESS;
+  while (OB_SUCC(ret) && pending_cnt_ > 0) {
+    int sys_ret = 0;
+    if (OB_SUCCESS == enter(pending_cnt_, 0, 0, nullptr, 0, sys_ret)) {
+      pending_cnt_ -= MIN(pending_cnt_, static_cast<uint32_t>(sys_ret));
+      if (0 == sys_ret) {
+        break;
+      }
+    } else if (-EINTR == sys_ret) {
+      // retry
+    } else if (-EAGAIN == sys_ret || -EBUSY == sys_ret) {
+      // out of kernel resources or completion queue is full, the entries go with the next enter
+      break;
+    } else {
+      ret = ObIODeviceLocalFileOp::convert_sys_errno(-sys_ret);
+      LOG_WARN("fail to submit io_uring entries", K(ret), K(sys_ret), K_(pending_cnt));
+    }
+  }
+  return ret;
+}
+
+int ObLocalIOUring::submit(const struct iocb &iocb)
+{
+  int ret = OB_SUCCESS;
+  uint8_t opcode = 0;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (IO_CMD_PREAD == iocb.aio_lio_opcode) {
+    opcode = IORING_OP_READ_CODE;
+  } else if (IO_CMD_PWRITE == iocb.aio_lio_opcode) {
+    opcode = IORING_OP_WRITE_CODE;
+  } else {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("not supported io command", K(ret), "opcode", iocb.aio_lio_opcode);
+  }
+  if (OB_SUCC(ret)) {
+    ObSpinLockGuard guard(submit_lock_);
+    const uint32_t head = ATOMIC_LOAD_ACQ(sq_head_);
+    const uint32_t tail = *sq_tail_;
+    if (tail - head >= sq_entries_) {
+      ret = OB_EAGAIN;
+      LOG_WARN("io_uring submission queue is full", K(ret), K(head), K(tail), K_(sq_entries));
+    } else {
+      const uint32_t idx = tail & *sq_mask_;
+      ObIOUringSQE &sqe = sqes_[idx];
+      MEMSET(&sqe, 0, sizeof(sqe));
+      sqe.opcode_ = opcode;
+      if (registered_fd_ >= 0 && iocb.aio_fildes == registered_fd_) {
+        sqe.flags_ = IOSQE_FIXED_FILE_FLAG;
+        sqe.fd_ = 0;
+      } else {
+        sqe.fd_ = iocb.aio_fildes;
+      }
+      sqe.off_ = static_cast<uint64_t>(iocb.u.c.offset);
+      sqe.addr_ = reinterpret_cast<uint64_t>(iocb.u.c.buf);
+      sqe.len_ = static_cast<uint32_t>(iocb.u.c.nbytes);
+      sqe.user_data_ = reinterpret_cast<uint64_t>(iocb.data);
+      sq_array_[idx] = idx;
+      ATOMIC_STORE_REL(sq_tail_, tail + 1);
+      if (is_sqpoll_) {
+        // the polling thread sets NEED_WAKEUP before sleeping, it must see the new tail or be woken
+        MEM_BARRIER();
+        if (0 != (ATOMIC_LOAD(sq_flags_) & IORING_SQ_NEED_WAKEUP_FLAG)) {
+          int sys_ret = 0;
+          if (OB_FAIL(enter(0, 0, IORING_ENTER_SQ_WAKEUP_FLAG, nullptr, 0, sys_ret))) {
+            LOG_WARN("fail to wake up io_uring polling thread", K(ret), K(sys_ret));
+            // the entry is in the queue and will be polled anyway
+            ret = OB_SUCCESS;
+          }
+        }
+      } else {
+        ++pending_cnt_;
+        // while requests are in the kernel, the poll thread comes back on their completions and
+        // submits the queued entries with one io_uring_enter, see get_events()
+        const uint32_t inflight_cnt = ATOMIC_LOAD_ACQ(sq_head_) - ATOMIC_LOAD_ACQ(cq_head_);
+        if (inflight_cnt > 0 && pending_cnt_ < MAX_PENDING_CNT) {
+        } else if (OB_FAIL(flush_pending())) {
+          // take back the entry if the kernel has not consumed it, so the caller can fail the request
+          if (static_cast<int32_t>(ATOMIC_LOAD_ACQ(sq_head_) - tail) <= 0) {
+            ATOMIC_STORE_REL(sq_tail_, tail);
+            --pending_cnt_;
+          } else {
+            ret = OB_SUCCESS;
+          }
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+int64_t ObLocalIOUring::reap(const int64_t max_nr, struct io_event *events)
+{
+  int64_t cnt = 0;
+  uint32_t head = *cq_head_;
+  const uint32_t tail = ATOMIC_LOAD_ACQ(cq_tail_);
+  while (head != tail && cnt < max_nr) {
+    const ObIOUringCQE &cqe = cqes_[head & *cq_mask_];
+    struct io_event &event = events[cnt++];
+    event.data = reinterpret_cast<void *>(cqe.user_data_);
+    event.obj = nullptr;
+    event.res = static_cast<int64_t>(cqe.res_);
+    event.res2 = 0;
+    ++head;
+  }
+  ATOMIC_STORE_REL(cq_head_, head);
+  return cnt;
+}
+
+int ObLocalIOUring::get_events(const int64_t min_nr,
+                               const int64_t max_nr,
+                               struct io_event *events,
+                               struct timespec *timeout,
+                               int64_t &complete_cnt)
+{
+  int ret = OB_SUCCESS;
+  complete_cnt = 0;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_UNLIKELY(nullptr == events || max_nr <= 0 || min_nr < 0 || min_nr > max_nr)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(events), K(min_nr), K(max_nr));
+  } else {
+    if (!is_sqpoll_ && ATOMIC_LOAD(&pending_cnt_) > 0) {
+      ObSpinLockGuard guard(submit_lock_);
+      int tmp_ret = OB_SUCCESS;
+      if (OB_SUCCESS != (tmp_ret = flush_pending())) {
+        LOG_WARN("fail to flush pending io_uring entries", K(tmp_ret), K_(pending_cnt));
+      }
+    }
+    ObSpinLockGuard guard(reap_lock_);
+    complete_cnt = reap(max_nr, events);
+    if (complete_cnt < min_nr) {
+      ObIOUringTimespec ts;
+      ObIOUringGetEventsArg arg;
+      MEMSET(&arg, 0, sizeof(arg));
+      arg.sigmask_sz_ = _NSIG / 8;
+      if (nullptr != timeout) {
+        ts.tv_sec_ = timeout->tv_sec;
+        ts.tv_nsec_ = timeout->tv_nsec;
+        arg.ts_ = reinterpret_cast<uint64_t>(&ts);
+      }
+      int sys_ret = 0;
+      while (OB_SUCCESS != enter(0, static_cast<uint32_t>(min_nr - complete_cnt),
+                                 IORING_ENTER_GETEVENTS_FLAG | IORING_ENTER_EXT_ARG_FLAG,
+                                 &arg, sizeof(arg), sys_ret)
+             && -EINTR == sys_ret); // ignore EINTR
+      if (sys_ret < 0 && -ETIME != sys_ret && -EAGAIN != sys_ret && -EBUSY != sys_ret) {
+        ret = ObIODeviceLocalFileOp::convert_sys_errno(-sys_ret);
+        LOG_WARN("fail to wait io_uring completions", K(ret), K(sys_ret));
+      } else {
+        complete_cnt += reap(max_nr - complete_cnt, events + complete_cnt);
+      }
+    }
+  }
+  return ret;
+}
+
+} /* namespace share */
+} /* namespace oceanbase */
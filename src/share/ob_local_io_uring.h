@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef SRC_SHARE_OB_LOCAL_IO_URING_H_
+#define SRC_SHARE_OB_LOCAL_IO_URING_H_
+
+#include <libaio.h>
+#include "lib/lock/ob_spin_lock.h"
+#include "lib/utility/ob_print_utils.h"
+
+namespace oceanbase {
+namespace share {
+
+struct ObIOUringSQE;
+struct ObIOUringCQE;
+
+/**
+ * @class ObLocalIOUring
+ * @brief io_uring ring of an async io context of ObLocalDevice.
+ *
+ * @desc:
+ * - Requests are still prepared as libaio iocbs by ObLocalDevice, submit() translates them to
+ *   submission queue entries, and get_events() returns completions as libaio io_events, so the
+ *   io channels work the same on both engines.
+ * - Without SQPOLL, submit() only queues the entry while other requests of the ring are in the
+ *   kernel, the poll thread submits the queued entries in get_events() when it comes back on their
+ *   completions, so one io_uring_enter submits a batch of requests. submit() enters the kernel
+ *   itself when nothing is in flight or MAX_PENDING_CNT entries are queued. Entries that can not
+ *   be submitted, e.g. for EAGAIN, stay in the queue the same way.
+ * - With SQPOLL a kernel thread polls the submission queue, and submit() only enters the kernel
+ *   to wake the thread after it has been idle.
+ * - The block file is registered, requests on it use the fixed file and skip the file reference
+ *   counting of each io.
+ * - The kernel ABI is declared in ob_local_io_uring.cpp, so neither liburing nor new kernel headers
+ *   are needed to build. A kernel without io_uring, or without the timeout of io_uring_enter
+ *   (5.11), fails init() and the device keeps using libaio.
+ */
+class ObLocalIOUring final
+{
+public:
+  ObLocalIOUring();
+  ~ObLocalIOUring() { destroy(); }
+  // sqpoll_idle_ms > 0 enables SQPOLL with the idle time of the polling thread
+  int init(const uint32_t entries, const int64_t sqpoll_idle_ms);
+  void destroy();
+  int register_file(const int fd);
+  int submit(const struct iocb &iocb);
+  int get_events(const int64_t min_nr,
+                 const int64_t max_nr,
+                 struct io_event *events,
+                 struct timespec *timeout,
+                 int64_t &complete_cnt);
+  bool is_sqpoll() const { return is_sqpoll_; }
+
+  TO_STRING_KV(K_(is_inited), K_(ring_fd), K_(sq_entries), K_(cq_entries), K_(pending_cnt),
+               K_(registered_fd), K_(is_sqpoll));
+
+private:
+  // queued entries that make submit() enter the kernel without waiting for the poll thread
+  static const uint32_t MAX_PENDING_CNT = 32;
+  int enter(const uint32_t to_submit,
+            const uint32_t min_complete,
+            const uint32_t flags,
+            const void *arg,
+            const size_t arg_size,
+            int &sys_ret);
+  // submits the pending entries, must hold submit_lock_
+  int flush_pending();
+  int64_t reap(const int64_t max_nr, struct io_event *events);
+  int map_rings(const void *params);
+
+private:
+  bool is_inited_;
+  int ring_fd_;
+  void *sq_ring_ptr_;
+  size_t sq_ring_size_;
+  void *cq_ring_ptr_;
+  size_t cq_ring_size_;
+  ObIOUringSQE *sqes_;
+  size_t sqes_size_;
+  uint32_t *sq_head_;
+  uint32_t *sq_tail_;
+  uint32_t *sq_mask_;
+  uint32_t *sq_flags_;
+  uint32_t *sq_array_;
+  uint32_t *cq_head_;
+  uint32_t *cq_tail_;
+  uint32_t *cq_mask_;
+  ObIOUringCQE *cqes_;
+  uint32_t sq_entries_;
+  uint32_t cq_entries_;
+  // entries in the submission queue not consumed by the kernel yet
+  uint32_t pending_cnt_;
+  int registered_fd_;
+  bool is_sqpoll_;
+  common::ObSpinLock submit_lock_;
+  common::ObSpinLock reap_lock_;
+  DISALLOW_COPY_AND_ASSIGN(ObLocalIOUring);
+};
+
+} /* namespace share */
+} /* namespace oceanbase */
+
+#endif /* SRC_SHARE_OB_LOCAL_IO_URING_H_ */
@@ -38,6 +38,7 @@ namespace share
 {
 const uint64_t ObUpgradeChecker::UPGRADE_PATH[] = {
   CALC_VERSION(1UL, 0UL, 0UL, 0UL),  // 1.0.0.0
+  CALC_VERSION(1UL, 1UL, 0UL, 0UL),  // 1.1.0.0
 };
 
 int ObUpgradeChecker::get_data_version_by_cluster_version(
@@ -52,6 +53,7 @@ int ObUpgradeChecker::get_data_version_by_cluster_version(
       break; \
     }
     CONVERT_CLUSTER_VERSION_TO_DATA_VERSION(CLUSTER_VERSION_1_0_0_0, DATA_VERSION_1_0_0_0)
+    CONVERT_CLUSTER_VERSION_TO_DATA_VERSION(CLUSTER_VERSION_1_1_0_0, DATA_VERSION_1_1_0_0)
 
 #undef CONVERT_CLUSTER_VERSION_TO_DATA_VERSION
     default: {
@@ -579,6 +581,8 @@ int ObUpgradeProcesserSet::init(
         all_version_upgrade_processor_);
 
     // order by data version asc
+    INIT_PROCESSOR_BY_VERSION(1, 0, 0, 0);
+    INIT_PROCESSOR_BY_VERSION(1, 1, 0, 0);
 
 #undef INIT_PROCESSOR_BY_NAME_AND_VERSION
 #undef INIT_PROCESSOR_BY_VERSION
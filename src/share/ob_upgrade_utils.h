@@ -188,7 +188,7 @@ public:
              const uint64_t cluster_version,
              uint64_t &data_version);
 public:
-  static const int64_t DATA_VERSION_NUM = 1;
+  static const int64_t DATA_VERSION_NUM = 2;
   static const uint64_t UPGRADE_PATH[];
 };
 
@@ -207,6 +207,9 @@ private:
 
 /* =========== special upgrade processor end   ============= */
 
+/* =========== upgrade processor start ============= */
+DEF_SIMPLE_UPGRARD_PROCESSER(1, 0, 0, 0)
+DEF_SIMPLE_UPGRARD_PROCESSER(1, 1, 0, 0)
 /* =========== upgrade processor end ============= */
 
 } // end namespace share
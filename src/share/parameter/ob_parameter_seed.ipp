@@ -1224,6 +1224,14 @@ DEF_CAP(_io_read_batch_size, OB_CLUSTER_PARAMETER, "0K", "[0K,16M]", "Maximum ba
 DEF_INT(_io_read_redundant_limit_percentage, OB_CLUSTER_PARAMETER, "0", "[0, 99]",
         "Maximum percentage of redundant size in one read io request, redundant data means blocks in the middle of the batch that hit in cache or filtered by skipping index but must be read. Range:[0,99]",
         ObParameterAttr(Section::SSTABLE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_io_uring, OB_CLUSTER_PARAMETER, "False",
+         "specifies whether the async io of the local block file uses io_uring instead of libaio, "
+         "falls back to libaio if the kernel does not support it",
+         ObParameterAttr(Section::SSTABLE, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
+DEF_TIME(_io_uring_sqpoll_idle_time, OB_CLUSTER_PARAMETER, "0ms", "[0ms, 10s]",
+         "idle time before the io_uring submission polling thread sleeps, 0 means io_uring does not "
+         "poll the submission queue. Range: [0ms, 10s]",
+         ObParameterAttr(Section::SSTABLE, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
 
 // TODO bin.lb: to be remove
 DEF_CAP(dtl_buffer_size, OB_CLUSTER_PARAMETER, "64K", "[4K,2M]", "to be removed",
@@ -1520,6 +1528,10 @@ DEF_INT(_max_schema_slot_num, OB_CLUSTER_PARAMETER, "128", "[2,256]",
 DEF_BOOL(_enable_add_fulltext_index_to_existing_table, OB_CLUSTER_PARAMETER, "False",
          "enable create fulltext index after table is created",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_ft_ik_dict_image, OB_CLUSTER_PARAMETER, "False",
+         "Enable or disable loading the built-in IK dictionaries from read-only image files in the data dir, "
+         "which are shared by all tenants, instead of the dictionary tables of each tenant.",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_INT_WITH_CHECKER(_ob_query_rate_limit, OB_CLUSTER_PARAMETER, "-1",
         common::ObConfigQueryRateLimitChecker,
         "the maximun throughput allowed for a tenant per observer instance",
@@ -2648,6 +2660,27 @@ DEF_INT_WITH_CHECKER(_hnsw_max_scan_vectors, OB_CLUSTER_PARAMETER, "20000",
                     common::ObHNSWIterFilterScanNumChecker,
                     "The upper limit of hnsw iter-filter search nums. Range: [0,)",
                     ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_embedding_max_inflight_requests, OB_CLUSTER_PARAMETER, "4", "[1, 64]",
+        "The max number of embedding http requests in flight to one model endpoint, "
+        "every embedding task always keeps at least one. Range: [1, 64]",
+        ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_ai_func_result_cache, OB_CLUSTER_PARAMETER, "False",
+         "Enable or disable caching the results of AI_EMBED and AI_RERANK calls, "
+         "identical calls to the same model with the same input and params reuse the cached result. "
+         "AI_COMPLETE results are never cached.",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_vector_index_snapshot_image, OB_CLUSTER_PARAMETER, "False",
+         "Enable or disable saving loaded vector index snapshots to local image files in the data dir, "
+         "later loads of the same snapshot map the image instead of reading the snapshot table.",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_ivf_mini_batch_kmeans, OB_CLUSTER_PARAMETER, "False",
+         "Enable or disable mini-batch kmeans for IVF_FLAT and IVF_SQ8 center builds with at least 1M samples, "
+         "mini-batch kmeans is faster than elkan kmeans but the centers may be less accurate.",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_ivf_parallel_kmeans, OB_CLUSTER_PARAMETER, "False",
+         "Enable or disable splitting the steps of IVF_FLAT and IVF_SQ8 center builds over the kmeans build "
+         "thread pool, the centers are built in the DDL thread when disabled.",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_BOOL(_enable_sql_ccl_rule, OB_CLUSTER_PARAMETER, "True",
          "Enable or disable sql ccl rule.",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
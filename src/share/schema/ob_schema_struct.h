@@ -7794,6 +7794,10 @@ public:
   inline void set_loose_min_max() { loose_min_max_ =1; }
   inline void set_bm25_token_freq_param() { bm25_token_freq_param_ = 1; }
   inline void set_bm25_doc_len_param() { bm25_doc_len_param_ = 1; }
+  inline void set_ngram_bloom_filter() { ngram_bloom_filter_ = 1; }
+  inline void set_hll() { hll_ = 1; }
+  inline void set_vector_bound() { vector_bound_ = 1; }
+  inline void set_bloom_filter() { bloom_filter_ = 1; }
   inline bool has_skip_index() const { return OB_DEFAULT_SKIP_INDEX_COLUMN_ATTR != pack_; }
   inline bool has_loose_skip_index() const { return has_loose_min_max(); }
   inline bool has_min_max() const { return 1 == min_max_; }
@@ -7801,8 +7805,20 @@ public:
   inline bool has_loose_min_max() const { return 1 == loose_min_max_; }
   inline bool has_bm25_token_freq_param() const { return 1 == bm25_token_freq_param_; }
   inline bool has_bm25_doc_len_param() const { return 1 == bm25_doc_len_param_; }
+  inline bool has_ngram_bloom_filter() const { return 1 == ngram_bloom_filter_; }
+  inline bool has_hll() const { return 1 == hll_; }
+  inline bool has_vector_bound() const { return 1 == vector_bound_; }
+  inline bool has_bloom_filter() const { return 1 == bloom_filter_; }
+  // vector bound is the only skip index on vector columns
+  inline bool is_vector_bound_only() const
+  {
+    ObSkipIndexColumnAttr vector_bound_attr;
+    vector_bound_attr.set_vector_bound();
+    return pack_ == vector_bound_attr.pack_;
+  }
   inline bool operator==(const ObSkipIndexColumnAttr &other) const { return pack_ == other.pack_; }
-  TO_STRING_KV(K_(pack), K_(min_max), K_(sum), K_(loose_min_max), K_(bm25_token_freq_param), K_(bm25_doc_len_param));
+  TO_STRING_KV(K_(pack), K_(min_max), K_(sum), K_(loose_min_max), K_(bm25_token_freq_param), K_(bm25_doc_len_param),
+      K_(ngram_bloom_filter), K_(hll), K_(vector_bound), K_(bloom_filter));
 
   union
   {
@@ -7813,7 +7829,11 @@ public:
       uint64_t loose_min_max_           :1;
       uint64_t bm25_token_freq_param_   :1;
       uint64_t bm25_doc_len_param_      :1;
-      uint64_t reserved_                :59;
+      uint64_t ngram_bloom_filter_      :1;
+      uint64_t hll_                     :1;
+      uint64_t vector_bound_            :1;
+      uint64_t bloom_filter_            :1;
+      uint64_t reserved_                :55;
     };
     uint64_t pack_;
   };
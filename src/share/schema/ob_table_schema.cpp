@@ -7851,15 +7851,34 @@ int ObTableSchema::check_skip_index_valid() const
       ret = OB_ERR_UNEXPECTED;
       LOG_USER_ERROR(OB_ERR_UNEXPECTED, "skip index on virtual generated column");
       LOG_WARN("unexpected skip index on virtual generated column", K(ret), KPC(column_schema));
-    } else if (OB_UNLIKELY(is_skip_index_black_list_type(column_schema->get_meta_type().get_type()))) {
+    } else if (OB_UNLIKELY(is_skip_index_black_list_type(column_schema->get_meta_type().get_type())
+                           && !column_schema->get_skip_index_attr().is_vector_bound_only())) {
       ret = OB_NOT_SUPPORTED;
       LOG_USER_ERROR(OB_NOT_SUPPORTED, "build skip index on invalid type");
       LOG_WARN("not supported skip index on column with invalid column type", K(ret), KPC(column_schema));
+    } else if (column_schema->get_skip_index_attr().has_vector_bound() &&
+               !blocksstable::can_agg_vector_bound(column_schema->get_meta_type().get_type(),
+                                                   column_schema->get_extended_type_info())) {
+      ret = OB_NOT_SUPPORTED;
+      LOG_USER_ERROR(OB_NOT_SUPPORTED, "build vector bound skip index on column not in float vector type");
+      LOG_WARN("not supported skip index on column with invalid column type", K(ret), KPC(column_schema));
     } else if (column_schema->get_skip_index_attr().has_sum() &&
                !can_agg_sum(column_schema->get_meta_type().get_type())) {
       ret = OB_NOT_SUPPORTED;
       LOG_USER_ERROR(OB_NOT_SUPPORTED, "build skip index on invalid type");
       LOG_WARN("not supported skip index on column with invalid column type", K(ret), KPC(column_schema));
+    } else if ((column_schema->get_skip_index_attr().has_bloom_filter()
+                || column_schema->get_skip_index_attr().has_hll()) &&
+               !blocksstable::can_agg_value_hash(column_schema->get_meta_type().get_type())) {
+      ret = OB_NOT_SUPPORTED;
+      LOG_USER_ERROR(OB_NOT_SUPPORTED, "build bloom filter or hll skip index on invalid type");
+      LOG_WARN("not supported skip index on column with invalid column type", K(ret), KPC(column_schema));
+    } else if (column_schema->get_skip_index_attr().has_ngram_bloom_filter() &&
+               !blocksstable::can_agg_ngram_bloom_filter(column_schema->get_meta_type().get_type(),
+                                                         column_schema->get_collation_type())) {
+      ret = OB_NOT_SUPPORTED;
+      LOG_USER_ERROR(OB_NOT_SUPPORTED, "build ngram bloom filter skip index on column not in binary collation");
+      LOG_WARN("not supported skip index on column with invalid column type", K(ret), KPC(column_schema));
     } else if (OB_FAIL(blocksstable::ObSkipIndexColMeta::calc_skip_index_maximum_size(
         column_schema->get_skip_index_attr(),
         column_schema->get_meta_type().get_type(),
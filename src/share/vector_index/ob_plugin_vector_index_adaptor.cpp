@@ -2982,6 +2982,173 @@ int ObPluginVectorIndexAdaptor::vsag_query_vids(float *vector,
   return ret;
 }
 
+int ObPluginVectorIndexAdaptor::vsag_batch_query_vids(ObVectorQueryAdaptorResultContext *ctx,
+                                                      ObVectorQueryConditions *query_cond,
+                                                      int64_t dim, float *query_vectors,
+                                                      int64_t query_count,
+                                                      ObVectorQueryVidIterator **vids_iters)
+{
+  INIT_SUCC(ret);
+  ObHnswBitmapFilter ifilter(tenant_id_);
+  ObHnswBitmapFilter dfilter(tenant_id_);
+  const int64_t **delta_vids = nullptr;
+  const int64_t **snap_vids = nullptr;
+  const float **delta_distances = nullptr;
+  const float **snap_distances = nullptr;
+  int64_t *delta_res_cnts = nullptr;
+  int64_t *snap_res_cnts = nullptr;
+  int64_t query_ef_search = 0;
+
+  if (OB_ISNULL(ctx) || OB_ISNULL(query_cond) || OB_ISNULL(query_vectors) || OB_ISNULL(vids_iters)
+      || query_count <= 0 || dim <= 0) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(ctx), KP(query_cond), KP(query_vectors), KP(vids_iters),
+             K(query_count), K(dim));
+  } else if (is_sparse_vector_index_type() || query_cond->is_post_with_filter_
+             || query_cond->extra_column_count_ > 0) {
+    // iterative filter, extra info and sparse vectors keep the per query path
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("batch query is not supported for this query", K(ret), K(query_cond->is_post_with_filter_),
+             K(query_cond->extra_column_count_));
+  } else if (OB_ISNULL(delta_vids = static_cast<const int64_t**>(
+                 ctx->tmp_allocator_->alloc(sizeof(int64_t*) * query_count)))
+             || OB_ISNULL(snap_vids = static_cast<const int64_t**>(
+                 ctx->tmp_allocator_->alloc(sizeof(int64_t*) * query_count)))
+             || OB_ISNULL(delta_distances = static_cast<const float**>(
+                 ctx->tmp_allocator_->alloc(sizeof(float*) * query_count)))
+             || OB_ISNULL(snap_distances = static_cast<const float**>(
+                 ctx->tmp_allocator_->alloc(sizeof(float*) * query_count)))
+             || OB_ISNULL(delta_res_cnts = static_cast<int64_t*>(
+                 ctx->tmp_allocator_->alloc(sizeof(int64_t) * query_count)))
+             || OB_ISNULL(snap_res_cnts = static_cast<int64_t*>(
+                 ctx->tmp_allocator_->alloc(sizeof(int64_t) * query_count)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc batch query result arrays.", K(ret), K(query_count));
+  } else if (OB_FAIL(merge_and_generate_bitmap(ctx, ifilter, dfilter))) {
+    LOG_WARN("failed to merge and generate bitmap.", K(ret));
+  } else {
+    query_ef_search = query_cond->ef_search_ > ObPluginVectorIndexAdaptor::VSAG_MAX_EF_SEARCH ?
+                      ObPluginVectorIndexAdaptor::VSAG_MAX_EF_SEARCH : query_cond->ef_search_;
+    MEMSET(delta_res_cnts, 0, sizeof(int64_t) * query_count);
+    MEMSET(snap_res_cnts, 0, sizeof(int64_t) * query_count);
+    MEMSET(delta_vids, 0, sizeof(int64_t*) * query_count);
+    MEMSET(snap_vids, 0, sizeof(int64_t*) * query_count);
+    MEMSET(delta_distances, 0, sizeof(float*) * query_count);
+    MEMSET(snap_distances, 0, sizeof(float*) * query_count);
+  }
+
+  float valid_ratio = 1.0;
+  if (OB_SUCC(ret) && ctx->is_prefilter_valid()) {
+    int64_t incr_cnt = 0;
+    int64_t snap_cnt = 0;
+    if (OB_NOT_NULL(get_incr_index()) && OB_FAIL(obvectorutil::get_index_number(get_incr_index(), incr_cnt))) {
+      LOG_WARN("failed to get inc index number.", K(ret));
+    } else if (OB_NOT_NULL(get_snap_index()) && OB_FAIL(obvectorutil::get_index_number(get_snap_index(), snap_cnt))) {
+      LOG_WARN("failed to get snap index number.", K(ret));
+    } else {
+      float incr_valid_ratio = ctx->pre_filter_->get_valid_ratio(incr_cnt);
+      float snap_valid_ratio = ctx->pre_filter_->get_valid_ratio(snap_cnt);
+      valid_ratio = incr_valid_ratio < snap_valid_ratio ? incr_valid_ratio : snap_valid_ratio;
+      valid_ratio = valid_ratio < 1.0f ? valid_ratio : 1.0f;
+    }
+  }
+
+  ifilter.is_snap_ = false;
+  dfilter.is_snap_ = false;
+  if (OB_SUCC(ret) && is_mem_data_init_atomic(VIRT_INC)) {
+    lib::ObMallocHookAttrGuard malloc_guard(lib::ObMemAttr(tenant_id_, "VIndexVsagADP"));
+    lib::ObLightBacktraceGuard light_backtrace_guard(false);
+    TCRLockGuard lock_guard(incr_data_->mem_data_rwlock_);
+    if (OB_FAIL(obvectorutil::batch_knn_search(get_incr_index(),
+                                               query_vectors,
+                                               dim,
+                                               query_count,
+                                               query_cond->query_limit_,
+                                               delta_distances,
+                                               delta_vids,
+                                               delta_res_cnts,
+                                               query_ef_search,
+                                               &ifilter, //ibitmap,
+                                               true,/*reverse_filter*/
+                                               ifilter.is_range_filter(), // use_inner_id_filter
+                                               valid_ratio,
+                                               &ctx->search_allocator_,
+                                               query_cond->distance_threshold_))) {
+      LOG_WARN("batch knn search delta failed.", K(ret), K(dim), K(query_count));
+    }
+  }
+  if (OB_SUCC(ret) && is_mem_data_init_atomic(VIRT_SNAP)) {
+    lib::ObMallocHookAttrGuard malloc_guard(lib::ObMemAttr(tenant_id_, "VIndexVsagADP"));
+    lib::ObLightBacktraceGuard light_backtrace_guard(false);
+    TCRLockGuard lock_guard(snap_data_->mem_data_rwlock_);
+    ifilter.is_snap_ = true;
+    dfilter.is_snap_ = true;
+    bool is_pre_filter = ctx->is_prefilter_valid();
+    if (OB_FAIL(obvectorutil::batch_knn_search(get_snap_index(),
+                                               query_vectors,
+                                               dim,
+                                               query_count,
+                                               query_cond->query_limit_,
+                                               snap_distances,
+                                               snap_vids,
+                                               snap_res_cnts,
+                                               query_ef_search,
+                                               (!is_pre_filter && dfilter.is_empty()) ? nullptr : &dfilter,
+                                               is_pre_filter,/*reverse_filter*/
+                                               dfilter.is_range_filter(), // use_inner_id_filter
+                                               valid_ratio,
+                                               &ctx->search_allocator_,
+                                               query_cond->distance_threshold_))) {
+      LOG_WARN("batch knn search snap failed.", K(ret), K(dim), K(query_count));
+    }
+  }
+
+  ObVectorIndexAlgorithmType index_type = get_snap_index_type();
+  for (int64_t i = 0; OB_SUCC(ret) && i < query_count; ++i) {
+    ObVecExtraInfoPtr empty_extra_info_ptr;
+    // results beyond distance_threshold_ are already cut off by vsag adaptor
+    const int64_t delta_cnt = delta_res_cnts[i];
+    const int64_t snap_cnt = snap_res_cnts[i];
+    int64_t *merge_vids = nullptr;
+    float *merge_distance = nullptr;
+    int64_t actual_res_cnt = 0;
+    ObVecExtraInfoPtr merge_extra_info_ptr;
+    const ObVsagQueryResult delta_data = {delta_cnt, delta_vids[i], delta_distances[i], empty_extra_info_ptr};
+    const ObVsagQueryResult snap_data = {snap_cnt, snap_vids[i], snap_distances[i], empty_extra_info_ptr};
+    uint64_t tmp_result_cnt = delta_cnt + snap_cnt;
+    uint64_t max_res_cnt = index_type == VIAT_HNSW_BQ || tmp_result_cnt < query_cond->query_limit_ ?
+                           tmp_result_cnt : query_cond->query_limit_;
+    if (OB_FAIL(ret)) {
+    } else if (OB_ISNULL(vids_iters[i])) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("vids iter is null", K(ret), K(i));
+    } else if (max_res_cnt == 0) {
+      actual_res_cnt = 0;
+    } else if (OB_ISNULL(merge_vids = static_cast<int64_t*>(ctx->allocator_->alloc(sizeof(int64_t) * max_res_cnt)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to allocator merge vids.", K(ret));
+    } else if (OB_ISNULL(merge_distance = static_cast<float*>(ctx->allocator_->alloc(sizeof(float) * max_res_cnt)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to allocator merge distance.", K(ret));
+    } else if (index_type == VIAT_HNSW_BQ) {
+      if (OB_FAIL(ObPluginVectorIndexHelper::driect_merge_delta_and_snap_vids(
+              delta_data, snap_data, actual_res_cnt, merge_vids, merge_distance, merge_extra_info_ptr))) {
+        LOG_WARN("failed to merge delta and snap vids.", K(ret));
+      }
+    } else if (OB_FAIL(ObPluginVectorIndexHelper::sort_merge_delta_and_snap_vids(
+                   delta_data, snap_data, max_res_cnt, actual_res_cnt, merge_vids, merge_distance, merge_extra_info_ptr))) {
+      LOG_WARN("failed to merge delta and snap vids.", K(ret));
+    }
+
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(vids_iters[i]->init(actual_res_cnt, merge_vids, merge_distance, merge_extra_info_ptr, ctx->allocator_))) {
+      LOG_WARN("iter init failed.", K(ret), K(i), K(actual_res_cnt));
+    }
+  }
+  LOG_TRACE("batch query result info", K(ret), K(query_count), K(dim));
+  return ret;
+}
+
 int ObPluginVectorIndexAdaptor::get_extra_info_by_ids(const int64_t *vids, int64_t count, char *extra_info_buf_ptr, bool is_snap)
 {
   INIT_SUCC(ret);
@@ -3653,6 +3820,79 @@ int ObPluginVectorIndexAdaptor::query_next_result(ObVectorQueryAdaptorResultCont
   return ret;
 }
 
+int ObPluginVectorIndexAdaptor::vsag_multi_query_vids(ObVectorQueryAdaptorResultContext *ctx,
+                                                      ObVectorQueryConditions *query_cond,
+                                                      int64_t dim, float *query_vectors,
+                                                      ObVectorQueryVidIterator *&vids_iter)
+{
+  INIT_SUCC(ret);
+  ObVectorQueryVidIterator **vids_iters = nullptr;
+  ObVectorQueryVidIterator *iters_buff = nullptr;
+  int64_t query_count = 0;
+  int64_t merge_cnt = 0;
+  int64_t *merge_vids = nullptr;
+  float *merge_distance = nullptr;
+  ObVecExtraInfoPtr empty_extra_info_ptr;
+
+  if (OB_ISNULL(ctx) || OB_ISNULL(query_cond) || OB_ISNULL(vids_iter)
+      || OB_FALSE_IT(query_count = query_cond->query_count_) || query_count <= 1) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(ctx), KP(query_cond), KP(vids_iter), K(query_count));
+  } else if (get_snap_index_type() == VIAT_HNSW_BQ) {
+    // bq results are not distance ordered before reorder, they can not be merged here
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("multi vector query is not supported for hnsw bq index", K(ret));
+  } else if (OB_ISNULL(vids_iters = static_cast<ObVectorQueryVidIterator**>(
+                 ctx->tmp_allocator_->alloc(sizeof(ObVectorQueryVidIterator*) * query_count)))
+             || OB_ISNULL(iters_buff = static_cast<ObVectorQueryVidIterator*>(
+                 ctx->tmp_allocator_->alloc(sizeof(ObVectorQueryVidIterator) * query_count)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc vids iters.", K(ret), K(query_count));
+  } else {
+    for (int64_t i = 0; i < query_count; ++i) {
+      vids_iters[i] = new(iters_buff + i) ObVectorQueryVidIterator(0, 0, 0, nullptr);
+    }
+    if (OB_FAIL(vsag_batch_query_vids(ctx, query_cond, dim, query_vectors, query_count, vids_iters))) {
+      LOG_WARN("failed to batch query vids.", K(ret), K(dim), K(query_count));
+    }
+  }
+
+  // every result is distance ordered, fold them one by one and keep the first (nearest) hit of a vid
+  for (int64_t i = 0; OB_SUCC(ret) && i < query_count; ++i) {
+    const ObVsagQueryResult merged_data = {merge_cnt, merge_vids, merge_distance, empty_extra_info_ptr};
+    const ObVsagQueryResult query_data = {vids_iters[i]->get_total(), vids_iters[i]->get_vids(),
+                                          vids_iters[i]->get_distance(), empty_extra_info_ptr};
+    int64_t *res_vids = nullptr;
+    float *res_distance = nullptr;
+    int64_t res_cnt = 0;
+    ObVecExtraInfoPtr res_extra_info_ptr;
+    uint64_t tmp_result_cnt = merge_cnt + query_data.total_;
+    uint64_t max_res_cnt = tmp_result_cnt < query_cond->query_limit_ ? tmp_result_cnt : query_cond->query_limit_;
+    if (max_res_cnt == 0) {
+    } else if (OB_ISNULL(res_vids = static_cast<int64_t*>(ctx->allocator_->alloc(sizeof(int64_t) * max_res_cnt)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to allocator merge vids.", K(ret));
+    } else if (OB_ISNULL(res_distance = static_cast<float*>(ctx->allocator_->alloc(sizeof(float) * max_res_cnt)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to allocator merge distance.", K(ret));
+    } else if (OB_FAIL(ObPluginVectorIndexHelper::sort_merge_delta_and_snap_vids(
+                   merged_data, query_data, max_res_cnt, res_cnt, res_vids, res_distance, res_extra_info_ptr))) {
+      LOG_WARN("failed to merge query vids.", K(ret), K(i));
+    } else {
+      merge_cnt = res_cnt;
+      merge_vids = res_vids;
+      merge_distance = res_distance;
+    }
+  }
+
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(vids_iter->init(merge_cnt, merge_vids, merge_distance, empty_extra_info_ptr, ctx->allocator_))) {
+    LOG_WARN("iter init failed.", K(ret), K(merge_cnt));
+  }
+  LOG_TRACE("multi vector query result info", K(ret), K(query_count), K(merge_cnt));
+  return ret;
+}
+
 int ObPluginVectorIndexAdaptor::query_result(ObLSID &ls_id,
                                              ObVectorQueryAdaptorResultContext *ctx,
                                              ObVectorQueryConditions *query_cond,
@@ -3674,9 +3914,12 @@ int ObPluginVectorIndexAdaptor::query_result(ObLSID &ls_id,
     LOG_WARN("get invalid query limit.", K(ret), K(query_cond->query_limit_));
   } else if (!is_sparse_vector_index_type() && OB_FAIL(get_dim(dim))) {
     LOG_WARN("get dim failed.", K(ret));
-  } else if (!is_sparse_vector_index_type() && query_cond->query_vector_.length() / sizeof(float) != dim) {
+  } else if (!is_sparse_vector_index_type() && query_cond->query_vector_.length() / sizeof(float) != dim * query_cond->query_count_) {
     ret = OB_ERR_UNEXPECTED;
-    LOG_WARN("get vector objct unexpect.", K(ret), K(query_cond->query_vector_.length()), K(dim));
+    LOG_WARN("get vector objct unexpect.", K(ret), K(query_cond->query_vector_.length()), K(dim), K(query_cond->query_count_));
+  } else if (is_sparse_vector_index_type() && query_cond->query_count_ > 1) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("multi vector query is not supported for sparse vector index", K(ret), K(query_cond->query_count_));
   } else if (OB_ISNULL(query_vector = reinterpret_cast<float *>(query_cond->query_vector_.ptr()))) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("failed to cast vectors.", K(ret), K(query_cond->query_vector_));
@@ -3693,7 +3936,9 @@ int ObPluginVectorIndexAdaptor::query_result(ObLSID &ls_id,
   } else if (!need_load_data_from_table) {
     if (query_cond->only_complete_data_) {
       // do nothing
-    } else if (OB_FAIL(vsag_query_vids(ctx, query_cond, dim, query_vector, vids_iter))) {
+    } else if (OB_FAIL(query_cond->query_count_ > 1
+                       ? vsag_multi_query_vids(ctx, query_cond, dim, query_vector, vids_iter)
+                       : vsag_query_vids(ctx, query_cond, dim, query_vector, vids_iter))) {
       LOG_WARN("failed to query vids.", K(ret), K(dim));
     }
   } else { // need load data
@@ -3730,7 +3975,9 @@ int ObPluginVectorIndexAdaptor::query_result(ObLSID &ls_id,
     } else if (PVQ_REFRESH == ctx->status_) { // skip
     } else if (query_cond->only_complete_data_) {
       // do nothing
-    } else if (OB_FAIL(vsag_query_vids(ctx, query_cond, dim, query_vector, vids_iter))) {
+    } else if (OB_FAIL(query_cond->query_count_ > 1
+                       ? vsag_multi_query_vids(ctx, query_cond, dim, query_vector, vids_iter)
+                       : vsag_query_vids(ctx, query_cond, dim, query_vector, vids_iter))) {
       LOG_WARN("failed to query vids.", K(ret), K(dim));
     } else {
       close_snap_data_rb_flag();
@@ -3765,17 +4012,13 @@ int ObPluginVectorIndexAdaptor::deserialize_snap_data(ObVectorQueryConditions *q
   } else if (OB_FAIL(ObPluginVectorIndexUtils::iter_table_rescan(*query_cond->scan_param_, table_scan_iter))) {
     LOG_WARN("failed to rescan", K(ret));
   } else {
-    ObHNSWDeserializeCallback::CbParam param;
-    param.iter_ = query_cond->row_iter_;
-    param.allocator_ = &tmp_allocator;
-    ObHNSWDeserializeCallback callback(static_cast<void*>(this));
-    ObIStreamBuf::Callback cb = callback;
     ObVectorIndexSerializer index_seri(tmp_allocator);
     TCWLockGuard lock_guard(snap_data_->mem_data_rwlock_);
     ObString target_prefix;
     if (!get_snapshot_key_prefix().empty() && key_prefix.prefix_match(get_snapshot_key_prefix()) && !snap_data_->rb_flag_) {
       // skip deserialize, already been deserialized by other concurrent thread
-    } else if (OB_FAIL(index_seri.deserialize(snap_data_->index_, param, cb, tenant_id_))) {
+    } else if (OB_FAIL(index_seri.deserialize_snapshot(static_cast<void*>(this), snap_data_->index_, snapshot_tablet_id_,
+                                                       key_prefix, query_cond->row_iter_, tenant_id_))) {
       LOG_WARN("serialize index failed.", K(ret));
     } else if (OB_FALSE_IT(index_type = get_snap_index_type())) {
     } else if (OB_FAIL(ObPluginVectorIndexUtils::get_split_snapshot_prefix(index_type, key_prefix, target_prefix))) {
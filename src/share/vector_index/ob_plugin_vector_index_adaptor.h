@@ -355,7 +355,8 @@ public:
       rel_map_ptr_(nullptr),
       ob_sparse_drop_ratio_search_(0),
       n_candidate_(0),
-      distance_threshold_(FLT_MAX) {}
+      distance_threshold_(FLT_MAX),
+      query_count_(1) {}
   ~ObVectorQueryConditions() { query_vector_.reset(); }
   bool is_inited() { return query_vector_.length() > 0 && ef_search_ > 0; }
   void reset() {
@@ -365,8 +366,10 @@ public:
     is_post_with_filter_ = false;
     ob_sparse_drop_ratio_search_ = 0;
     n_candidate_ = 0;
+    query_count_ = 1;
   }
-  TO_STRING_KV(K_(query_limit), K_(query_order), K_(ef_search), K_(query_vector), K_(query_scn), K_(ob_sparse_drop_ratio_search), K_(n_candidate));
+  TO_STRING_KV(K_(query_limit), K_(query_order), K_(ef_search), K_(query_vector), K_(query_scn), K_(ob_sparse_drop_ratio_search), K_(n_candidate),
+               K_(query_count));
 
   uint32_t query_limit_;
   bool query_order_; // true: asc, false: desc
@@ -384,6 +387,7 @@ public:
   float ob_sparse_drop_ratio_search_;
   int64_t n_candidate_;
   float distance_threshold_;
+  int64_t query_count_; // number of dense vectors laid out contiguously in query_vector_
 };
 
 struct ObVidBound {
@@ -868,6 +872,19 @@ private:
                       ObVectorQueryConditions *query_cond,
                       int64_t dim, float *query_vector,
                       ObVectorQueryVidIterator *&vids_iter);
+  // search query_count dense vectors laid out contiguously in query_vectors with the same
+  // bitmap filter, vids_iters[i] receives the merged delta and snap result of the i-th query
+  int vsag_batch_query_vids(ObVectorQueryAdaptorResultContext *ctx,
+                            ObVectorQueryConditions *query_cond,
+                            int64_t dim, float *query_vectors,
+                            int64_t query_count,
+                            ObVectorQueryVidIterator **vids_iters);
+  // search every vector of a multi vector query in one batch and keep the query_limit_
+  // nearest distinct vids, each with its smallest distance over all query vectors
+  int vsag_multi_query_vids(ObVectorQueryAdaptorResultContext *ctx,
+                            ObVectorQueryConditions *query_cond,
+                            int64_t dim, float *query_vectors,
+                            ObVectorQueryVidIterator *&vids_iter);
   int get_current_scn(share::SCN &current_scn);
 
   int init_sparse_vector_type();
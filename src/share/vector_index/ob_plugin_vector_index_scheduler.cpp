@@ -18,6 +18,7 @@
 #include "share/vector_index/ob_plugin_vector_index_service.h"
 #include "share/vector_index/ob_plugin_vector_index_utils.h"
 #include "share/vector_index/ob_vector_index_util.h"
+#include "share/vector_index/ob_vector_index_snapshot_image.h"
 #include "share/scheduler/ob_dag_warning_history_mgr.h"
 #include "share/schema/ob_table_dml_param.h"
 #include "storage/ob_value_row_iterator.h"
@@ -119,6 +120,9 @@ void ObPluginVectorIndexLoadScheduler::clean_deprecated_adapters()
           } else if (OB_FAIL(delete_tablet_id_array.push_back(adapter->get_embedded_tablet_id()))) {
             LOG_WARN("push back table id failed",
               K(delete_tablet_id_array.count()), K(adapter->get_embedded_tablet_id()), KR(ret));
+          } else {
+            // index dropped, its local snapshot image will never be loaded again
+            ObVecIdxSnapImageUtil::remove_image(tenant_id_, adapter->get_snap_tablet_id());
           }
         } else if (OB_FAIL(ls_->get_tablet_svr()->get_tablet(tablet_id, tablet_handle))) {
           if (OB_TABLET_NOT_EXIST != ret) {
@@ -128,6 +132,9 @@ void ObPluginVectorIndexLoadScheduler::clean_deprecated_adapters()
             if (OB_FAIL(delete_tablet_id_array.push_back(tablet_id))) {
               LOG_WARN("push back table id failed",
                 K(delete_tablet_id_array.count()), K(adapter->get_inc_tablet_id()), KR(ret));
+            } else if (tablet_id == adapter->get_snap_tablet_id()) {
+              // snapshot tablet dropped or moved away from this server
+              ObVecIdxSnapImageUtil::remove_image(tenant_id_, tablet_id);
             }
           }
         }
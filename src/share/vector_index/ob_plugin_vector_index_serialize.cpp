@@ -19,6 +19,7 @@
 #include "share/vector_index/ob_vector_index_util.h"
 #include "storage/access/ob_table_scan_iterator.h"
 #include "share/vector_index/ob_plugin_vector_index_adaptor.h"
+#include "share/vector_index/ob_vector_index_snapshot_image.h"
 
 namespace oceanbase
 {
@@ -250,6 +251,71 @@ int ObVectorIndexSerializer::deserialize(void *&index, ObIStreamBuf::CbParam &cb
   return ret;
 }
 
+int ObVectorIndexSerializer::deserialize_snapshot(void *adp, void *&index, const ObTabletID &snap_tablet_id,
+                                                  const ObString &key, ObNewRowIterator *iter, uint64_t tenant_id)
+{
+  int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
+  bool loaded = false;
+  const bool enable_image = ObVecIdxSnapImageUtil::is_enabled();
+  if (OB_ISNULL(adp) || OB_ISNULL(iter)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(adp), KP(iter));
+  } else if (enable_image && OB_FAIL(load_snapshot_image(adp, index, snap_tablet_id, key, tenant_id, loaded))) {
+    LOG_WARN("failed to load snapshot image", K(ret), K(snap_tablet_id), K(key));
+  } else if (!loaded) {
+    ObHNSWDeserializeCallback::CbParam param(iter, &allocator_);
+    ObHNSWDeserializeCallback callback(adp);
+    ObVecIdxSnapImageWriter image_writer;
+    if (!enable_image) {
+    } else if (OB_TMP_FAIL(image_writer.open(tenant_id, snap_tablet_id, key))) {
+      LOG_WARN("failed to open snapshot image, skip saving it", K(tmp_ret), K(snap_tablet_id), K(key));
+    } else {
+      callback.set_image_writer(&image_writer);
+    }
+    ObIStreamBuf::Callback cb = callback;
+    if (OB_FAIL(deserialize(index, param, cb, tenant_id))) {
+      LOG_WARN("failed to deserialize snapshot table", K(ret));
+    } else if (image_writer.is_opened() && OB_TMP_FAIL(image_writer.finish())) {
+      LOG_WARN("failed to save snapshot image", K(tmp_ret), K(snap_tablet_id), K(key));
+    }
+  }
+  return ret;
+}
+
+int ObVectorIndexSerializer::load_snapshot_image(void *adp, void *&index, const ObTabletID &snap_tablet_id,
+                                                 const ObString &key, uint64_t tenant_id, bool &loaded)
+{
+  int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
+  ObVecIdxSnapImageReader reader;
+  ObVecIdxSnapImageReadCallback::CbParam param(&reader);
+  ObVecIdxSnapImageReadCallback callback;
+  ObHNSWDeserializeCallback index_callback(adp);
+  const int64_t start_ts = ObTimeUtility::current_time();
+  loaded = false;
+  if (OB_TMP_FAIL(reader.open(tenant_id, snap_tablet_id, key))) {
+    if (OB_ENTRY_NOT_EXIST != tmp_ret) {
+      LOG_WARN("invalid snapshot image, load from snapshot table", K(tmp_ret), K(snap_tablet_id), K(key));
+      ObVecIdxSnapImageUtil::remove_image(tenant_id, snap_tablet_id);
+    }
+  } else if (OB_FAIL(index_callback.init_snap_data_by_key(key))) {
+    LOG_WARN("failed to init snap data by key", K(ret), K(key));
+  } else {
+    ObIStreamBuf::Callback cb = callback;
+    if (OB_TMP_FAIL(deserialize(index, param, cb, tenant_id))) {
+      // the index is only replaced by a successful deserialize, retry with the snapshot table
+      LOG_WARN("failed to deserialize snapshot image, load from snapshot table", K(tmp_ret), K(snap_tablet_id), K(key));
+      ObVecIdxSnapImageUtil::remove_image(tenant_id, snap_tablet_id);
+    } else {
+      loaded = true;
+      LOG_INFO("load vector index snapshot from local image", K(snap_tablet_id), K(key),
+               "cost_us", ObTimeUtility::current_time() - start_ts);
+    }
+  }
+  return ret;
+}
+
 int ObHNSWDeserializeCallback::operator()(char*& data, const int64_t data_size, int64_t &read_size, share::ObIStreamBuf::CbParam &cb_param)
 {
   UNUSED(data_size);
@@ -311,52 +377,16 @@ int ObHNSWDeserializeCallback::operator()(char*& data, const int64_t data_size,
             LOG_WARN("fail to new ObTextStringIter", KR(ret));
           } else if (OB_FAIL(str_iter->init(0, NULL, allocator))) {
             LOG_WARN("init lob str iter failed ", K(ret));
-          } else if (index_type_ == VIAT_MAX) {
-            ObPluginVectorIndexAdaptor *adp = static_cast<ObPluginVectorIndexAdaptor*>(adp_);
-            ObCollationType calc_cs_type = CS_TYPE_UTF8MB4_GENERAL_CI;
-            uint32_t idx_ipivf = ObCharset::locate(calc_cs_type, key_datum.get_string().ptr(), key_datum.get_string().length(),
-                                       "ipivf", 5, 1);
-            uint32_t idx_sq = ObCharset::locate(calc_cs_type, key_datum.get_string().ptr(), key_datum.get_string().length(),
-                                       "hnsw_sq", 7, 1);
-            uint32_t idx_bq = ObCharset::locate(calc_cs_type, key_datum.get_string().ptr(), key_datum.get_string().length(),
-                                       "hnsw_bq", 7, 1);
-            uint32_t hgraph_idx = ObCharset::locate(calc_cs_type, key_datum.get_string().ptr(), key_datum.get_string().length(),
-                                       "hgraph", 6, 1);
-            if (OB_ISNULL(adp)) {
-              ret = OB_ERR_UNEXPECTED;
-              LOG_WARN("get invalid adp", K(ret));
-            } else if (idx_ipivf > 0) {
-              index_type_ = VIAT_IPIVF;
-              if (OB_FAIL(adp->try_init_snap_data(VIAT_IPIVF))) {
-                LOG_WARN("failed to init sparse vector snap data", K(ret), K(index_type_));
-              }
-            } else if (idx_sq > 0) {
-              index_type_ = VIAT_HNSW_SQ;
-              if (OB_FAIL(adp->try_init_snap_data(VIAT_HNSW_SQ))) {
-                LOG_WARN("failed to init snap data", K(ret), K(index_type_));
-              }
-            } else if (idx_bq > 0) {
-              index_type_ = VIAT_HNSW_BQ;
-              if (OB_FAIL(adp->try_init_snap_data(VIAT_HNSW_BQ))) {
-                LOG_WARN("failed to init snap data", K(ret), K(index_type_));
-              }
-            } else if (hgraph_idx > 0) {
-              index_type_ = VIAT_HGRAPH;
-              if (OB_FAIL(adp->try_init_snap_data(VIAT_HGRAPH))) {
-                LOG_WARN("failed to init snap data", K(ret), K(index_type_));
-              }
-            } else {
-              index_type_ = VIAT_HNSW;
-              if (OB_FAIL(adp->try_init_snap_data(VIAT_HNSW))) {
-                LOG_WARN("failed to init snap data", K(ret), K(index_type_));
-              }
-            }
-            LOG_INFO("HgraphIndex vector index get key data from snap_index_table", K(ret), K(index_type_), K(key_datum.get_string()));
+          } else if (index_type_ == VIAT_MAX && OB_FAIL(init_snap_data_by_key(key_datum.get_string()))) {
+            LOG_WARN("failed to init snap data by key", K(ret), K(key_datum));
           }
         }
       }
     } while (OB_SUCC(ret) && OB_ISNULL(data));
 
+    if (OB_SUCC(ret) && OB_NOT_NULL(image_writer_)) {
+      image_writer_->append(data, read_size);
+    }
     if (ret == OB_ITER_END) {
       ret = OB_SUCCESS;
       ObPluginVectorIndexAdaptor *adp_ptr = static_cast<ObPluginVectorIndexAdaptor*>(adp_);
@@ -377,6 +407,52 @@ int ObHNSWDeserializeCallback::operator()(char*& data, const int64_t data_size,
   return ret;
 }
 
+int ObHNSWDeserializeCallback::init_snap_data_by_key(const ObString &key)
+{
+  int ret = OB_SUCCESS;
+  ObPluginVectorIndexAdaptor *adp = static_cast<ObPluginVectorIndexAdaptor*>(adp_);
+  ObCollationType calc_cs_type = CS_TYPE_UTF8MB4_GENERAL_CI;
+  uint32_t idx_ipivf = ObCharset::locate(calc_cs_type, key.ptr(), key.length(),
+                             "ipivf", 5, 1);
+  uint32_t idx_sq = ObCharset::locate(calc_cs_type, key.ptr(), key.length(),
+                             "hnsw_sq", 7, 1);
+  uint32_t idx_bq = ObCharset::locate(calc_cs_type, key.ptr(), key.length(),
+                             "hnsw_bq", 7, 1);
+  uint32_t hgraph_idx = ObCharset::locate(calc_cs_type, key.ptr(), key.length(),
+                             "hgraph", 6, 1);
+  if (OB_ISNULL(adp)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get invalid adp", K(ret));
+  } else if (idx_ipivf > 0) {
+    index_type_ = VIAT_IPIVF;
+    if (OB_FAIL(adp->try_init_snap_data(VIAT_IPIVF))) {
+      LOG_WARN("failed to init sparse vector snap data", K(ret), K(index_type_));
+    }
+  } else if (idx_sq > 0) {
+    index_type_ = VIAT_HNSW_SQ;
+    if (OB_FAIL(adp->try_init_snap_data(VIAT_HNSW_SQ))) {
+      LOG_WARN("failed to init snap data", K(ret), K(index_type_));
+    }
+  } else if (idx_bq > 0) {
+    index_type_ = VIAT_HNSW_BQ;
+    if (OB_FAIL(adp->try_init_snap_data(VIAT_HNSW_BQ))) {
+      LOG_WARN("failed to init snap data", K(ret), K(index_type_));
+    }
+  } else if (hgraph_idx > 0) {
+    index_type_ = VIAT_HGRAPH;
+    if (OB_FAIL(adp->try_init_snap_data(VIAT_HGRAPH))) {
+      LOG_WARN("failed to init snap data", K(ret), K(index_type_));
+    }
+  } else {
+    index_type_ = VIAT_HNSW;
+    if (OB_FAIL(adp->try_init_snap_data(VIAT_HNSW))) {
+      LOG_WARN("failed to init snap data", K(ret), K(index_type_));
+    }
+  }
+  LOG_INFO("HgraphIndex vector index get key data from snap_index_table", K(ret), K(index_type_), K(key));
+  return ret;
+}
+
 int ObHNSWSerializeCallback::operator()(const char *data, const int64_t data_size, share::ObOStreamBuf::CbParam &cb_param)
 {
   int ret = OB_SUCCESS;
@@ -19,6 +19,7 @@
 #include "lib/function/ob_function.h"
 #include "lib/allocator/page_arena.h"
 #include "common/row/ob_row_iterator.h"
+#include "common/ob_tablet_id.h"
 #include "share/ob_lob_access_utils.h"
 #include "share/vector_index/ob_plugin_vector_index_util.h"
 #include "ob_vector_index_util.h"
@@ -27,7 +28,7 @@ namespace oceanbase
 {
 namespace share
 {
-
+class ObVecIdxSnapImageWriter;
 
 class ObStreamBuf : public std::streambuf
 {
@@ -146,13 +147,18 @@ public:
     ObTextStringIter *str_iter_;
   };
 public:
-  ObHNSWDeserializeCallback(void *adp) : index_type_(VIAT_MAX), adp_(adp)
+  ObHNSWDeserializeCallback(void *adp) : index_type_(VIAT_MAX), adp_(adp), image_writer_(nullptr)
   {}
   ObVectorIndexAlgorithmType get_serialize_index_type() { return index_type_; }
+  // every piece handed to vsag is also appended to the image writer
+  void set_image_writer(ObVecIdxSnapImageWriter *image_writer) { image_writer_ = image_writer; }
+  // create the snapshot index of the type named by the snapshot key
+  int init_snap_data_by_key(const ObString &key);
   int operator()(char *&data, const int64_t data_size, int64_t &read_size, share::ObIStreamBuf::CbParam &cb_param);
 private:
   ObVectorIndexAlgorithmType index_type_;
   void *adp_;
+  ObVecIdxSnapImageWriter *image_writer_;
 };
 
 class ObHNSWSerializeCallback {
@@ -194,6 +200,13 @@ public:
   
   int serialize(void *index, ObOStreamBuf::CbParam &cb_param, ObOStreamBuf::Callback &cb, uint64_t tenant_id, const int64_t capacity = DEFAULT_OUTBUF_CAPACITY);
   int deserialize(void *&index, ObIStreamBuf::CbParam &cb_param, ObIStreamBuf::Callback &cb, uint64_t tenant_id);
+  // load the snapshot index of adaptor `adp` whose first snapshot row key is `key`, from the local
+  // snapshot image if there is a valid one, otherwise from the snapshot table rows of `iter`
+  int deserialize_snapshot(void *adp, void *&index, const ObTabletID &snap_tablet_id, const ObString &key,
+                           ObNewRowIterator *iter, uint64_t tenant_id);
+private:
+  int load_snapshot_image(void *adp, void *&index, const ObTabletID &snap_tablet_id, const ObString &key,
+                          uint64_t tenant_id, bool &loaded);
 private:
   static const int64_t DEFAULT_OUTBUF_CAPACITY = 2LL * 1024LL * 1024LL; // 2MB
 
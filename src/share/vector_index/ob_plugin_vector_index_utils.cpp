@@ -797,12 +797,6 @@ int ObPluginVectorIndexUtils::try_sync_snapshot_memdata(ObLSID &ls_id,
       } else {
   
         ObArenaAllocator tmp_allocator("VectorAdaptor", OB_MALLOC_NORMAL_BLOCK_SIZE, MTL_ID());
-        ObHNSWDeserializeCallback::CbParam param;
-        param.iter_ = snapshot_idx_iter;
-        param.allocator_ = &tmp_allocator;
-    
-        ObHNSWDeserializeCallback callback(static_cast<void*>(new_adapter));
-        ObIStreamBuf::Callback cb = callback;
         // ToDo: concurrency with weakread
         ObVectorIndexSerializer index_seri(tmp_allocator);
         ObVectorIndexMemData *snap_memdata = new_adapter->get_snap_data_();
@@ -815,7 +809,9 @@ int ObPluginVectorIndexUtils::try_sync_snapshot_memdata(ObLSID &ls_id,
           LOG_WARN("snap memdata is null", K(ret));
         } else {
           TCWLockGuard lock_guard(snap_memdata->mem_data_rwlock_);
-          if (OB_FAIL(index_seri.deserialize(snap_memdata->index_, param, cb, MTL_ID()))) {
+          if (OB_FAIL(index_seri.deserialize_snapshot(static_cast<void*>(new_adapter), snap_memdata->index_,
+                                                      new_adapter->get_snap_tablet_id(), key_prefix,
+                                                      snapshot_idx_iter, MTL_ID()))) {
             LOG_WARN("serialize index failed.", K(ret));
           } else if (OB_FALSE_IT(index_type = new_adapter->get_snap_index_type())) {
           } else if (OB_FAIL(get_split_snapshot_prefix(index_type, key_prefix, target_prefix))) {
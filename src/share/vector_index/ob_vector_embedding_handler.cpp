@@ -40,6 +40,7 @@ using namespace oceanbase::json;
   do { \
     LOG_WARN(error_msg, K(ret), K(*task)); \
     task->set_stop(); \
+    task->release_endpoint_slots(); \
     if (OB_NOT_NULL(thread_pool)) { \
       thread_pool->remove_task_from_tracking(task); \
       thread_pool->dec_task_ref(); \
@@ -50,6 +51,7 @@ using namespace oceanbase::json;
 #define HANDLE_TASK_COMPLETION_AND_CLEANUP(task, thread_pool, log_msg) \
   do { \
     LOG_INFO(log_msg, K(*task)); \
+    task->release_endpoint_slots(); \
     if (OB_NOT_NULL(thread_pool)) { \
       thread_pool->remove_task_from_tracking(task); \
       thread_pool->dec_task_ref(); \
@@ -84,6 +86,10 @@ const int64_t ObEmbeddingTask::HTTP_RETRY_MULTIPLIER = 2;
 // Callback related constants
 const int64_t ObEmbeddingTask::CALLBACK_BATCH_SIZE = 64;
 
+// Batching and pipelining related constants
+const int64_t ObEmbeddingTask::MAX_BATCH_TEXT_BYTES = 256 * 1024; // 256KB of input text per request
+const int64_t ObEmbeddingTask::MAX_INFLIGHT_REQUESTS = 16;
+
 //=============================================== ObEmbeddingTaskPhaseManager ================================================
 // Phase transition validation - strict state machine
 // Each array contains valid transitions FROM that phase
@@ -173,15 +179,19 @@ ObEmbeddingTask::ObEmbeddingTask() : local_allocator_("EmbeddingTask", OB_MALLOC
                                     internal_error_message_(),
                                     task_lock_(),
                                     batch_size_(10),
-                                    current_batch_idx_(),
+                                    http_timeout_us_(0),
                                     http_send_time_us_(0),
-                                    http_response_data_size_(0),
-                                    http_response_data_(nullptr),
+                                    unique_chunks_(),
+                                    chunk_unique_idx_(),
+                                    unique_vectors_(),
+                                    next_unique_idx_(0),
+                                    unique_ready_cnt_(0),
                                     curl_multi_handle_(nullptr),
-                                    curl_easy_handle_(nullptr),
-                                    curl_request_in_progress_(false),
-                                    curl_response_data_(nullptr),
+                                    model_url_cstr_(nullptr),
                                     curl_headers_(nullptr),
+                                    requests_(),
+                                    max_inflight_requests_(1),
+                                    endpoint_limiter_(nullptr),
                                     http_retry_count_(0),
                                     http_total_retry_count_(0),
                                     http_retry_start_time_us_(0),
@@ -189,8 +199,6 @@ ObEmbeddingTask::ObEmbeddingTask() : local_allocator_("EmbeddingTask", OB_MALLOC
                                     need_retry_flag_(false),
                                     original_batch_size_(batch_size_),
                                     batch_size_adjusted_(false),
-                                    current_batch_size_(10),
-                                    successful_requests_count_(0),
                                     task_cond_(),
                                     callback_done_(false) {}
 ObEmbeddingTask::ObEmbeddingTask(ObArenaAllocator &allocator) : local_allocator_(), allocator_(allocator),
@@ -219,15 +227,19 @@ ObEmbeddingTask::ObEmbeddingTask(ObArenaAllocator &allocator) : local_allocator_
                                      internal_error_message_(),
                                      task_lock_(),
                                      batch_size_(10),
-                                     current_batch_idx_(),
+                                     http_timeout_us_(0),
                                      http_send_time_us_(0),
-                                     http_response_data_size_(0),
-                                     http_response_data_(nullptr),
+                                     unique_chunks_(),
+                                     chunk_unique_idx_(),
+                                     unique_vectors_(),
+                                     next_unique_idx_(0),
+                                     unique_ready_cnt_(0),
                                      curl_multi_handle_(nullptr),
-                                     curl_easy_handle_(nullptr),
-                                     curl_request_in_progress_(false),
-                                     curl_response_data_(nullptr),
+                                     model_url_cstr_(nullptr),
                                      curl_headers_(nullptr),
+                                     requests_(),
+                                     max_inflight_requests_(1),
+                                     endpoint_limiter_(nullptr),
                                      http_retry_count_(0),
                                      http_total_retry_count_(0),
                                      http_retry_start_time_us_(0),
@@ -235,8 +247,6 @@ ObEmbeddingTask::ObEmbeddingTask(ObArenaAllocator &allocator) : local_allocator_
                                      need_retry_flag_(false),
                                      original_batch_size_(batch_size_),
                                      batch_size_adjusted_(false),
-                                     current_batch_size_(10),
-                                     successful_requests_count_(0),
                                      task_cond_(),
                                      callback_done_(false) {}
 ObEmbeddingTask::~ObEmbeddingTask() {
@@ -253,13 +263,20 @@ int ObEmbeddingTask::init(const ObString &model_url,
                           storage::ObEmbeddingIOCallbackHandle *cb_handle)
 {
   int ret = OB_SUCCESS;
+  const int64_t config_inflight_requests = GCONF._embedding_max_inflight_requests;
   if (is_inited_) {
     ret = OB_INIT_TWICE;
     LOG_WARN("ObEmbeddingTask already inited", K(ret), K(model_url), K(model_name), K(user_key), K(input_chunks));
   } else if (OB_FAIL(input_chunks_.assign(input_chunks))) {
     LOG_WARN("failed to assign input chunks", K(ret), K(input_chunks));
+  } else if (OB_FAIL(init_unique_chunks(input_chunks))) {
+    LOG_WARN("failed to init unique chunks", K(ret), K(input_chunks.count()));
   } else if (OB_FAIL(init_curl_handler(model_url, user_key))) {
     LOG_WARN("failed to init curl handler", K(ret), K(model_url), K(user_key));
+  } else if (FALSE_IT(max_inflight_requests_ = OB_MAX(1L, OB_MIN(OB_MIN(config_inflight_requests, MAX_INFLIGHT_REQUESTS),
+                                                                    unique_chunks_.count())))) {
+  } else if (OB_FAIL(init_request_slots())) {
+    LOG_WARN("failed to init request slots", K(ret), K_(max_inflight_requests));
   } else if (OB_FAIL(task_cond_.init(ObWaitEventIds::DEFAULT_COND_WAIT))) {
     LOG_WARN("failed to init completion cond", K(ret));
   } else {
@@ -281,7 +298,9 @@ int ObEmbeddingTask::init(const ObString &model_url,
     http_error_message_.reset();
     http_send_count_ = 0;
     http_send_time_us_ = 0;
-    http_response_data_size_ = 0;
+    next_unique_idx_ = 0;
+    requeued_ranges_.reset();
+    unique_ready_cnt_ = 0;
 
     cb_handle_ = cb_handle;
     if (nullptr != cb_handle_) {
@@ -301,24 +320,71 @@ int ObEmbeddingTask::init(const ObString &model_url,
     http_total_retry_count_ = 0;
     original_batch_size_ = batch_size_;
     batch_size_adjusted_ = false;
-    current_batch_size_ = batch_size_;
-    successful_requests_count_ = 0;
 
-    LOG_DEBUG("task initialized successfully", K(user_key_), K(task_id_), K(dimension_));
+    LOG_DEBUG("task initialized successfully", K(user_key_), K(task_id_), K(dimension_),
+              K(total_chunks_), K(unique_chunks_.count()), K_(max_inflight_requests));
   }
 
   return ret;
 }
 
-int ObEmbeddingTask::parse_embedding_response(const char *response_data, size_t response_size)
+// Identical texts of one task are sent only once, chunk_unique_idx_ maps every input chunk to
+// its text in unique_chunks_.
+int ObEmbeddingTask::init_unique_chunks(const ObIArray<ObString> &input_chunks)
+{
+  int ret = OB_SUCCESS;
+  hash::ObHashMap<ObString, int64_t> text_map;
+  const int64_t chunk_cnt = input_chunks.count();
+  if (0 == chunk_cnt) {
+    // nothing to embed
+  } else if (OB_FAIL(text_map.create(chunk_cnt, ObMemAttr(MTL_ID(), "EmbedTextMap")))) {
+    LOG_WARN("failed to create text map", K(ret), K(chunk_cnt));
+  } else if (OB_FAIL(chunk_unique_idx_.reserve(chunk_cnt))) {
+    LOG_WARN("failed to reserve chunk unique idx", K(ret), K(chunk_cnt));
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < chunk_cnt; ++i) {
+      const ObString &text = input_chunks.at(i);
+      int64_t unique_idx = unique_chunks_.count();
+      if (OB_FAIL(text_map.get_refactored(text, unique_idx))) {
+        if (OB_HASH_NOT_EXIST != ret) {
+          LOG_WARN("failed to get text from map", K(ret), K(i));
+        } else if (FALSE_IT(ret = OB_SUCCESS)) {
+        } else if (OB_FAIL(text_map.set_refactored(text, unique_idx))) {
+          LOG_WARN("failed to set text to map", K(ret), K(i));
+        } else if (OB_FAIL(unique_chunks_.push_back(text))) {
+          LOG_WARN("failed to push back unique chunk", K(ret), K(i));
+        }
+      }
+      if (OB_SUCC(ret) && OB_FAIL(chunk_unique_idx_.push_back(unique_idx))) {
+        LOG_WARN("failed to push back chunk unique idx", K(ret), K(i), K(unique_idx));
+      }
+    }
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(unique_vectors_.prepare_allocate(unique_chunks_.count()))) {
+      LOG_WARN("failed to prepare unique vectors", K(ret), K(unique_chunks_.count()));
+    } else {
+      for (int64_t i = 0; i < unique_vectors_.count(); ++i) {
+        unique_vectors_.at(i) = nullptr;
+      }
+      if (unique_chunks_.count() < chunk_cnt) {
+        LOG_DEBUG("duplicated texts are embedded once", K(chunk_cnt), K(unique_chunks_.count()));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObEmbeddingTask::parse_embedding_response(const char *response_data, size_t response_size,
+                                              const int64_t start_idx, const int64_t end_idx)
 {
   int ret = OB_SUCCESS;
   ObJsonReaderHelper json_reader(allocator_);
   ObJsonNode *root = nullptr;
 
-  if (OB_ISNULL(response_data) || response_size == 0) {
+  if (OB_ISNULL(response_data) || response_size == 0
+      || start_idx < 0 || start_idx >= end_idx || end_idx > unique_vectors_.count()) {
     ret = OB_INVALID_ARGUMENT;
-    LOG_WARN("invalid response data", K(ret), KP(response_data), K(response_size));
+    LOG_WARN("invalid response data", K(ret), KP(response_data), K(response_size), K(start_idx), K(end_idx));
   } else {
     if (OB_FAIL(json_reader.parse(response_data, response_size, root))) {
       LOG_WARN("failed to parse json response", K(ret), KP(response_data), K(response_size));
@@ -335,6 +401,10 @@ int ObEmbeddingTask::parse_embedding_response(const char *response_data, size_t
       } else if (!ObJsonHelper::is_array_type(data_array)) {
         ret = OB_INVALID_ARGUMENT;
         LOG_WARN("data field is not an array", K(ret), "data_type", ObJsonHelper::get_type_name(data_array));
+      } else if (json_reader.get_array_size(data_array) != end_idx - start_idx) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("embedding count mismatch with request", K(ret), K(start_idx), K(end_idx),
+                 "data_array_size", json_reader.get_array_size(data_array));
       } else {
         uint64_t data_array_size = json_reader.get_array_size(data_array);
         for (uint64_t data_idx = 0; data_idx < data_array_size && OB_SUCC(ret); data_idx++) {
@@ -360,9 +430,7 @@ int ObEmbeddingTask::parse_embedding_response(const char *response_data, size_t
               LOG_WARN("failed to decode float embedding array", K(ret));
             } else {
               // no need to lock here, only access by other thread when task is done
-              if (OB_FAIL(output_vectors_.push_back(vector))) {
-                LOG_WARN("failed to push back vector", K(ret));
-              }
+              unique_vectors_.at(start_idx + data_idx) = vector;
             }
           }
         }
@@ -373,6 +441,23 @@ int ObEmbeddingTask::parse_embedding_response(const char *response_data, size_t
   return ret;
 }
 
+// Appends the vectors of the input chunks in order, up to the first chunk whose text is not
+// embedded yet, so output_vectors_ is always a prefix of the result.
+int ObEmbeddingTask::fill_output_vectors()
+{
+  int ret = OB_SUCCESS;
+  bool meet_gap = false;
+  for (int64_t i = output_vectors_.count(); OB_SUCC(ret) && !meet_gap && i < chunk_unique_idx_.count(); ++i) {
+    float *vector = unique_vectors_.at(chunk_unique_idx_.at(i));
+    if (OB_ISNULL(vector)) {
+      meet_gap = true;
+    } else if (OB_FAIL(output_vectors_.push_back(vector))) {
+      LOG_WARN("failed to push back vector", K(ret), K(i));
+    }
+  }
+  return ret;
+}
+
 
 bool ObEmbeddingTask::is_finished() const
 {
@@ -381,6 +466,8 @@ bool ObEmbeddingTask::is_finished() const
 
 void ObEmbeddingTask::reset()
 {
+  // endpoint slots are released with model_url_, do it first
+  cleanup_async_http();
   is_inited_ = false;
   model_url_.reset();
   model_name_.reset();
@@ -394,10 +481,15 @@ void ObEmbeddingTask::reset()
   processed_chunks_ = 0;
   total_chunks_ = 0;
   task_id_ = OB_INVALID_ID;
-  current_batch_idx_ = 0;
   http_send_time_us_ = 0;
-  http_response_data_size_ = 0;
-  http_response_data_ = nullptr;
+  unique_chunks_.reset();
+  chunk_unique_idx_.reset();
+  unique_vectors_.reset();
+  next_unique_idx_ = 0;
+  requeued_ranges_.reset();
+  unique_ready_cnt_ = 0;
+  max_inflight_requests_ = 1;
+  endpoint_limiter_ = nullptr;
   if (nullptr != cb_handle_) {
     cb_handle_->release();
     cb_handle_ = nullptr;
@@ -411,7 +503,6 @@ void ObEmbeddingTask::reset()
   original_batch_size_ = 10;
   batch_size_adjusted_ = false;
 
-  cleanup_async_http();
   local_allocator_.reset();
   task_cond_.destroy();
 }
@@ -482,8 +573,8 @@ int ObEmbeddingTask::start_async_work()
     if (current_phase == OB_EMBEDDING_TASK_INIT || current_phase == OB_EMBEDDING_TASK_PARSED) {
       if (current_phase == OB_EMBEDDING_TASK_INIT) {
         // 记录开始时间
-        {
-          ObThreadCondGuard guard(task_cond_);
+        ObThreadCondGuard guard(task_cond_);
+        if (0 == process_start_time_us_) {
           process_start_time_us_ = ObTimeUtility::current_time();
         }
       }
@@ -492,73 +583,272 @@ int ObEmbeddingTask::start_async_work()
       LOG_WARN("task already started or not ready for next batch", K(ret), K(*this));
     }
 
-    int64_t start_idx = current_batch_idx_ * batch_size_;
-    int64_t end_idx = OB_MIN(start_idx + batch_size_, input_chunks_.count());
     if (OB_FAIL(ret)) {
-    } else if (start_idx >= input_chunks_.count()
-              && OB_FAIL(complete_task(OB_EMBEDDING_TASK_DONE, OB_SUCCESS, true))) {
-      LOG_WARN("failed to complete task successfully", K(ret));
+    } else if (unique_ready_cnt_ >= unique_chunks_.count() && !has_pending_request()) {
+      if (OB_FAIL(complete_task(OB_EMBEDDING_TASK_DONE, OB_SUCCESS, true))) {
+        LOG_WARN("failed to complete task successfully", K(ret));
+      }
+    } else if (OB_FAIL(dispatch_requests())) {
+      LOG_WARN("failed to dispatch http requests", K(ret), K(*this));
+      if (OB_FAIL(complete_task(OB_EMBEDDING_TASK_DONE, ret, true))) {
+        LOG_WARN("failed to handle task failure", K(ret));
+      }
+    } else if (OB_FAIL(set_phase(OB_EMBEDDING_TASK_HTTP_SENT))) {
+      LOG_WARN("failed to set phase to HTTP_SENT", K(ret), K(*this));
     } else {
-      // TODO: Depending on the model type, different HTTP requests need to be generated
-      ObJsonBuilder json_builder(allocator_);
-      Value *root = nullptr;
-      Value *input_array = nullptr;
-      if (OB_FAIL(json_builder.create_object(root))) {
-        LOG_WARN("failed to create json object", K(ret));
-      } else if (OB_FAIL(json_builder.add_array_field(root, INPUT_NAME, input_array))) {
-        LOG_WARN("failed to add input array field", K(ret));
+      LOG_DEBUG("HTTP requests dispatched", "inflight_cnt", get_inflight_request_count(), K(*this));
+    }
+  }
+  return ret;
+}
+
+// Fills the request slots: requests whose retry backoff is over are sent again, idle slots
+// take the next batch of unique chunks. A task always keeps one request in flight, the others
+// need a slot of the endpoint limiter so that concurrent tasks do not flood the same endpoint.
+int ObEmbeddingTask::dispatch_requests()
+{
+  int ret = OB_SUCCESS;
+  const int64_t current_time = ObTimeUtility::current_time();
+  const int64_t endpoint_limit = GCONF._embedding_max_inflight_requests;
+  bool endpoint_busy = false;
+  for (int64_t i = 0; OB_SUCC(ret) && !endpoint_busy && i < requests_.count(); ++i) {
+    HttpRequest *request = requests_.at(i);
+    bool need_send = false;
+    bool is_requeued = false;
+    int64_t start_idx = 0;
+    int64_t end_idx = 0;
+    if (OB_ISNULL(request)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected null request", K(ret), K(i));
+    } else if (request->need_retry_) {
+      if (request->retry_time_us_ <= current_time) {
+        need_send = true;
+        start_idx = request->start_idx_;
+        end_idx = request->end_idx_;
+      }
+    } else if (request->is_idle() && !requeued_ranges_.empty()) {
+      // rest of a shrunk retry batch, split again if batch_size_ went down further
+      std::pair<int64_t, int64_t> &range = requeued_ranges_.at(requeued_ranges_.count() - 1);
+      need_send = true;
+      is_requeued = true;
+      start_idx = range.first;
+      end_idx = OB_MIN(get_batch_end_idx(start_idx), range.second);
+    } else if (request->is_idle() && next_unique_idx_ < unique_chunks_.count()) {
+      need_send = true;
+      start_idx = next_unique_idx_;
+      end_idx = get_batch_end_idx(start_idx);
+    }
+
+    if (OB_FAIL(ret) || !need_send) {
+    } else if (OB_NOT_NULL(endpoint_limiter_)) {
+      if (0 == get_inflight_request_count()) {
+        endpoint_limiter_->acquire(model_url_);
+        request->hold_endpoint_slot_ = true;
+      } else if (endpoint_limiter_->try_acquire(model_url_, endpoint_limit)) {
+        request->hold_endpoint_slot_ = true;
       } else {
-        for (int64_t i = start_idx; i < end_idx && OB_SUCC(ret); i++) {
-          const ObString &text = input_chunks_.at(i);
-          LOG_DEBUG("Adding text to input array", K(i), K(text));
-          if (OB_FAIL(json_builder.array_add_string(input_array, text))) {
-            LOG_WARN("failed to add text to input array", K(ret), K(i));
-          }
-        }
-        if (OB_FAIL(ret)) {
-        } else if (OB_FAIL(json_builder.add_string_field(root, MODEL_NAME_NAME, model_name_))) {
-          LOG_WARN("failed to add model field", K(ret));
-        } else if (use_base64_format_ && OB_FAIL(json_builder.add_string_field(root, ENCODING_FORMAT_NAME, BASE64_FORMAT))) {
-          LOG_WARN("failed to add encoding format field", K(ret));
-        } else if (!use_base64_format_ && OB_FAIL(json_builder.add_string_field(root, ENCODING_FORMAT_NAME, FLOAT_FORMAT))) {
-          LOG_WARN("failed to add encoding format field", K(ret));
-        } else if (dimension_ > 0 && OB_FAIL(json_builder.add_int_field(root, DIMENSIONS_NAME, dimension_))) {
-          LOG_WARN("failed to add dimensions field", K(ret));
-        } else {
-          const int64_t json_buf_len = 8192;
-          char *json_buf = (char*)allocator_.alloc(json_buf_len);
-          if (OB_ISNULL(json_buf)) {
-            ret = OB_ALLOCATE_MEMORY_FAILED;
-            LOG_WARN("failed to alloc json buffer", K(ret));
-          } else {
-            int64_t json_len = 0;
-            if (OB_FAIL(json_builder.to_string(root, json_buf, json_buf_len, json_len))) {
-              LOG_WARN("failed to convert json to string", K(ret));
-            } else {
-              if (OB_FAIL(send_http_request_async(json_buf, json_len))) {
-                if (OB_FAIL(complete_task(OB_EMBEDDING_TASK_DONE, ret, true))) {
-                  LOG_WARN("failed to handle task failure", K(ret));
-                }
-              } else {
-                LOG_DEBUG("HTTP request sent successfully for batch", K(current_batch_idx_),
-                                                                    K(start_idx),
-                                                                    K(end_idx),
-                                                                    K(*this));
-              }
-            }
-          }
-        }
+        endpoint_busy = true;
       }
     }
+
+    if (OB_FAIL(ret) || !need_send || endpoint_busy) {
+    } else if (OB_FAIL(send_batch_request(i, start_idx, end_idx))) {
+      LOG_WARN("failed to send batch request", K(ret), K(i), K(start_idx), K(end_idx));
+    } else if (is_requeued) {
+      std::pair<int64_t, int64_t> &range = requeued_ranges_.at(requeued_ranges_.count() - 1);
+      if (end_idx < range.second) {
+        range.first = end_idx;
+      } else {
+        requeued_ranges_.pop_back();
+      }
+    } else if (end_idx > next_unique_idx_) {
+      next_unique_idx_ = end_idx;
+    }
   }
   return ret;
 }
 
+int ObEmbeddingTask::send_batch_request(const int64_t slot_idx, const int64_t start_idx, const int64_t end_idx)
+{
+  int ret = OB_SUCCESS;
+  HttpRequest *request = nullptr;
+  char *json_buf = nullptr;
+  int64_t json_len = 0;
+  if (OB_UNLIKELY(slot_idx < 0 || slot_idx >= requests_.count())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid slot idx", K(ret), K(slot_idx), K(requests_.count()));
+  } else if (OB_ISNULL(request = requests_.at(slot_idx)) || OB_ISNULL(request->easy_handle_)
+             || OB_ISNULL(curl_multi_handle_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected null curl handles", K(ret), KP(request), KP(curl_multi_handle_));
+  } else if (OB_FAIL(build_request_json(start_idx, end_idx, json_buf, json_len))) {
+    LOG_WARN("failed to build request json", K(ret), K(start_idx), K(end_idx));
+  } else {
+    curl_multi_remove_handle(curl_multi_handle_, request->easy_handle_);
+    request->response_.reset();
+    curl_easy_setopt(request->easy_handle_, CURLOPT_POSTFIELDS, json_buf);
+    curl_easy_setopt(request->easy_handle_, CURLOPT_POSTFIELDSIZE, json_len);
+    CURLMcode multi_res = curl_multi_add_handle(curl_multi_handle_, request->easy_handle_);
+    if (multi_res != CURLM_OK) {
+      ret = OB_CURL_ERROR;
+      LOG_WARN("curl_multi_add_handle failed", K(ret), K(multi_res));
+    } else {
+      request->start_idx_ = start_idx;
+      request->end_idx_ = end_idx;
+      request->send_time_us_ = ObTimeUtility::current_time();
+      request->retry_time_us_ = 0;
+      request->in_progress_ = true;
+      request->is_ready_ = false;
+      request->need_retry_ = false;
+      http_send_time_us_ = request->send_time_us_;
+      LOG_DEBUG("HTTP request sent successfully for batch", K(slot_idx), K(start_idx), K(end_idx), K(json_len));
+    }
+  }
+  return ret;
+}
+
+int ObEmbeddingTask::build_request_json(const int64_t start_idx, const int64_t end_idx,
+                                        char *&json_buf, int64_t &json_len)
+{
+  int ret = OB_SUCCESS;
+  // TODO: Depending on the model type, different HTTP requests need to be generated
+  ObJsonBuilder json_builder(allocator_);
+  Value *root = nullptr;
+  Value *input_array = nullptr;
+  int64_t text_bytes = 0;
+  json_buf = nullptr;
+  json_len = 0;
+  if (OB_UNLIKELY(start_idx < 0 || start_idx >= end_idx || end_idx > unique_chunks_.count())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid batch range", K(ret), K(start_idx), K(end_idx), K(unique_chunks_.count()));
+  } else if (OB_FAIL(json_builder.create_object(root))) {
+    LOG_WARN("failed to create json object", K(ret));
+  } else if (OB_FAIL(json_builder.add_array_field(root, INPUT_NAME, input_array))) {
+    LOG_WARN("failed to add input array field", K(ret));
+  } else {
+    for (int64_t i = start_idx; i < end_idx && OB_SUCC(ret); i++) {
+      const ObString &text = unique_chunks_.at(i);
+      LOG_DEBUG("Adding text to input array", K(i), K(text));
+      if (OB_FAIL(json_builder.array_add_string(input_array, text))) {
+        LOG_WARN("failed to add text to input array", K(ret), K(i));
+      } else {
+        text_bytes += text.length();
+      }
+    }
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(json_builder.add_string_field(root, MODEL_NAME_NAME, model_name_))) {
+      LOG_WARN("failed to add model field", K(ret));
+    } else if (use_base64_format_ && OB_FAIL(json_builder.add_string_field(root, ENCODING_FORMAT_NAME, BASE64_FORMAT))) {
+      LOG_WARN("failed to add encoding format field", K(ret));
+    } else if (!use_base64_format_ && OB_FAIL(json_builder.add_string_field(root, ENCODING_FORMAT_NAME, FLOAT_FORMAT))) {
+      LOG_WARN("failed to add encoding format field", K(ret));
+    } else if (dimension_ > 0 && OB_FAIL(json_builder.add_int_field(root, DIMENSIONS_NAME, dimension_))) {
+      LOG_WARN("failed to add dimensions field", K(ret));
+    } else {
+      // an escaped text byte takes at most 6 bytes ("\u00XX"), the rest of the body is small
+      const int64_t json_buf_len = 8192 + model_name_.length() + 6 * text_bytes;
+      if (OB_ISNULL(json_buf = static_cast<char *>(allocator_.alloc(json_buf_len)))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("failed to alloc json buffer", K(ret), K(json_buf_len));
+      } else if (OB_FAIL(json_builder.to_string(root, json_buf, json_buf_len, json_len))) {
+        LOG_WARN("failed to convert json to string", K(ret));
+      }
+    }
+  }
+  return ret;
+}
+
+// A batch holds at most batch_size_ texts and MAX_BATCH_TEXT_BYTES of text, but at least one text.
+int64_t ObEmbeddingTask::get_batch_end_idx(const int64_t start_idx) const
+{
+  const int64_t max_end_idx = OB_MIN(start_idx + static_cast<int64_t>(batch_size_), unique_chunks_.count());
+  int64_t end_idx = start_idx;
+  int64_t batch_bytes = 0;
+  while (end_idx < max_end_idx
+         && (end_idx == start_idx || batch_bytes + unique_chunks_.at(end_idx).length() <= MAX_BATCH_TEXT_BYTES)) {
+    batch_bytes += unique_chunks_.at(end_idx).length();
+    ++end_idx;
+  }
+  return end_idx;
+}
+
+int64_t ObEmbeddingTask::get_inflight_request_count() const
+{
+  int64_t inflight_cnt = 0;
+  for (int64_t i = 0; i < requests_.count(); ++i) {
+    if (OB_NOT_NULL(requests_.at(i)) && requests_.at(i)->in_progress_) {
+      ++inflight_cnt;
+    }
+  }
+  return inflight_cnt;
+}
+
+bool ObEmbeddingTask::has_pending_request() const
+{
+  bool bret = !requeued_ranges_.empty();
+  for (int64_t i = 0; !bret && i < requests_.count(); ++i) {
+    bret = OB_NOT_NULL(requests_.at(i)) && !requests_.at(i)->is_idle();
+  }
+  return bret;
+}
+
+bool ObEmbeddingTask::has_due_retry_request() const
+{
+  bool bret = false;
+  const int64_t current_time = ObTimeUtility::current_time();
+  for (int64_t i = 0; !bret && i < requests_.count(); ++i) {
+    const HttpRequest *request = requests_.at(i);
+    bret = OB_NOT_NULL(request) && request->need_retry_ && request->retry_time_us_ <= current_time;
+  }
+  return bret;
+}
+
+bool ObEmbeddingTask::is_request_timeout() const
+{
+  bool bret = false;
+  const int64_t current_time = ObTimeUtility::current_time();
+  for (int64_t i = 0; !bret && i < requests_.count(); ++i) {
+    const HttpRequest *request = requests_.at(i);
+    bret = OB_NOT_NULL(request) && request->in_progress_
+           && current_time - request->send_time_us_ > http_timeout_us_;
+  }
+  return bret;
+}
+
+int ObEmbeddingTask::find_request_slot(const CURL *easy_handle, int64_t &slot_idx) const
+{
+  int ret = OB_SUCCESS;
+  slot_idx = -1;
+  for (int64_t i = 0; slot_idx < 0 && i < requests_.count(); ++i) {
+    if (OB_NOT_NULL(requests_.at(i)) && requests_.at(i)->easy_handle_ == easy_handle) {
+      slot_idx = i;
+    }
+  }
+  if (slot_idx < 0) {
+    ret = OB_ENTRY_NOT_EXIST;
+    LOG_WARN("request slot of easy handle not found", K(ret), KP(easy_handle));
+  }
+  return ret;
+}
+
+void ObEmbeddingTask::release_endpoint_slots()
+{
+  for (int64_t i = 0; i < requests_.count(); ++i) {
+    HttpRequest *request = requests_.at(i);
+    if (OB_NOT_NULL(request) && request->hold_endpoint_slot_) {
+      if (OB_NOT_NULL(endpoint_limiter_)) {
+        endpoint_limiter_->release(model_url_);
+      }
+      request->hold_endpoint_slot_ = false;
+    }
+  }
+}
+
 int ObEmbeddingTask::check_async_progress()
 {
   int ret = OB_SUCCESS;
   ObEmbeddingTaskPhase current_phase = phase_;
-  LOG_DEBUG("check_async_progress", K(current_phase), K(curl_request_in_progress_));
+  LOG_DEBUG("check_async_progress", K(current_phase), "inflight_cnt", get_inflight_request_count());
   if (current_phase == OB_EMBEDDING_TASK_INIT) {
     ret = OB_STATE_NOT_MATCH;
     LOG_WARN("task not started yet", K(ret));
@@ -566,33 +856,9 @@ int ObEmbeddingTask::check_async_progress()
     ret = OB_SUCCESS;
   } else if (current_phase == OB_EMBEDDING_TASK_HTTP_SENT) {
     if (OB_FAIL(check_http_progress())) {
-      if (ret == OB_NEED_RETRY) {
-        // handle retry logic
-        int64_t retry_interval = calculate_retry_interval();
-        int64_t current_time = ObTimeUtility::current_time();
-
-        if (current_time - http_last_retry_time_us_ >= retry_interval) {
-          // time to retry
-          http_response_data_ = nullptr;
-          http_response_data_size_ = 0;
-
-          if (OB_FAIL(set_phase(OB_EMBEDDING_TASK_INIT))) {
-            LOG_WARN("failed to reset phase for retry", K(ret));
-          } else if (OB_FAIL(start_async_work())) {
-            LOG_WARN("failed to retry HTTP request", K(ret));
-            if (OB_FAIL(complete_task(OB_EMBEDDING_TASK_DONE, ret, true))) {
-              LOG_WARN("failed to handle retry failure", K(ret));
-            }
-          }
-        } else {
-          // not time to retry yet, continue waiting
-          ret = OB_SUCCESS;
-        }
-      } else {
-        // non-retryable error
-        if (OB_FAIL(complete_task(OB_EMBEDDING_TASK_DONE, ret, true))) {
-          LOG_WARN("failed to handle task failure", K(ret));
-        }
+      // non-retryable error
+      if (OB_FAIL(complete_task(OB_EMBEDDING_TASK_DONE, ret, true))) {
+        LOG_WARN("failed to handle task failure", K(ret));
       }
     } else if (is_http_response_ready()) {
       // Successful response, reset retry state
@@ -601,15 +867,21 @@ int ObEmbeddingTask::check_async_progress()
       if (OB_FAIL(set_phase(OB_EMBEDDING_TASK_HTTP_COMPLETED))) {
         LOG_WARN("failed to set phase to HTTP_COMPLETED", K(ret));
       }
-    } else {
-      int64_t current_time = ObTimeUtility::current_time();
-      int64_t elapsed_time = current_time - http_send_time_us_;
-      if (elapsed_time > http_timeout_us_) {
-        if (OB_FAIL(complete_task(OB_EMBEDDING_TASK_DONE, OB_TIMEOUT, true))) {
-          LOG_WARN("failed to handle task failure", K(ret));
+    } else if (has_due_retry_request()) {
+      // time to retry
+      if (OB_FAIL(set_phase(OB_EMBEDDING_TASK_INIT))) {
+        LOG_WARN("failed to reset phase for retry", K(ret));
+      } else if (OB_FAIL(start_async_work())) {
+        LOG_WARN("failed to retry HTTP request", K(ret));
+        if (OB_FAIL(complete_task(OB_EMBEDDING_TASK_DONE, ret, true))) {
+          LOG_WARN("failed to handle retry failure", K(ret));
         }
-        LOG_WARN("HTTP request timeout", K(elapsed_time), K(http_timeout_us_), K(*this));
       }
+    } else if (is_request_timeout()) {
+      if (OB_FAIL(complete_task(OB_EMBEDDING_TASK_DONE, OB_TIMEOUT, true))) {
+        LOG_WARN("failed to handle task failure", K(ret));
+      }
+      LOG_WARN("HTTP request timeout", K(http_timeout_us_), K(*this));
     }
   } else if (current_phase == OB_EMBEDDING_TASK_HTTP_COMPLETED) {
     if (OB_FAIL(process_http_response())) {
@@ -617,20 +889,18 @@ int ObEmbeddingTask::check_async_progress()
         LOG_WARN("failed to handle task failure", K(ret), K(*this));
       }
     } else {
-      int64_t actual_chunks_in_batch = OB_MIN(batch_size_, input_chunks_.count() - (current_batch_idx_ * batch_size_));
       {
         ObThreadCondGuard guard(task_cond_);
-        processed_chunks_ += actual_chunks_in_batch;
+        processed_chunks_ = output_vectors_.count();
       }
       if (OB_FAIL(set_phase(OB_EMBEDDING_TASK_PARSED))) {
         LOG_WARN("failed to set phase to PARSED", K(ret), K(*this));
       }
     }
   } else if (current_phase == OB_EMBEDDING_TASK_PARSED) {
-    int64_t next_start_idx = (current_batch_idx_ + 1) * batch_size_;
-    LOG_DEBUG("check_async_progress: PARSED phase", K(current_batch_idx_), K(next_start_idx), K(input_chunks_.count()), K(processed_chunks_), K(total_chunks_));
-    if (next_start_idx < input_chunks_.count()) {
-      current_batch_idx_++;
+    LOG_DEBUG("check_async_progress: PARSED phase", K(next_unique_idx_), K(unique_ready_cnt_),
+              K(unique_chunks_.count()), K(processed_chunks_), K(total_chunks_));
+    if (unique_ready_cnt_ < unique_chunks_.count() || has_pending_request()) {
       if (OB_FAIL(set_phase(OB_EMBEDDING_TASK_INIT))) {
         LOG_WARN("failed to set phase to INIT for next batch", K(ret), K(*this));
       }
@@ -672,57 +942,15 @@ int ObEmbeddingTask::get_async_result(ObArray<float*> &vectors)
 }
 
 
-int ObEmbeddingTask::send_http_request_async(const char *json_data, int64_t json_len)
-{
-  int ret = OB_SUCCESS;
-
-  if (OB_FAIL(init_http_request(json_data, json_len))) {
-    LOG_WARN("failed to init async http request", K(ret), K(*this));
-  } else {
-    if (OB_FAIL(set_phase(OB_EMBEDDING_TASK_HTTP_SENT))) {
-      LOG_WARN("failed to set phase to HTTP_SENT", K(ret), K(*this));
-    } else {
-      http_send_time_us_ = ObTimeUtility::current_time();
-      curl_request_in_progress_ = true;
-    }
-  }
-
-  return ret;
-}
-
-int ObEmbeddingTask::init_http_request(const char *json_data, int64_t json_len)
-{
-  int ret = OB_SUCCESS;
-
-  if (OB_ISNULL(curl_multi_handle_) || OB_ISNULL(curl_easy_handle_)) {
-    ret = OB_ERR_UNEXPECTED;
-    LOG_WARN("unexpected null curl handles", K(ret), KP(curl_multi_handle_), KP(curl_easy_handle_));
-  } else {
-    curl_multi_remove_handle(curl_multi_handle_, curl_easy_handle_);
-    CURLMcode multi_res = curl_multi_add_handle(curl_multi_handle_, curl_easy_handle_);
-    if (multi_res != CURLM_OK) {
-      ret = OB_CURL_ERROR;
-      LOG_WARN("curl_multi_add_handle failed", K(ret), K(multi_res));
-    } else {
-      http_response_data_ = nullptr;
-      http_response_data_size_ = 0;
-      curl_easy_setopt(curl_easy_handle_, CURLOPT_POSTFIELDS, json_data);
-      curl_easy_setopt(curl_easy_handle_, CURLOPT_POSTFIELDSIZE, json_len);
-    }
-  }
-  return ret;
-}
-
 int ObEmbeddingTask::check_http_progress()
 {
   int ret = OB_SUCCESS;
-  if (need_retry_flag_ && !curl_request_in_progress_ && http_response_data_ == nullptr) {
-    ret = OB_NEED_RETRY;
-    LOG_DEBUG("in retry backoff state, signaling retry", K(http_retry_count_), K(http_error_code_));
-  } else if (!curl_request_in_progress_ || OB_ISNULL(curl_multi_handle_) || OB_ISNULL(curl_easy_handle_)) {
+  if (OB_ISNULL(curl_multi_handle_)) {
     ret = OB_ERR_UNEXPECTED;
-    LOG_WARN("no async HTTP request in progress or handles are null", K(ret),
-            K(curl_request_in_progress_), KP(curl_multi_handle_), KP(curl_easy_handle_));
+    LOG_WARN("curl multi handle is null", K(ret), KP(curl_multi_handle_));
+  } else if (0 == get_inflight_request_count()) {
+    // only requests in retry backoff
+    LOG_DEBUG("in retry backoff state", K(http_retry_count_), K(http_error_code_));
   } else {
     int running_handles = 0;
     CURLMcode multi_res = curl_multi_perform(curl_multi_handle_, &running_handles);
@@ -732,84 +960,83 @@ int ObEmbeddingTask::check_http_progress()
     if (multi_res != CURLM_OK) {
       ret = OB_CURL_ERROR;
       LOG_WARN("curl_multi_perform failed", K(ret), K(multi_res));
-    } else if (running_handles == 0) {
-      curl_request_in_progress_ = false;
-      need_retry_flag_ = false;
+    } else {
       CURLMsg *msg = nullptr;
       int msgs_in_queue = 0;
-      while (OB_SUCC(ret) && (msg = curl_multi_info_read(curl_multi_handle_, &msgs_in_queue))) {
-        if (OB_ISNULL(msg)) {
-          ret = OB_ERR_UNEXPECTED;
-          LOG_WARN("curl_multi_info_read returned null", K(ret));
-        } else if (msg->msg == CURLMSG_DONE) {
-          CURL *easy_handle = msg->easy_handle;
+      while (OB_SUCC(ret) && OB_NOT_NULL(msg = curl_multi_info_read(curl_multi_handle_, &msgs_in_queue))) {
+        int64_t slot_idx = -1;
+        if (msg->msg != CURLMSG_DONE) {
+        } else if (OB_FAIL(find_request_slot(msg->easy_handle, slot_idx))) {
+          LOG_WARN("failed to find request slot", K(ret));
+        } else {
+          HttpRequest *request = requests_.at(slot_idx);
+          // msg is freed by curl_multi_remove_handle
           CURLcode res = msg->data.result;
+          curl_multi_remove_handle(curl_multi_handle_, request->easy_handle_);
+          request->in_progress_ = false;
+          if (request->hold_endpoint_slot_) {
+            if (OB_NOT_NULL(endpoint_limiter_)) {
+              endpoint_limiter_->release(model_url_);
+            }
+            request->hold_endpoint_slot_ = false;
+          }
 
           if (res == CURLE_OK) {
             long response_code;
-            curl_easy_getinfo(easy_handle, CURLINFO_RESPONSE_CODE, &response_code);
+            curl_easy_getinfo(request->easy_handle_, CURLINFO_RESPONSE_CODE, &response_code);
 
             if (response_code == 200 /* HTTP OK */) {
-              if (OB_NOT_NULL(curl_response_data_) && OB_NOT_NULL(curl_response_data_->data)) {
-                http_response_data_size_ = curl_response_data_->size;
-                http_response_data_ = (char*)allocator_.alloc(http_response_data_size_ + 1);
-                if (OB_ISNULL(http_response_data_)) {
-                  ret = OB_ALLOCATE_MEMORY_FAILED;
-                  LOG_WARN("failed to allocate response data storage", K(ret), K(*this));
-                } else {
-                  memcpy(http_response_data_, curl_response_data_->data, http_response_data_size_);
-                  http_response_data_[http_response_data_size_] = '\0';
-                }
-              } else {
+              if (OB_ISNULL(request->response_.data)) {
                 ret = OB_ERR_UNEXPECTED;
-                LOG_WARN("no response data available", K(ret), K(*this));
+                LOG_WARN("no response data available", K(ret), KPC(request), K(*this));
+              } else {
+                request->is_ready_ = true;
               }
             } else {
-              {
-                ObThreadCondGuard guard(task_cond_);
-                if (OB_NOT_NULL(curl_response_data_) && OB_NOT_NULL(curl_response_data_->data)) {
-                  http_error_message_ = ObString(curl_response_data_->size, curl_response_data_->data);
-                }
-                http_error_code_ = response_code;
-                need_retry_flag_ = should_retry_http_request(response_code);
-                // Check if we should retry this http request
-                if (need_retry_flag_) {
-                  http_retry_count_++;
-                  http_total_retry_count_++;
-
-                  // Check if we need to adjust batch size for retry
-                  if (is_batch_size_related_error(response_code) && OB_FAIL(adjust_batch_size_for_retry())) {
-                    LOG_WARN("failed to adjust batch size for retry", K(ret), K(*this));
-                  } else {
-                    // Set retry flag to indicate we should retry
-                    ret = OB_NEED_RETRY;
-                  }
-                } else {
-                  // Map HTTP error to internal error code
-                  internal_error_code_ = map_http_error_to_internal_error(response_code);
-                  internal_error_message_ = ObString("HTTP request failed");
-                  ret = internal_error_code_;
-                  LOG_WARN("HTTP request failed, no retry", K(response_code), K_(internal_error_code), K_(http_error_message), K(*this));
-                }
+              ObThreadCondGuard guard(task_cond_);
+              int tmp_ret = OB_SUCCESS;
+              // the response buffer is reset when the request is sent again, keep a copy
+              http_error_message_.reset();
+              if (OB_NOT_NULL(request->response_.data)
+                  && OB_TMP_FAIL(ob_write_string(allocator_,
+                                                 ObString(request->response_.size, request->response_.data),
+                                                 http_error_message_))) {
+                LOG_WARN("failed to copy http error message", K(tmp_ret), K(request->response_.size));
               }
-
+              http_error_code_ = response_code;
+              need_retry_flag_ = should_retry_http_request(response_code);
+              // Check if we should retry this http request
               if (need_retry_flag_) {
-                if (http_retry_count_ == 1) { // 第一次重试
-                  http_retry_start_time_us_ = ObTimeUtility::current_time();
+                http_retry_count_++;
+                http_total_retry_count_++;
+
+                // Check if we need to adjust batch size for retry
+                if (is_batch_size_related_error(response_code)
+                    && OB_FAIL(adjust_batch_size_for_retry(request->start_idx_, request->end_idx_))) {
+                  LOG_WARN("failed to adjust batch size for retry", K(ret), K(*this));
+                } else {
+                  const int64_t current_time = ObTimeUtility::current_time();
+                  if (http_retry_count_ == 1) { // 第一次重试
+                    http_retry_start_time_us_ = current_time;
+                  }
+                  http_last_retry_time_us_ = current_time;
+                  request->need_retry_ = true;
+                  request->retry_time_us_ = current_time + calculate_retry_interval();
                 }
-                http_last_retry_time_us_ = ObTimeUtility::current_time();
+              } else {
+                // Map HTTP error to internal error code
+                internal_error_code_ = map_http_error_to_internal_error(response_code);
+                internal_error_message_ = ObString("HTTP request failed");
+                ret = internal_error_code_;
+                LOG_WARN("HTTP request failed, no retry", K(response_code), K_(internal_error_code), K_(http_error_message), K(*this));
               }
             }
           } else {
             ret = OB_CURL_ERROR;
-            LOG_WARN("curl request failed", K(ret), K(res), K(*this));
+            LOG_WARN("curl request failed", K(ret), K(res), KPC(request), K(*this));
           }
         }
       }
-
-      if (OB_NOT_NULL(curl_response_data_)) {
-        curl_response_data_->reset();
-      }
     }
   }
 
@@ -818,17 +1045,25 @@ int ObEmbeddingTask::check_http_progress()
 
 void ObEmbeddingTask::cleanup_async_http()
 {
-  if (OB_UNLIKELY(curl_request_in_progress_)) {
-    FLOG_INFO("cleanup_async_http while curl_request_in_progress_ is true", K(*this));
+  if (OB_UNLIKELY(get_inflight_request_count() > 0)) {
+    FLOG_INFO("cleanup_async_http while http requests are in progress", K(*this));
   }
 
-  if (OB_NOT_NULL(curl_easy_handle_)) {
-    if (OB_NOT_NULL(curl_multi_handle_)) {
-      curl_multi_remove_handle(curl_multi_handle_, curl_easy_handle_);
+  release_endpoint_slots();
+  for (int64_t i = 0; i < requests_.count(); ++i) {
+    HttpRequest *request = requests_.at(i);
+    if (OB_NOT_NULL(request)) {
+      if (OB_NOT_NULL(request->easy_handle_)) {
+        if (OB_NOT_NULL(curl_multi_handle_)) {
+          curl_multi_remove_handle(curl_multi_handle_, request->easy_handle_);
+        }
+        curl_easy_cleanup(request->easy_handle_);
+        request->easy_handle_ = nullptr;
+      }
+      OB_DELETEx(HttpRequest, &allocator_, request);
     }
-    curl_easy_cleanup(curl_easy_handle_);
-    curl_easy_handle_ = nullptr;
   }
+  requests_.reset();
 
   if (OB_NOT_NULL(curl_multi_handle_)) {
     curl_multi_cleanup(curl_multi_handle_);
@@ -840,11 +1075,7 @@ void ObEmbeddingTask::cleanup_async_http()
     curl_headers_ = nullptr;
     LOG_DEBUG("Freed HTTP headers");
   }
-
-  if (OB_NOT_NULL(curl_response_data_)) {
-    OB_DELETEx(HttpResponseData, &allocator_, curl_response_data_);
-    curl_response_data_ = nullptr;
-  }
+  model_url_cstr_ = nullptr;
 }
 
 void ObEmbeddingTask::log_phase_transition(ObEmbeddingTaskPhase from_phase, ObEmbeddingTaskPhase to_phase)
@@ -884,21 +1115,38 @@ int ObEmbeddingTask::process_http_response()
 {
   int ret = OB_SUCCESS;
 
-  if (OB_ISNULL(http_response_data_)) {
-    ret = OB_ERR_UNEXPECTED;
-    LOG_WARN("no HTTP response data available", K(ret), K(*this));
-  } else {
-    if (OB_FAIL(parse_embedding_response(http_response_data_, http_response_data_size_))) {
-      LOG_WARN("failed to parse embedding response", K(ret), K(*this));
+  for (int64_t i = 0; OB_SUCC(ret) && i < requests_.count(); ++i) {
+    HttpRequest *request = requests_.at(i);
+    if (OB_ISNULL(request)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected null request", K(ret), K(i));
+    } else if (!request->is_ready_) {
+    } else if (OB_ISNULL(request->response_.data)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("no HTTP response data available", K(ret), KPC(request), K(*this));
+    } else if (OB_FAIL(parse_embedding_response(request->response_.data, request->response_.size,
+                                                request->start_idx_, request->end_idx_))) {
+      LOG_WARN("failed to parse embedding response", K(ret), KPC(request), K(*this));
+    } else {
+      unique_ready_cnt_ += request->end_idx_ - request->start_idx_;
+      request->is_ready_ = false;
+      request->response_.reset();
     }
   }
+  if (OB_SUCC(ret) && OB_FAIL(fill_output_vectors())) {
+    LOG_WARN("failed to fill output vectors", K(ret), K(*this));
+  }
 
   return ret;
 }
 
 bool ObEmbeddingTask::is_http_response_ready() const
 {
-  return OB_NOT_NULL(http_response_data_);
+  bool bret = false;
+  for (int64_t i = 0; !bret && i < requests_.count(); ++i) {
+    bret = OB_NOT_NULL(requests_.at(i)) && requests_.at(i)->is_ready_;
+  }
+  return bret;
 }
 
 template <typename ThreadPoolType>
@@ -913,6 +1161,9 @@ int ObEmbeddingTask::do_work(ThreadPoolType *thread_pool)
     LOG_DEBUG("task already finished, no work needed", K(*this));
   } else {
     LOG_DEBUG("processing embedding task", K(*this), "internal_phase", phase_);
+    if (OB_ISNULL(endpoint_limiter_) && OB_NOT_NULL(thread_pool)) {
+      endpoint_limiter_ = &thread_pool->get_endpoint_limiter();
+    }
 
     bool continue_processing = true;
     while (OB_SUCC(ret) && continue_processing && !is_finished()) {
@@ -1081,6 +1332,105 @@ int ObEmbeddingTask::get_task_info_for_virtual_table(ObEmbeddingTaskInfo &task_i
   return ret;
 }
 
+//=============================================== ObEmbeddingEndpointLimiter ================================================
+
+int ObEmbeddingEndpointLimiter::init(const uint64_t tenant_id)
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("endpoint limiter already inited", K(ret));
+  } else if (OB_FAIL(inflight_map_.create(DEFAULT_BUCKET_NUM, ObMemAttr(tenant_id, "EmbedEndpoint")))) {
+    LOG_WARN("failed to create inflight map", K(ret), K(tenant_id));
+  } else {
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+void ObEmbeddingEndpointLimiter::destroy()
+{
+  common::ObSpinLockGuard guard(lock_);
+  if (inflight_map_.created()) {
+    inflight_map_.destroy();
+  }
+  is_inited_ = false;
+}
+
+bool ObEmbeddingEndpointLimiter::try_acquire(const ObString &model_url, const int64_t limit)
+{
+  int ret = OB_SUCCESS;
+  bool bret = false;
+  if (IS_NOT_INIT) {
+    // without limiter every task keeps only one request in flight
+  } else {
+    const uint64_t endpoint_key = model_url.hash();
+    int64_t inflight_cnt = 0;
+    common::ObSpinLockGuard guard(lock_);
+    if (OB_FAIL(inflight_map_.get_refactored(endpoint_key, inflight_cnt))) {
+      if (OB_HASH_NOT_EXIST == ret) {
+        ret = OB_SUCCESS;
+        inflight_cnt = 0;
+      } else {
+        LOG_WARN("failed to get inflight count", K(ret), K(model_url));
+      }
+    }
+    if (OB_FAIL(ret) || inflight_cnt >= limit) {
+    } else if (OB_FAIL(inflight_map_.set_refactored(endpoint_key, inflight_cnt + 1, 1/*overwrite*/))) {
+      LOG_WARN("failed to set inflight count", K(ret), K(model_url), K(inflight_cnt));
+    } else {
+      bret = true;
+    }
+  }
+  return bret;
+}
+
+void ObEmbeddingEndpointLimiter::acquire(const ObString &model_url)
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    const uint64_t endpoint_key = model_url.hash();
+    int64_t inflight_cnt = 0;
+    common::ObSpinLockGuard guard(lock_);
+    if (OB_FAIL(inflight_map_.get_refactored(endpoint_key, inflight_cnt)) && OB_HASH_NOT_EXIST != ret) {
+      LOG_WARN("failed to get inflight count", K(ret), K(model_url));
+    } else if (OB_FAIL(inflight_map_.set_refactored(endpoint_key, inflight_cnt + 1, 1/*overwrite*/))) {
+      LOG_WARN("failed to set inflight count", K(ret), K(model_url), K(inflight_cnt));
+    }
+  }
+}
+
+void ObEmbeddingEndpointLimiter::release(const ObString &model_url)
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    const uint64_t endpoint_key = model_url.hash();
+    int64_t inflight_cnt = 0;
+    common::ObSpinLockGuard guard(lock_);
+    if (OB_FAIL(inflight_map_.get_refactored(endpoint_key, inflight_cnt))) {
+      LOG_WARN("failed to get inflight count", K(ret), K(model_url));
+    } else if (inflight_cnt <= 1) {
+      if (OB_FAIL(inflight_map_.erase_refactored(endpoint_key))) {
+        LOG_WARN("failed to erase inflight count", K(ret), K(model_url));
+      }
+    } else if (OB_FAIL(inflight_map_.set_refactored(endpoint_key, inflight_cnt - 1, 1/*overwrite*/))) {
+      LOG_WARN("failed to set inflight count", K(ret), K(model_url), K(inflight_cnt));
+    }
+  }
+}
+
+int64_t ObEmbeddingEndpointLimiter::get_inflight_count(const ObString &model_url)
+{
+  int64_t inflight_cnt = 0;
+  if (IS_INIT) {
+    common::ObSpinLockGuard guard(lock_);
+    if (OB_SUCCESS != inflight_map_.get_refactored(model_url.hash(), inflight_cnt)) {
+      inflight_cnt = 0;
+    }
+  }
+  return inflight_cnt;
+}
+
 //=============================================== ObEmbeddingTaskHandler ================================================
 
 ObEmbeddingTaskHandler::ObEmbeddingTaskHandler() : is_inited_(false),
@@ -1101,6 +1451,8 @@ int ObEmbeddingTaskHandler::init()
   common::ObSpinLockGuard guard(lock_);
   if (OB_UNLIKELY(is_inited_)) {
     // already inited
+  } else if (OB_FAIL(endpoint_limiter_.init(MTL_ID()))) {
+    LOG_WARN("failed to init endpoint limiter", KR(ret));
   } else if (OB_FAIL(start())) {
     LOG_WARN("failed to start embedding task handler", KR(ret));
     wait();
@@ -1259,6 +1611,7 @@ void ObEmbeddingTaskHandler::destroy()
     TG_DESTROY(tg_id_);
   }
   tg_id_ = INVALID_TG_ID;
+  endpoint_limiter_.destroy();
   is_inited_ = false;
   LOG_INFO("embedding task handler destroyed", K_(task_ref_cnt), K_(dropped_task_cnt));
 }
@@ -1452,18 +1805,31 @@ int64_t ObEmbeddingTask::calculate_retry_interval() const
   return interval;
 }
 
-int ObEmbeddingTask::adjust_batch_size_for_retry()
+int ObEmbeddingTask::adjust_batch_size_for_retry(const int64_t start_idx, int64_t &end_idx)
 {
   int ret = OB_SUCCESS;
-
-  if (batch_size_ > 1) {
-    batch_size_ = batch_size_ - 1;
-  } else {
-    // batch size is 1, but still need to decrease it, maybe remote server is not ready
+  const int64_t failed_cnt = end_idx - start_idx;
+  if (OB_UNLIKELY(failed_cnt <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid failed batch", K(ret), K(start_idx), K(end_idx));
+  } else if (failed_cnt <= 1) {
+    // a single text is still too large, maybe remote server is not ready
     ret = OB_ERR_UNEXPECTED;
-    LOG_WARN("batch size can not be decreased", K(ret), K(batch_size_));
+    LOG_WARN("batch size can not be decreased", K(ret), K(batch_size_), K(start_idx), K(end_idx));
+  } else {
+    // the failed batch may be smaller than batch_size_ when it was cut by text bytes
+    batch_size_ = static_cast<uint32_t>(OB_MIN(static_cast<int64_t>(batch_size_), failed_cnt) - 1);
+    batch_size_adjusted_ = true;
+    const int64_t new_end_idx = OB_MIN(get_batch_end_idx(start_idx), end_idx);
+    if (new_end_idx < end_idx) {
+      if (OB_FAIL(requeued_ranges_.push_back(std::make_pair(new_end_idx, end_idx)))) {
+        LOG_WARN("failed to requeue rest of the batch", K(ret), K(new_end_idx), K(end_idx));
+      } else {
+        LOG_INFO("shrink embedding batch for retry", K(start_idx), K(end_idx), K(new_end_idx), K(batch_size_));
+        end_idx = new_end_idx;
+      }
+    }
   }
-
   return ret;
 }
 
@@ -1574,15 +1940,12 @@ int ObEmbeddingTask::maybe_callback()
 int ObEmbeddingTask::init_curl_handler(const ObString &model_url, const ObString &user_key)
 {
   int ret = OB_SUCCESS;
-  if (OB_UNLIKELY(curl_multi_handle_ || curl_easy_handle_)) {
+  if (OB_UNLIKELY(curl_multi_handle_ || requests_.count() > 0)) {
     ret = OB_INIT_TWICE;
     LOG_WARN("curl handles already initialized", K(ret), KPC(this));
   }else if (OB_ISNULL(curl_multi_handle_ = curl_multi_init())) {
     ret = OB_CURL_ERROR;
     LOG_WARN("failed to init curl multi handle", K(ret));
-  } else if (OB_ISNULL(curl_easy_handle_ = curl_easy_init())) {
-    ret = OB_CURL_ERROR;
-    LOG_WARN("failed to init curl easy handle", K(ret));
   } else {
     char auth_header[512];
     snprintf(auth_header, sizeof(auth_header), "Authorization: Bearer %.*s",
@@ -1591,37 +1954,58 @@ int ObEmbeddingTask::init_curl_handler(const ObString &model_url, const ObString
     curl_headers_ = nullptr;
     curl_headers_ = curl_slist_append(curl_headers_, "Content-Type: application/json");
     curl_headers_ = curl_slist_append(curl_headers_, auth_header);
-    char *model_url_cstr = nullptr;
-    if (OB_FAIL(ob_dup_cstring(allocator_, model_url, model_url_cstr))) { // add \0
+    if (OB_FAIL(ob_dup_cstring(allocator_, model_url, model_url_cstr_))) { // add \0
       LOG_WARN("failed to duplicate model url", K(ret));
-    } else if (OB_ISNULL(model_url_cstr)) {
+    } else if (OB_ISNULL(model_url_cstr_)) {
       ret = OB_ERR_UNEXPECTED;
       LOG_WARN("failed to duplicate model url", K(ret));
-    } else {
-      curl_easy_setopt(curl_easy_handle_, CURLOPT_URL, model_url_cstr);
-      curl_easy_setopt(curl_easy_handle_, CURLOPT_HTTPHEADER, curl_headers_);
-      curl_easy_setopt(curl_easy_handle_, CURLOPT_WRITEFUNCTION, ObEmbeddingTask::WriteMemoryCallback);
+    }
+  }
+  return ret;
 
-      curl_response_data_ = OB_NEWx(HttpResponseData, &allocator_, allocator_);
-      if (OB_ISNULL(curl_response_data_)) {
-        ret = OB_ALLOCATE_MEMORY_FAILED;
-        LOG_WARN("failed to create response data structure", K(ret));
-      } else {
-        curl_easy_setopt(curl_easy_handle_, CURLOPT_WRITEDATA, (void *)curl_response_data_);
+}
 
-        curl_easy_setopt(curl_easy_handle_, CURLOPT_TIMEOUT, HTTP_REQUEST_TIMEOUT / 1000);
-        curl_easy_setopt(curl_easy_handle_, CURLOPT_CONNECTTIMEOUT, HTTP_REQUEST_TIMEOUT / 1000);
+// Every request slot owns an easy handle, which keeps its connection to the endpoint alive
+// between batches.
+int ObEmbeddingTask::init_request_slots()
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(curl_multi_handle_) || OB_ISNULL(model_url_cstr_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("curl handler not inited", K(ret), KP(curl_multi_handle_), KP(model_url_cstr_));
+  } else if (OB_FAIL(requests_.reserve(max_inflight_requests_))) {
+    LOG_WARN("failed to reserve request slots", K(ret), K_(max_inflight_requests));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < max_inflight_requests_; ++i) {
+    HttpRequest *request = OB_NEWx(HttpRequest, &allocator_, allocator_);
+    if (OB_ISNULL(request)) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to create http request", K(ret), K(i));
+    } else if (OB_ISNULL(request->easy_handle_ = curl_easy_init())) {
+      ret = OB_CURL_ERROR;
+      LOG_WARN("failed to init curl easy handle", K(ret), K(i));
+    } else {
+      curl_easy_setopt(request->easy_handle_, CURLOPT_URL, model_url_cstr_);
+      curl_easy_setopt(request->easy_handle_, CURLOPT_HTTPHEADER, curl_headers_);
+      curl_easy_setopt(request->easy_handle_, CURLOPT_WRITEFUNCTION, ObEmbeddingTask::WriteMemoryCallback);
+      curl_easy_setopt(request->easy_handle_, CURLOPT_WRITEDATA, (void *)&request->response_);
 
-        CURLMcode multi_res = curl_multi_add_handle(curl_multi_handle_, curl_easy_handle_);
-        if (multi_res != CURLM_OK) {
-          ret = OB_CURL_ERROR;
-          LOG_WARN("failed to add easy handle to multi handle", K(ret), K(multi_res), K(*this));
-        }
+      curl_easy_setopt(request->easy_handle_, CURLOPT_TIMEOUT, HTTP_REQUEST_TIMEOUT / 1000);
+      curl_easy_setopt(request->easy_handle_, CURLOPT_CONNECTTIMEOUT, HTTP_REQUEST_TIMEOUT / 1000);
+    }
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(requests_.push_back(request))) {
+      LOG_WARN("failed to push back request slot", K(ret), K(i));
+    }
+    if (OB_FAIL(ret) && OB_NOT_NULL(request)) {
+      if (OB_NOT_NULL(request->easy_handle_)) {
+        curl_easy_cleanup(request->easy_handle_);
+        request->easy_handle_ = nullptr;
       }
+      OB_DELETEx(HttpRequest, &allocator_, request);
     }
   }
   return ret;
-
 }
 
 int ObEmbeddingTask::wait_for_completion(const int64_t timeout_ms)
@@ -22,6 +22,7 @@
 #include "lib/lock/ob_latch.h"
 #include "lib/thread/thread_mgr_interface.h"
 #include "lib/allocator/ob_allocator.h"
+#include "lib/hash/ob_hashmap.h"
 #include "share/io/ob_io_define.h"
 
 
@@ -157,6 +158,28 @@ public:
 
 class ObEmbeddingTaskHandler;
 
+// Bounds the pipelined http requests sent to one model endpoint by all tasks of a tenant.
+// Every task may always keep one request in flight, extra requests of a task are only sent
+// while the endpoint has less than `limit` requests in flight.
+class ObEmbeddingEndpointLimiter
+{
+public:
+  ObEmbeddingEndpointLimiter() : is_inited_(false), lock_(), inflight_map_() {}
+  ~ObEmbeddingEndpointLimiter() { destroy(); }
+  int init(const uint64_t tenant_id);
+  void destroy();
+  bool try_acquire(const ObString &model_url, const int64_t limit);
+  void acquire(const ObString &model_url);
+  void release(const ObString &model_url);
+  int64_t get_inflight_count(const ObString &model_url);
+private:
+  static const int64_t DEFAULT_BUCKET_NUM = 64;
+  bool is_inited_;
+  common::ObSpinLock lock_;
+  common::hash::ObHashMap<uint64_t, int64_t, common::hash::NoPthreadDefendMode> inflight_map_;
+  DISALLOW_COPY_AND_ASSIGN(ObEmbeddingEndpointLimiter);
+};
+
 // Constants for field lengths
 class ObEmbeddingTask
 {
@@ -184,9 +207,14 @@ class ObEmbeddingTask
                 K_(model_name),
                 K_(user_key),
                 K(input_chunks_.count()),
+                K(unique_chunks_.count()),
                 K(output_vectors_.count()),
                 K_(dimension),
                 K_(batch_size),
+                K_(next_unique_idx),
+                K_(unique_ready_cnt),
+                K_(max_inflight_requests),
+                K(requests_.count()),
                 K_(processed_chunks),
                 K_(total_chunks),
                 K_(process_callback_offset));
@@ -228,6 +256,10 @@ public:
   // Callback related constants
   static const int64_t CALLBACK_BATCH_SIZE;
 
+  // Batching and pipelining related constants
+  static const int64_t MAX_BATCH_TEXT_BYTES;
+  static const int64_t MAX_INFLIGHT_REQUESTS;
+
 private:
   void reset();
   bool is_finished() const;  // Internal use only - no lock needed
@@ -237,26 +269,39 @@ private:
   int start_async_work();
   int check_async_progress();
 
-  int send_http_request_async(const char *json_data, int64_t json_len);
   int process_http_response();
   bool is_http_response_ready() const;
 
-  int init_http_request(const char *json_data, int64_t json_len);
   int check_http_progress();
   void cleanup_async_http();
   void log_phase_transition(ObEmbeddingTaskPhase from_phase, ObEmbeddingTaskPhase to_phase);
   int reschedule(ObEmbeddingTaskHandler *thread_pool);
   int handle_reschedule_failure(ObEmbeddingTaskHandler *thread_pool, int error_code);
-  bool is_http_sent() const { return curl_request_in_progress_; }
   void set_task_id(int64_t task_id) { task_id_ = task_id; }
 
-  int parse_embedding_response(const char *response_data, size_t response_size);
+  int init_unique_chunks(const ObIArray<ObString> &input_chunks);
+  int init_request_slots();
+  int dispatch_requests();
+  int send_batch_request(const int64_t slot_idx, const int64_t start_idx, const int64_t end_idx);
+  int build_request_json(const int64_t start_idx, const int64_t end_idx, char *&json_buf, int64_t &json_len);
+  int64_t get_batch_end_idx(const int64_t start_idx) const;
+  int64_t get_inflight_request_count() const;
+  bool has_pending_request() const;
+  bool has_due_retry_request() const;
+  bool is_request_timeout() const;
+  int find_request_slot(const CURL *easy_handle, int64_t &slot_idx) const;
+  void release_endpoint_slots();
+  int fill_output_vectors();
+  int parse_embedding_response(const char *response_data, size_t response_size,
+                               const int64_t start_idx, const int64_t end_idx);
 
   // Helper methods for retry logic
   bool should_retry_http_request(int64_t http_error_code) const;
   bool is_batch_size_related_error(int64_t http_error_code) const;
   int64_t calculate_retry_interval() const;
-  int adjust_batch_size_for_retry();
+  // shrink batch_size_ below the failed batch [start_idx, end_idx), end_idx is cut to the new
+  // batch size and the rest of the range is requeued
+  int adjust_batch_size_for_retry(const int64_t start_idx, int64_t &end_idx);
   void reset_retry_state();
   int map_http_error_to_internal_error(int64_t http_error_code) const;
   void try_increase_batch_size();
@@ -278,6 +323,27 @@ private:
     ObIAllocator &allocator;
   };
 
+  // One pipelined http request, it embeds unique_chunks_[start_idx_, end_idx_)
+  struct HttpRequest {
+    HttpRequest(ObIAllocator &allocator)
+      : easy_handle_(nullptr), response_(allocator), start_idx_(0), end_idx_(0), send_time_us_(0),
+        retry_time_us_(0), in_progress_(false), is_ready_(false), need_retry_(false), hold_endpoint_slot_(false)
+    {}
+    bool is_idle() const { return !in_progress_ && !is_ready_ && !need_retry_; }
+    TO_STRING_KV(KP_(easy_handle), K_(start_idx), K_(end_idx), K_(send_time_us), K_(retry_time_us),
+                 K_(in_progress), K_(is_ready), K_(need_retry), K_(hold_endpoint_slot));
+    CURL *easy_handle_;
+    HttpResponseData response_;
+    int64_t start_idx_;
+    int64_t end_idx_;
+    int64_t send_time_us_;
+    int64_t retry_time_us_;
+    bool in_progress_;
+    bool is_ready_;
+    bool need_retry_;
+    bool hold_endpoint_slot_;
+  };
+
   static size_t WriteMemoryCallback(void *contents, size_t size, size_t nmemb, void *userp)
   {
     size_t realsize = size * nmemb;
@@ -338,20 +404,27 @@ private:
   // flow control
   mutable ObLatch task_lock_;
   uint32_t batch_size_;
-  int64_t current_batch_idx_;
 
   // Async processing related members
   int64_t http_timeout_us_;
   int64_t http_send_time_us_; // Unified HTTP send time
-  int64_t http_response_data_size_;
-  char *http_response_data_;
+
+  // Deduplicated input: identical texts are embedded once and fanned out to all their rows
+  ObArray<ObString> unique_chunks_;
+  ObArray<int64_t> chunk_unique_idx_;
+  ObArray<float*> unique_vectors_;
+  int64_t next_unique_idx_;  // first unique chunk not sent yet
+  // ranges split off shrunk retry batches, sent before the chunks from next_unique_idx_
+  ObArray<std::pair<int64_t, int64_t>> requeued_ranges_;
+  int64_t unique_ready_cnt_; // unique chunks whose vectors are ready without gap
 
   // Async HTTP processing members
   CURLM *curl_multi_handle_;
-  CURL *curl_easy_handle_;
-  bool curl_request_in_progress_;
-  HttpResponseData *curl_response_data_; // Store response data for async HTTP processing
+  char *model_url_cstr_;
   struct curl_slist *curl_headers_; // Store HTTP headers for cleanup
+  ObArray<HttpRequest*> requests_;
+  int64_t max_inflight_requests_;
+  ObEmbeddingEndpointLimiter *endpoint_limiter_;
 
   // HTTP retry related members
   int64_t http_retry_count_;
@@ -363,8 +436,6 @@ private:
   // Batch size adjustment for retry
   uint32_t original_batch_size_;
   bool batch_size_adjusted_;
-  uint32_t current_batch_size_;
-  uint32_t successful_requests_count_;
 
   ObThreadCond task_cond_;
   bool callback_done_;
@@ -390,6 +461,7 @@ public:
 
   int push_task(ObEmbeddingTask &task);
   int get_tg_id() { return tg_id_; }
+  ObEmbeddingEndpointLimiter &get_endpoint_limiter() { return endpoint_limiter_; }
   void inc_task_ref() { ATOMIC_INC(&task_ref_cnt_); }
   void dec_task_ref() { ATOMIC_DEC(&task_ref_cnt_); }
   void inc_dropped_task_cnt() { ATOMIC_INC(&dropped_task_cnt_); }
@@ -441,6 +513,7 @@ private:
   // task tracking for force drop functionality
   common::ObSpinLock task_list_lock_;
   common::ObArray<ObEmbeddingTask*> active_tasks_;
+  ObEmbeddingEndpointLimiter endpoint_limiter_;
 private:
   DISALLOW_COPY_AND_ASSIGN(ObEmbeddingTaskHandler);
 };
@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define USING_LOG_PREFIX SHARE
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "ob_vector_index_snapshot_image.h"
+#include "lib/checksum/ob_crc64.h"
+#include "lib/file/ob_file.h"
+#include "lib/file/file_directory_utils.h"
+#include "lib/time/ob_time_utility.h"
+#include "share/config/ob_server_config.h"
+#include "storage/ob_file_system_router.h"
+
+namespace oceanbase
+{
+namespace share
+{
+/*
+ * ObVecIdxSnapImageHeader implement
+ * */
+int ObVecIdxSnapImageHeader::init(const ObString &key, const int64_t data_size, const int64_t data_checksum)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(key.empty() || key.length() > MAX_KEY_LENGTH || data_size <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(key), K(data_size));
+  } else {
+    reset();
+    magic_ = MAGIC;
+    version_ = VERSION;
+    data_size_ = data_size;
+    data_checksum_ = data_checksum;
+    key_length_ = key.length();
+    MEMCPY(key_, key.ptr(), key.length());
+    header_checksum_ = calc_header_checksum();
+  }
+  return ret;
+}
+
+int64_t ObVecIdxSnapImageHeader::calc_header_checksum() const
+{
+  return static_cast<int64_t>(ob_crc64(this, offsetof(ObVecIdxSnapImageHeader, header_checksum_)));
+}
+
+bool ObVecIdxSnapImageHeader::is_valid() const
+{
+  return MAGIC == magic_
+         && VERSION == version_
+         && data_size_ > 0
+         && key_length_ > 0
+         && key_length_ <= MAX_KEY_LENGTH
+         && calc_header_checksum() == header_checksum_;
+}
+
+/*
+ * ObVecIdxSnapImageUtil implement
+ * */
+bool ObVecIdxSnapImageUtil::is_enabled()
+{
+  return GCONF._enable_vector_index_snapshot_image;
+}
+
+int ObVecIdxSnapImageUtil::get_image_path(const uint64_t tenant_id, const ObTabletID &tablet_id,
+                                          char *path, const int64_t path_len)
+{
+  int ret = OB_SUCCESS;
+  int64_t pos = 0;
+  if (OB_ISNULL(path) || OB_UNLIKELY(!tablet_id.is_valid() || path_len <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(path), K(tablet_id), K(path_len));
+  } else if (OB_FAIL(databuff_printf(path, path_len, pos, "%s/vec_snapshot/%lu/%lu.img",
+                                     OB_FILE_SYSTEM_ROUTER.get_data_dir(), tenant_id, tablet_id.id()))) {
+    LOG_WARN("failed to print image path", K(ret), K(tenant_id), K(tablet_id));
+  }
+  return ret;
+}
+
+void ObVecIdxSnapImageUtil::remove_image(const uint64_t tenant_id, const ObTabletID &tablet_id)
+{
+  int tmp_ret = OB_SUCCESS;
+  char path[common::MAX_PATH_SIZE] = {0};
+  if (OB_TMP_FAIL(get_image_path(tenant_id, tablet_id, path, sizeof(path)))) {
+    LOG_WARN_RET(tmp_ret, "failed to get image path", K(tenant_id), K(tablet_id));
+  } else if (0 != ::unlink(path) && ENOENT != errno) {
+    LOG_WARN_RET(OB_IO_ERROR, "failed to remove snapshot image", KCSTRING(path), KERRMSG);
+  }
+}
+
+void ObVecIdxSnapImageUtil::remove_tenant_images(const uint64_t tenant_id)
+{
+  int tmp_ret = OB_SUCCESS;
+  char dir[common::MAX_PATH_SIZE] = {0};
+  int64_t pos = 0;
+  bool is_exist = false;
+  if (OB_TMP_FAIL(databuff_printf(dir, sizeof(dir), pos, "%s/vec_snapshot/%lu",
+                                  OB_FILE_SYSTEM_ROUTER.get_data_dir(), tenant_id))) {
+    LOG_WARN_RET(tmp_ret, "failed to print image dir", K(tenant_id));
+  } else if (OB_TMP_FAIL(FileDirectoryUtils::is_exists(dir, is_exist))) {
+    LOG_WARN_RET(tmp_ret, "failed to check image dir", KCSTRING(dir));
+  } else if (!is_exist) {
+  } else if (OB_TMP_FAIL(FileDirectoryUtils::delete_directory_rec(dir))) {
+    LOG_WARN_RET(tmp_ret, "failed to remove snapshot image dir", KCSTRING(dir));
+  } else {
+    LOG_INFO("remove vector index snapshot images of tenant", K(tenant_id), KCSTRING(dir));
+  }
+}
+
+/*
+ * ObVecIdxSnapImageWriter implement
+ * */
+ObVecIdxSnapImageWriter::ObVecIdxSnapImageWriter()
+  : fd_(-1), data_size_(0), data_checksum_(0), key_()
+{
+  path_[0] = '\0';
+  tmp_path_[0] = '\0';
+}
+
+ObVecIdxSnapImageWriter::~ObVecIdxSnapImageWriter()
+{
+  abort();
+}
+
+int ObVecIdxSnapImageWriter::open(const uint64_t tenant_id, const ObTabletID &tablet_id, const ObString &key)
+{
+  int ret = OB_SUCCESS;
+  char dir[common::MAX_PATH_SIZE] = {0};
+  int64_t pos = 0;
+  if (OB_UNLIKELY(is_opened())) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("open image writer twice", K(ret), KPC(this));
+  } else if (OB_UNLIKELY(key.empty() || key.length() > ObVecIdxSnapImageHeader::MAX_KEY_LENGTH)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid snapshot key", K(ret), K(key));
+  } else if (OB_FAIL(ObVecIdxSnapImageUtil::get_image_path(tenant_id, tablet_id, path_, sizeof(path_)))) {
+    LOG_WARN("failed to get image path", K(ret), K(tenant_id), K(tablet_id));
+  } else if (OB_FAIL(databuff_printf(dir, sizeof(dir), pos, "%s/vec_snapshot/%lu",
+                                     OB_FILE_SYSTEM_ROUTER.get_data_dir(), tenant_id))) {
+    LOG_WARN("failed to print image dir", K(ret), K(tenant_id));
+  } else if (OB_FAIL(FileDirectoryUtils::create_full_path(dir))) {
+    LOG_WARN("failed to create image dir", K(ret), KCSTRING(dir));
+  } else if (OB_FALSE_IT(pos = 0)) {
+  } else if (OB_FAIL(databuff_printf(tmp_path_, sizeof(tmp_path_), pos, "%s.%ld.tmp",
+                                     path_, ObTimeUtility::current_time()))) {
+    LOG_WARN("failed to print tmp image path", K(ret));
+  } else if ((fd_ = ::open(tmp_path_, O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR)) < 0) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("failed to create snapshot image", K(ret), KCSTRING(tmp_path_), KERRMSG);
+  } else {
+    MEMCPY(key_buf_, key.ptr(), key.length());
+    key_.assign_ptr(key_buf_, key.length());
+    data_size_ = 0;
+    data_checksum_ = 0;
+  }
+  return ret;
+}
+
+void ObVecIdxSnapImageWriter::append(const char *data, const int64_t data_size)
+{
+  if (is_opened() && OB_NOT_NULL(data) && data_size > 0) {
+    const int64_t offset = ObVecIdxSnapImageHeader::DATA_OFFSET + data_size_;
+    if (data_size != unintr_pwrite(fd_, data, data_size, offset)) {
+      LOG_WARN_RET(OB_IO_ERROR, "failed to write snapshot image, drop it", K(data_size), KPC(this), KERRMSG);
+      abort();
+    } else {
+      data_checksum_ = static_cast<int64_t>(ob_crc64(static_cast<uint64_t>(data_checksum_), data, data_size));
+      data_size_ += data_size;
+    }
+  }
+}
+
+int ObVecIdxSnapImageWriter::finish()
+{
+  int ret = OB_SUCCESS;
+  ObVecIdxSnapImageHeader header;
+  if (OB_UNLIKELY(!is_opened())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("image writer not opened", K(ret));
+  } else if (0 == data_size_) {
+    // empty snapshot table, nothing to save
+    abort();
+  } else if (OB_FAIL(header.init(key_, data_size_, data_checksum_))) {
+    LOG_WARN("failed to init image header", K(ret), KPC(this));
+  } else if (sizeof(header) != unintr_pwrite(fd_, &header, sizeof(header), 0)) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("failed to write image header", K(ret), KPC(this), KERRMSG);
+  } else if (0 != ::fsync(fd_)) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("failed to sync snapshot image", K(ret), KPC(this), KERRMSG);
+  } else if (0 != ::close(fd_)) {
+    fd_ = -1;
+    ret = OB_IO_ERROR;
+    LOG_WARN("failed to close snapshot image", K(ret), KPC(this), KERRMSG);
+  } else if (OB_FALSE_IT(fd_ = -1)) {
+  } else if (0 != ::rename(tmp_path_, path_)) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("failed to rename snapshot image", K(ret), KPC(this), KERRMSG);
+  } else {
+    LOG_INFO("save vector index snapshot image", K(header), KCSTRING(path_));
+    tmp_path_[0] = '\0';
+  }
+  if (OB_FAIL(ret)) {
+    abort();
+  }
+  return ret;
+}
+
+void ObVecIdxSnapImageWriter::abort()
+{
+  if (is_opened()) {
+    ::close(fd_);
+    fd_ = -1;
+  }
+  if ('\0' != tmp_path_[0]) {
+    ::unlink(tmp_path_);
+    tmp_path_[0] = '\0';
+  }
+}
+
+/*
+ * ObVecIdxSnapImageReader implement
+ * */
+ObVecIdxSnapImageReader::ObVecIdxSnapImageReader()
+  : fd_(-1), base_(nullptr), file_size_(0), pos_(0), header_()
+{}
+
+ObVecIdxSnapImageReader::~ObVecIdxSnapImageReader()
+{
+  close();
+}
+
+int ObVecIdxSnapImageReader::open(const uint64_t tenant_id, const ObTabletID &tablet_id, const ObString &key)
+{
+  int ret = OB_SUCCESS;
+  char path[common::MAX_PATH_SIZE] = {0};
+  struct stat st;
+  if (OB_UNLIKELY(fd_ >= 0)) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("open image reader twice", K(ret), KPC(this));
+  } else if (OB_FAIL(ObVecIdxSnapImageUtil::get_image_path(tenant_id, tablet_id, path, sizeof(path)))) {
+    LOG_WARN("failed to get image path", K(ret), K(tenant_id), K(tablet_id));
+  } else if ((fd_ = ::open(path, O_RDONLY)) < 0) {
+    if (ENOENT == errno) {
+      ret = OB_ENTRY_NOT_EXIST;
+    } else {
+      ret = OB_IO_ERROR;
+      LOG_WARN("failed to open snapshot image", K(ret), KCSTRING(path), KERRMSG);
+    }
+  } else if (0 != ::fstat(fd_, &st)) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("failed to stat snapshot image", K(ret), KCSTRING(path), KERRMSG);
+  } else if (sizeof(header_) != unintr_pread(fd_, &header_, sizeof(header_), 0)) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("failed to read image header", K(ret), KCSTRING(path), KERRMSG);
+  } else if (!header_.is_valid()
+             || st.st_size != ObVecIdxSnapImageHeader::DATA_OFFSET + header_.data_size_) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("invalid snapshot image", K(ret), KCSTRING(path), K(header_), K(st.st_size));
+  } else if (!header_.is_key_match(key)) {
+    // image of an older snapshot, it is replaced after the snapshot table is loaded
+    ret = OB_ENTRY_NOT_EXIST;
+  } else if (MAP_FAILED == (base_ = static_cast<char *>(::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd_, 0)))) {
+    base_ = nullptr;
+    ret = OB_IO_ERROR;
+    LOG_WARN("failed to map snapshot image", K(ret), KCSTRING(path), K(st.st_size), KERRMSG);
+  } else {
+    file_size_ = st.st_size;
+    pos_ = ObVecIdxSnapImageHeader::DATA_OFFSET;
+    (void)::madvise(base_, file_size_, MADV_SEQUENTIAL);
+    const int64_t checksum = static_cast<int64_t>(ob_crc64(base_ + pos_, header_.data_size_));
+    if (checksum != header_.data_checksum_) {
+      ret = OB_CHECKSUM_ERROR;
+      LOG_WARN("snapshot image checksum mismatch", K(ret), KCSTRING(path), K(checksum), K(header_));
+    }
+  }
+  if (OB_FAIL(ret)) {
+    close();
+  }
+  return ret;
+}
+
+int ObVecIdxSnapImageReader::get_next_chunk(char *&data, int64_t &data_size)
+{
+  int ret = OB_SUCCESS;
+  data = nullptr;
+  data_size = 0;
+  if (OB_ISNULL(base_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("image reader not opened", K(ret));
+  } else if (pos_ >= file_size_) {
+    ret = OB_ITER_END;
+  } else {
+    if (pos_ > ObVecIdxSnapImageHeader::DATA_OFFSET) {
+      // the stream buffer has moved past the previous chunk
+      (void)::madvise(base_ + pos_ - READ_CHUNK_SIZE, READ_CHUNK_SIZE, MADV_DONTNEED);
+    }
+    data = base_ + pos_;
+    data_size = MIN(READ_CHUNK_SIZE, file_size_ - pos_);
+    pos_ += data_size;
+  }
+  return ret;
+}
+
+void ObVecIdxSnapImageReader::close()
+{
+  if (OB_NOT_NULL(base_)) {
+    ::munmap(base_, file_size_);
+    base_ = nullptr;
+  }
+  if (fd_ >= 0) {
+    ::close(fd_);
+    fd_ = -1;
+  }
+  file_size_ = 0;
+  pos_ = 0;
+}
+
+int ObVecIdxSnapImageReadCallback::operator()(char *&data, const int64_t data_size, int64_t &read_size, share::ObIStreamBuf::CbParam &cb_param)
+{
+  UNUSED(data_size);
+  int ret = OB_SUCCESS;
+  ObVecIdxSnapImageReadCallback::CbParam &param = static_cast<ObVecIdxSnapImageReadCallback::CbParam&>(cb_param);
+  if (!param.is_valid()) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("invalid image reader", K(ret));
+  } else if (OB_FAIL(param.reader_->get_next_chunk(data, read_size))) {
+    if (OB_ITER_END != ret) {
+      LOG_WARN("failed to read snapshot image", K(ret), KPC(param.reader_));
+    }
+  }
+  return ret;
+}
+
+};
+};
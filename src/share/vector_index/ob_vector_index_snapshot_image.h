@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef OCEANBASE_SHARE_VECTOR_INDEX_SNAPSHOT_IMAGE_H_
+#define OCEANBASE_SHARE_VECTOR_INDEX_SNAPSHOT_IMAGE_H_
+
+#include "lib/string/ob_string.h"
+#include "common/ob_tablet_id.h"
+#include "share/vector_index/ob_plugin_vector_index_serialize.h"
+
+namespace oceanbase
+{
+namespace share
+{
+
+// Local image of a vector index snapshot.
+// A snapshot is normally rebuilt from the lob pieces of the snapshot table, which are read through
+// the table scan and lob iterators one block at a time. After such a load the serialized stream is
+// also saved to <data_dir>/vec_snapshot/<tenant_id>/<tablet_id>.img, and the next load of the same
+// snapshot (same first snapshot key) maps that file and feeds vsag straight from the page cache.
+// File layout: one header page followed by the serialized stream.
+struct ObVecIdxSnapImageHeader
+{
+public:
+  static const int64_t MAGIC = 0x474D49504E535649; // "IVSNPIMG"
+  static const int64_t VERSION = 1;
+  static const int64_t DATA_OFFSET = 4096;
+  static const int64_t MAX_KEY_LENGTH = 256;
+
+  ObVecIdxSnapImageHeader() { reset(); }
+  void reset() { MEMSET(this, 0, sizeof(*this)); }
+  int init(const ObString &key, const int64_t data_size, const int64_t data_checksum);
+  bool is_valid() const;
+  bool is_key_match(const ObString &key) const
+  {
+    return key.length() == key_length_ && 0 == MEMCMP(key.ptr(), key_, key_length_);
+  }
+  TO_STRING_KV(K_(magic), K_(version), K_(data_size), K_(data_checksum), K_(key_length),
+               "key", ObString(key_length_, key_), K_(header_checksum));
+
+private:
+  int64_t calc_header_checksum() const;
+
+public:
+  int64_t magic_;
+  int64_t version_;
+  int64_t data_size_;
+  int64_t data_checksum_;
+  int64_t key_length_;
+  char key_[MAX_KEY_LENGTH];
+  int64_t header_checksum_;
+};
+
+class ObVecIdxSnapImageUtil
+{
+public:
+  static bool is_enabled();
+  static int get_image_path(const uint64_t tenant_id, const ObTabletID &tablet_id,
+                            char *path, const int64_t path_len);
+  static void remove_image(const uint64_t tenant_id, const ObTabletID &tablet_id);
+  // drop all images of a removed tenant
+  static void remove_tenant_images(const uint64_t tenant_id);
+};
+
+// Saves the stream handed out by ObHNSWDeserializeCallback, the image only becomes visible after
+// finish(). A failed append drops the image and never fails the load itself.
+class ObVecIdxSnapImageWriter
+{
+public:
+  ObVecIdxSnapImageWriter();
+  ~ObVecIdxSnapImageWriter();
+  int open(const uint64_t tenant_id, const ObTabletID &tablet_id, const ObString &key);
+  void append(const char *data, const int64_t data_size);
+  int finish();
+  void abort();
+  bool is_opened() const { return fd_ >= 0; }
+  TO_STRING_KV(K_(fd), K_(data_size), K_(data_checksum), KCSTRING(path_));
+
+private:
+  int fd_;
+  int64_t data_size_;
+  int64_t data_checksum_;
+  ObString key_;
+  char key_buf_[ObVecIdxSnapImageHeader::MAX_KEY_LENGTH];
+  char path_[common::MAX_PATH_SIZE];
+  char tmp_path_[common::MAX_PATH_SIZE];
+  DISALLOW_COPY_AND_ASSIGN(ObVecIdxSnapImageWriter);
+};
+
+// Maps a saved image read-only. The checksum of the whole stream is verified in open(), so vsag
+// never sees a torn or stale file. Pieces already handed out are dropped from the mapping to keep
+// the resident size of the load bounded, the pages stay in the page cache.
+class ObVecIdxSnapImageReader
+{
+public:
+  static const int64_t READ_CHUNK_SIZE = 16LL * 1024LL * 1024LL; // 16MB
+
+  ObVecIdxSnapImageReader();
+  ~ObVecIdxSnapImageReader();
+  // return OB_ENTRY_NOT_EXIST if there is no image of the snapshot `key`
+  int open(const uint64_t tenant_id, const ObTabletID &tablet_id, const ObString &key);
+  int get_next_chunk(char *&data, int64_t &data_size);
+  void close();
+  TO_STRING_KV(K_(fd), KP_(base), K_(file_size), K_(pos), K_(header));
+
+private:
+  int fd_;
+  char *base_;
+  int64_t file_size_;
+  int64_t pos_;
+  ObVecIdxSnapImageHeader header_;
+  DISALLOW_COPY_AND_ASSIGN(ObVecIdxSnapImageReader);
+};
+
+class ObVecIdxSnapImageReadCallback
+{
+public:
+  struct CbParam : public ObIStreamBuf::CbParam {
+    explicit CbParam(ObVecIdxSnapImageReader *reader) : reader_(reader) {}
+    virtual ~CbParam() {}
+    bool is_valid() const { return nullptr != reader_; }
+    ObVecIdxSnapImageReader *reader_;
+  };
+public:
+  ObVecIdxSnapImageReadCallback() {}
+  int operator()(char *&data, const int64_t data_size, int64_t &read_size, share::ObIStreamBuf::CbParam &cb_param);
+};
+
+};
+};
+#endif // OCEANBASE_SHARE_VECTOR_INDEX_SNAPSHOT_IMAGE_H_
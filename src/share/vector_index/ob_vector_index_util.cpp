@@ -548,6 +548,50 @@ int ObVectorIndexUtil::cast_vector_array_str_to_float_array_binary(ObIAllocator
   return ret;
 }
 
+// "[[1,2],[3,4]]" is split into "[1,2]" and "[3,4]", any other string is returned as it is
+int ObVectorIndexUtil::split_vector_array_str(const ObString &vector_array_str, ObIArray<ObString> &vector_strs)
+{
+  int ret = OB_SUCCESS;
+  const char *ptr = vector_array_str.ptr();
+  const int64_t len = vector_array_str.length();
+  int64_t pos = 0;
+  while (pos < len && isspace(ptr[pos])) {
+    ++pos;
+  }
+  int64_t next = pos + 1;
+  while (next < len && isspace(ptr[next])) {
+    ++next;
+  }
+  if (pos >= len || ptr[pos] != '[' || next >= len || ptr[next] != '[') {
+    if (OB_FAIL(vector_strs.push_back(vector_array_str))) {
+      LOG_WARN("failed to push back vector str", K(ret));
+    }
+  } else {
+    int64_t depth = 0;
+    int64_t start = 0;
+    bool is_closed = false;
+    for (int64_t i = pos + 1; OB_SUCC(ret) && !is_closed && i < len; ++i) {
+      if (ptr[i] == '[') {
+        start = depth == 0 ? i : start;
+        ++depth;
+      } else if (ptr[i] != ']') {
+      } else if (depth == 0) {
+        is_closed = true;
+      } else if (--depth == 0 && OB_FAIL(vector_strs.push_back(ObString(i - start + 1, ptr + start)))) {
+        LOG_WARN("failed to push back vector str", K(ret));
+      }
+    }
+    if (OB_SUCC(ret) && (!is_closed || vector_strs.empty())) {
+      // malformed, let the vector cast report it
+      vector_strs.reuse();
+      if (OB_FAIL(vector_strs.push_back(vector_array_str))) {
+        LOG_WARN("failed to push back vector str", K(ret));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObVectorIndexUtil::get_vector_from_vector_array_string(ObIAllocator &allocator,
                                                           const ObString &vector_array_str,
                                                           const ObString &param_str,
@@ -556,10 +600,33 @@ int ObVectorIndexUtil::get_vector_from_vector_array_string(ObIAllocator &allocat
   int ret = OB_SUCCESS;
   ObVectorIndexParam param;
   ObVectorIndexType index_type = ObVectorIndexType::VIT_HNSW_INDEX;
+  ObSEArray<ObString, 4> vector_strs;
+  char *buf = nullptr;
   if (OB_FAIL(parser_params_from_string(param_str, index_type, param, false))) {
     LOG_WARN("parse vector index param failed", K(ret), K(param_str));
-  } else if (OB_FAIL(cast_vector_array_str_to_float_array_binary(allocator, vector_array_str, param.dim_, output_vec))) {
-    LOG_WARN("cast vector array str to float binary failed", K(ret));
+  } else if (OB_FAIL(split_vector_array_str(vector_array_str, vector_strs))) {
+    LOG_WARN("failed to split vector array str", K(ret));
+  } else if (vector_strs.count() == 1) {
+    if (OB_FAIL(cast_vector_array_str_to_float_array_binary(allocator, vector_strs.at(0), param.dim_, output_vec))) {
+      LOG_WARN("cast vector array str to float binary failed", K(ret));
+    }
+  } else if (OB_ISNULL(buf = static_cast<char *>(allocator.alloc(vector_strs.count() * param.dim_ * sizeof(float))))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc multi vector buf", K(ret), K(vector_strs.count()), K(param.dim_));
+  } else {
+    // several query vectors are laid out one after another, the hnsw scan searches them as a batch
+    const int64_t vec_size = param.dim_ * sizeof(float);
+    for (int64_t i = 0; OB_SUCC(ret) && i < vector_strs.count(); ++i) {
+      ObString vec;
+      if (OB_FAIL(cast_vector_array_str_to_float_array_binary(allocator, vector_strs.at(i), param.dim_, vec))) {
+        LOG_WARN("cast vector array str to float binary failed", K(ret), K(i));
+      } else {
+        MEMCPY(buf + i * vec_size, vec.ptr(), vec_size);
+      }
+    }
+    if (OB_SUCC(ret)) {
+      output_vec.assign_ptr(buf, vector_strs.count() * vec_size);
+    }
   }
   return ret;
 }
@@ -95,6 +95,7 @@ enum ObVectorIndexAlgorithmType : uint16_t
 enum ObKmeansAlgoType
 {
   KAT_ELKAN = 0,
+  KAT_MINI_BATCH,
   KAT_MAX
 };
 const static double VEC_ESTIMATE_MEMORY_FACTOR = 2.0;
@@ -882,6 +883,7 @@ private:
       const ObString &vector_array_str,
       int64_t dim,
       ObString &output_vec);
+  static int split_vector_array_str(const ObString &vector_array_str, ObIArray<ObString> &vector_strs);
 };
 
 // For vector index snapshot write data
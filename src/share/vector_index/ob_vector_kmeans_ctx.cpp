@@ -17,7 +17,9 @@
 #define USING_LOG_PREFIX SHARE
 #include "ob_vector_kmeans_ctx.h"
 #include "lib/container/ob_array_array.h"
+#include "share/config/ob_server_config.h"
 #include "share/vector_index/ob_plugin_vector_index_service.h"
+#include "share/vector_type/ob_vector_batch_distance.h"
 #include "storage/ddl/ob_direct_load_struct.h"
 
 namespace oceanbase {
@@ -285,7 +287,6 @@ int ObKmeansAlgo::init_centers(const ObIArray<float*> &input_vectors)
     int64_t center_idx = centers_[cur_idx_].count() - 1;
     float *current_center = centers_[cur_idx_].at(center_idx);
 
-    float distance = 0;
     bool is_finish = kmeans_ctx_->lists_ == centers_[cur_idx_].count();
     float sum = 0;
     float random_weight = 0;
@@ -299,16 +300,12 @@ int ObKmeansAlgo::init_centers(const ObIArray<float*> &input_vectors)
       SHARE_LOG(INFO, "success to init all centers", K(ret), K(center_count), K(kmeans_ctx_->lists_), K(sample_count));
     } else {
       int64_t i = 0;
-      for (i = 0; OB_SUCC(ret) && i < sample_cnt; ++i) {
-        float *sample_vector = input_vectors.at(i);
-        if (OB_FAIL(calc_kmeans_distance(sample_vector, current_center, kmeans_ctx_->dim_, distance))) {
-          SHARE_LOG(WARN, "failed to calc kmeans distance", K(ret));
-        } else {
-          distance *= distance;
-          if (distance < weight_[i]) {
-            weight_[i] = distance;
-          }
-          sum += weight_[i];
+      slice_center_ = current_center;
+      if (OB_FAIL(run_step(SLICE_STEP_UPDATE_WEIGHT, input_vectors, sample_cnt))) {
+        SHARE_LOG(WARN, "failed to update kmeans++ weight", K(ret));
+      } else {
+        for (int64_t s = 0; s < get_slice_count(); ++s) {
+          sum += slice_sums_[s];
         }
       }
       if (OB_SUCC(ret)) {
@@ -334,6 +331,77 @@ int ObKmeansAlgo::init_centers(const ObIArray<float*> &input_vectors)
   return ret;
 }
 
+int64_t ObKmeansAlgo::get_slice_count() const
+{
+  return OB_ISNULL(runner_) ? 1 : runner_->get_slice_count();
+}
+
+int ObKmeansAlgo::run_step(const ObKmeansSliceStep step, const ObIArray<float*> &input_vectors, const int64_t total)
+{
+  int ret = OB_SUCCESS;
+  slice_step_ = step;
+  slice_vectors_ = &input_vectors;
+  MEMSET(slice_sums_, 0, sizeof(slice_sums_));
+  if (0 >= total) {
+  } else if (OB_ISNULL(runner_)) {
+    if (OB_FAIL(run_slice(0, 0, total))) {
+      SHARE_LOG(WARN, "failed to run slice", K(ret), K(step), K(total));
+    }
+  } else if (OB_FAIL(runner_->run(*this, total))) {
+    SHARE_LOG(WARN, "failed to run step in parallel", K(ret), K(step), K(total));
+  }
+  slice_step_ = SLICE_STEP_NONE;
+  slice_vectors_ = nullptr;
+  return ret;
+}
+
+int ObKmeansAlgo::run_slice(const int64_t slice_idx, const int64_t start, const int64_t end)
+{
+  int ret = OB_SUCCESS;
+  const int64_t dim = kmeans_ctx_->dim_;
+  if (OB_ISNULL(slice_vectors_) || OB_UNLIKELY(slice_idx < 0 || slice_idx >= MAX_SLICE_CNT)) {
+    ret = OB_ERR_UNEXPECTED;
+    SHARE_LOG(WARN, "invalid slice", K(ret), KP(slice_vectors_), K(slice_idx));
+  } else if (SLICE_STEP_UPDATE_WEIGHT == slice_step_) {
+    double sum = 0;
+    float distance = 0;
+    for (int64_t i = start; OB_SUCC(ret) && i < end; ++i) {
+      if (OB_FAIL(calc_kmeans_distance(slice_vectors_->at(i), slice_center_, dim, distance))) {
+        SHARE_LOG(WARN, "failed to calc kmeans distance", K(ret));
+      } else {
+        distance *= distance;
+        if (distance < weight_[i]) {
+          weight_[i] = distance;
+        }
+        sum += weight_[i];
+      }
+    }
+    slice_sums_[slice_idx] = sum;
+  } else if (SLICE_STEP_NEAREST_CENTER == slice_step_) {
+    const int64_t center_count = centers_[cur_idx_].count();
+    float *dists = slice_dist_buf_ + slice_idx * kmeans_ctx_->lists_;
+    for (int64_t i = start; OB_SUCC(ret) && i < end; ++i) {
+      if (OB_FAIL(ObVectorBatchDistance<float>::l2_square_batch(
+          slice_vectors_->at(i), centers_[cur_idx_].at(0), dim, center_count, dists))) {
+        SHARE_LOG(WARN, "failed to calc batch distance", K(ret), K(dim), K(center_count));
+      } else {
+        int32_t nearest_center_idx = 0;
+        for (int32_t j = 1; j < center_count; ++j) {
+          if (dists[j] < dists[nearest_center_idx]) {
+            nearest_center_idx = j;
+          }
+        }
+        slice_assign_[i] = nearest_center_idx;
+        slice_min_dist_[i] = dists[nearest_center_idx];
+      }
+    }
+  } else {
+    ret = OB_ERR_UNEXPECTED;
+    SHARE_LOG(WARN, "unexpected slice step", K(ret), K(slice_step_));
+  }
+  return ret;
+}
+
 int ObKmeansAlgo::calc_kmeans_distance(const float* a, const float* b, const int64_t len, float &distance)
 {
   int ret = OB_SUCCESS;
@@ -398,7 +466,81 @@ int ObKmeansExecutor::append_sample_vector(float* vector)
   return ret;
 }
 
+ObKmeansAlgoType ObKmeansExecutor::get_algo_type(const int64_t lists, const int64_t samples_per_nlist)
+{
+  ObKmeansAlgoType algo_type = ObKmeansAlgoType::KAT_ELKAN;
+  // mini-batch trades center quality for build time, it is only used when enabled explicitly
+  if (GCONF._enable_ivf_mini_batch_kmeans
+      && 0 < samples_per_nlist && lists >= ObMiniBatchKmeansAlgo::MIN_SAMPLE_CNT / samples_per_nlist) {
+    algo_type = ObKmeansAlgoType::KAT_MINI_BATCH;
+  }
+  return algo_type;
+}
+
+int ObKmeansExecutor::create_algo(ObKmeansAlgoType algo_type, ObKmeansAlgo *&algo)
+{
+  int ret = OB_SUCCESS;
+  void *tmp_buf = nullptr;
+  algo = nullptr;
+  if (algo_type == ObKmeansAlgoType::KAT_ELKAN) {
+    if (OB_ISNULL(tmp_buf = ivf_build_mem_ctx_.Allocate(sizeof(ObElkanKmeansAlgo)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to alloc tmp_buf", K(ret), K(ivf_build_mem_ctx_.get_all_vsag_use_mem_byte()));
+    } else {
+      algo = new (tmp_buf) ObElkanKmeansAlgo(ivf_build_mem_ctx_);
+    }
+  } else if (algo_type == ObKmeansAlgoType::KAT_MINI_BATCH) {
+    if (OB_ISNULL(tmp_buf = ivf_build_mem_ctx_.Allocate(sizeof(ObMiniBatchKmeansAlgo)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to alloc tmp_buf", K(ret), K(ivf_build_mem_ctx_.get_all_vsag_use_mem_byte()));
+    } else {
+      algo = new (tmp_buf) ObMiniBatchKmeansAlgo(ivf_build_mem_ctx_);
+    }
+  } else {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid kmeans algorithm type", K(ret), K(algo_type));
+  }
+  return ret;
+}
+
+int ObKmeansExecutor::init_build_handle(ObKmeansBuildTaskHandler &handle)
+{
+  int ret = OB_SUCCESS;
+
+  common::ObSpinLockGuard init_guard(handle.lock_);                  // lock thread pool init to avoid init twice
+  ObPluginVectorIndexService *service = MTL(ObPluginVectorIndexService *);
+  if (OB_ISNULL(service)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected nullptr", K(ret));
+  } else if (handle.get_tg_id() != ObKmeansBuildTaskHandler::INVALID_TG_ID) {
+    // no need to init twice, skip
+  } else if (OB_FAIL(service->start_kmeans_tg())) {
+    LOG_WARN("fail to start kmeans thread pool", K(ret));
+  } else if (OB_FAIL(handle.init(service->get_kmeans_tg_id()))) {
+    LOG_WARN("fail to init vector kmeans build task handle", K(ret));
+  } else if (OB_FAIL(handle.start())) {
+    LOG_WARN("fail to start vector kmeans build thread pool", K(ret));
+  }
+
+  return ret;
+}
+
 // ------------------ ObSingleKmeansExecutor implement ------------------
+ObSingleKmeansExecutor::~ObSingleKmeansExecutor()
+{
+  is_inited_ = false;
+  if (OB_NOT_NULL(algo_)) {
+    algo_->~ObKmeansAlgo();
+    ivf_build_mem_ctx_.Deallocate(algo_);
+    algo_ = nullptr;
+  }
+  if (OB_NOT_NULL(runner_)) {
+    runner_->~ObKmeansParallelRunner();
+    ivf_build_mem_ctx_.Deallocate(runner_);
+    runner_ = nullptr;
+  }
+}
+
 int ObSingleKmeansExecutor::init(
     ObKmeansAlgoType algo_type,
     const int64_t tenant_id,
@@ -412,19 +554,8 @@ int ObSingleKmeansExecutor::init(
   int ret = OB_SUCCESS;
   if (OB_FAIL(ctx_.init(tenant_id, lists, samples_per_nlist, dim, dist_algo, norm_info, 1 /*pq_m*/))) {
     LOG_WARN("fail to init kmeans ctx", K(ret), K(tenant_id), K(lists), K(samples_per_nlist), K(dim), K(dist_algo));
-  } else {
-    if (algo_type == ObKmeansAlgoType::KAT_ELKAN) {
-      void *tmp_buf = nullptr;
-      if (OB_ISNULL(tmp_buf = ivf_build_mem_ctx_.Allocate(sizeof(ObElkanKmeansAlgo)))) {
-        ret = OB_ALLOCATE_MEMORY_FAILED;
-        LOG_WARN("failed to alloc tmp_buf", K(ret), K(ivf_build_mem_ctx_.get_all_vsag_use_mem_byte()));
-      } else {
-        algo_ = new (tmp_buf) ObElkanKmeansAlgo(ivf_build_mem_ctx_);
-      }
-    } else {
-      ret = OB_INVALID_ARGUMENT;
-      LOG_WARN("invalid kmeans algorithm type", K(ret), K(algo_type));
-    }
+  } else if (OB_FAIL(create_algo(algo_type, algo_))) {
+    LOG_WARN("fail to create kmeans algo", K(ret), K(algo_type));
   }
 
   if (FAILEDx(algo_->init(ctx_))) {
@@ -443,15 +574,48 @@ int ObSingleKmeansExecutor::build()
     SHARE_LOG(WARN, "kmeans ctx is not inited", K(ret));
   } else if (OB_FAIL(ctx_.try_normalize_samples())) {
     LOG_WARN("fail to try normalize all samples", K(ret), K(ctx_));
+  } else if (OB_FAIL(prepare_parallel_runner())) {
+    LOG_WARN("fail to prepare parallel runner", K(ret));
   } else if (OB_FAIL(algo_->build(ctx_.sample_vectors_))) {
     LOG_WARN("fail to build kmeans algo", K(ret), K(algo_));
   }
   if (OB_NOT_NULL(algo_)) {
+    algo_->set_parallel_runner(nullptr);
     algo_->destroy();
   }
   return ret;
 }
 
+// split the per-sample steps over the kmeans build thread group with _enable_ivf_parallel_kmeans,
+// the build still runs in the current thread if the thread group is unavailable
+int ObSingleKmeansExecutor::prepare_parallel_runner()
+{
+  int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
+  int64_t slice_cnt = MTL_CPU_COUNT() * ObKmeansBuildTaskHandler::THREAD_FACTOR;
+  slice_cnt = OB_MIN(slice_cnt, ObKmeansSliceWorker::MAX_SLICE_CNT);
+  ObPluginVectorIndexService *service = MTL(ObPluginVectorIndexService *);
+  void *tmp_buf = nullptr;
+  if (!GCONF._enable_ivf_parallel_kmeans) {
+    // build in the current thread
+  } else if (OB_NOT_NULL(runner_) || slice_cnt <= 1 || OB_ISNULL(service)) {
+    // no need to run in parallel
+  } else if (OB_TMP_FAIL(init_build_handle(service->get_kmeans_build_handler()))) {
+    LOG_WARN("fail to init build handle, build kmeans in current thread", K(tmp_ret));
+  } else if (OB_ISNULL(tmp_buf = ivf_build_mem_ctx_.Allocate(sizeof(ObKmeansParallelRunner)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc parallel runner", K(ret), K(ivf_build_mem_ctx_.get_all_vsag_use_mem_byte()));
+  } else if (OB_FALSE_IT(runner_ = new (tmp_buf) ObKmeansParallelRunner())) {
+  } else if (OB_FAIL(runner_->init(service->get_kmeans_build_handler(), slice_cnt))) {
+    LOG_WARN("fail to init parallel runner", K(ret), K(slice_cnt));
+  }
+  if (OB_SUCC(ret) && OB_NOT_NULL(runner_)) {
+    algo_->set_parallel_runner(runner_);
+    LOG_INFO("build kmeans in parallel", KPC(runner_));
+  }
+  return ret;
+}
+
 int ObSingleKmeansExecutor::get_kmeans_algo(ObKmeansAlgo *&algo)
 {
   int ret = OB_SUCCESS;
@@ -530,19 +694,9 @@ int ObMultiKmeansExecutor::init(
     }
 
     for (int i = 0; OB_SUCC(ret) && i < algos_.count(); ++i) {
-      if (algo_type == ObKmeansAlgoType::KAT_ELKAN) {
-        void *tmp_buf = nullptr;
-        if (OB_ISNULL(tmp_buf = ivf_build_mem_ctx_.Allocate(sizeof(ObElkanKmeansAlgo)))) {
-          ret = OB_ALLOCATE_MEMORY_FAILED;
-          LOG_WARN("failed to alloc tmp_buf", K(ret), K(ivf_build_mem_ctx_.get_all_vsag_use_mem_byte()));
-        } else {
-          algos_[i] = new (tmp_buf) ObElkanKmeansAlgo(ivf_build_mem_ctx_);
-        }
-      } else {
-        ret = OB_INVALID_ARGUMENT;
-        LOG_WARN("invalid kmeans algorithm type", K(ret), K(algo_type));
-      }
-      if (FAILEDx(algos_[i]->init(ctx_))) {
+      if (OB_FAIL(create_algo(algo_type, algos_[i]))) {
+        LOG_WARN("fail to create kmeans algo", K(ret), K(algo_type));
+      } else if (OB_FAIL(algos_[i]->init(ctx_))) {
         LOG_WARN("fail to init kmeans algo", K(ret), K(ctx_));
       }
     }
@@ -616,28 +770,6 @@ int ObMultiKmeansExecutor::prepare_splited_arrs(ObArrayArray<float *> &splited_a
   return ret;
 }
 
-int ObMultiKmeansExecutor::init_build_handle(ObKmeansBuildTaskHandler &handle)
-{
-  int ret = OB_SUCCESS;
-
-  common::ObSpinLockGuard init_guard(handle.lock_);                  // lock thread pool init to avoid init twice
-  ObPluginVectorIndexService *service = MTL(ObPluginVectorIndexService *);
-  if (OB_ISNULL(service)) {
-    ret = OB_ERR_UNEXPECTED;
-    LOG_WARN("unexpected nullptr", K(ret));
-  } else if (handle.get_tg_id() != ObKmeansBuildTaskHandler::INVALID_TG_ID) {
-    // no need to init twice, skip
-  } else if (OB_FAIL(service->start_kmeans_tg())) {
-    LOG_WARN("fail to start kmeans thread pool", K(ret));
-  } else if (OB_FAIL(handle.init(service->get_kmeans_tg_id()))) {
-    LOG_WARN("fail to init vector kmeans build task handle", K(ret));
-  } else if (OB_FAIL(handle.start())) {
-    LOG_WARN("fail to start vector kmeans build thread pool", K(ret));
-  }
-
-  return ret;
-}
-
 void ObMultiKmeansExecutor::wait_kmeans_task_finish(ObKmeansBuildTask *build_tasks, ObKmeansBuildTaskHandler &handle,
                                                     ObInsertMonitor *insert_monitor)
 {
@@ -817,7 +949,8 @@ void ObElkanKmeansAlgo::destroy()
 int ObElkanKmeansAlgo::search_nearest_center(const ObIArray<float*> &input_vectors, float* centers_distance, int32_t *data_cnt_in_cluster, float &dis_obj)
 {
   int ret = OB_SUCCESS;  
-  if (OB_UNLIKELY(kmeans_ctx_->lists_ != centers_[cur_idx_].count() || OB_ISNULL(centers_distance) || OB_ISNULL(data_cnt_in_cluster))) {
+  if (OB_UNLIKELY(kmeans_ctx_->lists_ != centers_[cur_idx_].count() || OB_ISNULL(centers_distance) || OB_ISNULL(data_cnt_in_cluster)
+                  || OB_ISNULL(slice_assign_) || OB_ISNULL(slice_min_dist_))) {
     ret = OB_ERR_UNEXPECTED;
     SHARE_LOG(WARN, "param error", K(ret), K(kmeans_ctx_->lists_), K(centers_[cur_idx_].count()), KP(centers_distance), KP(data_cnt_in_cluster));
   } else {
@@ -828,69 +961,135 @@ int ObElkanKmeansAlgo::search_nearest_center(const ObIArray<float*> &input_vecto
     const int64_t dim = kmeans_ctx_->dim_;
 
     const int64_t total_dis_cnt = center_count * sample_cnt;
-
-    float distance = 0.0;
+    centers_distance_ = centers_distance;
+    MEMSET(slice_calc_cnt_, 0, sizeof(slice_calc_cnt_));
+    MEMSET(slice_half_calc_cnt_, 0, sizeof(slice_half_calc_cnt_));
     // 1. calc distance between each two centers
-    for (int64_t i = 0; OB_SUCC(ret) && i < center_count; ++i) {
-      for (int64_t j = i + 1; OB_SUCC(ret) && j < center_count; ++j) {
-        calc_dis_cnt++;
-        if (OB_FAIL(calc_kmeans_distance(centers_[cur_idx_].at(i), centers_[cur_idx_].at(j), dim, distance))) {
-          SHARE_LOG(WARN, "failed to calc kmeans distance between centers", K(ret));
-        } else {
-          set_centers_distance(centers_distance, i, j, distance);
-        }
+    if (OB_FAIL(run_step(SLICE_STEP_CENTERS_DISTANCE, input_vectors, center_count * (center_count - 1) / 2))) {
+      SHARE_LOG(WARN, "failed to calc distance between centers", K(ret));
+    // 2. search the nearest center of each sample
+    } else if (OB_FAIL(run_step(SLICE_STEP_ELKAN_ASSIGN, input_vectors, sample_cnt))) {
+      SHARE_LOG(WARN, "failed to search nearest center", K(ret));
+    } else {
+      calc_dis_cnt = center_count * (center_count - 1) / 2;
+      for (int64_t s = 0; s < MAX_SLICE_CNT; ++s) {
+        calc_dis_cnt += slice_calc_cnt_[s];
+        calc_half_dis_cnt += slice_half_calc_cnt_[s];
       }
     }
-  
+    // 3. accumulate samples into the new centers in sample order
     for (int64_t i = 0; OB_SUCC(ret) && i < sample_cnt; ++i) {
-      float* sample_vector = input_vectors.at(i);
-      int64_t nearest_center_idx = 0;
-      float min_distance = FLT_MAX;
-      float gate_distance = FLT_MAX;
-      calc_dis_cnt++;
-      if (OB_FAIL(calc_kmeans_distance(sample_vector, centers_[cur_idx_].at(0), kmeans_ctx_->dim_, min_distance))) {
-        SHARE_LOG(WARN, "failed to calc kmeans distance", K(ret));
+      const int32_t nearest_center_idx = slice_assign_[i];
+      // Update the distance of the target function
+      dis_obj += slice_min_dist_[i];
+      if (OB_FAIL(centers_[next_idx()].add(nearest_center_idx, dim, input_vectors.at(i)))) {
+        SHARE_LOG(WARN, "failed to add vector to center buffer", K(ret));
       } else {
-        nearest_center_idx = 0;
-        gate_distance = min_distance * GATE_DISTANCE_FACTOR;
+        ++data_cnt_in_cluster[nearest_center_idx];
       }
-      for (int64_t j = 1; OB_SUCC(ret) && j < center_count; ++j) {
-        float dis_near_cur = get_centers_distance(centers_distance, nearest_center_idx, j);
-        if (dis_near_cur < gate_distance) {
-          float dis_half_dim = 0.0;
+    }
+    if (OB_SUCC(ret)) {
+      dis_obj = dis_obj / sample_cnt;
+      float calc_sum_dis_rate = static_cast<float>(calc_dis_cnt + calc_half_dis_cnt / 2) / total_dis_cnt;
+      SHARE_LOG(TRACE, "dis_obj", K(dis_obj), K(calc_sum_dis_rate), K(calc_dis_cnt), K(calc_half_dis_cnt), K(total_dis_cnt));
+    }
+    centers_distance_ = nullptr;
+  }
+  return ret;
+}
+
+int ObElkanKmeansAlgo::run_slice(const int64_t slice_idx, const int64_t start, const int64_t end)
+{
+  int ret = OB_SUCCESS;
+  if (SLICE_STEP_CENTERS_DISTANCE == slice_step_) {
+    if (OB_FAIL(calc_centers_distance_slice(start, end))) {
+      SHARE_LOG(WARN, "failed to calc centers distance", K(ret), K(start), K(end));
+    }
+  } else if (SLICE_STEP_ELKAN_ASSIGN == slice_step_) {
+    if (OB_FAIL(search_nearest_center_slice(slice_idx, start, end))) {
+      SHARE_LOG(WARN, "failed to search nearest center", K(ret), K(slice_idx), K(start), K(end));
+    }
+  } else if (OB_FAIL(ObKmeansAlgo::run_slice(slice_idx, start, end))) {
+    SHARE_LOG(WARN, "failed to run slice", K(ret), K(slice_idx), K(start), K(end));
+  }
+  return ret;
+}
+
+// [start, end) are positions in the lower triangular matrix, position p of (i, j) is i * (i - 1) / 2 + j, j < i
+int ObElkanKmeansAlgo::calc_centers_distance_slice(const int64_t start, const int64_t end)
+{
+  int ret = OB_SUCCESS;
+  const int64_t dim = kmeans_ctx_->dim_;
+  int64_t i = static_cast<int64_t>((1 + sqrt(1.0 + 8.0 * start)) / 2);
+  while (i * (i - 1) / 2 > start) {
+    --i;
+  }
+  while ((i + 1) * i / 2 <= start) {
+    ++i;
+  }
+  int64_t j = start - i * (i - 1) / 2;
+  float distance = 0.0;
+  for (int64_t p = start; OB_SUCC(ret) && p < end; ++p) {
+    if (OB_FAIL(calc_kmeans_distance(centers_[cur_idx_].at(i), centers_[cur_idx_].at(j), dim, distance))) {
+      SHARE_LOG(WARN, "failed to calc kmeans distance between centers", K(ret));
+    } else {
+      centers_distance_[p] = distance;
+      if (++j == i) {
+        ++i;
+        j = 0;
+      }
+    }
+  }
+  return ret;
+}
+
+int ObElkanKmeansAlgo::search_nearest_center_slice(const int64_t slice_idx, const int64_t start, const int64_t end)
+{
+  int ret = OB_SUCCESS;
+  const int64_t center_count = kmeans_ctx_->lists_;
+  const int64_t dim = kmeans_ctx_->dim_;
+  int64_t calc_dis_cnt = 0;
+  int64_t calc_half_dis_cnt = 0;
+  for (int64_t i = start; OB_SUCC(ret) && i < end; ++i) {
+    float* sample_vector = slice_vectors_->at(i);
+    int64_t nearest_center_idx = 0;
+    float min_distance = FLT_MAX;
+    float gate_distance = FLT_MAX;
+    calc_dis_cnt++;
+    if (OB_FAIL(calc_kmeans_distance(sample_vector, centers_[cur_idx_].at(0), dim, min_distance))) {
+      SHARE_LOG(WARN, "failed to calc kmeans distance", K(ret));
+    } else {
+      nearest_center_idx = 0;
+      gate_distance = min_distance * GATE_DISTANCE_FACTOR;
+    }
+    for (int64_t j = 1; OB_SUCC(ret) && j < center_count; ++j) {
+      float dis_near_cur = get_centers_distance(centers_distance_, nearest_center_idx, j);
+      if (dis_near_cur < gate_distance) {
+        float dis_half_dim = 0.0;
+        calc_half_dis_cnt++;
+        if (OB_FAIL(calc_kmeans_distance(sample_vector, centers_[cur_idx_].at(j), dim / 2, dis_half_dim))) {
+          SHARE_LOG(WARN, "failed to calc kmeans distance", K(ret)); 
+        } else if (dis_half_dim < min_distance) {
+          float full_distance = 0.0;
           calc_half_dis_cnt++;
-          if (OB_FAIL(calc_kmeans_distance(sample_vector, centers_[cur_idx_].at(j), dim / 2, dis_half_dim))) {
-            SHARE_LOG(WARN, "failed to calc kmeans distance", K(ret)); 
-          } else if (dis_half_dim < min_distance) {
-            float full_distance = 0.0;
-            calc_half_dis_cnt++;
-            if (OB_FAIL(calc_kmeans_distance(sample_vector + dim / 2, centers_[cur_idx_].at(j) + dim / 2, dim - dim / 2, full_distance))) {
-              SHARE_LOG(WARN, "failed to calc kmeans distance", K(ret));
-            } else if (OB_FALSE_IT(full_distance += dis_half_dim)) {
-            } else if (full_distance < min_distance) {
-              min_distance = full_distance;
-              gate_distance = min_distance * GATE_DISTANCE_FACTOR;
-              nearest_center_idx = j;
-            }
+          if (OB_FAIL(calc_kmeans_distance(sample_vector + dim / 2, centers_[cur_idx_].at(j) + dim / 2, dim - dim / 2, full_distance))) {
+            SHARE_LOG(WARN, "failed to calc kmeans distance", K(ret));
+          } else if (OB_FALSE_IT(full_distance += dis_half_dim)) {
+          } else if (full_distance < min_distance) {
+            min_distance = full_distance;
+            gate_distance = min_distance * GATE_DISTANCE_FACTOR;
+            nearest_center_idx = j;
           }
         }
       }
-      if (OB_SUCC(ret)) {
-        // Update the distance of the target function
-        dis_obj += min_distance;
-        if (OB_FAIL(centers_[next_idx()].add(nearest_center_idx, dim, sample_vector))) {
-          SHARE_LOG(WARN, "failed to add vector to center buffer", K(ret));
-        } else {
-          ++data_cnt_in_cluster[nearest_center_idx];
-        }
-      }
     }
     if (OB_SUCC(ret)) {
-      dis_obj = dis_obj / sample_cnt;
-      float calc_sum_dis_rate = static_cast<float>(calc_dis_cnt + calc_half_dis_cnt / 2) / total_dis_cnt;
-      SHARE_LOG(TRACE, "dis_obj", K(dis_obj), K(calc_sum_dis_rate), K(calc_dis_cnt), K(calc_half_dis_cnt), K(total_dis_cnt));
+      slice_assign_[i] = static_cast<int32_t>(nearest_center_idx);
+      slice_min_dist_[i] = min_distance;
     }
   }
+  slice_calc_cnt_[slice_idx] += calc_dis_cnt;
+  slice_half_calc_cnt_[slice_idx] += calc_half_dis_cnt;
   return ret;
 }
 
@@ -924,6 +1123,16 @@ int ObElkanKmeansAlgo::do_kmeans(const ObIArray<float*> &input_vectors)
     } else {
       MEMSET(data_cnt_in_cluster, 0, sizeof(int32_t) * kmeans_ctx_->lists_);
     }
+    if (OB_FAIL(ret)) {
+    } else if (OB_ISNULL(slice_assign_ =
+        static_cast<int32_t*>(ivf_build_mem_ctx_.Allocate(sizeof(int32_t) * input_vectors.count())))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      SHARE_LOG(WARN, "failed to alloc memory", K(ret), K(ivf_build_mem_ctx_.get_all_vsag_use_mem_byte()));
+    } else if (OB_ISNULL(slice_min_dist_ =
+        static_cast<float*>(ivf_build_mem_ctx_.Allocate(sizeof(float) * input_vectors.count())))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      SHARE_LOG(WARN, "failed to alloc memory", K(ret), K(ivf_build_mem_ctx_.get_all_vsag_use_mem_byte()));
+    }
 
     const int64_t dim = kmeans_ctx_->dim_;
     float prev_dis_obj = 0;
@@ -991,6 +1200,175 @@ int ObElkanKmeansAlgo::do_kmeans(const ObIArray<float*> &input_vectors)
       ivf_build_mem_ctx_.Deallocate(data_cnt_in_cluster);
       data_cnt_in_cluster = nullptr;
     }
+    if (OB_NOT_NULL(slice_assign_)) {
+      ivf_build_mem_ctx_.Deallocate(slice_assign_);
+      slice_assign_ = nullptr;
+    }
+    if (OB_NOT_NULL(slice_min_dist_)) {
+      ivf_build_mem_ctx_.Deallocate(slice_min_dist_);
+      slice_min_dist_ = nullptr;
+    }
+    if (OB_SUCC(ret)) {
+      status_ = FINISH;
+    }
+  }
+  return ret;
+}
+
+// ------------------ ObMiniBatchKmeansAlgo implement ------------------
+void ObMiniBatchKmeansAlgo::destroy()
+{
+  init_vectors_.reset();
+  ObKmeansAlgo::destroy();
+}
+
+int64_t ObMiniBatchKmeansAlgo::get_batch_size(const int64_t sample_cnt) const
+{
+  return OB_MIN(sample_cnt, OB_MAX(MIN_BATCH_SIZE, kmeans_ctx_->lists_ * BATCH_SIZE_PER_LIST));
+}
+
+int ObMiniBatchKmeansAlgo::init_first_center(const ObIArray<float*> &input_vectors)
+{
+  int ret = OB_SUCCESS;
+  const int64_t sample_cnt = input_vectors.count();
+  const int64_t init_cnt = OB_MIN(sample_cnt, get_batch_size(sample_cnt) * INIT_SIZE_PER_BATCH);
+  init_vectors_.set_attr(ObMemAttr(kmeans_ctx_->tenant_id_, "KmeansInit"));
+  init_vectors_.reuse();
+  if (OB_FAIL(init_vectors_.reserve(init_cnt))) {
+    SHARE_LOG(WARN, "failed to reserve init vectors", K(ret), K(init_cnt));
+  } else {
+    // selection sampling, keeps the order of samples
+    int64_t need_cnt = init_cnt;
+    for (int64_t i = 0; OB_SUCC(ret) && need_cnt > 0 && i < sample_cnt; ++i) {
+      if (ObRandom::rand(0, sample_cnt - i - 1) < need_cnt) {
+        if (OB_FAIL(init_vectors_.push_back(input_vectors.at(i)))) {
+          SHARE_LOG(WARN, "failed to push back init vector", K(ret));
+        } else {
+          --need_cnt;
+        }
+      }
+    }
+  }
+  if (FAILEDx(ObKmeansAlgo::init_first_center(init_vectors_))) {
+    SHARE_LOG(WARN, "failed to init first center", K(ret));
+  } else {
+    SHARE_LOG(INFO, "mini-batch kmeans seeds on sampled vectors", K(init_cnt), K(sample_cnt), K(kmeans_ctx_->lists_));
+  }
+  return ret;
+}
+
+int ObMiniBatchKmeansAlgo::init_centers(const ObIArray<float*> &input_vectors)
+{
+  UNUSED(input_vectors);
+  return ObKmeansAlgo::init_centers(init_vectors_);
+}
+
+int ObMiniBatchKmeansAlgo::do_kmeans(const ObIArray<float*> &input_vectors)
+{
+  int ret = OB_SUCCESS;
+  if (RUNNING_KMEANS != status_) {
+    ret = OB_STATE_NOT_MATCH;
+    SHARE_LOG(WARN, "status not match", K(ret), K(status_));
+  } else {
+    const int64_t sample_cnt = input_vectors.count();
+    const int64_t lists = kmeans_ctx_->lists_;
+    const int64_t dim = kmeans_ctx_->dim_;
+    const int64_t batch_size = get_batch_size(sample_cnt);
+    const int64_t max_steps = OB_MAX(MIN_STEPS, MAX_EPOCHS * sample_cnt / batch_size);
+    // smoothing factor of the objective, about the fraction of samples seen by one step
+    const double alpha = OB_MIN(1.0, 2.0 * batch_size / (sample_cnt + 1));
+    int64_t *center_cnt = nullptr; // the number of samples that have moved each center
+    int64_t *moved_step = nullptr; // the last step that moved each center
+    ObArray<float*> batch_vectors;
+    batch_vectors.set_attr(ObMemAttr(kmeans_ctx_->tenant_id_, "KmeansBatch"));
+    if (OB_ISNULL(center_cnt = static_cast<int64_t*>(ivf_build_mem_ctx_.Allocate(sizeof(int64_t) * lists)))
+        || OB_ISNULL(moved_step = static_cast<int64_t*>(ivf_build_mem_ctx_.Allocate(sizeof(int64_t) * lists)))
+        || OB_ISNULL(slice_assign_ = static_cast<int32_t*>(ivf_build_mem_ctx_.Allocate(sizeof(int32_t) * batch_size)))
+        || OB_ISNULL(slice_min_dist_ = static_cast<float*>(ivf_build_mem_ctx_.Allocate(sizeof(float) * batch_size)))
+        || OB_ISNULL(slice_dist_buf_ = static_cast<float*>(ivf_build_mem_ctx_.Allocate(sizeof(float) * lists * get_slice_count())))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      SHARE_LOG(WARN, "failed to alloc memory", K(ret), K(ivf_build_mem_ctx_.get_all_vsag_use_mem_byte()));
+    } else if (OB_FAIL(batch_vectors.reserve(batch_size))) {
+      SHARE_LOG(WARN, "failed to reserve batch vectors", K(ret), K(batch_size));
+    } else {
+      MEMSET(center_cnt, 0, sizeof(int64_t) * lists);
+      for (int64_t i = 0; i < lists; ++i) {
+        moved_step[i] = -1;
+      }
+    }
+
+    double ewa_obj = 0;
+    double best_obj = DBL_MAX;
+    int64_t no_improvement_cnt = 0;
+    int64_t step = 0;
+    for (step = 0; OB_SUCC(ret) && step < max_steps && no_improvement_cnt < MAX_NO_IMPROVEMENT; ++step) {
+      double batch_obj = 0;
+      batch_vectors.reuse();
+      // 1. draw a random batch and search the nearest center of each sample
+      for (int64_t b = 0; OB_SUCC(ret) && b < batch_size; ++b) {
+        if (OB_FAIL(batch_vectors.push_back(input_vectors.at(ObRandom::rand(0, sample_cnt - 1))))) {
+          SHARE_LOG(WARN, "failed to push back batch vector", K(ret));
+        }
+      }
+      if (FAILEDx(run_step(SLICE_STEP_NEAREST_CENTER, batch_vectors, batch_size))) {
+        SHARE_LOG(WARN, "failed to search nearest center", K(ret), K(step));
+      }
+      // 2. move each center towards its samples, the learning rate is 1 / samples seen by the center
+      for (int64_t b = 0; OB_SUCC(ret) && b < batch_size; ++b) {
+        const int32_t center_idx = slice_assign_[b];
+        float *center = centers_[cur_idx_].at(center_idx);
+        const float *sample = batch_vectors.at(b);
+        const float eta = 1.0f / static_cast<float>(++center_cnt[center_idx]);
+        for (int64_t d = 0; d < dim; ++d) {
+          center[d] += eta * (sample[d] - center[d]);
+        }
+        moved_step[center_idx] = step;
+        batch_obj += slice_min_dist_[b];
+      }
+      // 3. normalize the moved centers, if need
+      for (int64_t i = 0; OB_SUCC(ret) && i < lists; ++i) {
+        if (moved_step[i] == step && OB_FAIL(kmeans_ctx_->try_normalize(dim, centers_[cur_idx_].at(i), centers_[cur_idx_].at(i)))) {
+          LOG_WARN("failed to normalize vector", K(ret));
+        }
+      }
+      // 4. early stop when the smoothed objective stops decreasing
+      if (OB_SUCC(ret)) {
+        batch_obj /= batch_size;
+        ewa_obj = (0 == step) ? batch_obj : ewa_obj * (1 - alpha) + batch_obj * alpha;
+        if (ewa_obj < best_obj) {
+          best_obj = ewa_obj;
+          no_improvement_cnt = 0;
+        } else {
+          ++no_improvement_cnt;
+        }
+        SHARE_LOG(TRACE, "finish one mini-batch step", K(step), K(batch_obj), K(ewa_obj));
+        if (check_stop()) {
+          ret = OB_CANCELED;
+          SHARE_LOG(INFO, "kmeans is force stopped", K(ret), K(step));
+        }
+      }
+    }
+    LOG_INFO("finish mini-batch kmeans", K(ret), K(step), K(max_steps), K(batch_size), K(sample_cnt), K(ewa_obj));
+    if (OB_NOT_NULL(center_cnt)) {
+      ivf_build_mem_ctx_.Deallocate(center_cnt);
+      center_cnt = nullptr;
+    }
+    if (OB_NOT_NULL(moved_step)) {
+      ivf_build_mem_ctx_.Deallocate(moved_step);
+      moved_step = nullptr;
+    }
+    if (OB_NOT_NULL(slice_assign_)) {
+      ivf_build_mem_ctx_.Deallocate(slice_assign_);
+      slice_assign_ = nullptr;
+    }
+    if (OB_NOT_NULL(slice_min_dist_)) {
+      ivf_build_mem_ctx_.Deallocate(slice_min_dist_);
+      slice_min_dist_ = nullptr;
+    }
+    if (OB_NOT_NULL(slice_dist_buf_)) {
+      ivf_build_mem_ctx_.Deallocate(slice_dist_buf_);
+      slice_dist_buf_ = nullptr;
+    }
     if (OB_SUCC(ret)) {
       status_ = FINISH;
     }
@@ -1093,7 +1471,7 @@ ObIvfFlatBuildHelper::~ObIvfFlatBuildHelper()
 int ObIvfFlatBuildHelper::init_kmeans_ctx(const int64_t dim)
 {
   int ret = OB_SUCCESS;
-  ObKmeansAlgoType algo_type = ObKmeansAlgoType::KAT_ELKAN;
+  ObKmeansAlgoType algo_type = ObKmeansExecutor::get_algo_type(param_.nlist_, param_.sample_per_nlist_);
 
   void *buf = nullptr;
   ObVectorNormalizeInfo *norm_info = nullptr;
@@ -1455,6 +1833,74 @@ void ObKmeansBuildTaskHandler::handle_drop(void *task)
   }
 }
 
+/**************************** ObKmeansParallelRunner ******************************/
+int ObKmeansParallelRunner::init(ObKmeansBuildTaskHandler &handle, const int64_t slice_cnt)
+{
+  int ret = OB_SUCCESS;
+  if (OB_NOT_NULL(handle_)) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("init twice", KR(ret));
+  } else if (slice_cnt <= 0 || slice_cnt > ObKmeansSliceWorker::MAX_SLICE_CNT) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid slice count", KR(ret), K(slice_cnt));
+  } else {
+    handle_ = &handle;
+    slice_cnt_ = slice_cnt;
+  }
+  return ret;
+}
+
+int ObKmeansParallelRunner::run(ObKmeansSliceWorker &worker, const int64_t total)
+{
+  int ret = OB_SUCCESS;
+  const int64_t slice_cnt = OB_ISNULL(handle_) ? 1 : OB_MAX(1, OB_MIN(slice_cnt_, total / MIN_SLICE_ITEMS));
+  const int64_t slice_size = (total + slice_cnt - 1) / slice_cnt;
+  bool is_pushed[ObKmeansSliceWorker::MAX_SLICE_CNT];
+  MEMSET(is_pushed, 0, sizeof(is_pushed));
+  // 1. push slices except the first one to the thread group
+  for (int64_t i = 1; OB_SUCC(ret) && i < slice_cnt; ++i) {
+    const int64_t start = i * slice_size;
+    const int64_t end = OB_MIN(total, start + slice_size);
+    tasks_[i].reset();
+    if (start >= end) {
+    } else if (OB_FAIL(tasks_[i].init_slice(&worker, i, start, end))) {
+      LOG_WARN("fail to init slice task", KR(ret), K(i), K(start), K(end));
+    } else if (OB_FAIL(handle_->push_task(tasks_[i]))) {
+      LOG_WARN("fail to push slice task, run it in current thread", KR(ret), K(i));
+      tasks_[i].reset();
+      ret = OB_SUCCESS;
+    } else {
+      is_pushed[i] = true;
+    }
+  }
+  // 2. run the first slice and the slices failed to push in current thread
+  for (int64_t i = 0; OB_SUCC(ret) && i < slice_cnt; ++i) {
+    const int64_t start = i * slice_size;
+    const int64_t end = OB_MIN(total, start + slice_size);
+    if (is_pushed[i] || start >= end) {
+    } else if (OB_FAIL(worker.run_slice(i, start, end))) {
+      LOG_WARN("fail to run slice", KR(ret), K(i), K(start), K(end));
+    }
+  }
+  // 3. wait for the pushed slices even on failure, they refer to the state of worker
+  bool is_all_finish = false;
+  while (!is_all_finish) {
+    is_all_finish = true;
+    for (int64_t i = 1; is_all_finish && i < slice_cnt; ++i) {
+      is_all_finish = !is_pushed[i] || tasks_[i].is_finish();
+    }
+    if (!is_all_finish) {
+      ob_usleep(WAIT_SLICE_INTERVAL);
+    }
+  }
+  for (int64_t i = 1; OB_SUCC(ret) && i < slice_cnt; ++i) {
+    if (is_pushed[i] && OB_FAIL(tasks_[i].get_ret())) {
+      LOG_WARN("fail to run slice task", KR(ret), K(i), K(tasks_[i]));
+    }
+  }
+  return ret;
+}
+
 /******************************* ObKmeansBuildTask **********************************/
 int ObKmeansBuildTask::init(const common::ObTableID &table_id, const common::ObTabletID &tablet_id, int m_idx,
                             ObKmeansAlgo *algo, const ObIArray<float *> *vectors)
@@ -1482,12 +1928,39 @@ int ObKmeansBuildTask::init(const common::ObTableID &table_id, const common::ObT
   return ret;
 }
 
+int ObKmeansBuildTask::init_slice(ObKmeansSliceWorker *worker, const int64_t slice_idx, const int64_t start,
+                                  const int64_t end)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(is_inited_)) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("init twice", KR(ret));
+  } else if (OB_ISNULL(worker) || slice_idx < 0 || start >= end) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", KR(ret), KP(worker), K(slice_idx), K(start), K(end));
+  } else {
+    slice_worker_ = worker;
+    slice_idx_ = slice_idx;
+    slice_start_ = start;
+    slice_end_ = end;
+    task_ctx_.gmt_create_ = ObTimeUtility::current_time();
+    task_ctx_.is_finish_ = false;
+    task_ctx_.ret_code_ = OB_SUCCESS;
+    is_inited_ = true;
+  }
+  return ret;
+}
+
 void ObKmeansBuildTask::reset()
 {
 
   is_inited_ = false;
   algo_ = nullptr;
   vectors_ = nullptr;
+  slice_worker_ = nullptr;
+  slice_idx_ = 0;
+  slice_start_ = 0;
+  slice_end_ = 0;
   // update ctx
   task_ctx_.reset();
 }
@@ -1499,6 +1972,10 @@ int ObKmeansBuildTask::do_work()
     ret = OB_NOT_INIT;
     LOG_WARN("not init", KR(ret));
   } else if (OB_FALSE_IT(task_ctx_.gmt_modified_ = ObTimeUtility::current_time())) {
+  } else if (OB_NOT_NULL(slice_worker_)) {
+    if (OB_FAIL(slice_worker_->run_slice(slice_idx_, slice_start_, slice_end_))) {
+      LOG_WARN("fail to run slice", KR(ret), K_(slice_idx), K_(slice_start), K_(slice_end));
+    }
   } else if (OB_FAIL(algo_->build(*vectors_))) {
     LOG_WARN("fail to build", KR(ret), K_(task_ctx), KP_(algo), KP_(vectors));
   }
@@ -1506,9 +1983,10 @@ int ObKmeansBuildTask::do_work()
       algo_->destroy();
   }
   // update ctx
-  task_ctx_.is_finish_ = true;
   task_ctx_.ret_code_ = ret;
   task_ctx_.gmt_modified_ = ObTimeUtility::current_time();
+  // publish the results before marking finish, the waiter may read them right after
+  ATOMIC_STORE(&task_ctx_.is_finish_, true);
   return ret;
 }
 } // end namespace share
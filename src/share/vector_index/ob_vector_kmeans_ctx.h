@@ -18,6 +18,7 @@
 #define SRC_SHARE_VECTOR_INDEX_OB_VECTOR_KMEANS_CTX_H
 
 #include "lib/container/ob_se_array.h"
+#include "lib/container/ob_array.h"
 #include "lib/allocator/page_arena.h"
 #include "ob_vector_index_util.h"
 #include "share/vector_type/ob_vector_l2_distance.h"
@@ -98,9 +99,20 @@ public:
   ObSEArray<float*, 64> sample_vectors_;
 };
 
+// one step of kmeans split into slices of items, see ObKmeansParallelRunner
+class ObKmeansSliceWorker
+{
+public:
+  static const int64_t MAX_SLICE_CNT = 64;
+  virtual ~ObKmeansSliceWorker() {}
+  // process items [start, end) of the current step, slice_idx is in [0, MAX_SLICE_CNT)
+  virtual int run_slice(const int64_t slice_idx, const int64_t start, const int64_t end) = 0;
+};
+
+class ObKmeansParallelRunner;
 // normal kmeans
 // quantization and normalization are not of concern here
-class ObKmeansAlgo {
+class ObKmeansAlgo : public ObKmeansSliceWorker {
 public:
   explicit ObKmeansAlgo(ObIvfMemContext &ivf_build_mem_ctx)
     : kmeans_ctx_(nullptr),
@@ -108,7 +120,14 @@ public:
       weight_(nullptr),
       status_(PREPARE_CENTERS),
       force_stop_(false),
-      ivf_build_mem_ctx_(ivf_build_mem_ctx)
+      ivf_build_mem_ctx_(ivf_build_mem_ctx),
+      runner_(nullptr),
+      slice_step_(SLICE_STEP_NONE),
+      slice_vectors_(nullptr),
+      slice_center_(nullptr),
+      slice_assign_(nullptr),
+      slice_min_dist_(nullptr),
+      slice_dist_buf_(nullptr)
   {}
   virtual ~ObKmeansAlgo() {
     ObKmeansAlgo::destroy();
@@ -133,7 +152,22 @@ public:
 
   void set_stop() { ATOMIC_STORE(&force_stop_, true); }
   bool check_stop() { return ATOMIC_LOAD(&force_stop_) == true; }
+  // per-sample steps run on the kmeans build thread group when a runner is set
+  void set_parallel_runner(ObKmeansParallelRunner *runner) { runner_ = runner; }
+  virtual int run_slice(const int64_t slice_idx, const int64_t start, const int64_t end) override;
 protected:
+  enum ObKmeansSliceStep
+  {
+    SLICE_STEP_NONE = 0,
+    SLICE_STEP_UPDATE_WEIGHT, // kmeans++: min distance of each sample to the chosen centers
+    SLICE_STEP_NEAREST_CENTER, // brute force nearest center of each sample
+    SLICE_STEP_CENTERS_DISTANCE, // elkan: distance between each two centers
+    SLICE_STEP_ELKAN_ASSIGN, // elkan: nearest center of each sample with triangle pruning
+    SLICE_STEP_MAX
+  };
+  // run `step` over items [0, total), slice results are left in the slice_* members
+  int run_step(const ObKmeansSliceStep step, const ObIArray<float*> &input_vectors, const int64_t total);
+  int64_t get_slice_count() const;
   int inner_build(const ObIArray<float*> &input_vectors);
   int quick_centers(const ObIArray<float*> &input_vectors); // use samples as finally centers
   virtual int init_first_center(const ObIArray<float*> &input_vectors);
@@ -153,13 +187,23 @@ protected:
   // When executing in parallel, tasks may be forcibly stopped.
   volatile bool force_stop_;
   ObIvfMemContext &ivf_build_mem_ctx_; // from ObIvfBuildHelper, used for alloc memory for kmeans build process
+  ObKmeansParallelRunner *runner_; // nullptr means running all steps in the current thread
+  // state of the running slice step
+  ObKmeansSliceStep slice_step_;
+  const ObIArray<float*> *slice_vectors_;
+  const float *slice_center_; // the latest chosen center of kmeans++
+  int32_t *slice_assign_; // nearest center idx of each item
+  float *slice_min_dist_; // distance to the nearest center of each item
+  float *slice_dist_buf_; // lists_ distances for each slice
+  double slice_sums_[MAX_SLICE_CNT];
 };
 
 class ObElkanKmeansAlgo : public ObKmeansAlgo
 {
 public:
   ObElkanKmeansAlgo(ObIvfMemContext &ivf_build_mem_ctx)
-    : ObKmeansAlgo(ivf_build_mem_ctx)
+    : ObKmeansAlgo(ivf_build_mem_ctx),
+      centers_distance_(nullptr)
   {}
   virtual ~ObElkanKmeansAlgo() {
     destroy();
@@ -169,8 +213,17 @@ public:
 protected:
   virtual int do_kmeans(const ObIArray<float*> &input_vectors) override;
 
+  virtual int run_slice(const int64_t slice_idx, const int64_t start, const int64_t end) override;
+
 private:
   int search_nearest_center(const ObIArray<float*> &input_vectors, float* centers_distance, int32_t *data_cnt_in_cluster, float &dis_obj);
+  int calc_centers_distance_slice(const int64_t start, const int64_t end);
+  int search_nearest_center_slice(const int64_t slice_idx, const int64_t start, const int64_t end);
+
+private:
+  float *centers_distance_;
+  int64_t slice_calc_cnt_[MAX_SLICE_CNT];
+  int64_t slice_half_calc_cnt_[MAX_SLICE_CNT];
 
 protected:
   static constexpr float GATE_DISTANCE_FACTOR = 4.0; // for gate distance
@@ -178,6 +231,45 @@ protected:
   static const int64_t N_ITER = 25; // for max iterations
 };
 
+// mini-batch kmeans (Sculley, WWW'10)
+// centers are seeded by kmeans++ on a random subset of the samples, then each step assigns a
+// random batch of samples and moves every center towards its assigned samples with a per-center
+// learning rate. The whole sample set is never scanned per step.
+class ObMiniBatchKmeansAlgo : public ObKmeansAlgo
+{
+public:
+  ObMiniBatchKmeansAlgo(ObIvfMemContext &ivf_build_mem_ctx)
+    : ObKmeansAlgo(ivf_build_mem_ctx),
+      init_vectors_()
+  {}
+  virtual ~ObMiniBatchKmeansAlgo() {
+    destroy();
+  }
+  virtual void destroy() override;
+
+protected:
+  virtual int init_first_center(const ObIArray<float*> &input_vectors) override;
+  virtual int init_centers(const ObIArray<float*> &input_vectors) override;
+  virtual int do_kmeans(const ObIArray<float*> &input_vectors) override;
+
+private:
+  int64_t get_batch_size(const int64_t sample_cnt) const;
+
+private:
+  ObArray<float*> init_vectors_; // subset of samples used by kmeans++
+
+public:
+  static const int64_t MIN_BATCH_SIZE = 4096;
+  static const int64_t BATCH_SIZE_PER_LIST = 2;
+  static const int64_t INIT_SIZE_PER_BATCH = 3; // samples for kmeans++ = 3 * batch size
+  static const int64_t MAX_EPOCHS = 3; // max steps = MAX_EPOCHS * samples / batch size
+  static const int64_t MIN_STEPS = 50;
+  static const int64_t MAX_NO_IMPROVEMENT = 10; // early stop if the smoothed objective stalls
+  // with _enable_ivf_mini_batch_kmeans, use mini-batch instead of elkan when the sample count reaches this
+  static const int64_t MIN_SAMPLE_CNT = 1000000;
+};
+
+class ObKmeansBuildTaskHandler;
 class ObKmeansExecutor
 {
 public:
@@ -197,10 +289,16 @@ public:
   virtual int append_sample_vector(float* vector);
   OB_INLINE int64_t get_max_sample_count() { return ctx_.max_sample_count_; }
   bool is_empty() { return ctx_.is_empty(); }
+  int init_build_handle(ObKmeansBuildTaskHandler &handle);
+  // mini-batch for large sample sets, elkan otherwise
+  static ObKmeansAlgoType get_algo_type(const int64_t lists, const int64_t samples_per_nlist);
 
   VIRTUAL_TO_STRING_KV(K(is_inited_), 
                K(ctx_));
 
+protected:
+  int create_algo(ObKmeansAlgoType algo_type, ObKmeansAlgo *&algo);
+
 protected:
   bool is_inited_;
   ObKmeansCtx ctx_;
@@ -210,15 +308,8 @@ protected:
 class ObSingleKmeansExecutor : public ObKmeansExecutor
 {
 public:
-  ObSingleKmeansExecutor(ObIvfMemContext &ivf_build_mem_ctx) : ObKmeansExecutor(ivf_build_mem_ctx), algo_(nullptr) {}
-  virtual ~ObSingleKmeansExecutor() {
-    is_inited_ = false;
-    if (OB_NOT_NULL(algo_)) {
-      algo_->~ObKmeansAlgo();
-      ivf_build_mem_ctx_.Deallocate(algo_);
-      algo_ = nullptr;
-    }
-  }
+  ObSingleKmeansExecutor(ObIvfMemContext &ivf_build_mem_ctx) : ObKmeansExecutor(ivf_build_mem_ctx), algo_(nullptr), runner_(nullptr) {}
+  virtual ~ObSingleKmeansExecutor();
   virtual int init(ObKmeansAlgoType algo_type,
            const int64_t tenant_id,
            const int64_t lists,
@@ -235,11 +326,14 @@ public:
 
   TO_STRING_KV(KP(algo_), KPC(algo_));
 
+private:
+  int prepare_parallel_runner();
+
 private:
   ObKmeansAlgo *algo_;
+  ObKmeansParallelRunner *runner_;
 };
 
-class ObKmeansBuildTaskHandler;
 class ObKmeansBuildTask;
 class ObMultiKmeansExecutor : public ObKmeansExecutor
 {
@@ -258,7 +352,6 @@ public:
           ObVectorNormalizeInfo *norm_info = nullptr,
           const int64_t pq_m_size = 1) override;
   virtual int build(ObInsertMonitor *insert_monitor);
-  int init_build_handle(ObKmeansBuildTaskHandler &handle);
   int build_parallel(const common::ObTableID &table_id, const common::ObTabletID &tablet_id,
                      ObInsertMonitor *insert_monitor);
   int64_t get_total_centers_count() const;
@@ -457,13 +550,18 @@ class ObKmeansBuildTask
 {
 public:
 
-  ObKmeansBuildTask() : is_inited_(false), algo_(nullptr), vectors_(nullptr) {}
+  ObKmeansBuildTask()
+    : is_inited_(false), algo_(nullptr), vectors_(nullptr),
+      slice_worker_(nullptr), slice_idx_(0), slice_start_(0), slice_end_(0)
+  {}
   ~ObKmeansBuildTask() { reset(); }
   int init(const common::ObTableID &table_id, const common::ObTabletID &tablet_id, int m_idx, ObKmeansAlgo *algo,
            const ObIArray<float *> *vectors);
+  // run one slice of a kmeans step instead of a whole kmeans build
+  int init_slice(ObKmeansSliceWorker *worker, const int64_t slice_idx, const int64_t start, const int64_t end);
   void reset();
   int do_work();
-  OB_INLINE bool is_finish() const { return is_inited_ == false || task_ctx_.is_finish_; }
+  OB_INLINE bool is_finish() const { return is_inited_ == false || ATOMIC_LOAD(&task_ctx_.is_finish_); }
   OB_INLINE int get_ret() const { return task_ctx_.ret_code_; }
   OB_INLINE void set_task_stop()
   {
@@ -472,12 +570,16 @@ public:
     }
   }
 
-  TO_STRING_KV(K_(is_inited), K_(task_ctx));
+  TO_STRING_KV(K_(is_inited), K_(task_ctx), KP_(slice_worker), K_(slice_idx), K_(slice_start), K_(slice_end));
 
 private:
   bool is_inited_;
   ObKmeansAlgo *algo_;
   const ObIArray<float *> *vectors_;
+  ObKmeansSliceWorker *slice_worker_;
+  int64_t slice_idx_;
+  int64_t slice_start_;
+  int64_t slice_end_;
   // task ctx
   ObKmeansBuildTaskCtx task_ctx_;
 
@@ -527,6 +629,31 @@ private:
   DISALLOW_COPY_AND_ASSIGN(ObKmeansBuildTaskHandler);
 };
 
+// splits one kmeans step into slices and runs them on the kmeans build thread group,
+// the calling thread runs the first slice itself and then waits for the others.
+// must not be used from a thread of the same group, it would wait on its own queue.
+class ObKmeansParallelRunner
+{
+public:
+  ObKmeansParallelRunner() : handle_(nullptr), slice_cnt_(1) {}
+  ~ObKmeansParallelRunner() { handle_ = nullptr; }
+  int init(ObKmeansBuildTaskHandler &handle, const int64_t slice_cnt);
+  int64_t get_slice_count() const { return slice_cnt_; }
+  int run(ObKmeansSliceWorker &worker, const int64_t total);
+
+  TO_STRING_KV(KP_(handle), K_(slice_cnt));
+
+public:
+  static const int64_t MIN_SLICE_ITEMS = 1024;
+  static const int64_t WAIT_SLICE_INTERVAL = 50; // us
+
+private:
+  ObKmeansBuildTaskHandler *handle_;
+  int64_t slice_cnt_;
+  ObKmeansBuildTask tasks_[ObKmeansSliceWorker::MAX_SLICE_CNT];
+  DISALLOW_COPY_AND_ASSIGN(ObKmeansParallelRunner);
+};
+
 }  // namespace share
 }
 
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ob_vector_batch_distance.h"
+#include "ob_vector_l2_distance.h"
+#include "ob_vector_cosine_distance.h"
+namespace oceanbase
+{
+namespace common
+{
+namespace
+{
+typedef void (*ObIpNormBatchFunc)(const float *query, const float *rows, const int64_t dim,
+                                  const int64_t count, float *dists, float *norms);
+
+// slot 0 is the generic variant, others are specialized for common embedding dimensions
+static const int64_t BATCH_DIM_SLOT_CNT = 6;
+static const int64_t BATCH_SPECIALIZED_DIMS[BATCH_DIM_SLOT_CNT] = {0, 128, 384, 768, 1024, 1536};
+// rows scored per round of cosine distance, bounded by the norm buffer on stack
+static const int64_t COSINE_BATCH_ROWS = 256;
+
+struct ObBatchDistanceFuncTable
+{
+  ObVectorBatchDistance<float>::BatchFunc l2_square_[BATCH_DIM_SLOT_CNT];
+  ObVectorBatchDistance<float>::BatchFunc ip_[BATCH_DIM_SLOT_CNT];
+  ObIpNormBatchFunc ip_norm_[BATCH_DIM_SLOT_CNT];
+};
+
+#define BATCH_FUNC_SLOTS(ns, func) \
+  { ns::func<0>, ns::func<128>, ns::func<384>, ns::func<768>, ns::func<1024>, ns::func<1536> }
+
+#define BATCH_FUNC_TABLE(ns)                   \
+  {                                            \
+    BATCH_FUNC_SLOTS(ns, l2_square_batch),     \
+    BATCH_FUNC_SLOTS(ns, ip_batch),            \
+    BATCH_FUNC_SLOTS(ns, ip_norm_batch)        \
+  }
+
+static const ObBatchDistanceFuncTable NORMAL_BATCH_FUNCS = BATCH_FUNC_TABLE(common::specific::normal);
+#if OB_USE_MULTITARGET_CODE
+static const ObBatchDistanceFuncTable AVX2_BATCH_FUNCS = BATCH_FUNC_TABLE(common::specific::avx2);
+static const ObBatchDistanceFuncTable AVX512_BATCH_FUNCS = BATCH_FUNC_TABLE(common::specific::avx512);
+#endif
+
+#undef BATCH_FUNC_TABLE
+#undef BATCH_FUNC_SLOTS
+
+static const ObBatchDistanceFuncTable &get_batch_func_table()
+{
+#if OB_USE_MULTITARGET_CODE
+  static const ObBatchDistanceFuncTable &table =
+      common::is_arch_supported(ObTargetArch::AVX512) ? AVX512_BATCH_FUNCS
+      : common::is_arch_supported(ObTargetArch::AVX2) ? AVX2_BATCH_FUNCS
+      : NORMAL_BATCH_FUNCS;
+  return table;
+#else
+  return NORMAL_BATCH_FUNCS;
+#endif
+}
+
+OB_INLINE static int64_t get_batch_dim_slot(const int64_t dim)
+{
+  int64_t slot = 0;
+  for (int64_t i = 1; 0 == slot && i < BATCH_DIM_SLOT_CNT; ++i) {
+    if (BATCH_SPECIALIZED_DIMS[i] == dim) {
+      slot = i;
+    }
+  }
+  return slot;
+}
+
+OB_INLINE static int check_batch_args(const float *query, const float *rows, const int64_t dim,
+                                      const int64_t count, float *dists)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(dim <= 0 || count < 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LIB_LOG(WARN, "invalid argument", K(ret), K(dim), K(count));
+  } else if (count > 0 && (OB_ISNULL(query) || OB_ISNULL(rows) || OB_ISNULL(dists))) {
+    ret = OB_ERR_NULL_VALUE;
+    LIB_LOG(WARN, "invalid null pointer", K(ret), KP(query), KP(rows), KP(dists));
+  }
+  return ret;
+}
+} // namespace
+
+template <>
+int ObVectorBatchDistance<float>::l2_square_batch(const float *query, const float *rows,
+                                                   const int64_t dim, const int64_t count,
+                                                   float *dists)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(check_batch_args(query, rows, dim, count, dists))) {
+    LIB_LOG(WARN, "invalid batch args", K(ret));
+  } else if (count > 0) {
+    get_batch_func_table().l2_square_[get_batch_dim_slot(dim)](query, rows, dim, count, dists);
+  }
+  return ret;
+}
+
+template <>
+int ObVectorBatchDistance<float>::l2_distance_batch(const float *query, const float *rows,
+                                                     const int64_t dim, const int64_t count,
+                                                     float *dists)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(l2_square_batch(query, rows, dim, count, dists))) {
+    LIB_LOG(WARN, "failed to cal l2 square batch", K(ret));
+  } else {
+    for (int64_t i = 0; i < count; ++i) {
+      dists[i] = sqrtf(dists[i]);
+    }
+  }
+  return ret;
+}
+
+template <>
+int ObVectorBatchDistance<float>::ip_batch(const float *query, const float *rows,
+                                            const int64_t dim, const int64_t count,
+                                            float *dists)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(check_batch_args(query, rows, dim, count, dists))) {
+    LIB_LOG(WARN, "invalid batch args", K(ret));
+  } else if (count > 0) {
+    get_batch_func_table().ip_[get_batch_dim_slot(dim)](query, rows, dim, count, dists);
+  }
+  return ret;
+}
+
+template <>
+int ObVectorBatchDistance<float>::cosine_distance_batch(const float *query, const float *rows,
+                                                         const int64_t dim, const int64_t count,
+                                                         float *dists)
+{
+  int ret = OB_SUCCESS;
+  float query_norm = 0;
+  if (OB_FAIL(check_batch_args(query, rows, dim, count, dists))) {
+    LIB_LOG(WARN, "invalid batch args", K(ret));
+  } else if (0 == count) {
+  } else if (FALSE_IT(query_norm = ObVectorL2Distance<float>::l2_norm_square(query, dim))) {
+  } else if (0 == query_norm) {
+    ret = OB_ERR_NULL_VALUE;
+    LIB_LOG(WARN, "query vector has zero norm", K(ret), K(dim), K(count));
+  } else {
+    ObIpNormBatchFunc func = get_batch_func_table().ip_norm_[get_batch_dim_slot(dim)];
+    float norms[COSINE_BATCH_ROWS];
+    for (int64_t start = 0; start < count; start += COSINE_BATCH_ROWS) {
+      const int64_t batch_cnt = MIN(COSINE_BATCH_ROWS, count - start);
+      float *batch_dists = dists + start;
+      func(query, rows + start * dim, dim, batch_cnt, batch_dists, norms);
+      for (int64_t i = 0; i < batch_cnt; ++i) {
+        if (0 == norms[i]) {
+          batch_dists[i] = FLT_MAX;
+        } else {
+          const double similarity = batch_dists[i] / sqrt(static_cast<double>(query_norm) * norms[i]);
+          batch_dists[i] = static_cast<float>(ObVectorCosineDistance<float>::get_cosine_distance(similarity));
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+template <>
+int ObVectorBatchDistance<float>::l2_square_pairwise(const float *query, const float *rows,
+                                                      const int64_t dim, const int64_t count,
+                                                      float *dists)
+{
+  int ret = OB_SUCCESS;
+  double square = 0;
+  if (OB_FAIL(check_batch_args(query, rows, dim, count, dists))) {
+    LIB_LOG(WARN, "invalid batch args", K(ret));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < count; ++i) {
+    if (OB_FAIL(ObVectorL2Distance<float>::l2_square_func(query, rows + i * dim, dim, square))) {
+      LIB_LOG(WARN, "failed to cal l2 square", K(ret), K(i));
+    } else {
+      dists[i] = static_cast<float>(square);
+    }
+  }
+  return ret;
+}
+
+}
+}
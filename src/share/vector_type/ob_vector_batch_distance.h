@@ -0,0 +1,474 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OCEANBASE_LIB_OB_VECTOR_BATCH_DISTANCE_H_
+#define OCEANBASE_LIB_OB_VECTOR_BATCH_DISTANCE_H_
+
+#include "lib/utility/ob_print_utils.h"
+#include "lib/oblog/ob_log.h"
+#include "lib/ob_define.h"
+#include "ob_vector_op_common.h"
+
+namespace oceanbase
+{
+namespace common
+{
+// One-to-many distance kernels: score one query against `count` rows stored contiguously,
+// row i starts at rows + i * dim. Each pass loads a query block once and reuses it for
+// four rows. Dimensions in ObVectorBatchDistance::SPECIALIZED_DIMS use variants whose
+// loop trip counts are known at compile time.
+template <typename T>
+struct ObVectorBatchDistance
+{
+  typedef void (*BatchFunc)(const T *query, const T *rows, const int64_t dim,
+                            const int64_t count, float *dists);
+  static int l2_square_batch(const T *query, const T *rows, const int64_t dim,
+                             const int64_t count, float *dists);
+  static int l2_distance_batch(const T *query, const T *rows, const int64_t dim,
+                               const int64_t count, float *dists);
+  // inner product similarity, same as ObVectorIpDistance::ip_distance_func
+  static int ip_batch(const T *query, const T *rows, const int64_t dim,
+                      const int64_t count, float *dists);
+  // 1 - cosine similarity, rows with zero norm get FLT_MAX so that they rank last
+  static int cosine_distance_batch(const T *query, const T *rows, const int64_t dim,
+                                   const int64_t count, float *dists);
+  // per-pair reference path, kept for comparison with the batch kernels
+  static int l2_square_pairwise(const T *query, const T *rows, const int64_t dim,
+                                const int64_t count, float *dists);
+};
+
+template <>
+int ObVectorBatchDistance<float>::l2_square_batch(const float *query, const float *rows,
+                                                   const int64_t dim, const int64_t count,
+                                                   float *dists);
+template <>
+int ObVectorBatchDistance<float>::l2_distance_batch(const float *query, const float *rows,
+                                                     const int64_t dim, const int64_t count,
+                                                     float *dists);
+template <>
+int ObVectorBatchDistance<float>::ip_batch(const float *query, const float *rows,
+                                            const int64_t dim, const int64_t count,
+                                            float *dists);
+template <>
+int ObVectorBatchDistance<float>::cosine_distance_batch(const float *query, const float *rows,
+                                                         const int64_t dim, const int64_t count,
+                                                         float *dists);
+template <>
+int ObVectorBatchDistance<float>::l2_square_pairwise(const float *query, const float *rows,
+                                                      const int64_t dim, const int64_t count,
+                                                      float *dists);
+
+// FIXED_DIM is 0 for the generic variant, otherwise the compile-time dimension.
+#define BATCH_DIM(dim) (FIXED_DIM > 0 ? FIXED_DIM : (dim))
+
+OB_DECLARE_DEFAULT_CODE(
+  template <int64_t FIXED_DIM>
+  inline static void l2_square_batch(const float *query, const float *rows, const int64_t dim,
+                                     const int64_t count, float *dists) {
+    const int64_t d = BATCH_DIM(dim);
+    for (int64_t i = 0; i < count; ++i) {
+      const float *row = rows + i * d;
+      double sum = 0;
+      for (int64_t j = 0; j < d; ++j) {
+        const double diff = query[j] - row[j];
+        sum += diff * diff;
+      }
+      dists[i] = static_cast<float>(sum);
+    }
+  }
+
+  template <int64_t FIXED_DIM>
+  inline static void ip_batch(const float *query, const float *rows, const int64_t dim,
+                              const int64_t count, float *dists) {
+    const int64_t d = BATCH_DIM(dim);
+    for (int64_t i = 0; i < count; ++i) {
+      const float *row = rows + i * d;
+      float sum = 0;
+      for (int64_t j = 0; j < d; ++j) {
+        sum += query[j] * row[j];
+      }
+      dists[i] = sum;
+    }
+  }
+
+  // dists get the inner products, norms get the squared l2 norms of rows
+  template <int64_t FIXED_DIM>
+  inline static void ip_norm_batch(const float *query, const float *rows, const int64_t dim,
+                                   const int64_t count, float *dists, float *norms) {
+    const int64_t d = BATCH_DIM(dim);
+    for (int64_t i = 0; i < count; ++i) {
+      const float *row = rows + i * d;
+      float ip = 0;
+      float norm = 0;
+      for (int64_t j = 0; j < d; ++j) {
+        ip += query[j] * row[j];
+        norm += row[j] * row[j];
+      }
+      dists[i] = ip;
+      norms[i] = norm;
+    }
+  }
+)
+
+OB_DECLARE_AVX2_SPECIFIC_CODE(
+  inline static float batch_reduce_add(__m256 v) {
+    __m128 sum = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+    __m128 shuf = _mm_movehdup_ps(sum);
+    sum = _mm_add_ps(sum, shuf);
+    shuf = _mm_movehl_ps(shuf, sum);
+    sum = _mm_add_ss(sum, shuf);
+    return _mm_cvtss_f32(sum);
+  }
+
+  template <int64_t FIXED_DIM>
+  inline static void l2_square_batch(const float *query, const float *rows, const int64_t dim,
+                                     const int64_t count, float *dists) {
+    const int64_t d = BATCH_DIM(dim);
+    const int64_t simd_d = d >> 3 << 3;
+    int64_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+      const float *r0 = rows + i * d;
+      const float *r1 = r0 + d;
+      const float *r2 = r1 + d;
+      const float *r3 = r2 + d;
+      __m256 s0 = _mm256_setzero_ps();
+      __m256 s1 = _mm256_setzero_ps();
+      __m256 s2 = _mm256_setzero_ps();
+      __m256 s3 = _mm256_setzero_ps();
+      for (int64_t j = 0; j < simd_d; j += 8) {
+        const __m256 q = _mm256_loadu_ps(query + j);
+        const __m256 d0 = _mm256_sub_ps(q, _mm256_loadu_ps(r0 + j));
+        const __m256 d1 = _mm256_sub_ps(q, _mm256_loadu_ps(r1 + j));
+        const __m256 d2 = _mm256_sub_ps(q, _mm256_loadu_ps(r2 + j));
+        const __m256 d3 = _mm256_sub_ps(q, _mm256_loadu_ps(r3 + j));
+        s0 = _mm256_fmadd_ps(d0, d0, s0);
+        s1 = _mm256_fmadd_ps(d1, d1, s1);
+        s2 = _mm256_fmadd_ps(d2, d2, s2);
+        s3 = _mm256_fmadd_ps(d3, d3, s3);
+      }
+      // the tail is summed in double, like ObVectorL2Distance does
+      double t0 = batch_reduce_add(s0);
+      double t1 = batch_reduce_add(s1);
+      double t2 = batch_reduce_add(s2);
+      double t3 = batch_reduce_add(s3);
+      for (int64_t j = simd_d; j < d; ++j) {
+        const double q = query[j];
+        t0 += (q - r0[j]) * (q - r0[j]);
+        t1 += (q - r1[j]) * (q - r1[j]);
+        t2 += (q - r2[j]) * (q - r2[j]);
+        t3 += (q - r3[j]) * (q - r3[j]);
+      }
+      dists[i] = static_cast<float>(t0);
+      dists[i + 1] = static_cast<float>(t1);
+      dists[i + 2] = static_cast<float>(t2);
+      dists[i + 3] = static_cast<float>(t3);
+    }
+    for (; i < count; ++i) {
+      const float *r0 = rows + i * d;
+      __m256 s0 = _mm256_setzero_ps();
+      for (int64_t j = 0; j < simd_d; j += 8) {
+        const __m256 d0 = _mm256_sub_ps(_mm256_loadu_ps(query + j), _mm256_loadu_ps(r0 + j));
+        s0 = _mm256_fmadd_ps(d0, d0, s0);
+      }
+      double t0 = batch_reduce_add(s0);
+      for (int64_t j = simd_d; j < d; ++j) {
+        const double diff = query[j] - r0[j];
+        t0 += diff * diff;
+      }
+      dists[i] = static_cast<float>(t0);
+    }
+  }
+
+  template <int64_t FIXED_DIM>
+  inline static void ip_batch(const float *query, const float *rows, const int64_t dim,
+                              const int64_t count, float *dists) {
+    const int64_t d = BATCH_DIM(dim);
+    const int64_t simd_d = d >> 3 << 3;
+    int64_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+      const float *r0 = rows + i * d;
+      const float *r1 = r0 + d;
+      const float *r2 = r1 + d;
+      const float *r3 = r2 + d;
+      __m256 s0 = _mm256_setzero_ps();
+      __m256 s1 = _mm256_setzero_ps();
+      __m256 s2 = _mm256_setzero_ps();
+      __m256 s3 = _mm256_setzero_ps();
+      for (int64_t j = 0; j < simd_d; j += 8) {
+        const __m256 q = _mm256_loadu_ps(query + j);
+        s0 = _mm256_fmadd_ps(q, _mm256_loadu_ps(r0 + j), s0);
+        s1 = _mm256_fmadd_ps(q, _mm256_loadu_ps(r1 + j), s1);
+        s2 = _mm256_fmadd_ps(q, _mm256_loadu_ps(r2 + j), s2);
+        s3 = _mm256_fmadd_ps(q, _mm256_loadu_ps(r3 + j), s3);
+      }
+      float t0 = batch_reduce_add(s0);
+      float t1 = batch_reduce_add(s1);
+      float t2 = batch_reduce_add(s2);
+      float t3 = batch_reduce_add(s3);
+      for (int64_t j = simd_d; j < d; ++j) {
+        t0 += query[j] * r0[j];
+        t1 += query[j] * r1[j];
+        t2 += query[j] * r2[j];
+        t3 += query[j] * r3[j];
+      }
+      dists[i] = t0;
+      dists[i + 1] = t1;
+      dists[i + 2] = t2;
+      dists[i + 3] = t3;
+    }
+    for (; i < count; ++i) {
+      const float *r0 = rows + i * d;
+      __m256 s0 = _mm256_setzero_ps();
+      for (int64_t j = 0; j < simd_d; j += 8) {
+        s0 = _mm256_fmadd_ps(_mm256_loadu_ps(query + j), _mm256_loadu_ps(r0 + j), s0);
+      }
+      float t0 = batch_reduce_add(s0);
+      for (int64_t j = simd_d; j < d; ++j) {
+        t0 += query[j] * r0[j];
+      }
+      dists[i] = t0;
+    }
+  }
+
+  template <int64_t FIXED_DIM>
+  inline static void ip_norm_batch(const float *query, const float *rows, const int64_t dim,
+                                   const int64_t count, float *dists, float *norms) {
+    const int64_t d = BATCH_DIM(dim);
+    const int64_t simd_d = d >> 3 << 3;
+    int64_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+      const float *r0 = rows + i * d;
+      const float *r1 = r0 + d;
+      __m256 s0 = _mm256_setzero_ps();
+      __m256 s1 = _mm256_setzero_ps();
+      __m256 n0 = _mm256_setzero_ps();
+      __m256 n1 = _mm256_setzero_ps();
+      for (int64_t j = 0; j < simd_d; j += 8) {
+        const __m256 q = _mm256_loadu_ps(query + j);
+        const __m256 v0 = _mm256_loadu_ps(r0 + j);
+        const __m256 v1 = _mm256_loadu_ps(r1 + j);
+        s0 = _mm256_fmadd_ps(q, v0, s0);
+        s1 = _mm256_fmadd_ps(q, v1, s1);
+        n0 = _mm256_fmadd_ps(v0, v0, n0);
+        n1 = _mm256_fmadd_ps(v1, v1, n1);
+      }
+      float t0 = batch_reduce_add(s0);
+      float t1 = batch_reduce_add(s1);
+      float m0 = batch_reduce_add(n0);
+      float m1 = batch_reduce_add(n1);
+      for (int64_t j = simd_d; j < d; ++j) {
+        t0 += query[j] * r0[j];
+        t1 += query[j] * r1[j];
+        m0 += r0[j] * r0[j];
+        m1 += r1[j] * r1[j];
+      }
+      dists[i] = t0;
+      dists[i + 1] = t1;
+      norms[i] = m0;
+      norms[i + 1] = m1;
+    }
+    for (; i < count; ++i) {
+      const float *r0 = rows + i * d;
+      __m256 s0 = _mm256_setzero_ps();
+      __m256 n0 = _mm256_setzero_ps();
+      for (int64_t j = 0; j < simd_d; j += 8) {
+        const __m256 v0 = _mm256_loadu_ps(r0 + j);
+        s0 = _mm256_fmadd_ps(_mm256_loadu_ps(query + j), v0, s0);
+        n0 = _mm256_fmadd_ps(v0, v0, n0);
+      }
+      float t0 = batch_reduce_add(s0);
+      float m0 = batch_reduce_add(n0);
+      for (int64_t j = simd_d; j < d; ++j) {
+        t0 += query[j] * r0[j];
+        m0 += r0[j] * r0[j];
+      }
+      dists[i] = t0;
+      norms[i] = m0;
+    }
+  }
+)
+
+OB_DECLARE_AVX512_SPECIFIC_CODE(
+  template <int64_t FIXED_DIM>
+  inline static void l2_square_batch(const float *query, const float *rows, const int64_t dim,
+                                     const int64_t count, float *dists) {
+    const int64_t d = BATCH_DIM(dim);
+    const int64_t simd_d = d >> 4 << 4;
+    const __mmask16 tail_mask = static_cast<__mmask16>((1U << (d - simd_d)) - 1);
+    int64_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+      const float *r0 = rows + i * d;
+      const float *r1 = r0 + d;
+      const float *r2 = r1 + d;
+      const float *r3 = r2 + d;
+      __m512 s0 = _mm512_setzero_ps();
+      __m512 s1 = _mm512_setzero_ps();
+      __m512 s2 = _mm512_setzero_ps();
+      __m512 s3 = _mm512_setzero_ps();
+      for (int64_t j = 0; j < simd_d; j += 16) {
+        const __m512 q = _mm512_loadu_ps(query + j);
+        const __m512 d0 = _mm512_sub_ps(q, _mm512_loadu_ps(r0 + j));
+        const __m512 d1 = _mm512_sub_ps(q, _mm512_loadu_ps(r1 + j));
+        const __m512 d2 = _mm512_sub_ps(q, _mm512_loadu_ps(r2 + j));
+        const __m512 d3 = _mm512_sub_ps(q, _mm512_loadu_ps(r3 + j));
+        s0 = _mm512_fmadd_ps(d0, d0, s0);
+        s1 = _mm512_fmadd_ps(d1, d1, s1);
+        s2 = _mm512_fmadd_ps(d2, d2, s2);
+        s3 = _mm512_fmadd_ps(d3, d3, s3);
+      }
+      if (simd_d < d) {
+        const __m512 q = _mm512_maskz_loadu_ps(tail_mask, query + simd_d);
+        const __m512 d0 = _mm512_sub_ps(q, _mm512_maskz_loadu_ps(tail_mask, r0 + simd_d));
+        const __m512 d1 = _mm512_sub_ps(q, _mm512_maskz_loadu_ps(tail_mask, r1 + simd_d));
+        const __m512 d2 = _mm512_sub_ps(q, _mm512_maskz_loadu_ps(tail_mask, r2 + simd_d));
+        const __m512 d3 = _mm512_sub_ps(q, _mm512_maskz_loadu_ps(tail_mask, r3 + simd_d));
+        s0 = _mm512_fmadd_ps(d0, d0, s0);
+        s1 = _mm512_fmadd_ps(d1, d1, s1);
+        s2 = _mm512_fmadd_ps(d2, d2, s2);
+        s3 = _mm512_fmadd_ps(d3, d3, s3);
+      }
+      dists[i] = _mm512_reduce_add_ps(s0);
+      dists[i + 1] = _mm512_reduce_add_ps(s1);
+      dists[i + 2] = _mm512_reduce_add_ps(s2);
+      dists[i + 3] = _mm512_reduce_add_ps(s3);
+    }
+    for (; i < count; ++i) {
+      const float *r0 = rows + i * d;
+      __m512 s0 = _mm512_setzero_ps();
+      for (int64_t j = 0; j < simd_d; j += 16) {
+        const __m512 d0 = _mm512_sub_ps(_mm512_loadu_ps(query + j), _mm512_loadu_ps(r0 + j));
+        s0 = _mm512_fmadd_ps(d0, d0, s0);
+      }
+      if (simd_d < d) {
+        const __m512 d0 = _mm512_sub_ps(_mm512_maskz_loadu_ps(tail_mask, query + simd_d),
+                                        _mm512_maskz_loadu_ps(tail_mask, r0 + simd_d));
+        s0 = _mm512_fmadd_ps(d0, d0, s0);
+      }
+      dists[i] = _mm512_reduce_add_ps(s0);
+    }
+  }
+
+  template <int64_t FIXED_DIM>
+  inline static void ip_batch(const float *query, const float *rows, const int64_t dim,
+                              const int64_t count, float *dists) {
+    const int64_t d = BATCH_DIM(dim);
+    const int64_t simd_d = d >> 4 << 4;
+    const __mmask16 tail_mask = static_cast<__mmask16>((1U << (d - simd_d)) - 1);
+    int64_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+      const float *r0 = rows + i * d;
+      const float *r1 = r0 + d;
+      const float *r2 = r1 + d;
+      const float *r3 = r2 + d;
+      __m512 s0 = _mm512_setzero_ps();
+      __m512 s1 = _mm512_setzero_ps();
+      __m512 s2 = _mm512_setzero_ps();
+      __m512 s3 = _mm512_setzero_ps();
+      for (int64_t j = 0; j < simd_d; j += 16) {
+        const __m512 q = _mm512_loadu_ps(query + j);
+        s0 = _mm512_fmadd_ps(q, _mm512_loadu_ps(r0 + j), s0);
+        s1 = _mm512_fmadd_ps(q, _mm512_loadu_ps(r1 + j), s1);
+        s2 = _mm512_fmadd_ps(q, _mm512_loadu_ps(r2 + j), s2);
+        s3 = _mm512_fmadd_ps(q, _mm512_loadu_ps(r3 + j), s3);
+      }
+      if (simd_d < d) {
+        const __m512 q = _mm512_maskz_loadu_ps(tail_mask, query + simd_d);
+        s0 = _mm512_fmadd_ps(q, _mm512_maskz_loadu_ps(tail_mask, r0 + simd_d), s0);
+        s1 = _mm512_fmadd_ps(q, _mm512_maskz_loadu_ps(tail_mask, r1 + simd_d), s1);
+        s2 = _mm512_fmadd_ps(q, _mm512_maskz_loadu_ps(tail_mask, r2 + simd_d), s2);
+        s3 = _mm512_fmadd_ps(q, _mm512_maskz_loadu_ps(tail_mask, r3 + simd_d), s3);
+      }
+      dists[i] = _mm512_reduce_add_ps(s0);
+      dists[i + 1] = _mm512_reduce_add_ps(s1);
+      dists[i + 2] = _mm512_reduce_add_ps(s2);
+      dists[i + 3] = _mm512_reduce_add_ps(s3);
+    }
+    for (; i < count; ++i) {
+      const float *r0 = rows + i * d;
+      __m512 s0 = _mm512_setzero_ps();
+      for (int64_t j = 0; j < simd_d; j += 16) {
+        s0 = _mm512_fmadd_ps(_mm512_loadu_ps(query + j), _mm512_loadu_ps(r0 + j), s0);
+      }
+      if (simd_d < d) {
+        s0 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(tail_mask, query + simd_d),
+                             _mm512_maskz_loadu_ps(tail_mask, r0 + simd_d), s0);
+      }
+      dists[i] = _mm512_reduce_add_ps(s0);
+    }
+  }
+
+  template <int64_t FIXED_DIM>
+  inline static void ip_norm_batch(const float *query, const float *rows, const int64_t dim,
+                                   const int64_t count, float *dists, float *norms) {
+    const int64_t d = BATCH_DIM(dim);
+    const int64_t simd_d = d >> 4 << 4;
+    const __mmask16 tail_mask = static_cast<__mmask16>((1U << (d - simd_d)) - 1);
+    int64_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+      const float *r0 = rows + i * d;
+      const float *r1 = r0 + d;
+      __m512 s0 = _mm512_setzero_ps();
+      __m512 s1 = _mm512_setzero_ps();
+      __m512 n0 = _mm512_setzero_ps();
+      __m512 n1 = _mm512_setzero_ps();
+      for (int64_t j = 0; j < simd_d; j += 16) {
+        const __m512 q = _mm512_loadu_ps(query + j);
+        const __m512 v0 = _mm512_loadu_ps(r0 + j);
+        const __m512 v1 = _mm512_loadu_ps(r1 + j);
+        s0 = _mm512_fmadd_ps(q, v0, s0);
+        s1 = _mm512_fmadd_ps(q, v1, s1);
+        n0 = _mm512_fmadd_ps(v0, v0, n0);
+        n1 = _mm512_fmadd_ps(v1, v1, n1);
+      }
+      if (simd_d < d) {
+        const __m512 q = _mm512_maskz_loadu_ps(tail_mask, query + simd_d);
+        const __m512 v0 = _mm512_maskz_loadu_ps(tail_mask, r0 + simd_d);
+        const __m512 v1 = _mm512_maskz_loadu_ps(tail_mask, r1 + simd_d);
+        s0 = _mm512_fmadd_ps(q, v0, s0);
+        s1 = _mm512_fmadd_ps(q, v1, s1);
+        n0 = _mm512_fmadd_ps(v0, v0, n0);
+        n1 = _mm512_fmadd_ps(v1, v1, n1);
+      }
+      dists[i] = _mm512_reduce_add_ps(s0);
+      dists[i + 1] = _mm512_reduce_add_ps(s1);
+      norms[i] = _mm512_reduce_add_ps(n0);
+      norms[i + 1] = _mm512_reduce_add_ps(n1);
+    }
+    for (; i < count; ++i) {
+      const float *r0 = rows + i * d;
+      __m512 s0 = _mm512_setzero_ps();
+      __m512 n0 = _mm512_setzero_ps();
+      for (int64_t j = 0; j < simd_d; j += 16) {
+        const __m512 v0 = _mm512_loadu_ps(r0 + j);
+        s0 = _mm512_fmadd_ps(_mm512_loadu_ps(query + j), v0, s0);
+        n0 = _mm512_fmadd_ps(v0, v0, n0);
+      }
+      if (simd_d < d) {
+        const __m512 v0 = _mm512_maskz_loadu_ps(tail_mask, r0 + simd_d);
+        s0 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(tail_mask, query + simd_d), v0, s0);
+        n0 = _mm512_fmadd_ps(v0, v0, n0);
+      }
+      dists[i] = _mm512_reduce_add_ps(s0);
+      norms[i] = _mm512_reduce_add_ps(n0);
+    }
+  }
+)
+
+#undef BATCH_DIM
+
+}  // namespace common
+}  // namespace oceanbase
+#endif
@@ -371,6 +371,16 @@ public:
   int64_t get_center_count() const {
     return heap_.count();
   }
+  // whether push_center would reject any distance in [lower_bound, upper_bound],
+  // lets callers drop a candidate by its approximate distance before computing the exact one
+  bool is_out_of_range(const double lower_bound, const double upper_bound) const {
+    bool bret = lower_bound > distance_threshold_;
+    if (!bret && heap_.count() >= nprobe_ && heap_.count() > 0) {
+      const double top_distance = heap_.top().distance_;
+      bret = compare_.is_max_heap_ ? lower_bound >= top_distance : upper_bound <= top_distance;
+    }
+    return bret;
+  }
 
  public:
   struct HeapCenterItemTemp
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ob_vector_pq_fast_scan.h"
+namespace oceanbase
+{
+namespace common
+{
+namespace
+{
+typedef void (*ObPQFastScanBlockFunc)(const int64_t m, const uint8_t *lut, const uint8_t *block,
+                                      uint16_t *dists);
+// relative slack on top of the rounding error, covers float summation order of the exact path
+static const float PQ_FAST_SCAN_RELATIVE_SLACK = 1e-5f;
+
+static ObPQFastScanBlockFunc get_fast_scan_block_func()
+{
+#if OB_USE_MULTITARGET_CODE
+  static const ObPQFastScanBlockFunc func =
+      common::is_arch_supported(ObTargetArch::AVX2) ? common::specific::avx2::pq_fast_scan_block
+      : common::is_arch_supported(ObTargetArch::SSE42) ? common::specific::sse42::pq_fast_scan_block
+      : common::specific::normal::pq_fast_scan_block;
+  return func;
+#else
+  return common::specific::normal::pq_fast_scan_block;
+#endif
+}
+} // namespace
+
+int ObPQFastScanner::init(ObIAllocator &allocator, const int64_t m)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(is_inited())) {
+    ret = OB_INIT_TWICE;
+    LIB_LOG(WARN, "init twice", K(ret));
+  } else if (OB_UNLIKELY(!is_supported(m, 4))) {
+    ret = OB_INVALID_ARGUMENT;
+    LIB_LOG(WARN, "invalid argument", K(ret), K(m));
+  } else if (OB_ISNULL(lut_ = static_cast<uint8_t *>(allocator.alloc(sizeof(uint8_t) * m * KSUB * 2)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LIB_LOG(WARN, "failed to alloc fast scan buffer", K(ret), K(m));
+  } else {
+    block_ = lut_ + m * KSUB;
+    m_ = m;
+    row_cnt_ = 0;
+  }
+  return ret;
+}
+
+int ObPQFastScanner::build_lut(const float *sim_table)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited())) {
+    ret = OB_NOT_INIT;
+    LIB_LOG(WARN, "not init", K(ret));
+  } else if (OB_ISNULL(sim_table)) {
+    ret = OB_INVALID_ARGUMENT;
+    LIB_LOG(WARN, "invalid null sim table", K(ret));
+  } else {
+    // a single scale for all sub-quantizers keeps the quantized partial distances additive,
+    // the per sub-quantizer minimum is folded into bias_
+    float max_range = 0;
+    float abs_sum = 0;
+    bias_ = 0;
+    for (int64_t i = 0; i < m_; ++i) {
+      const float *tab = sim_table + i * KSUB;
+      float min_val = tab[0];
+      float max_val = tab[0];
+      for (int64_t j = 1; j < KSUB; ++j) {
+        min_val = MIN(min_val, tab[j]);
+        max_val = MAX(max_val, tab[j]);
+      }
+      bias_ += min_val;
+      max_range = MAX(max_range, max_val - min_val);
+      abs_sum += MAX(fabsf(min_val), fabsf(max_val));
+    }
+    scale_ = max_range > 0 ? 255.0f / max_range : 1.0f;
+    for (int64_t i = 0; i < m_; ++i) {
+      const float *tab = sim_table + i * KSUB;
+      float min_val = tab[0];
+      for (int64_t j = 1; j < KSUB; ++j) {
+        min_val = MIN(min_val, tab[j]);
+      }
+      for (int64_t j = 0; j < KSUB; ++j) {
+        const int64_t q = static_cast<int64_t>((tab[j] - min_val) * scale_ + 0.5f);
+        lut_[i * KSUB + j] = static_cast<uint8_t>(MIN(q, 255));
+      }
+    }
+    // each term is rounded by at most half a step
+    error_ = (0.5f * m_ + 1.0f) / scale_ + PQ_FAST_SCAN_RELATIVE_SLACK * (abs_sum + fabsf(bias_));
+    row_cnt_ = 0;
+  }
+  return ret;
+}
+
+void ObPQFastScanner::scan_block(uint16_t *dists)
+{
+  get_fast_scan_block_func()(m_, lut_, block_, dists);
+  row_cnt_ = 0;
+}
+
+}
+}
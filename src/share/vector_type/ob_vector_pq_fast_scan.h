@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OCEANBASE_LIB_OB_VECTOR_PQ_FAST_SCAN_H_
+#define OCEANBASE_LIB_OB_VECTOR_PQ_FAST_SCAN_H_
+
+#include "lib/utility/ob_print_utils.h"
+#include "lib/oblog/ob_log.h"
+#include "lib/ob_define.h"
+#include "lib/allocator/ob_allocator.h"
+#include "ob_vector_op_common.h"
+
+namespace oceanbase
+{
+namespace common
+{
+// ADC fast scan for 4-bit PQ codes.
+// The float distance table of a probed list (layout (m, 16)) is quantized to uint8 once, and
+// codes of up to 32 rows are packed into a transposed block: for sub-quantizer i, byte r of
+// block[i * 16, i * 16 + 16) holds the code of row r in its low nibble and the code of row
+// r + 16 in its high nibble. A block is then scored with one table shuffle per sub-quantizer,
+// which yields the quantized partial distances of all 32 rows at once.
+// The scanned distances are approximate, get_bounds() gives an interval that always contains
+// the exact ADC distance so that callers can drop rows before computing the exact one.
+class ObPQFastScanner
+{
+public:
+  static const int64_t KSUB = 16;
+  static const int64_t BLOCK_SIZE = 32;
+  // uint16 accumulators hold at most 257 * 255 without overflow
+  static const int64_t MAX_M = 256;
+
+  ObPQFastScanner()
+    : m_(0), lut_(nullptr), block_(nullptr), scale_(1.0f), bias_(0.0f), error_(0.0f), row_cnt_(0)
+  {}
+  ~ObPQFastScanner() {}
+
+  static bool is_supported(const int64_t m, const int64_t nbits)
+  {
+    return 4 == nbits && m > 0 && m <= MAX_M;
+  }
+  int init(ObIAllocator &allocator, const int64_t m);
+  bool is_inited() const { return nullptr != lut_; }
+  // quantize the distance table of one probed list, sim_table layout is (m, KSUB)
+  int build_lut(const float *sim_table);
+  // append the codes (one byte per sub-quantizer) of a row to the current block
+  OB_INLINE void add_code(const uint8_t *code)
+  {
+    if (row_cnt_ < KSUB) {
+      for (int64_t i = 0; i < m_; ++i) {
+        block_[i * KSUB + row_cnt_] = code[i] & 0x0f;
+      }
+    } else {
+      for (int64_t i = 0; i < m_; ++i) {
+        block_[i * KSUB + row_cnt_ - KSUB] |= static_cast<uint8_t>(code[i] << 4);
+      }
+    }
+    ++row_cnt_;
+  }
+  bool is_block_full() const { return row_cnt_ >= BLOCK_SIZE; }
+  int64_t get_row_count() const { return row_cnt_; }
+  // score the current block, dists must hold BLOCK_SIZE items, the block is reset afterwards
+  void scan_block(uint16_t *dists);
+  // interval of the exact ADC distance of a row whose scanned distance is `dist`
+  OB_INLINE void get_bounds(const uint16_t dist, float &lower_bound, float &upper_bound) const
+  {
+    const float approx = bias_ + dist / scale_;
+    lower_bound = approx - error_;
+    upper_bound = approx + error_;
+  }
+  TO_STRING_KV(K_(m), KP_(lut), KP_(block), K_(scale), K_(bias), K_(error), K_(row_cnt));
+
+private:
+  int64_t m_;
+  uint8_t *lut_;
+  uint8_t *block_;
+  float scale_;
+  float bias_;
+  float error_;
+  int64_t row_cnt_;
+  DISALLOW_COPY_AND_ASSIGN(ObPQFastScanner);
+};
+
+OB_DECLARE_DEFAULT_CODE(
+  inline static void pq_fast_scan_block(const int64_t m, const uint8_t *lut, const uint8_t *block,
+                                        uint16_t *dists) {
+    for (int64_t r = 0; r < 32; ++r) {
+      dists[r] = 0;
+    }
+    for (int64_t i = 0; i < m; ++i) {
+      const uint8_t *tab = lut + i * 16;
+      const uint8_t *codes = block + i * 16;
+      for (int64_t r = 0; r < 16; ++r) {
+        dists[r] += tab[codes[r] & 0x0f];
+        dists[r + 16] += tab[codes[r] >> 4];
+      }
+    }
+  }
+)
+
+OB_DECLARE_SSE42_SPECIFIC_CODE(
+  inline static void pq_fast_scan_block(const int64_t m, const uint8_t *lut, const uint8_t *block,
+                                        uint16_t *dists) {
+    const __m128i low_mask = _mm_set1_epi8(0x0f);
+    __m128i acc0 = _mm_setzero_si128();
+    __m128i acc1 = _mm_setzero_si128();
+    __m128i acc2 = _mm_setzero_si128();
+    __m128i acc3 = _mm_setzero_si128();
+    for (int64_t i = 0; i < m; ++i) {
+      const __m128i tab = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lut + i * 16));
+      const __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + i * 16));
+      // rows 0-15 and rows 16-31
+      const __m128i d_lo = _mm_shuffle_epi8(tab, _mm_and_si128(packed, low_mask));
+      const __m128i d_hi = _mm_shuffle_epi8(tab, _mm_and_si128(_mm_srli_epi16(packed, 4), low_mask));
+      acc0 = _mm_add_epi16(acc0, _mm_cvtepu8_epi16(d_lo));
+      acc1 = _mm_add_epi16(acc1, _mm_cvtepu8_epi16(_mm_srli_si128(d_lo, 8)));
+      acc2 = _mm_add_epi16(acc2, _mm_cvtepu8_epi16(d_hi));
+      acc3 = _mm_add_epi16(acc3, _mm_cvtepu8_epi16(_mm_srli_si128(d_hi, 8)));
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dists), acc0);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dists + 8), acc1);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dists + 16), acc2);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dists + 24), acc3);
+  }
+)
+
+OB_DECLARE_AVX2_SPECIFIC_CODE(
+  inline static void pq_fast_scan_block(const int64_t m, const uint8_t *lut, const uint8_t *block,
+                                        uint16_t *dists) {
+    const __m256i low_mask = _mm256_set1_epi8(0x0f);
+    __m256i acc_lo = _mm256_setzero_si256();
+    __m256i acc_hi = _mm256_setzero_si256();
+    for (int64_t i = 0; i < m; ++i) {
+      // the table is duplicated in both lanes, lane 0 looks up rows 0-15 and lane 1 rows 16-31
+      const __m256i tab = _mm256_broadcastsi128_si256(
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(lut + i * 16)));
+      const __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + i * 16));
+      const __m256i codes = _mm256_and_si256(
+          _mm256_inserti128_si256(_mm256_castsi128_si256(packed), _mm_srli_epi16(packed, 4), 1),
+          low_mask);
+      const __m256i d = _mm256_shuffle_epi8(tab, codes);
+      acc_lo = _mm256_add_epi16(acc_lo, _mm256_cvtepu8_epi16(_mm256_castsi256_si128(d)));
+      acc_hi = _mm256_add_epi16(acc_hi, _mm256_cvtepu8_epi16(_mm256_extracti128_si256(d, 1)));
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dists), acc_lo);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dists + 16), acc_hi);
+  }
+)
+
+}  // namespace common
+}  // namespace oceanbase
+#endif
@@ -18,6 +18,8 @@
 
 #include "sql/code_generator/ob_code_generator.h"
 #include "sql/code_generator/ob_static_engine_cg.h"
+#include "sql/engine/expr/ob_expr_jit_filter.h"
+#include "sql/engine/table/ob_table_scan_op.h"
 
 namespace oceanbase
 {
@@ -40,10 +42,140 @@ int ObCodeGenerator::generate(const ObLogPlan &log_plan,
     LOG_WARN("fail to get all raw exprs", K(ret));
   } else if (OB_FAIL(generate_operators(log_plan, phy_plan, cur_cluster_version))) {
     LOG_WARN("fail to generate plan", K(ret));
+  } else if (use_jit_ && phy_plan.is_vectorized() && phy_plan.get_use_rich_format()
+             && OB_FAIL(generate_jit_filters(phy_plan))) {
+    LOG_WARN("fail to generate jit filters", K(ret));
   }
 
   return ret;
 }
+
+int ObCodeGenerator::generate_jit_filters(ObPhysicalPlan &phy_plan)
+{
+  int ret = OB_SUCCESS;
+  ObIAllocator &alloc = phy_plan.get_allocator();
+  ObSEArray<ObExprJitFilter *, 4> jit_filters;
+  jit::ObJitFilterModule *module = NULL;
+  bool handed_over = false;
+  if (OB_ISNULL(phy_plan.get_root_op_spec())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected null root spec", K(ret));
+  } else if (OB_ISNULL(module = OB_NEWx(jit::ObJitFilterModule, &alloc, alloc))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc jit filter module", K(ret));
+  } else if (OB_FAIL(generate_jit_filters(alloc,
+                                          *module,
+                                          *phy_plan.get_root_op_spec(),
+                                          jit_filters))) {
+    LOG_WARN("fail to generate jit filters", K(ret));
+  } else if (jit_filters.empty()) {
+  } else if (OB_FAIL(module->compile())) {
+    // the kernels are left not compiled, the filters are evaluated by the exprs
+    LOG_WARN("fail to compile jit filters, ignore", K(ret), KPC(module));
+    ret = OB_SUCCESS;
+  }
+  if (OB_SUCC(ret) && !jit_filters.empty()) {
+    if (OB_FAIL(phy_plan.set_jit_filters(jit_filters, module))) {
+      LOG_WARN("fail to set jit filters", K(ret));
+    } else {
+      handed_over = true;
+    }
+  }
+  if (!handed_over) {
+    if (OB_FAIL(ret)) {
+      for (int64_t i = 0; i < jit_filters.count(); ++i) {
+        jit_filters.at(i)->~ObExprJitFilter();
+      }
+    }
+    if (NULL != module) {
+      module->~ObJitFilterModule();
+    }
+  }
+  return ret;
+}
+
+int ObCodeGenerator::generate_jit_filters(ObIAllocator &alloc,
+                                          jit::ObJitFilterModule &module,
+                                          ObOpSpec &spec,
+                                          ObIArray<ObExprJitFilter *> &jit_filters)
+{
+  int ret = OB_SUCCESS;
+  ObSEArray<ObExpr *, 16> evaluated_exprs;
+  for (uint32_t i = 0; OB_SUCC(ret) && i < spec.get_child_cnt(); ++i) {
+    if (OB_ISNULL(spec.get_child(i))) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected null child", K(ret), K(i));
+    } else if (OB_FAIL(generate_jit_filters(alloc, module, *spec.get_child(i), jit_filters))) {
+      LOG_WARN("fail to generate jit filters", K(ret));
+    } else if (OB_FAIL(append(evaluated_exprs, spec.get_child(i)->output_))) {
+      LOG_WARN("fail to append child output", K(ret));
+    }
+  }
+  if (OB_FAIL(ret) || !spec.is_vectorized() || !spec.use_rich_format_) {
+  } else if (!spec.filters_.empty()) {
+    // the children outputs are evaluated before the filters of the operator
+    ObExprJitFilter *jit_filter = NULL;
+    if (OB_FAIL(ObExprJitFilter::build(alloc, module, spec.filters_, evaluated_exprs, jit_filter))) {
+      LOG_WARN("fail to build jit filter", K(ret));
+    } else if (NULL == jit_filter) {
+    } else if (OB_FAIL(jit_filters.push_back(jit_filter))) {
+      LOG_WARN("fail to push back", K(ret));
+      jit_filter->~ObExprJitFilter();
+    } else {
+      spec.jit_filter_ = jit_filter;
+    }
+  }
+  if (OB_SUCC(ret) && spec.is_table_scan()) {
+    ObTableScanCtDef &tsc_ctdef = static_cast<ObTableScanSpec &>(spec).tsc_ctdef_;
+    if (OB_FAIL(generate_jit_filters(alloc,
+                                     module,
+                                     tsc_ctdef.scan_ctdef_.pd_expr_spec_.pd_storage_filters_
+                                                                        .get_pushdown_filter(),
+                                     jit_filters))) {
+      LOG_WARN("fail to generate jit filters for scan", K(ret));
+    } else if (NULL != tsc_ctdef.get_lookup_ctdef()
+               && OB_FAIL(generate_jit_filters(alloc,
+                                               module,
+                                               tsc_ctdef.get_lookup_ctdef()->pd_expr_spec_
+                                                        .pd_storage_filters_.get_pushdown_filter(),
+                                               jit_filters))) {
+      LOG_WARN("fail to generate jit filters for lookup", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObCodeGenerator::generate_jit_filters(ObIAllocator &alloc,
+                                          jit::ObJitFilterModule &module,
+                                          ObPushdownFilterNode *node,
+                                          ObIArray<ObExprJitFilter *> &jit_filters)
+{
+  int ret = OB_SUCCESS;
+  if (NULL == node) {
+  } else if (BLACK_FILTER == node->get_type()) {
+    // only the columns are projected before the black filter is evaluated
+    ObPushdownBlackFilterNode *black_node = static_cast<ObPushdownBlackFilterNode *>(node);
+    ObExprJitFilter *jit_filter = NULL;
+    if (black_node->filter_exprs_.empty()) {
+    } else if (OB_FAIL(ObExprJitFilter::build(alloc, module, black_node->filter_exprs_,
+                                              black_node->column_exprs_, jit_filter))) {
+      LOG_WARN("fail to build jit filter", K(ret));
+    } else if (NULL == jit_filter) {
+    } else if (OB_FAIL(jit_filters.push_back(jit_filter))) {
+      LOG_WARN("fail to push back", K(ret));
+      jit_filter->~ObExprJitFilter();
+    } else {
+      black_node->jit_filter_ = jit_filter;
+    }
+  } else {
+    for (uint32_t i = 0; OB_SUCC(ret) && i < node->n_child_; ++i) {
+      if (OB_FAIL(generate_jit_filters(alloc, module, node->childs_[i], jit_filters))) {
+        LOG_WARN("fail to generate jit filters", K(ret), K(i));
+      }
+    }
+  }
+  return ret;
+}
 //1. Generate the old execution plan, used for initializing all expression operators
 //   and initialize to ObExpr's op_, for mixed running of new and old expressions, will be removed later
 //2. Get all expressions that will be used during execution
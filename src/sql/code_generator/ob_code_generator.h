@@ -27,6 +27,10 @@ namespace common
 {
 class ObIAllocator;
 }
+namespace jit
+{
+class ObJitFilterModule;
+}
 
 namespace sql
 {
@@ -36,6 +40,9 @@ class ObLogPlan;
 class ObRawExpr;
 class ObLogicalOperator;
 class ObRawExprUniqueSet;
+class ObOpSpec;
+class ObPushdownFilterNode;
+class ObExprJitFilter;
 
 class ObCodeGenerator
 {
@@ -70,11 +77,22 @@ private:
   int generate_operators(const ObLogPlan &log_plan,
                          ObPhysicalPlan &phy_plan,
                          const uint64_t cur_cluster_version);
+  //Compile the filters of the vectorized operators and storage black filters in one module, the
+  //kernels and the module are owned by the physical plan
+  int generate_jit_filters(ObPhysicalPlan &phy_plan);
+  int generate_jit_filters(common::ObIAllocator &alloc,
+                           jit::ObJitFilterModule &module,
+                           ObOpSpec &spec,
+                           common::ObIArray<ObExprJitFilter *> &jit_filters);
+  int generate_jit_filters(common::ObIAllocator &alloc,
+                           jit::ObJitFilterModule &module,
+                           ObPushdownFilterNode *node,
+                           common::ObIArray<ObExprJitFilter *> &jit_filters);
 
   // disallow copy
   DISALLOW_COPY_AND_ASSIGN(ObCodeGenerator);
 private:
-  //TODO shengle remove
+  // compile filters with ObExprJitFilter
   bool use_jit_;
   uint64_t min_cluster_version_;
   // All parameterized constant objects
@@ -21,6 +21,7 @@
 #include "src/share/vector_index/ob_vector_index_util.h"
 #include "share/domain_id/ob_domain_id.h"
 #include "share/external_table/ob_external_table_utils.h"
+#include "sql/engine/table/ob_external_table_pushdown_filter.h"
 namespace oceanbase
 {
 
@@ -756,6 +757,10 @@ int ObTscCgService::generate_tsc_filter(const ObLogTableScan &op, ObTableScanSpe
       }
     }
   }
+  if (OB_SUCC(ret) && share::schema::EXTERNAL_TABLE == op.get_table_type()
+      && OB_FAIL(generate_ext_tbl_pd_storage_filters(op, nonpushdown_filters, scan_ctdef))) {
+    LOG_WARN("generate external table pushdown storage filters failed", K(ret));
+  }
   if (OB_SUCC(ret)) {
     if (OB_FAIL(cg_.generate_rt_exprs(nonpushdown_filters, spec.filters_))) {
       LOG_WARN("generate filter expr failed", K(ret));
@@ -822,6 +827,45 @@ int ObTscCgService::generate_pd_storage_flag(const ObLogPlan *log_plan,
   return ret;
 }
 
+// Filters of an external table are all evaluated by the table scan operator. For Parquet and ORC
+// the filters are also built into a pushdown filter tree, which the file readers only check against
+// the row group and stripe statistics to skip the row groups and stripes that can not match.
+int ObTscCgService::generate_ext_tbl_pd_storage_filters(const ObLogTableScan &op,
+                                                        const ObIArray<ObRawExpr *> &filters,
+                                                        ObDASScanCtDef &scan_ctdef)
+{
+  int ret = OB_SUCCESS;
+  ObPushdownExprSpec &pd_spec = scan_ctdef.pd_expr_spec_;
+  ObSEArray<ObRawExpr *, 8> stat_filters;
+  if (OB_FAIL(generate_ext_tbl_filter_pd_level(op, scan_ctdef, pd_spec))) {
+    LOG_WARN("generate external table filter pushdown level failed", K(ret));
+  } else if (pd_spec.ext_tbl_filter_pd_level_ < ObExternalTablePushdownFilter::ROW_GROUP_FILTER_PD_LEVEL
+             || !pd_spec.pd_storage_flag_.is_filter_pushdown()) {
+    // disabled
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < filters.count(); ++i) {
+      ObRawExpr *filter = filters.at(i);
+      if (OB_ISNULL(filter)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("unexpected null filter", K(ret), K(i));
+      } else if (T_OP_RUNTIME_FILTER == filter->get_expr_type()
+                 || T_OP_PUSHDOWN_TOPN_FILTER == filter->get_expr_type()) {
+        // runtime filters are not known at open and have no use for statistics
+      } else if (OB_FAIL(stat_filters.push_back(filter))) {
+        LOG_WARN("failed to push back filter", K(ret));
+      }
+    }
+    if (OB_SUCC(ret) && !stat_filters.empty()) {
+      ObPushdownFilterConstructor filter_constructor(
+          &cg_.phy_plan_->get_allocator(), cg_, &op, false /*use_column_store*/);
+      if (OB_FAIL(filter_constructor.apply(stat_filters, pd_spec.pd_storage_filters_.get_pushdown_filter()))) {
+        LOG_WARN("failed to apply filter constructor", K(ret));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObTscCgService::generate_ext_tbl_filter_pd_level(const ObLogTableScan &op,
                                                      const ObDASScanCtDef &scan_ctdef,
                                                      ObPushdownExprSpec &pd_spec)
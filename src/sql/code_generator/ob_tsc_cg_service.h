@@ -51,6 +51,9 @@ public:
                                ObPushdownExprSpec &pd_spec);
   int generate_ext_tbl_filter_pd_level(const ObLogTableScan &op, const ObDASScanCtDef &scan_ctdef,
                                        ObPushdownExprSpec &pd_spec);
+  int generate_ext_tbl_pd_storage_filters(const ObLogTableScan &op,
+                                          const ObIArray<ObRawExpr *> &filters,
+                                          ObDASScanCtDef &scan_ctdef);
   int generate_table_loc_meta(uint64_t table_loc_id,
                               const ObDMLStmt &stmt,
                               const share::schema::ObTableSchema &table_schema,
@@ -969,6 +969,12 @@ int ObDASHNSWScanIter::process_adaptor_state_hnsw(ObIAllocator &allocator, bool
       LOG_WARN("shouldn't be null.", K(ret));
     } else if (!query_cond_.is_inited() && OB_FAIL(set_vector_query_condition(query_cond_))) {
       LOG_WARN("failed to set query condition.", K(ret));
+    } else if (query_cond_.query_count_ > 1
+               && (is_pre_filter() || is_in_filter() || is_iter_filter() || extra_column_count_ > 0 || is_hnsw_bq())) {
+      ret = OB_NOT_SUPPORTED;
+      LOG_WARN("multi vector query only supports post filter without extra info", K(ret), K(query_cond_.query_count_),
+               K(vec_idx_try_path_), K(extra_column_count_));
+      LOG_USER_ERROR(OB_NOT_SUPPORTED, "multi vector query with pre filter, iterative filter, extra info or hnsw_bq index is");
     } else if (vec_aux_ctdef_->relevance_col_cnt_ > 0  && OB_FAIL(init_rel_map(adaptor))) {
       LOG_WARN("failed to init rel map", K(ret));
     } else if (OB_FAIL(ObPluginVectorIndexUtils::get_ls_leader_flag(ls_id_, ls_leader))) {
@@ -3284,6 +3290,11 @@ int ObDASHNSWScanIter::set_vector_query_condition(ObVectorQueryConditions &query
       }
     } else {
       query_cond.query_vector_ = hybrid_search_vec_;
+      // a hybrid search may carry several query vectors, they are searched as one batch
+      if (!is_ipivf() && dim_ > 0 && hybrid_search_vec_.length() > dim_ * sizeof(float)
+          && hybrid_search_vec_.length() % (dim_ * sizeof(float)) == 0) {
+        query_cond.query_count_ = hybrid_search_vec_.length() / (dim_ * sizeof(float));
+      }
     }
     LOG_TRACE("vector index show basic hnsw query cond", K(query_cond.only_complete_data_), K(query_cond.ef_search_), K(query_cond.query_limit_),
                                             K(query_cond.extra_column_count_), K(query_cond.query_vector_));
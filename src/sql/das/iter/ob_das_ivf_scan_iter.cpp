@@ -20,6 +20,7 @@
 #include "storage/tx_storage/ob_access_service.h"
 #include "src/storage/access/ob_table_scan_iterator.h"
 #include "share/vector_type/ob_vector_common_util.h"
+#include "share/vector_type/ob_vector_batch_distance.h"
 #include "sql/engine/expr/ob_expr_vec_ivf_sq8_data_vector.h"
 #include "sql/engine/expr/ob_array_expr_utils.h"
 #include "share/ob_vec_index_builder_util.h"
@@ -970,22 +971,50 @@ int ObDASIvfBaseScanIter::prepare_cid_range(
   return ret;
 }
 
-int ObDASIvfBaseScanIter::scan_cid_range(
-  const ObString &cid, 
-  int64_t cid_vec_pri_key_cnt, 
-  const ObDASScanCtDef *cid_vec_ctdef, 
+int ObDASIvfBaseScanIter::append_probe_cid_str(const ObCenterId &cid, char *buf, ObIArray<ObString> &cid_strs)
+{
+  int ret = OB_SUCCESS;
+  ObString cid_str;
+  if (OB_ISNULL(buf) || OB_UNLIKELY(cid_strs.count() >= IVF_PROBE_BATCH_CNT)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(buf), K(cid_strs.count()));
+  } else if (OB_FALSE_IT(cid_str.assign_buffer(buf + cid_strs.count() * OB_DOC_ID_COLUMN_BYTE_LENGTH,
+                                               OB_DOC_ID_COLUMN_BYTE_LENGTH))) {
+  } else if (OB_FAIL(ObVectorClusterHelper::set_center_id_to_string(cid, cid_str))) {
+    LOG_WARN("failed to set center_id to string", K(ret), K(cid), K(cid_str));
+  } else if (OB_FAIL(cid_strs.push_back(cid_str))) {
+    LOG_WARN("failed to push back cid str", K(ret));
+  }
+  return ret;
+}
+
+// All the lists are read by one multi-range scan, so the storage prefetches the blocks of the
+// following lists while the rows of the current one are consumed, instead of a rescan per list.
+// Ranges of different cids never overlap, the rows of one list are always adjacent.
+int ObDASIvfBaseScanIter::scan_cid_ranges(
+  const ObIArray<ObString> &cids,
+  int64_t cid_vec_pri_key_cnt,
+  const ObDASScanCtDef *cid_vec_ctdef,
   ObDASScanRtDef *cid_vec_rtdef,
   storage::ObTableScanIterator *&cid_vec_scan_iter)
 {
   int ret = OB_SUCCESS;
-  ObNewRange cid_pri_key_range;
   if (OB_ISNULL(cid_vec_ctdef) || OB_ISNULL(cid_vec_rtdef)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("ctdef or rtdef is null", K(ret), KP(cid_vec_ctdef), KP(cid_vec_rtdef));
-  } else if (OB_FAIL(build_cid_vec_query_range(cid, cid_vec_pri_key_cnt, cid_pri_key_range))) {
-    LOG_WARN("failed to build cid vec query rowkey", K(ret));
-  } else if (OB_FAIL(ObDasVecScanUtils::set_lookup_range(cid_pri_key_range, cid_vec_scan_param_, cid_vec_ctdef->ref_table_id_))) {
-    LOG_WARN("failed to append scan range", K(ret));
+  } else if (OB_UNLIKELY(cids.empty())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("no cid to scan", K(ret));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < cids.count(); ++i) {
+    ObNewRange cid_pri_key_range;
+    if (OB_FAIL(build_cid_vec_query_range(cids.at(i), cid_vec_pri_key_cnt, cid_pri_key_range))) {
+      LOG_WARN("failed to build cid vec query rowkey", K(ret), K(i));
+    } else if (OB_FAIL(ObDasVecScanUtils::set_lookup_range(cid_pri_key_range, cid_vec_scan_param_, cid_vec_ctdef->ref_table_id_))) {
+      LOG_WARN("failed to append scan range", K(ret));
+    }
+  }
+  if (OB_FAIL(ret)) {
   } else if (OB_FAIL(do_aux_table_scan(cid_vec_iter_first_scan_,
                                         cid_vec_scan_param_,
                                         cid_vec_ctdef,
@@ -1274,8 +1303,79 @@ int ObDASIvfScanIter::parse_cid_vec_datum(
 }
 
 template <typename T>
-int ObDASIvfScanIter::get_rowkeys_to_heap(const ObString &cid_str, int64_t cid_vec_pri_key_cnt,
+int ObDASIvfScanIter::calc_packed_distances(const T *search_vec, ObIvfPackedRows<T> &packed_rows)
+{
+  int ret = OB_SUCCESS;
+  double *distances = packed_rows.get_distances();
+  for (int64_t i = 0; OB_SUCC(ret) && i < packed_rows.get_row_count(); ++i) {
+    double distance = 0; // the inner product functions add to it
+    if (OB_FAIL(ObExprVectorDistance::DisFunc<T>::distance_funcs[dis_type_](search_vec, packed_rows.get_vec(i), dim_, distance))) {
+      LOG_WARN("failed to get distance", K(ret), K(i), K(dis_type_));
+    } else {
+      distances[i] = distance;
+    }
+  }
+  return ret;
+}
+
+// the float metrics with batch kernels score the packed rows four at a time,
+// the others fall back to the per row distance functions. l2 takes the square
+// root in double, as ObVectorL2Distance does.
+template <>
+int ObDASIvfScanIter::calc_packed_distances<float>(const float *search_vec, ObIvfPackedRows<float> &packed_rows)
+{
+  int ret = OB_SUCCESS;
+  const float *vecs = packed_rows.get_vecs();
+  const int64_t row_cnt = packed_rows.get_row_count();
+  float *kernel_dists = packed_rows.get_kernel_dists();
+  double *distances = packed_rows.get_distances();
+  switch (dis_type_) {
+    case ObExprVectorDistance::ObVecDisType::EUCLIDEAN: {
+      if (OB_SUCC(ObVectorBatchDistance<float>::l2_square_batch(search_vec, vecs, dim_, row_cnt, kernel_dists))) {
+        for (int64_t i = 0; i < row_cnt; ++i) {
+          distances[i] = sqrt(static_cast<double>(kernel_dists[i]));
+        }
+      }
+      break;
+    }
+    case ObExprVectorDistance::ObVecDisType::EUCLIDEAN_SQUARED: {
+      if (OB_SUCC(ObVectorBatchDistance<float>::l2_square_batch(search_vec, vecs, dim_, row_cnt, kernel_dists))) {
+        for (int64_t i = 0; i < row_cnt; ++i) {
+          distances[i] = kernel_dists[i];
+        }
+      }
+      break;
+    }
+    case ObExprVectorDistance::ObVecDisType::DOT: {
+      if (OB_SUCC(ObVectorBatchDistance<float>::ip_batch(search_vec, vecs, dim_, row_cnt, kernel_dists))) {
+        for (int64_t i = 0; i < row_cnt; ++i) {
+          distances[i] = kernel_dists[i];
+        }
+      }
+      break;
+    }
+    default: {
+      for (int64_t i = 0; OB_SUCC(ret) && i < row_cnt; ++i) {
+        double distance = 0;
+        if (OB_FAIL(ObExprVectorDistance::DisFunc<float>::distance_funcs[dis_type_](search_vec, packed_rows.get_vec(i), dim_, distance))) {
+          LOG_WARN("failed to get distance", K(ret), K(i), K(dis_type_));
+        } else {
+          distances[i] = distance;
+        }
+      }
+      break;
+    }
+  }
+  if (OB_FAIL(ret)) {
+    LOG_WARN("failed to calc packed distances", K(ret), K(dis_type_), K(row_cnt), K(dim_));
+  }
+  return ret;
+}
+
+template <typename T>
+int ObDASIvfScanIter::get_rowkeys_to_heap(const ObIArray<ObString> &cid_strs, int64_t cid_vec_pri_key_cnt,
                                           int64_t cid_vec_column_count, int64_t rowkey_cnt, bool is_vectorized,
+                                          const T *search_vec,
                                           ObVectorCenterClusterHelper<T, ObRowkey> &nearest_rowkey_heap)
 {
   int ret = OB_SUCCESS;
@@ -1285,8 +1385,9 @@ int ObDASIvfScanIter::get_rowkeys_to_heap(const ObString &cid_str, int64_t cid_v
   storage::ObTableScanIterator *cid_vec_scan_iter = nullptr;
   bool is_first_vec = true;
   bool cid_vec_need_norm = true;
-  if (OB_FAIL(scan_cid_range(cid_str, cid_vec_pri_key_cnt, cid_vec_ctdef, cid_vec_rtdef, cid_vec_scan_iter))) {
-    LOG_WARN("fail to scan cid range", K(ret), K(cid_str), K(cid_vec_pri_key_cnt));
+  ObIvfPackedRows<T> packed_rows;
+  if (OB_FAIL(scan_cid_ranges(cid_strs, cid_vec_pri_key_cnt, cid_vec_ctdef, cid_vec_rtdef, cid_vec_scan_iter))) {
+    LOG_WARN("fail to scan cid ranges", K(ret), K(cid_strs), K(cid_vec_pri_key_cnt));
   } else if (is_vectorized) {
     IVF_GET_NEXT_ROWS_BEGIN(cid_vec_iter_)
     if (OB_SUCC(ret)) {
@@ -1296,9 +1397,13 @@ int ObDASIvfScanIter::get_rowkeys_to_heap(const ObString &cid_str, int64_t cid_v
       ObExpr *cid_expr = cid_vec_ctdef->result_output_[CID_VECTOR_IDX];
       ObDatum *cid_datum = cid_expr->locate_batch_datums(*vec_aux_rtdef_->eval_ctx_);
 
+      if (!packed_rows.is_inited() && OB_FAIL(packed_rows.init(mem_context_->get_arena_allocator(), dim_, batch_row_count))) {
+        LOG_WARN("failed to init packed rows", K(ret), K(dim_), K(batch_row_count));
+      } else {
+        packed_rows.reuse();
+      }
+      // 1. pack the vectors of the batch, rowkeys are only built for the rows that enter the heap
       for (int64_t i = 0; OB_SUCC(ret) && i < scan_row_cnt; ++i) {
-        guard.set_batch_idx(i);
-        ObRowkey main_rowkey;
         ObString vec = cid_datum[i].get_string();
         if (OB_FAIL(ObTextStringHelper::read_real_string_data(
                         &mem_context_->get_arena_allocator(),
@@ -1309,8 +1414,9 @@ int ObDASIvfScanIter::get_rowkeys_to_heap(const ObString &cid_str, int64_t cid_v
           LOG_WARN("failed to get real data.", K(ret));
         } else if (OB_ISNULL(vec.ptr())) {
           // ignoring null vector.
-        } else if (OB_FAIL(get_main_rowkey_from_cid_vec_datum(mem_context_->get_arena_allocator(), cid_vec_ctdef, rowkey_cnt, main_rowkey))) {
-          LOG_WARN("fail to get main rowkey", K(ret));
+        } else if (OB_UNLIKELY(vec.length() < dim_ * sizeof(T))) {
+          ret = OB_ERR_UNEXPECTED;
+          LOG_WARN("unexpected vector length", K(ret), K(vec.length()), K(dim_));
         } else if (std::is_same<T, float>::value && need_norm_) {
           // If the first vec needs do_norm, it means that the vec in the cid_vector table is not normalized.
           if (is_first_vec) {
@@ -1328,8 +1434,24 @@ int ObDASIvfScanIter::get_rowkeys_to_heap(const ObString &cid_str, int64_t cid_v
           }
         }
         if (OB_FAIL(ret)) {
-          LOG_WARN("failed to get rowkey", K(ret));
-        } else if (OB_NOT_NULL(vec.ptr()) && OB_FAIL(nearest_rowkey_heap.push_center(main_rowkey, reinterpret_cast<T *>(vec.ptr()), dim_))) {
+          LOG_WARN("failed to get vector", K(ret));
+        } else if (OB_NOT_NULL(vec.ptr())) {
+          packed_rows.add_row(i, reinterpret_cast<const T *>(vec.ptr()));
+        }
+      }
+      // 2. score the packed vectors at once
+      if (OB_SUCC(ret) && packed_rows.get_row_count() > 0 && OB_FAIL(calc_packed_distances(search_vec, packed_rows))) {
+        LOG_WARN("failed to calc packed distances", K(ret), K(packed_rows.get_row_count()));
+      }
+      for (int64_t j = 0; OB_SUCC(ret) && j < packed_rows.get_row_count(); ++j) {
+        const double distance = packed_rows.get_distance(j);
+        ObRowkey main_rowkey;
+        if (nearest_rowkey_heap.is_out_of_range(distance, distance)) {
+          // can not enter the heap
+        } else if (OB_FALSE_IT(guard.set_batch_idx(packed_rows.get_batch_idx(j)))) {
+        } else if (OB_FAIL(get_main_rowkey_from_cid_vec_datum(mem_context_->get_arena_allocator(), cid_vec_ctdef, rowkey_cnt, main_rowkey))) {
+          LOG_WARN("fail to get main rowkey", K(ret));
+        } else if (OB_FAIL(nearest_rowkey_heap.push_center(main_rowkey, distance))) {
           LOG_WARN("failed to push center.", K(ret));
         }
       }
@@ -1398,35 +1520,41 @@ int ObDASIvfScanIter::get_nearest_limit_rowkeys_in_cids(bool is_vectorized, T *s
   int64_t cid_vec_column_count = 0;
   int64_t cid_vec_pri_key_cnt = 0;
   int64_t rowkey_cnt = 0;
-  int64_t buf_len = OB_DOC_ID_COLUMN_BYTE_LENGTH;
+  int64_t buf_len = OB_DOC_ID_COLUMN_BYTE_LENGTH * IVF_PROBE_BATCH_CNT;
   char *buf = nullptr;
-  ObString cid_str;
+  ObSEArray<ObString, IVF_PROBE_BATCH_CNT> cid_strs;
 
   if (OB_FAIL(prepare_cid_range(cid_vec_ctdef, cid_vec_column_count, cid_vec_pri_key_cnt, rowkey_cnt))) {
     LOG_WARN("fail to prepare cid range", K(ret));
   } else if (OB_ISNULL(buf = static_cast<char*>(mem_context_->get_arena_allocator().alloc(buf_len)))) {
     ret = OB_ALLOCATE_MEMORY_FAILED;
     LOG_WARN("failed to alloc cid", K(ret));
-  } else {
-    cid_str.assign_buffer(buf, buf_len);
-  } 
+  }
   // 3. Obtain nprobes * k rowkeys
-  if (near_cid_.count() == 0) {
+  if (OB_FAIL(ret)) {
+  } else if (near_cid_.count() == 0) {
     // The situation of index creation with table creation
     ObString empty_cid;
-    if (OB_FAIL(get_rowkeys_to_heap(empty_cid, cid_vec_pri_key_cnt, cid_vec_column_count, rowkey_cnt, is_vectorized,
-                                    nearest_rowkey_heap))) {
+    if (OB_FAIL(cid_strs.push_back(empty_cid))) {
+      LOG_WARN("failed to push back empty cid", K(ret));
+    } else if (OB_FAIL(get_rowkeys_to_heap(cid_strs, cid_vec_pri_key_cnt, cid_vec_column_count, rowkey_cnt, is_vectorized,
+                                           serch_vec, nearest_rowkey_heap))) {
       LOG_WARN("failed to get rowkeys to heap, when near_cid is empty", K(ret));
     }
   } else {
-    for (int64_t i = 0; OB_SUCC(ret) && i < near_cid_.count(); ++i) {
-      const ObCenterId &cur_cid = near_cid_.at(i);
-      if (OB_FALSE_IT(cid_str.assign_buffer(buf, buf_len))) {
-      } else if (OB_FAIL(ObVectorClusterHelper::set_center_id_to_string(cur_cid, cid_str))) {
-        LOG_WARN("failed to set center_id to string", K(ret), K(cur_cid), K(cid_str));
-      } else if (OB_FAIL(get_rowkeys_to_heap(cid_str, cid_vec_pri_key_cnt, cid_vec_column_count, rowkey_cnt,
-                                             is_vectorized, nearest_rowkey_heap))) {
-        LOG_WARN("failed to get rowkeys to heap", K(ret), K(cur_cid));
+    // every IVF_PROBE_BATCH_CNT lists are read by one multi-range scan
+    for (int64_t i = 0; OB_SUCC(ret) && i < near_cid_.count(); i += IVF_PROBE_BATCH_CNT) {
+      const int64_t end_idx = MIN(i + IVF_PROBE_BATCH_CNT, near_cid_.count());
+      cid_strs.reuse();
+      for (int64_t j = i; OB_SUCC(ret) && j < end_idx; ++j) {
+        if (OB_FAIL(append_probe_cid_str(near_cid_.at(j), buf, cid_strs))) {
+          LOG_WARN("failed to append probe cid", K(ret), K(j), K(near_cid_.at(j)));
+        }
+      }
+      if (OB_FAIL(ret)) {
+      } else if (OB_FAIL(get_rowkeys_to_heap(cid_strs, cid_vec_pri_key_cnt, cid_vec_column_count, rowkey_cnt,
+                                             is_vectorized, serch_vec, nearest_rowkey_heap))) {
+        LOG_WARN("failed to get rowkeys to heap", K(ret), K(i), K(end_idx));
       }
     }
   }
@@ -1964,7 +2092,8 @@ int ObDASIvfPQScanIter::calc_distance_between_pq_ids(
 
 int ObDASIvfPQScanIter::calc_distance_with_precompute(
     ObEvalCtx::BatchInfoScopeGuard &guard,
-    int64_t scan_row_cnt,
+    int64_t begin_idx,
+    int64_t end_idx,
     int64_t rowkey_cnt,
     ObRowkey& filter_main_rowkey,
     float *sim_table,
@@ -1979,7 +2108,7 @@ int ObDASIvfPQScanIter::calc_distance_with_precompute(
   ObDatum *cid_datum = cid_expr->locate_batch_datums(*vec_aux_rtdef_->eval_ctx_);
   int counter = 0;
   size_t saved_j[4] = {0, 0, 0, 0};
-  for (int64_t j = 0; OB_SUCC(ret) && j < scan_row_cnt; ++j) {
+  for (int64_t j = begin_idx; OB_SUCC(ret) && j < end_idx; ++j) {
     bool is_skip = false;
     if (cid_datum[j].is_null()) {
       is_skip = true;
@@ -2080,6 +2209,70 @@ int ObDASIvfPQScanIter::calc_distance_with_precompute(
   return ret;
 }
 
+int ObDASIvfPQScanIter::calc_distance_with_fast_scan(
+    ObEvalCtx::BatchInfoScopeGuard &guard,
+    int64_t begin_idx,
+    int64_t end_idx,
+    int64_t rowkey_cnt,
+    ObRowkey& filter_main_rowkey,
+    float *sim_table,
+    float dis0,
+    ObPQFastScanner &fast_scanner,
+    IvfRowkeyHeap& nearest_rowkey_heap,
+    ObIvfPreFilter *prefilter)
+{
+  int ret = OB_SUCCESS;
+  const ObDASScanCtDef *cid_vec_ctdef = vec_aux_ctdef_->get_vec_aux_tbl_ctdef(
+      vec_aux_ctdef_->get_ivf_cid_vec_tbl_idx(), ObTSCIRScanType::OB_VEC_IVF_CID_VEC_SCAN);
+  ObExpr *cid_expr = cid_vec_ctdef->result_output_[PQ_IDS_IDX];
+  ObDatum *cid_datum = cid_expr->locate_batch_datums(*vec_aux_rtdef_->eval_ctx_);
+  int64_t saved_j[ObPQFastScanner::BLOCK_SIZE];
+  uint16_t block_dists[ObPQFastScanner::BLOCK_SIZE];
+  for (int64_t j = begin_idx; OB_SUCC(ret) && j < end_idx; ++j) {
+    bool is_skip = false;
+    if (cid_datum[j].is_null()) {
+      is_skip = true;
+    } else if (prefilter != nullptr) {
+      guard.set_batch_idx(j);
+      if (OB_FAIL(get_main_rowkey_from_cid_vec_datum(mem_context_->get_arena_allocator(), cid_vec_ctdef, rowkey_cnt, filter_main_rowkey, false))) {
+        LOG_WARN("fail to get main rowkey", K(ret));
+      } else if (!prefilter->test(filter_main_rowkey)) {
+        is_skip = true;
+      }
+    }
+    if (OB_FAIL(ret) || is_skip) {
+    } else {
+      saved_j[fast_scanner.get_row_count()] = j;
+      fast_scanner.add_code(ObVecIVFPQCenterIDS::get_pq_id_ptr(cid_datum[j].get_string().ptr()));
+    }
+    // score a full block, or the partial one left at the end of the list rows
+    const int64_t block_row_cnt = fast_scanner.get_row_count();
+    if (OB_FAIL(ret) || 0 == block_row_cnt) {
+    } else if (fast_scanner.is_block_full() || j == end_idx - 1) {
+      fast_scanner.scan_block(block_dists);
+      for (int64_t k = 0; OB_SUCC(ret) && k < block_row_cnt; ++k) {
+        float lower_bound = 0;
+        float upper_bound = 0;
+        fast_scanner.get_bounds(block_dists[k], lower_bound, upper_bound);
+        if (nearest_rowkey_heap.is_out_of_range(dis0 + lower_bound, dis0 + upper_bound)) {
+          // can not enter the heap, skip rowkey and exact distance
+        } else {
+          const uint8_t* pq_id_ptr = ObVecIVFPQCenterIDS::get_pq_id_ptr(cid_datum[saved_j[k]].get_string().ptr());
+          float dis = dis0 + ObVectorL2Distance<float>::distance_one_code(m_, nbits_, sim_table, pq_id_ptr);
+          ObRowkey main_rowkey;
+          guard.set_batch_idx(saved_j[k]);
+          if (OB_FAIL(get_main_rowkey_from_cid_vec_datum(mem_context_->get_arena_allocator(), cid_vec_ctdef, rowkey_cnt, main_rowkey))) {
+            LOG_WARN("fail to get main rowkey", K(ret));
+          } else if (OB_FAIL(nearest_rowkey_heap.push_center(main_rowkey, dis))) {
+            LOG_WARN("failed to push center.", K(ret));
+          }
+        }
+      }
+    }
+  }
+  return ret;
+}
+
 int ObDASIvfPQScanIter::check_can_pre_compute(
     bool is_vectorized,
     ObIvfCacheMgrGuard &pre_cache_guard,
@@ -2107,6 +2300,66 @@ int ObDASIvfPQScanIter::check_can_pre_compute(
   return ret;
 }
 
+int ObDASIvfPQScanIter::switch_probe_list(
+    const ObString &list_cid,
+    const ObIArray<ObString> &cid_strs,
+    const int64_t first_list_idx,
+    float *search_vec,
+    PQProbeCtx &ctx)
+{
+  int ret = OB_SUCCESS;
+  int64_t list_idx = -1;
+  int64_t ksub = 1L << nbits_;
+  for (int64_t i = 0; i < cid_strs.count() && list_idx < 0; ++i) {
+    if (cid_strs.at(i) == list_cid) {
+      list_idx = first_list_idx + i;
+    }
+  }
+  if (OB_UNLIKELY(list_idx < 0 || list_idx >= near_cid_vec_.count())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("scanned cid is not probed", K(ret), KPHEX(list_cid.ptr(), list_cid.length()), K(first_list_idx));
+  } else if (list_idx == ctx.list_idx_) {
+    // still the same list
+  } else {
+    const ObCenterId &cur_cid = near_cid_vec_.at(list_idx).first;
+    float *cur_cid_vec = near_cid_vec_.at(list_idx).second;
+    ctx.list_idx_ = list_idx;
+    ctx.dis0_ = 0.0f;
+    if (ctx.pre_compute_table_) {
+      if (dis_type_ == oceanbase::sql::ObExprVectorDistance::ObVecDisType::EUCLIDEAN) {
+        const float *sim_table_ptrs = ctx.pre_cent_cache_->get_centroids() + (cur_cid.center_id_ - 1) * ksub * m_;
+        ObVectorL2Distance<float>::fvec_madd(m_ * ksub,
+                                             sim_table_ptrs,
+                                             -2.0,
+                                             ctx.sim_table_2_,
+                                             ctx.sim_table_);
+      }
+      ctx.dis0_ = near_cid_vec_dis_.at(list_idx);
+      if (ctx.fast_scanner_.is_inited() && OB_FAIL(ctx.fast_scanner_.build_lut(ctx.sim_table_))) {
+        LOG_WARN("fail to build fast scan lut", K(ret));
+      }
+    } else {
+      // Calculate the residual r(x) = x - cid_vec
+      // split r(x) into m parts, the jth part is called r(x)[j]
+      float *residual = ctx.residual_;
+      ctx.splited_residual_.reuse();
+      if (dis_type_ == oceanbase::sql::ObExprVectorDistance::ObVecDisType::EUCLIDEAN) {
+        if (OB_FAIL(ObVectorIndexUtil::calc_residual_vector(dim_, search_vec, cur_cid_vec, residual))) {
+          LOG_WARN("fail to calc residual vector", K(ret), K(dim_));
+        }
+      } else {
+        ctx.dis0_ = near_cid_vec_dis_.at(list_idx);
+        residual = search_vec; // ip dis = dis0 + search_vec · pq_vec
+      }
+      if (OB_FAIL(ret)) {
+      } else if (OB_FAIL(ObVectorIndexUtil::split_vector(m_, dim_, residual, ctx.splited_residual_))) {
+        LOG_WARN("fail to split vector", K(ret));
+      }
+    }
+  }
+  return ret;
+}
+
 int ObDASIvfPQScanIter::calc_nearest_limit_rowkeys_in_cids(
     bool is_vectorized,
     float *search_vec,
@@ -2125,17 +2378,11 @@ int ObDASIvfPQScanIter::calc_nearest_limit_rowkeys_in_cids(
   int64_t cid_vec_column_count = 0;
   int64_t cid_vec_pri_key_cnt = 0;
   int64_t rowkey_cnt = 0;
-  ObArray<float *> splited_residual;
-  int64_t buf_len = OB_DOC_ID_COLUMN_BYTE_LENGTH;
+  int64_t buf_len = OB_DOC_ID_COLUMN_BYTE_LENGTH * IVF_PROBE_BATCH_CNT;
   char *buf = nullptr;
-  ObString cid_str;
-  float *residual = nullptr;
-  bool pre_compute_table = false;
+  ObSEArray<ObString, IVF_PROBE_BATCH_CNT> cid_strs;
   ObIvfCacheMgrGuard pre_cache_guard;
-  ObIvfCentCache *pre_cent_cache = nullptr;
-  float *sim_table = nullptr;
-  float *sim_table_2 = nullptr;
-  const float* sim_table_ptrs = nullptr;
+  PQProbeCtx ctx;
   ObRowkey filter_main_rowkey;
   bool is_l2 = (dis_type_ == oceanbase::sql::ObExprVectorDistance::ObVecDisType::EUCLIDEAN);
   if (OB_FAIL(prepare_cid_range(cid_vec_ctdef, cid_vec_column_count, cid_vec_pri_key_cnt, rowkey_cnt))) {
@@ -2143,95 +2390,88 @@ int ObDASIvfPQScanIter::calc_nearest_limit_rowkeys_in_cids(
   } else if (OB_ISNULL(buf = static_cast<char*>(mem_context_->get_arena_allocator().alloc(buf_len)))) {
     ret = OB_ALLOCATE_MEMORY_FAILED;
     LOG_WARN("failed to alloc cid", K(ret));
-  } else if (OB_FALSE_IT(cid_str.assign_buffer(buf, buf_len))) {
-  } else if (OB_FAIL(check_can_pre_compute(is_vectorized, pre_cache_guard, pre_cent_cache, pre_compute_table))) {
+  } else if (OB_FAIL(check_can_pre_compute(is_vectorized, pre_cache_guard, ctx.pre_cent_cache_, ctx.pre_compute_table_))) {
     LOG_WARN("fail to check can use precomputetable", K(ret));
-  } else if (!pre_compute_table) {
+  } else if (!ctx.pre_compute_table_) {
     char *residual_buf = nullptr;
-    if (OB_FAIL(splited_residual.reserve(m_))) {
+    if (OB_FAIL(ctx.splited_residual_.reserve(m_))) {
       LOG_WARN("fail to init splited residual array", K(ret), K(m_));
     } else if (is_l2) { // only L2 need residual
       if (OB_ISNULL(residual_buf = static_cast<char*>(mem_context_->get_arena_allocator().alloc(dim_ * sizeof(float))))) {
         ret = OB_ALLOCATE_MEMORY_FAILED;
         LOG_WARN("failed to alloc residual buf", K(ret));
-      } else if (OB_FALSE_IT(residual = new(residual_buf) float[dim_])) {
+      } else if (OB_FALSE_IT(ctx.residual_ = new(residual_buf) float[dim_])) {
       }
     }
   } else { // scan by precompute table cache
     ObObj *obj_ptr = nullptr;
-    sim_table = (float*)mem_context_->get_arena_allocator().alloc(sizeof(float) * (ksub * m_) * 2);
+    ctx.sim_table_ = (float*)mem_context_->get_arena_allocator().alloc(sizeof(float) * (ksub * m_) * 2);
     obj_ptr = (ObObj*)mem_context_->get_arena_allocator().alloc(sizeof(ObObj) * rowkey_cnt);
-    if (OB_ISNULL(sim_table) || OB_ISNULL(obj_ptr)) {
+    if (OB_ISNULL(ctx.sim_table_) || OB_ISNULL(obj_ptr)) {
       ret = OB_ALLOCATE_MEMORY_FAILED;
       LOG_WARN("failed to alloc residual buf", K(ret), K(ksub), K(m_));
     } else {
       filter_main_rowkey.assign(obj_ptr, rowkey_cnt);
-      sim_table_2 = sim_table + (ksub * m_);
-      if (is_l2 && OB_FAIL(pre_compute_inner_prod_table(search_vec, sim_table_2, is_vectorized))) {
+      ctx.sim_table_2_ = ctx.sim_table_ + (ksub * m_);
+      if (is_l2 && OB_FAIL(pre_compute_inner_prod_table(search_vec, ctx.sim_table_2_, is_vectorized))) {
         LOG_WARN("fail to pre compute inner prod table", K(ret));
-      } else if (!is_l2 && OB_FAIL(pre_compute_inner_prod_table(search_vec, sim_table, is_vectorized))) {
+      } else if (!is_l2 && OB_FAIL(pre_compute_inner_prod_table(search_vec, ctx.sim_table_, is_vectorized))) {
         LOG_WARN("fail to pre compute inner prod table", K(ret));
+      } else if (is_vectorized && ObPQFastScanner::is_supported(m_, nbits_)
+                 && OB_FAIL(ctx.fast_scanner_.init(mem_context_->get_arena_allocator(), m_))) {
+        LOG_WARN("fail to init pq fast scanner", K(ret), K(m_));
       }
     }
   }
-  // 1. for every (cid, cid_vec),
-  for (int i = 0; OB_SUCC(ret) && i < near_cid_vec_.count(); ++i) {
-    const ObCenterId &cur_cid = near_cid_vec_.at(i).first;
-    float *cur_cid_vec = near_cid_vec_.at(i).second;
-    float dis0 = 0.0f;
-    if (pre_compute_table) {
-      if (dis_type_ == oceanbase::sql::ObExprVectorDistance::ObVecDisType::EUCLIDEAN) {
-        sim_table_ptrs = pre_cent_cache->get_centroids() + (cur_cid.center_id_ - 1) * ksub * m_;
-        ObVectorL2Distance<float>::fvec_madd(m_ * ksub,
-                                             sim_table_ptrs,
-                                             -2.0,
-                                             sim_table_2,
-                                             sim_table);
-      }
-      dis0 = near_cid_vec_dis_.at(i);
-    } else {
-      // 1.1 Calculate the residual r(x) = x - cid_vec
-      //     split r(x) into m parts, the jth part is called r(x)[j]
-      splited_residual.reuse();
-      if (dis_type_ == oceanbase::sql::ObExprVectorDistance::ObVecDisType::EUCLIDEAN) {
-        if (OB_FAIL(ObVectorIndexUtil::calc_residual_vector(dim_, search_vec, cur_cid_vec, residual))) {
-          LOG_WARN("fail to calc residual vector", K(ret), K(dim_));
-        } 
-      } else {
-        dis0 = near_cid_vec_dis_.at(i);
-        residual = search_vec; // ip dis = dis0 + search_vec · pq_vec
-      }
-      if (OB_FAIL(ret)) {
-        LOG_WARN("fail to calc residual vector", K(ret), K(dim_));
-      } else if (OB_FAIL(ObVectorIndexUtil::split_vector(m_, dim_, residual, splited_residual))) {
-        LOG_WARN("fail to split vector", K(ret));
+  // 1. every IVF_PROBE_BATCH_CNT lists are read by one multi-range scan, the distance state of a list
+  //    (residual or sim table) is prepared when its rows begin
+  for (int64_t i = 0; OB_SUCC(ret) && i < near_cid_vec_.count(); i += IVF_PROBE_BATCH_CNT) {
+    const int64_t end_idx = MIN(i + IVF_PROBE_BATCH_CNT, near_cid_vec_.count());
+    storage::ObTableScanIterator *cid_vec_scan_iter = nullptr;
+    ObExpr *list_cid_expr = cid_vec_ctdef->result_output_[CID_IDX];
+    cid_strs.reuse();
+    ctx.list_idx_ = -1;
+    for (int64_t j = i; OB_SUCC(ret) && j < end_idx; ++j) {
+      if (OB_FAIL(append_probe_cid_str(near_cid_vec_.at(j).first, buf, cid_strs))) {
+        LOG_WARN("failed to append probe cid", K(ret), K(j), K(near_cid_vec_.at(j).first));
       }
     }
+    // 1.1 cids put the query in the ivf_pq_code table to find (cid, rowkey, pq_center_ids)
     if (OB_FAIL(ret)) {
-    } else {
-      // 1.2 cid put the query in the ivf_pq_code table to find (rowkey, pq_center_ids)
-      storage::ObTableScanIterator *cid_vec_scan_iter = nullptr;
-      if (OB_FALSE_IT(cid_str.assign_buffer(buf, buf_len))) {
-      } else if (OB_FAIL(ObVectorClusterHelper::set_center_id_to_string(cur_cid, cid_str))) {
-        LOG_WARN("failed to set center_id to string", K(ret), K(cur_cid), K(cid_str));
-      } else if (OB_FAIL(scan_cid_range(cid_str, cid_vec_pri_key_cnt, cid_vec_ctdef, cid_vec_rtdef, cid_vec_scan_iter))) {
-        LOG_WARN("fail to scan cid range", K(ret), K(cur_cid), K(cid_vec_pri_key_cnt));
-      } else if (is_vectorized) {
-        IVF_GET_NEXT_ROWS_BEGIN(cid_vec_iter_)
-        if (OB_SUCC(ret)) {
-          ObEvalCtx::BatchInfoScopeGuard guard(*vec_aux_rtdef_->eval_ctx_);
-          guard.set_batch_size(scan_row_cnt);
-          ObExpr *cid_expr = cid_vec_ctdef->result_output_[PQ_IDS_IDX];
-          ObDatum *cid_datum = cid_expr->locate_batch_datums(*vec_aux_rtdef_->eval_ctx_);
-
-          if (pre_compute_table) {
-            if (OB_FAIL(calc_distance_with_precompute(guard, scan_row_cnt, rowkey_cnt, filter_main_rowkey,
-                                                      sim_table, dis0, nearest_rowkey_heap, prefilter))) {
+    } else if (OB_FAIL(scan_cid_ranges(cid_strs, cid_vec_pri_key_cnt, cid_vec_ctdef, cid_vec_rtdef, cid_vec_scan_iter))) {
+      LOG_WARN("fail to scan cid ranges", K(ret), K(i), K(end_idx), K(cid_vec_pri_key_cnt));
+    } else if (is_vectorized) {
+      IVF_GET_NEXT_ROWS_BEGIN(cid_vec_iter_)
+      if (OB_SUCC(ret)) {
+        ObEvalCtx::BatchInfoScopeGuard guard(*vec_aux_rtdef_->eval_ctx_);
+        guard.set_batch_size(scan_row_cnt);
+        ObExpr *cid_expr = cid_vec_ctdef->result_output_[PQ_IDS_IDX];
+        ObDatum *cid_datum = cid_expr->locate_batch_datums(*vec_aux_rtdef_->eval_ctx_);
+        ObDatum *list_cid_datum = list_cid_expr->locate_batch_datums(*vec_aux_rtdef_->eval_ctx_);
+
+        // 1.2 rows of one list are adjacent, compute the distances list by list
+        int64_t list_end = 0;
+        for (int64_t list_begin = 0; OB_SUCC(ret) && list_begin < scan_row_cnt; list_begin = list_end) {
+          const ObString list_cid = list_cid_datum[list_begin].get_string();
+          for (list_end = list_begin + 1;
+               list_end < scan_row_cnt && list_cid_datum[list_end].get_string() == list_cid;
+               ++list_end) {
+          }
+          if (OB_FAIL(switch_probe_list(list_cid, cid_strs, i, search_vec, ctx))) {
+            LOG_WARN("fail to switch probe list", K(ret), K(i));
+          } else if (ctx.pre_compute_table_ && ctx.fast_scanner_.is_inited()) {
+            if (OB_FAIL(calc_distance_with_fast_scan(guard, list_begin, list_end, rowkey_cnt, filter_main_rowkey,
+                                                     ctx.sim_table_, ctx.dis0_, ctx.fast_scanner_,
+                                                     nearest_rowkey_heap, prefilter))) {
+              LOG_WARN("fail to calc distance with fast scan", K(ret));
+            }
+          } else if (ctx.pre_compute_table_) {
+            if (OB_FAIL(calc_distance_with_precompute(guard, list_begin, list_end, rowkey_cnt, filter_main_rowkey,
+                                                      ctx.sim_table_, ctx.dis0_, nearest_rowkey_heap, prefilter))) {
               LOG_WARN("fail to calc distance with pre compute table", K(ret));
             }
           } else {
-            for (int64_t j = 0; OB_SUCC(ret) && j < scan_row_cnt; ++j) {
-              bool is_skip = false;
+            for (int64_t j = list_begin; OB_SUCC(ret) && j < list_end; ++j) {
               guard.set_batch_idx(j);
               if (cid_datum[j].is_null() || cid_datum[j].get_string().empty()) {
                 // do nothing
@@ -2243,59 +2483,61 @@ int ObDASIvfPQScanIter::calc_nearest_limit_rowkeys_in_cids(
                   LOG_WARN("fail to get main rowkey", K(ret));
                 } else if (prefilter != nullptr && !prefilter->test(main_rowkey)) {
                   // has been filter, do nothing
-                } else if (OB_FAIL(calc_distance_between_pq_ids(is_vectorized, pq_center_ids, splited_residual, distance))) {
+                } else if (OB_FAIL(calc_distance_between_pq_ids(is_vectorized, pq_center_ids, ctx.splited_residual_, distance))) {
                   LOG_WARN("fail to calc distance between pq ids", K(ret));
-                } else if (OB_FAIL(nearest_rowkey_heap.push_center(main_rowkey, distance + dis0))) {
+                } else if (OB_FAIL(nearest_rowkey_heap.push_center(main_rowkey, distance + ctx.dis0_))) {
                   LOG_WARN("failed to push center.", K(ret));
                 }
               }
             }
           }
         }
-        IVF_GET_NEXT_ROWS_END(cid_vec_iter_, cid_vec_scan_param_, cid_vec_tablet_id_)
-      } else {
-        while (OB_SUCC(ret)) {
-          ObRowkey main_rowkey;
-          ObString vec_arr_str;
-          ObString pq_center_ids;
-          float distance = 0.0f;
-          // cid_vec_scan_iter output: [IVF_CID_VEC_CID_COL IVF_CID_VEC_VECTOR_COL ROWKEY]
-          if (OB_FAIL(cid_vec_scan_iter->get_next_row())) {
-            if (OB_ITER_END != ret) {
-              LOG_WARN("failed to scan vid rowkey iter", K(ret));
-            }
-          } else if (OB_FAIL(parse_pq_ids_vec_datum(
-              mem_context_->get_arena_allocator(), 
-              cid_vec_column_count, 
-              cid_vec_ctdef, 
-              rowkey_cnt,
-              main_rowkey, 
-              pq_center_ids))) {
-            LOG_WARN("fail to parse cid vec datum", K(ret), K(cid_vec_column_count), K(rowkey_cnt));
-          } else if (pq_center_ids.empty()) {
-            // ignore null arr
-          } else if (prefilter != nullptr && !prefilter->test(main_rowkey)) {
-            // has been filter, do nothing
-          } else {
-            if (pre_compute_table) {
-              const uint8_t* pq_id_ptr = ObVecIVFPQCenterIDS::get_pq_id_ptr(pq_center_ids.ptr());
-              distance = ObVectorL2Distance<float>::distance_one_code(m_, nbits_, sim_table, pq_id_ptr);
-            } else if (OB_FAIL(calc_distance_between_pq_ids(is_vectorized, pq_center_ids, splited_residual, distance))) {
-              LOG_WARN("fail to calc distance between pq ids", K(ret));
-            }
-            if (OB_FAIL(ret)) {
-            } else if (OB_FAIL(nearest_rowkey_heap.push_center(main_rowkey, distance + dis0))) {
-              LOG_WARN("failed to push center.", K(ret));
-            }
+      }
+      IVF_GET_NEXT_ROWS_END(cid_vec_iter_, cid_vec_scan_param_, cid_vec_tablet_id_)
+    } else {
+      while (OB_SUCC(ret)) {
+        ObRowkey main_rowkey;
+        ObString pq_center_ids;
+        float distance = 0.0f;
+        // cid_vec_scan_iter output: [IVF_CID_VEC_CID_COL IVF_CID_VEC_VECTOR_COL ROWKEY]
+        if (OB_FAIL(cid_vec_scan_iter->get_next_row())) {
+          if (OB_ITER_END != ret) {
+            LOG_WARN("failed to scan vid rowkey iter", K(ret));
           }
-        } // end while
-
-        if (ret == OB_ITER_END) {
-          ret = OB_SUCCESS;
-          if (OB_FAIL(cid_vec_iter_->reuse())) {
-            LOG_WARN("fail to reuse scan iterator.", K(ret));
+        } else if (OB_FAIL(parse_pq_ids_vec_datum(
+            mem_context_->get_arena_allocator(),
+            cid_vec_column_count,
+            cid_vec_ctdef,
+            rowkey_cnt,
+            main_rowkey,
+            pq_center_ids))) {
+          LOG_WARN("fail to parse cid vec datum", K(ret), K(cid_vec_column_count), K(rowkey_cnt));
+        } else if (pq_center_ids.empty()) {
+          // ignore null arr
+        } else if (prefilter != nullptr && !prefilter->test(main_rowkey)) {
+          // has been filter, do nothing
+        } else if (OB_FAIL(switch_probe_list(list_cid_expr->locate_expr_datum(*vec_aux_rtdef_->eval_ctx_).get_string(),
+                                             cid_strs, i, search_vec, ctx))) {
+          LOG_WARN("fail to switch probe list", K(ret), K(i));
+        } else {
+          if (ctx.pre_compute_table_) {
+            const uint8_t* pq_id_ptr = ObVecIVFPQCenterIDS::get_pq_id_ptr(pq_center_ids.ptr());
+            distance = ObVectorL2Distance<float>::distance_one_code(m_, nbits_, ctx.sim_table_, pq_id_ptr);
+          } else if (OB_FAIL(calc_distance_between_pq_ids(is_vectorized, pq_center_ids, ctx.splited_residual_, distance))) {
+            LOG_WARN("fail to calc distance between pq ids", K(ret));
+          }
+          if (OB_FAIL(ret)) {
+          } else if (OB_FAIL(nearest_rowkey_heap.push_center(main_rowkey, distance + ctx.dis0_))) {
+            LOG_WARN("failed to push center.", K(ret));
           }
         }
+      } // end while
+
+      if (ret == OB_ITER_END) {
+        ret = OB_SUCCESS;
+        if (OB_FAIL(cid_vec_iter_->reuse())) {
+          LOG_WARN("fail to reuse scan iterator.", K(ret));
+        }
       }
     }
   } // end for i
@@ -23,6 +23,7 @@
 #include "sql/das/iter/ob_das_vec_scan_utils.h"
 #include "sql/engine/expr/ob_expr_vec_ivf_sq8_data_vector.h"
 #include "share/vector_index/ob_plugin_vector_index_service.h"
+#include "share/vector_type/ob_vector_pq_fast_scan.h"
 
 namespace oceanbase
 {
@@ -265,8 +266,10 @@ protected:
   int get_rowkey_pre_filter(ObIAllocator& allocator, bool is_vectorized, int64_t max_rowkey_count);
   int prepare_cid_range(const ObDASScanCtDef *cid_vec_ctdef, int64_t &cid_vec_column_count,
                         int64_t &cid_vec_pri_key_cnt, int64_t &rowkey_cnt);
-  int scan_cid_range(const ObString &cid, int64_t cid_vec_pri_key_cnt, const ObDASScanCtDef *cid_vec_ctdef,
-                     ObDASScanRtDef *cid_vec_rtdef, storage::ObTableScanIterator *&cid_vec_scan_iter);
+  // buf holds IVF_PROBE_BATCH_CNT cids of OB_DOC_ID_COLUMN_BYTE_LENGTH bytes
+  int append_probe_cid_str(const ObCenterId &cid, char *buf, ObIArray<ObString> &cid_strs);
+  int scan_cid_ranges(const ObIArray<ObString> &cids, int64_t cid_vec_pri_key_cnt, const ObDASScanCtDef *cid_vec_ctdef,
+                      ObDASScanRtDef *cid_vec_rtdef, storage::ObTableScanIterator *&cid_vec_scan_iter);
   int64_t get_nprobe(const common::ObLimitParam &limit_param, int64_t enlargement_factor = 1);
   int generate_nearest_cid_heap(bool is_vectorized,
                                 share::ObVectorCenterClusterHelper<float, ObCenterId> &nearest_cid_heap,
@@ -322,6 +325,8 @@ protected:
   static const int64_t CID_IDX = 0;
   static const int64_t CID_VECTOR_IDX = 1;
   static const uint64_t IVF_MAX_BRUTE_FORCE_SIZE = 10001;
+  // probed lists read by one multi-range scan of the cid_vec table
+  static const int64_t IVF_PROBE_BATCH_CNT = 16;
   // data table
   static const int64_t DATA_VECTOR_IDX = 0;
 
@@ -382,6 +387,75 @@ protected:
   float distance_threshold_;
 };
 
+// Vectors of one scanned batch of the cid_vec table, copied back to back into a 64 bytes aligned
+// buffer so that they are scored by one call of the batch distance kernels, batch_idxs_ maps a
+// packed row back to its row in the batch to build the rowkey later. The kernels write float
+// results to kernel_dists_, distances_ keep double like the per row distance functions.
+template <typename T>
+class ObIvfPackedRows
+{
+public:
+  static const int64_t PACKED_ROWS_ALIGN = 64;
+
+  ObIvfPackedRows()
+      : dim_(0), capacity_(0), row_cnt_(0), vecs_(nullptr), kernel_dists_(nullptr), distances_(nullptr),
+        batch_idxs_(nullptr)
+  {}
+  ~ObIvfPackedRows() {}
+  int init(ObArenaAllocator &allocator, const int64_t dim, const int64_t capacity)
+  {
+    int ret = OB_SUCCESS;
+    if (OB_UNLIKELY(dim <= 0 || capacity <= 0)) {
+      ret = OB_INVALID_ARGUMENT;
+      SQL_LOG(WARN, "invalid argument", K(ret), K(dim), K(capacity));
+    } else if (OB_ISNULL(vecs_ = static_cast<T *>(allocator.alloc_aligned(sizeof(T) * dim * capacity, PACKED_ROWS_ALIGN)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      SQL_LOG(WARN, "failed to alloc packed vectors", K(ret), K(dim), K(capacity));
+    } else if (OB_ISNULL(kernel_dists_ = static_cast<float *>(allocator.alloc(sizeof(float) * capacity)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      SQL_LOG(WARN, "failed to alloc kernel distances", K(ret), K(capacity));
+    } else if (OB_ISNULL(distances_ = static_cast<double *>(allocator.alloc(sizeof(double) * capacity)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      SQL_LOG(WARN, "failed to alloc distances", K(ret), K(capacity));
+    } else if (OB_ISNULL(batch_idxs_ = static_cast<int64_t *>(allocator.alloc(sizeof(int64_t) * capacity)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      SQL_LOG(WARN, "failed to alloc batch idxs", K(ret), K(capacity));
+    } else {
+      dim_ = dim;
+      capacity_ = capacity;
+      row_cnt_ = 0;
+    }
+    return ret;
+  }
+  bool is_inited() const { return capacity_ > 0; }
+  void reuse() { row_cnt_ = 0; }
+  // vec holds dim items, the caller makes sure the batch is not larger than capacity
+  void add_row(const int64_t batch_idx, const T *vec)
+  {
+    MEMCPY(vecs_ + row_cnt_ * dim_, vec, sizeof(T) * dim_);
+    batch_idxs_[row_cnt_++] = batch_idx;
+  }
+  int64_t get_dim() const { return dim_; }
+  int64_t get_row_count() const { return row_cnt_; }
+  const T *get_vecs() const { return vecs_; }
+  const T *get_vec(const int64_t idx) const { return vecs_ + idx * dim_; }
+  float *get_kernel_dists() { return kernel_dists_; }
+  double *get_distances() { return distances_; }
+  double get_distance(const int64_t idx) const { return distances_[idx]; }
+  int64_t get_batch_idx(const int64_t idx) const { return batch_idxs_[idx]; }
+  TO_STRING_KV(K_(dim), K_(capacity), K_(row_cnt), KP_(vecs));
+
+private:
+  int64_t dim_;
+  int64_t capacity_;
+  int64_t row_cnt_;
+  T *vecs_;
+  float *kernel_dists_;
+  double *distances_;
+  int64_t *batch_idxs_;
+  DISALLOW_COPY_AND_ASSIGN(ObIvfPackedRows);
+};
+
 class ObDASIvfScanIter : public ObDASIvfBaseScanIter
 {
 public:
@@ -401,10 +475,12 @@ protected:
   int get_nearest_probe_center_ids(bool is_vectorized);
 
   template <typename T>
-  int get_rowkeys_to_heap(const ObString &cid_str, int64_t cid_vec_pri_key_cnt, int64_t cid_vec_column_count,
-                          int64_t rowkey_cnt, bool is_vectorized,
+  int get_rowkeys_to_heap(const ObIArray<ObString> &cid_strs, int64_t cid_vec_pri_key_cnt, int64_t cid_vec_column_count,
+                          int64_t rowkey_cnt, bool is_vectorized, const T *search_vec,
                           ObVectorCenterClusterHelper<T, ObRowkey> &nearest_rowkey_heap);
   template <typename T>
+  int calc_packed_distances(const T *search_vec, ObIvfPackedRows<T> &packed_rows);
+  template <typename T>
   int get_nearest_limit_rowkeys_in_cids(bool is_vectorized, T *serch_vec);
   virtual int process_ivf_scan_pre(ObIAllocator &allocator, bool is_vectorized);
   int check_cid_exist(const ObString &src_cid, bool &src_cid_exist);
@@ -513,11 +589,25 @@ protected:
   uint64_t hash_val_for_rk(const common::ObRowkey& rk);
   int calc_distance_with_precompute(
     ObEvalCtx::BatchInfoScopeGuard &guard,
-    int64_t scan_row_cnt,
+    int64_t begin_idx,
+    int64_t end_idx,
+    int64_t rowkey_cnt,
+    ObRowkey& filter_main_rowkey,
+    float *sim_table,
+    float dis0,
+    IvfRowkeyHeap& nearest_rowkey_heap,
+    ObIvfPreFilter *prefilter);
+  // 4-bit pq codes, rows that can not enter the heap by quantized distance bounds are dropped
+  // before fetching the rowkey and computing the exact distance
+  int calc_distance_with_fast_scan(
+    ObEvalCtx::BatchInfoScopeGuard &guard,
+    int64_t begin_idx,
+    int64_t end_idx,
     int64_t rowkey_cnt,
     ObRowkey& filter_main_rowkey,
     float *sim_table,
     float dis0,
+    ObPQFastScanner &fast_scanner,
     IvfRowkeyHeap& nearest_rowkey_heap,
     ObIvfPreFilter *prefilter);
   int check_can_pre_compute(
@@ -526,6 +616,31 @@ protected:
     ObIvfCentCache *&pre_cent_cache,
     bool &pre_compute_table);
 private:
+  // distance state of the probed list whose rows are being scanned
+  struct PQProbeCtx
+  {
+    PQProbeCtx()
+        : list_idx_(-1), dis0_(0.0f), pre_compute_table_(false), pre_cent_cache_(nullptr),
+          sim_table_(nullptr), sim_table_2_(nullptr), residual_(nullptr), splited_residual_(), fast_scanner_()
+    {}
+    int64_t list_idx_; // index in near_cid_vec_
+    float dis0_;
+    bool pre_compute_table_;
+    ObIvfCentCache *pre_cent_cache_;
+    float *sim_table_;
+    float *sim_table_2_;
+    float *residual_;
+    ObArray<float *> splited_residual_;
+    ObPQFastScanner fast_scanner_;
+  };
+  // prepare ctx for the list of list_cid, cid_strs are the cids of near_cid_vec_ from first_list_idx
+  int switch_probe_list(
+    const ObString &list_cid,
+    const ObIArray<ObString> &cid_strs,
+    const int64_t first_list_idx,
+    float *search_vec,
+    PQProbeCtx &ctx);
+
   // in pq_code table
   static const int64_t PQ_CENTROID_VEC_IDX = 1;
   // in pq_centroid table
@@ -183,7 +183,6 @@ void ObDASSPIVMergeIter::sort_by_value(uint32_t *keys, float *values, int l, int
   }
 }
 
-// TODO: set algo dynamic
 void ObDASSPIVMergeIter::set_algo()
 {
   algo_ = SPIVAlgo::BLOCK_MAX_WAND;
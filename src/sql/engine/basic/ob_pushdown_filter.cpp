@@ -23,6 +23,7 @@
 #include "sql/code_generator/ob_static_engine_cg.h"
 #include "storage/blocksstable/ob_micro_block_row_scanner.h"
 #include "sql/engine/expr/ob_expr_topn_filter.h"
+#include "sql/engine/expr/ob_expr_jit_filter.h"
 #include "sql/engine/expr/ob_json_param_type.h"
 #include "sql/engine/expr/ob_expr_json_func_helper.h"
 
@@ -2373,18 +2374,32 @@ int ObBlackFilterExecutor::eval_exprs_batch(ObBitVector &skip, const int64_t bsi
   clear_evaluated_infos();
   ObEvalCtx &eval_ctx = op_.get_eval_ctx();
   const bool enable_rich_format = op_.enable_rich_format_;
+  int64_t start_idx = 0;
   FOREACH_CNT_X(e, filter_.column_exprs_, OB_SUCC(ret)) {
     (*e)->get_eval_info(eval_ctx).projected_ = true;
   }
-  FOREACH_CNT_X(e, filter_.filter_exprs_, OB_SUCC(ret) && !skip.is_all_true(bsize)) {
+  if (enable_rich_format && nullptr != filter_.jit_filter_) {
+    bool all_active = skip.is_all_false(bsize);
+    int64_t output_rows = 0;
+    bool done = false;
+    if (OB_FAIL(filter_.jit_filter_->filter(eval_ctx, skip, bsize, all_active, output_rows, done))) {
+      LOG_WARN("jit filter failed", K(ret));
+    } else if (done) {
+      start_idx = filter_.jit_filter_->get_filter_cnt();
+    }
+  }
+  for (int64_t filter_idx = start_idx;
+       OB_SUCC(ret) && filter_idx < filter_.filter_exprs_.count() && !skip.is_all_true(bsize);
+       ++filter_idx) {
+    ObExpr *e = filter_.filter_exprs_.at(filter_idx);
     if (enable_rich_format) {
-      if (can_skip_eval_runtime_filter_expr(*e, op_)) {
+      if (can_skip_eval_runtime_filter_expr(e, op_)) {
         // For black runtime filter, they are in the same BlackFilterExecutor, in filter and bloom
         // filter is mutually exclusive, so we can skip the inactive one here.
-      } else if (OB_FAIL((*e)->eval_vector(eval_ctx, skip, bsize, skip.is_all_false(bsize)))) {
+      } else if (OB_FAIL(e->eval_vector(eval_ctx, skip, bsize, skip.is_all_false(bsize)))) {
         LOG_WARN("evaluate batch failed", K(ret));
       } else {
-        ObIVector *res = (*e)->get_vector(eval_ctx);
+        ObIVector *res = e->get_vector(eval_ctx);
         if (VectorFormat::VEC_FIXED == res->get_format()) {
           ObFixedLengthBase *fixed_length_base = static_cast<ObFixedLengthBase *>(res);
           const bool has_null = fixed_length_base->has_null();
@@ -2402,21 +2417,21 @@ int ObBlackFilterExecutor::eval_exprs_batch(ObBitVector &skip, const int64_t bsi
         }
       }
     } else {
-      if (OB_FAIL((*e)->eval_batch(eval_ctx, skip, bsize))) {
+      if (OB_FAIL(e->eval_batch(eval_ctx, skip, bsize))) {
        LOG_WARN("evaluate batch failed", K(ret));
-      } else if (!(*e)->is_batch_result()) {
-        const ObDatum &d = (*e)->locate_expr_datum(eval_ctx);
+      } else if (!e->is_batch_result()) {
+        const ObDatum &d = e->locate_expr_datum(eval_ctx);
         if (is_row_filtered(d)) {
           skip.set_all(bsize);
         }
       } else {
-        const ObDatum *datums = (*e)->locate_batch_datums(eval_ctx);
+        const ObDatum *datums = e->locate_batch_datums(eval_ctx);
         if (mark_filtered_datums_simd == mark_filtered_datums_func
-            && (*e)->get_eval_info(eval_ctx).point_to_frame_) {
+            && e->get_eval_info(eval_ctx).point_to_frame_) {
           char bit_vec_mem[ObBitVector::memory_size(bsize)];
           ObBitVector *tmp_vec = to_bit_vector(bit_vec_mem);
           mark_filtered_datums_func(datums,
-                                   reinterpret_cast<uint64_t *>((*e)->get_rev_buf(eval_ctx)),
+                                   reinterpret_cast<uint64_t *>(e->get_rev_buf(eval_ctx)),
                                   bsize,
                                   *tmp_vec);
           skip.bit_calculate(skip, *tmp_vec, bsize,
@@ -62,6 +62,7 @@ class ObOpRawExpr;
 class ObExprOperatorCtx;
 class ObStaticEngineCG;
 class ObPushdownOperator;
+class ObExprJitFilter;
 struct ObExprFrameInfo;
 struct PushdownFilterInfo;
 typedef common::ObFixedArray<const share::schema::ObColumnParam*, common::ObIAllocator> ColumnParamFixedArray;
@@ -349,7 +350,8 @@ public:
       filter_exprs_(alloc),
       tmp_expr_(nullptr),
       assist_exprs_(alloc),
-      mono_(MON_NON)
+      mono_(MON_NON),
+      jit_filter_(nullptr)
   {}
   ~ObPushdownBlackFilterNode() {}
 
@@ -371,6 +373,8 @@ public:
   // assist_exprs_[0] is greater expr, assist_exprs_[1] is less expr.
   ExprFixedArray assist_exprs_;
   PushdownFilterMonotonicity mono_;
+  // %filter_exprs_ compiled by ObExprJitFilter, owned by the plan and not serialized
+  const ObExprJitFilter *jit_filter_;
 };
 
 enum ObWhiteFilterOperatorType
@@ -907,6 +911,7 @@ public:
   ~ObBlackFilterExecutor();
 
   OB_INLINE ObPushdownBlackFilterNode &get_filter_node() { return filter_; }
+  OB_INLINE const ObPushdownBlackFilterNode &get_filter_node() const { return filter_; }
   OB_INLINE virtual common::ObIArray<uint64_t> &get_col_ids() override
   { return filter_.get_col_ids(); }
   virtual const common::ObIArray<ObExpr *> *get_cg_col_exprs() const override { return &filter_.column_exprs_; }
@@ -1590,6 +1590,7 @@ int ObAIFuncModel::call_dense_embedding(ObString &content, ObJsonObject *config,
   int ret = OB_SUCCESS;
   ObArray<ObString> contents;
   ObArray<ObString> results;
+  share::ObAIFuncResultCacheKey cache_key;
   if (content.empty()) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("content is empty", K(ret));
@@ -1598,6 +1599,10 @@ int ObAIFuncModel::call_dense_embedding(ObString &content, ObJsonObject *config,
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("info type is not dense embedding", K(ret));
     LOG_USER_ERROR(OB_INVALID_ARGUMENT, "info type is not dense embedding");
+  } else if (OB_FAIL(init_result_cache_key(config, content, cache_key))) {
+    LOG_WARN("Failed to init result cache key", K(ret));
+  } else if (get_cached_result(cache_key, result)) {
+    // cache hit
   } else if (OB_FAIL(contents.push_back(content))) {
     LOG_WARN("Failed to push back content", K(ret));
   } else if (OB_FAIL(call_dense_embedding_vector_v2(contents, config, results))) {
@@ -1607,6 +1612,7 @@ int ObAIFuncModel::call_dense_embedding(ObString &content, ObJsonObject *config,
     LOG_WARN("results is not equal to 1", K(ret));
   } else {
     result = results[0];
+    put_cached_result(cache_key, result);
   }
   return ret;
 }
@@ -1746,10 +1752,47 @@ int ObAIFuncModel::call_rerank(ObString &query, ObJsonArray *contents, ObJsonArr
   ObAIFuncClient client;
   ObString unencrypted_access_key;
   ObString request_model_name = get_request_model_name();
+  share::ObAIFuncResultCacheKey cache_key;
+  ObString document_str;
+  ObString cached_result;
+  ObIJsonBase *cached_base = nullptr;
+  bool cache_hit = false;
   if (!is_rerank_type()) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("info type is not rerank", K(ret));
     LOG_USER_ERROR(OB_INVALID_ARGUMENT, "info type is not rerank");
+  } else if (OB_FAIL(init_result_cache_key(nullptr, query, cache_key))) {
+    LOG_WARN("Failed to init result cache key", K(ret));
+  } else if (!cache_key.is_valid()) {
+    // no cache
+  } else if (OB_ISNULL(contents)) {
+    cache_key = share::ObAIFuncResultCacheKey();
+  } else {
+    // every document is a separate input of the key, after the query
+    for (uint64_t i = 0; OB_SUCC(ret) && i < contents->element_count(); ++i) {
+      ObIJsonBase *document = nullptr;
+      if (OB_FAIL(contents->get_array_element(i, document))) {
+        LOG_WARN("Failed to get document", K(ret), K(i));
+      } else if (OB_FAIL(ObAIFuncJsonUtils::print_json_to_str(*allocator_, document, document_str))) {
+        LOG_WARN("Failed to print document", K(ret), K(i));
+      } else {
+        cache_key.append_input(document_str);
+      }
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (!get_cached_result(cache_key, cached_result)) {
+  } else {
+    int tmp_ret = OB_SUCCESS;
+    if (OB_TMP_FAIL(ObJsonBaseFactory::get_json_base(allocator_, cached_result, ObJsonInType::JSON_TREE,
+                                                     ObJsonInType::JSON_TREE, cached_base))) {
+      LOG_WARN("Failed to parse cached rerank result, ignore it", K(tmp_ret));
+    } else if (OB_NOT_NULL(cached_base) && cached_base->json_type() == ObJsonNodeType::J_ARRAY) {
+      results = static_cast<ObJsonArray *>(cached_base);
+      cache_hit = true;
+    }
+  }
+  if (OB_FAIL(ret) || cache_hit) {
   } else if (OB_FAIL(ObAIFuncUtils::get_rerank_provider(*allocator_, endpoint_info_.get_provider(), rerank_provider))) {
     LOG_WARN("Failed to get rerank provider", K(ret));
   } else if (OB_FAIL(endpoint_info_.get_unencrypted_access_key(*allocator_, unencrypted_access_key))) {
@@ -1764,6 +1807,15 @@ int ObAIFuncModel::call_rerank(ObString &query, ObJsonArray *contents, ObJsonArr
     LOG_WARN("Failed to parse output", K(ret));
   } else {
     results = static_cast<ObJsonArray *>(result_base);
+    if (cache_key.is_valid()) {
+      ObString result_str;
+      int tmp_ret = OB_SUCCESS;
+      if (OB_TMP_FAIL(ObAIFuncJsonUtils::print_json_to_str(*allocator_, result_base, result_str))) {
+        LOG_WARN("Failed to print rerank result", K(tmp_ret));
+      } else {
+        put_cached_result(cache_key, result_str);
+      }
+    }
   }
   return ret;
 }
@@ -1960,5 +2012,55 @@ const ObString ObAIFuncModel::get_request_model_name()
   return request_model_name;
 }
 
+// The key stays invalid when the cache is disabled or the function is not deterministic,
+// so the lookup and the put are skipped.
+int ObAIFuncModel::init_result_cache_key(ObJsonObject *config, const ObString &input,
+                                         share::ObAIFuncResultCacheKey &cache_key)
+{
+  int ret = OB_SUCCESS;
+  ObString config_str;
+  if (!share::ObAIFuncResultCache::is_enabled()
+      || !share::ObAIFuncResultCacheKey::is_cacheable_func_type(info_.type_)
+      || input.empty()) {
+    // no cache
+  } else if (OB_NOT_NULL(config) && OB_FAIL(ObAIFuncJsonUtils::print_json_to_str(*allocator_, config, config_str))) {
+    LOG_WARN("Failed to print config", K(ret));
+  } else {
+    cache_key = share::ObAIFuncResultCacheKey(MTL_ID(), info_.type_);
+    cache_key.append_param(info_.name_);
+    cache_key.append_param(get_request_model_name());
+    cache_key.append_param(endpoint_info_.get_provider());
+    cache_key.append_param(endpoint_info_.get_url());
+    cache_key.append_param(config_str);
+    cache_key.append_input(input);
+  }
+  return ret;
+}
+
+bool ObAIFuncModel::get_cached_result(const share::ObAIFuncResultCacheKey &cache_key, ObString &result)
+{
+  int ret = OB_SUCCESS;
+  bool cache_hit = false;
+  if (!cache_key.is_valid()) {
+  } else if (OB_FAIL(share::ObAIFuncResultCache::get_instance().get_result(cache_key, *allocator_, result))) {
+    if (OB_ENTRY_NOT_EXIST != ret) {
+      LOG_WARN("Failed to get ai func result from cache, ignore it", K(ret), K(cache_key));
+    }
+  } else {
+    cache_hit = true;
+    LOG_DEBUG("ai func result cache hit", K(cache_key));
+  }
+  return cache_hit;
+}
+
+void ObAIFuncModel::put_cached_result(const share::ObAIFuncResultCacheKey &cache_key, const ObString &result)
+{
+  int ret = OB_SUCCESS;
+  if (!cache_key.is_valid() || result.empty()) {
+  } else if (OB_FAIL(share::ObAIFuncResultCache::get_instance().put_result(cache_key, result))) {
+    LOG_WARN("Failed to put ai func result into cache, ignore it", K(ret), K(cache_key));
+  }
+}
+
 } // namespace common
 } // namespace oceanbase
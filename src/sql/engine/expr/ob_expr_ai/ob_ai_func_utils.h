@@ -20,6 +20,7 @@
 #include "ob_ai_func.h"
 #include "share/vector_index/ob_json_helper.h"
 #include "lib/encode/ob_base64_encode.h"
+#include "share/ai_service/ob_ai_func_result_cache.h"
 
 namespace oceanbase
 {
@@ -431,6 +432,10 @@ public:
    bool is_dense_embedding_type() {return info_.type_ == share::EndpointType::DENSE_EMBEDDING;}
    bool is_rerank_type() {return info_.type_ == share::EndpointType::RERANK;}
    const ObString get_request_model_name();
+   // result cache of identical calls, cache errors never fail the call
+   int init_result_cache_key(ObJsonObject *config, const ObString &input, share::ObAIFuncResultCacheKey &cache_key);
+   bool get_cached_result(const share::ObAIFuncResultCacheKey &cache_key, ObString &result);
+   void put_cached_result(const share::ObAIFuncResultCacheKey &cache_key, const ObString &result);
    ObIAllocator *allocator_;
    const ObAIFuncExprInfo &info_;
    const ObAiModelEndpointInfo &endpoint_info_;
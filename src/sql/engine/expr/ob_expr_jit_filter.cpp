@@ -0,0 +1,392 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+
+#include "sql/engine/expr/ob_expr_jit_filter.h"
+#include "sql/engine/expr/ob_expr_add.h"
+#include "sql/engine/expr/ob_expr_minus.h"
+#include "sql/engine/expr/ob_expr_mul.h"
+#include "share/vector/ob_fixed_length_base.h"
+#include "share/vector/ob_uniform_base.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace sql
+{
+
+namespace
+{
+
+// Translates filters to the node dag of ObJitFilterKernel, the exprs must have the same
+// semantics as the nodes, including null and errors, or they are not supported.
+class ObJitFilterTranslator
+{
+public:
+  explicit ObJitFilterTranslator(const ObIArray<ObExpr *> &evaluated_exprs)
+    : evaluated_exprs_(evaluated_exprs) {}
+  // the filter is not added if it is not supported
+  int add_filter(ObExpr *filter, bool &supported);
+
+  ObSEArray<jit::ObJitFilterNode, 32> nodes_;
+  ObSEArray<int64_t, 64> args_;
+  ObSEArray<int64_t, 8> roots_;
+  ObSEArray<ObExpr *, 16> leaves_;
+
+private:
+  int add_expr(ObExpr *expr, int64_t &node_idx, bool &supported);
+  bool is_leaf(const ObExpr &expr) const;
+  static bool get_op(const ObExpr &expr, jit::ObJitFilterOp &op);
+  static bool get_value_type(const ObDatumMeta &meta, jit::ObJitValueType &type);
+  // doubles with a fixed scale are compared with a precision, see ObExprCmpFuncsHelper
+  static bool is_fixed_double(const ObDatumMeta &meta)
+  {
+    return ObDoubleType == meta.type_ && meta.scale_ > SCALE_UNKNOWN_YET
+        && meta.scale_ <= OB_MAX_DOUBLE_FLOAT_SCALE;
+  }
+  static bool is_int(const ObExpr *expr) { return ob_is_int_tc(expr->datum_meta_.type_); }
+  static bool is_double(const ObExpr *expr)
+  {
+    return ObDoubleType == expr->datum_meta_.type_ && !is_fixed_double(expr->datum_meta_);
+  }
+
+private:
+  const ObIArray<ObExpr *> &evaluated_exprs_;
+  // expr of each node, shared exprs are translated once
+  ObSEArray<ObExpr *, 32> node_exprs_;
+};
+
+int ObJitFilterTranslator::add_filter(ObExpr *filter, bool &supported)
+{
+  int ret = OB_SUCCESS;
+  const int64_t node_cnt = nodes_.count();
+  const int64_t arg_cnt = args_.count();
+  const int64_t leaf_cnt = leaves_.count();
+  int64_t node_idx = -1;
+  supported = true;
+  if (OB_ISNULL(filter)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("filter is null", K(ret));
+  } else if (!is_int(filter)) {
+    supported = false;
+  } else if (OB_FAIL(add_expr(filter, node_idx, supported))) {
+    LOG_WARN("failed to add expr", K(ret));
+  } else if (supported && OB_FAIL(roots_.push_back(node_idx))) {
+    LOG_WARN("failed to push back root", K(ret));
+  }
+  if (OB_SUCC(ret) && !supported) {
+    while (nodes_.count() > node_cnt) {
+      nodes_.pop_back();
+      node_exprs_.pop_back();
+    }
+    while (args_.count() > arg_cnt) {
+      args_.pop_back();
+    }
+    while (leaves_.count() > leaf_cnt) {
+      leaves_.pop_back();
+    }
+  }
+  return ret;
+}
+
+int ObJitFilterTranslator::add_expr(ObExpr *expr, int64_t &node_idx, bool &supported)
+{
+  int ret = OB_SUCCESS;
+  jit::ObJitFilterNode node;
+  node_idx = -1;
+  for (int64_t i = 0; -1 == node_idx && i < node_exprs_.count(); ++i) {
+    if (node_exprs_.at(i) == expr) {
+      node_idx = i;
+    }
+  }
+  if (-1 != node_idx) {
+    // translated
+  } else if (OB_ISNULL(expr)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("expr is null", K(ret));
+  } else if (!get_value_type(expr->datum_meta_, node.type_)) {
+    supported = false;
+  } else if (is_leaf(*expr)) {
+    if (leaves_.count() >= ObExprJitFilter::MAX_LEAF_CNT) {
+      supported = false;
+    } else if (OB_FAIL(leaves_.push_back(expr))) {
+      LOG_WARN("failed to push back leaf", K(ret));
+    } else {
+      node.op_ = jit::ObJitFilterOp::LEAF;
+      node.leaf_idx_ = leaves_.count() - 1;
+    }
+  } else if (!get_op(*expr, node.op_)) {
+    supported = false;
+  } else {
+    // the type arg of cast is not translated
+    const int64_t arg_cnt = jit::ObJitFilterOp::INT_TO_DOUBLE == node.op_ ? 1 : expr->arg_cnt_;
+    ObSEArray<int64_t, 8> arg_idxs;
+    for (int64_t i = 0; OB_SUCC(ret) && supported && i < arg_cnt; ++i) {
+      int64_t arg_idx = -1;
+      if (OB_FAIL(add_expr(expr->args_[i], arg_idx, supported))) {
+        LOG_WARN("failed to add arg", K(ret), K(i));
+      } else if (supported && OB_FAIL(arg_idxs.push_back(arg_idx))) {
+        LOG_WARN("failed to push back arg", K(ret));
+      }
+    }
+    if (OB_SUCC(ret) && supported) {
+      node.arg_start_ = args_.count();
+      node.arg_cnt_ = arg_cnt;
+      if (OB_FAIL(append(args_, arg_idxs))) {
+        LOG_WARN("failed to append args", K(ret));
+      }
+    }
+  }
+  if (OB_SUCC(ret) && supported && -1 == node_idx) {
+    if (nodes_.count() >= ObExprJitFilter::MAX_NODE_CNT) {
+      supported = false;
+    } else if (OB_FAIL(nodes_.push_back(node))) {
+      LOG_WARN("failed to push back node", K(ret));
+    } else if (OB_FAIL(node_exprs_.push_back(expr))) {
+      LOG_WARN("failed to push back expr", K(ret));
+    } else {
+      node_idx = nodes_.count() - 1;
+    }
+  }
+  return ret;
+}
+
+// Leaves are evaluated by ObExpr::eval_vector() before the kernel runs, which should not
+// compute anything the filters would not, so only values already there are leaves.
+bool ObJitFilterTranslator::is_leaf(const ObExpr &expr) const
+{
+  bool is_leaf = T_REF_COLUMN == expr.type_
+      || (!expr.is_batch_result() && (IS_CONST_LITERAL(expr.type_) || T_QUESTIONMARK == expr.type_));
+  for (int64_t i = 0; !is_leaf && i < evaluated_exprs_.count(); ++i) {
+    is_leaf = evaluated_exprs_.at(i) == &expr;
+  }
+  return is_leaf;
+}
+
+bool ObJitFilterTranslator::get_value_type(const ObDatumMeta &meta, jit::ObJitValueType &type)
+{
+  bool supported = true;
+  if (ob_is_int_tc(meta.type_)) {
+    type = jit::ObJitValueType::INT64;
+  } else if (ObDoubleType == meta.type_) {
+    type = jit::ObJitValueType::DOUBLE;
+  } else {
+    supported = false;
+  }
+  return supported;
+}
+
+bool ObJitFilterTranslator::get_op(const ObExpr &expr, jit::ObJitFilterOp &op)
+{
+  bool supported = false;
+  ObExpr **args = expr.args_;
+  switch (expr.type_) {
+    case T_OP_ADD:
+    case T_OP_MINUS:
+    case T_OP_MUL: {
+      // match the eval functions to make sure of the overflow checks
+      op = T_OP_ADD == expr.type_ ? jit::ObJitFilterOp::ADD
+          : (T_OP_MINUS == expr.type_ ? jit::ObJitFilterOp::SUB : jit::ObJitFilterOp::MUL);
+      ObExpr::EvalVectorFunc int_func = T_OP_ADD == expr.type_ ? ObExprAdd::add_int_int_vector
+          : (T_OP_MINUS == expr.type_ ? ObExprMinus::minus_int_int_vector
+                                      : ObExprMul::mul_int_int_vector);
+      ObExpr::EvalVectorFunc double_func = T_OP_ADD == expr.type_ ? ObExprAdd::add_double_double_vector
+          : (T_OP_MINUS == expr.type_ ? ObExprMinus::minus_double_double_vector
+                                      : ObExprMul::mul_double_vector);
+      supported = 2 == expr.arg_cnt_
+          && ((ObIntType == expr.datum_meta_.type_ && int_func == expr.eval_vector_func_
+               && is_int(args[0]) && is_int(args[1]))
+              || (ObDoubleType == expr.datum_meta_.type_ && double_func == expr.eval_vector_func_
+                  && is_double(args[0]) && is_double(args[1])));
+      break;
+    }
+    case T_OP_EQ:
+    case T_OP_NE:
+    case T_OP_LT:
+    case T_OP_LE:
+    case T_OP_GT:
+    case T_OP_GE: {
+      op = T_OP_EQ == expr.type_ ? jit::ObJitFilterOp::EQ
+          : T_OP_NE == expr.type_ ? jit::ObJitFilterOp::NE
+          : T_OP_LT == expr.type_ ? jit::ObJitFilterOp::LT
+          : T_OP_LE == expr.type_ ? jit::ObJitFilterOp::LE
+          : T_OP_GT == expr.type_ ? jit::ObJitFilterOp::GT
+          : jit::ObJitFilterOp::GE;
+      // inner functions are set for auto partition exprs which compare with min and max
+      supported = 2 == expr.arg_cnt_ && 0 == expr.inner_func_cnt_ && is_int(&expr)
+          && ((is_int(args[0]) && is_int(args[1])) || (is_double(args[0]) && is_double(args[1])));
+      break;
+    }
+    case T_OP_AND:
+    case T_OP_OR: {
+      op = T_OP_AND == expr.type_ ? jit::ObJitFilterOp::AND : jit::ObJitFilterOp::OR;
+      supported = expr.arg_cnt_ >= 2 && is_int(&expr);
+      for (int64_t i = 0; supported && i < expr.arg_cnt_; ++i) {
+        supported = is_int(args[i]);
+      }
+      break;
+    }
+    case T_OP_NOT: {
+      op = jit::ObJitFilterOp::NOT;
+      supported = 1 == expr.arg_cnt_ && is_int(&expr) && is_int(args[0]);
+      break;
+    }
+    case T_OP_CASE: {
+      // [when, then]*, [else]
+      op = jit::ObJitFilterOp::CASE;
+      supported = expr.arg_cnt_ >= 2 && (is_int(&expr) || is_double(&expr));
+      for (int64_t i = 0; supported && i < expr.arg_cnt_; ++i) {
+        if (i % 2 == 0 && i + 1 < expr.arg_cnt_) {
+          supported = is_int(args[i]);
+        } else {
+          supported = is_int(&expr) ? is_int(args[i]) : is_double(args[i]);
+        }
+      }
+      break;
+    }
+    case T_FUN_SYS_CAST: {
+      op = jit::ObJitFilterOp::INT_TO_DOUBLE;
+      supported = expr.arg_cnt_ >= 1 && is_double(&expr) && is_int(args[0]);
+      break;
+    }
+    default:
+      break;
+  }
+  return supported;
+}
+
+} // namespace
+
+int ObExprJitFilter::build(ObIAllocator &alloc,
+                           jit::ObJitFilterModule &module,
+                           const ObIArray<ObExpr *> &filters,
+                           const ObIArray<ObExpr *> &evaluated_exprs,
+                           ObExprJitFilter *&jit_filter)
+{
+  int ret = OB_SUCCESS;
+  ObJitFilterTranslator translator(evaluated_exprs);
+  bool supported = true;
+  jit_filter = nullptr;
+  if (lib::is_oracle_mode()) {
+    // numbers of oracle mode are not supported
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && supported && i < filters.count(); ++i) {
+      if (OB_FAIL(translator.add_filter(filters.at(i), supported))) {
+        LOG_WARN("failed to add filter", K(ret), K(i));
+      }
+    }
+  }
+  if (OB_FAIL(ret) || translator.roots_.empty()) {
+  } else if (OB_ISNULL(jit_filter = OB_NEWx(ObExprJitFilter, &alloc, alloc))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc jit filter", K(ret));
+  } else if (OB_FAIL(jit_filter->leaves_.assign(translator.leaves_))) {
+    LOG_WARN("failed to assign leaves", K(ret));
+  } else {
+    ObDatum datum;
+    datum.set_null();
+    jit::ObJitDatumLayout datum_layout;
+    datum_layout.size_ = sizeof(ObDatum);
+    datum_layout.ptr_offset_ = reinterpret_cast<const char *>(&datum.ptr())
+        - reinterpret_cast<const char *>(&datum);
+    // pack_ is the whole ObDatumDesc
+    datum_layout.desc_offset_ = reinterpret_cast<const char *>(&datum.desc())
+        - reinterpret_cast<const char *>(&datum);
+    datum_layout.null_mask_ = datum.pack_;
+    jit_filter->filter_cnt_ = translator.roots_.count();
+    if (OB_FAIL(module.add_kernel(translator.nodes_, translator.args_, translator.roots_,
+                                  translator.leaves_.count(), datum_layout, jit_filter->kernel_))) {
+      // the filters are evaluated as before
+      LOG_WARN("failed to generate filter kernel, ignore", K(ret), KPC(jit_filter));
+      ret = OB_SUCCESS;
+      jit_filter->~ObExprJitFilter();
+      alloc.free(jit_filter);
+      jit_filter = nullptr;
+    } else {
+      LOG_TRACE("filter kernel generated", KPC(jit_filter), K(filters.count()),
+                "node_cnt", translator.nodes_.count());
+    }
+  }
+  if (OB_FAIL(ret) && nullptr != jit_filter) {
+    jit_filter->~ObExprJitFilter();
+    alloc.free(jit_filter);
+    jit_filter = nullptr;
+  }
+  return ret;
+}
+
+int ObExprJitFilter::filter(ObEvalCtx &eval_ctx,
+                            ObBitVector &skip,
+                            const int64_t bsize,
+                            bool &all_active,
+                            int64_t &output_rows,
+                            bool &done) const
+{
+  int ret = OB_SUCCESS;
+  jit::ObJitLeafVector leaf_vecs[MAX_LEAF_CNT];
+  // the module of the plan may have failed to compile
+  done = kernel_.is_compiled();
+  output_rows = 0;
+  for (int64_t i = 0; OB_SUCC(ret) && done && i < leaves_.count(); ++i) {
+    ObExpr *leaf = leaves_.at(i);
+    ObIVector *vec = nullptr;
+    jit::ObJitLeafVector &leaf_vec = leaf_vecs[i];
+    if (OB_FAIL(leaf->eval_vector(eval_ctx, skip, bsize, all_active))) {
+      LOG_WARN("failed to eval leaf", K(ret), K(i));
+    } else if (OB_ISNULL(vec = leaf->get_vector(eval_ctx))) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("vector is null", K(ret), K(i));
+    } else {
+      switch (vec->get_format()) {
+        case VEC_FIXED: {
+          ObFixedLengthBase *fixed_vec = static_cast<ObFixedLengthBase *>(vec);
+          leaf_vec.data_ = fixed_vec->get_data();
+          leaf_vec.nulls_ = nullptr == fixed_vec->get_nulls()
+              ? nullptr : reinterpret_cast<const uint64_t *>(fixed_vec->get_nulls()->data_);
+          break;
+        }
+        case VEC_UNIFORM: {
+          leaf_vec.datums_ = reinterpret_cast<const char *>(
+              static_cast<ObUniformBase *>(vec)->get_datums());
+          break;
+        }
+        case VEC_UNIFORM_CONST: {
+          leaf_vec.datums_ = reinterpret_cast<const char *>(
+              static_cast<ObUniformBase *>(vec)->get_datums());
+          leaf_vec.idx_mask_ = 0;
+          break;
+        }
+        default:
+          done = false;
+      }
+    }
+  }
+  if (OB_SUCC(ret) && done) {
+    output_rows = kernel_.run(leaf_vecs, reinterpret_cast<uint64_t *>(skip.data_), bsize);
+    if (jit::ObJitFilterKernel::BAIL_OUT == output_rows) {
+      done = false;
+      all_active = false;
+      output_rows = 0;
+    } else {
+      all_active &= (output_rows == bsize);
+    }
+  }
+  return ret;
+}
+
+} // end namespace sql
+} // end namespace oceanbase
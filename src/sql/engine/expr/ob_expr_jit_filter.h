@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OCEANBASE_SQL_ENGINE_EXPR_OB_EXPR_JIT_FILTER_H_
+#define OCEANBASE_SQL_ENGINE_EXPR_OB_EXPR_JIT_FILTER_H_
+
+#include "sql/engine/expr/ob_expr.h"
+#include "objit/ob_jit_filter_kernel.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+
+/**
+ * @class ObExprJitFilter
+ * @brief Filters of an operator or a storage black filter compiled into one kernel.
+ *
+ * @desc:
+ * - Int and double arithmetic, comparisons, logic operators, CASE and int to double casts over
+ *   columns, constants and the exprs already evaluated before the filters are supported.
+ * - Only the longest prefix of the filters built from supported exprs is compiled, the filters
+ *   after it are evaluated by the caller after the kernel, so filters are still applied in order.
+ * - The kernels of a plan are compiled together in one jit::ObJitFilterModule owned by the plan
+ *   and cached with it in the plan cache. Specs deserialized from remote do not carry the kernel
+ *   and evaluate the filters as before.
+ */
+class ObExprJitFilter
+{
+public:
+  static const int64_t MAX_LEAF_CNT = 64;
+  static const int64_t MAX_NODE_CNT = 256;
+
+  explicit ObExprJitFilter(common::ObIAllocator &alloc)
+    : kernel_(), leaves_(&alloc), filter_cnt_(0) {}
+  ~ObExprJitFilter() {}
+
+  // %evaluated_exprs are read by the kernel as they are, e.g. the output exprs of the children.
+  // %jit_filter is nullptr if the first filter is not supported. The kernel is added to %module
+  // and can be used once the module is compiled.
+  static int build(common::ObIAllocator &alloc,
+                   jit::ObJitFilterModule &module,
+                   const common::ObIArray<ObExpr *> &filters,
+                   const common::ObIArray<ObExpr *> &evaluated_exprs,
+                   ObExprJitFilter *&jit_filter);
+  // Applies the first get_filter_cnt() filters to the batch. %done is false if a leaf is not in
+  // a format the kernel reads, the kernel is not compiled or it bails out, the caller should
+  // evaluate all the filters then, rows already set in %skip by the kernel are rejected by the
+  // filters anyway.
+  int filter(ObEvalCtx &eval_ctx,
+             ObBitVector &skip,
+             const int64_t bsize,
+             bool &all_active,
+             int64_t &output_rows,
+             bool &done) const;
+  int64_t get_filter_cnt() const { return filter_cnt_; }
+
+  TO_STRING_KV(K_(filter_cnt), "leaf_cnt", leaves_.count(), K_(kernel));
+
+private:
+  jit::ObJitFilterKernel kernel_;
+  ExprFixedArray leaves_;
+  int64_t filter_cnt_;
+  DISALLOW_COPY_AND_ASSIGN(ObExprJitFilter);
+};
+
+} // end namespace sql
+} // end namespace oceanbase
+
+#endif // OCEANBASE_SQL_ENGINE_EXPR_OB_EXPR_JIT_FILTER_H_
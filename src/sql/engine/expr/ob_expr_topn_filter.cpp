@@ -488,5 +488,22 @@ int ObExprTopNFilter::update_storage_white_filter_data(const ObExpr &expr,
   return ret;
 }
 
+int ObExprTopNFilter::get_first_sort_key_bound(const ObExpr &expr, ObEvalCtx &eval_ctx,
+                                               ObDatum &bound, ObObjMeta &bound_meta,
+                                               bool &is_ascending, bool &has_bound)
+{
+  int ret = OB_SUCCESS;
+  has_bound = false;
+  ObExprTopNFilterContext *topn_filter_ctx = static_cast<ObExprTopNFilterContext *>(
+      eval_ctx.exec_ctx_.get_expr_op_ctx(expr.expr_ctx_id_));
+  if (OB_ISNULL(topn_filter_ctx) || OB_ISNULL(topn_filter_ctx->topn_filter_msg_)) {
+    // topn filter ctx may be null in das, and the msg is got when the filter is checked ready
+  } else if (OB_FAIL(topn_filter_ctx->topn_filter_msg_->get_first_sort_key_bound(
+                 bound, bound_meta, is_ascending, has_bound))) {
+    LOG_WARN("failed to get first sort key bound", K(ret));
+  }
+  return ret;
+}
+
 } // end namespace sql
 } // end namespace oceanbase
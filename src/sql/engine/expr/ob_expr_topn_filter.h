@@ -189,6 +189,10 @@ public:
                                               ObDynamicFilterExecutor &dynamic_filter,
                                               ObEvalCtx &eval_ctx, ObRuntimeFilterParams &params,
                                               bool &is_update);
+
+  // for storage to skip blocks of rows sorting after the heap top of the first sort key
+  static int get_first_sort_key_bound(const ObExpr &expr, ObEvalCtx &eval_ctx, ObDatum &bound,
+                                      ObObjMeta &bound_meta, bool &is_ascending, bool &has_bound);
 private:
   DISALLOW_COPY_AND_ASSIGN(ObExprTopNFilter);
 };
@@ -20,6 +20,7 @@
 #include "ob_operator_factory.h"
 #include "observer/ob_server.h"
 #include "sql/engine/expr/ob_array_expr_utils.h"
+#include "sql/engine/expr/ob_expr_jit_filter.h"
 
 namespace oceanbase
 {
@@ -203,7 +204,8 @@ ObOpSpec::ObOpSpec(ObIAllocator &alloc, const ObPhyOperatorType type)
     max_batch_size_(0),
     need_check_output_datum_(false),
     use_rich_format_(false),
-    compress_type_(NONE_COMPRESSOR)
+    compress_type_(NONE_COMPRESSOR),
+    jit_filter_(NULL)
 {
 }
 
@@ -1718,15 +1720,27 @@ int ObOperator::filter_vector_rows(const ObExprPtrIArray &exprs,
   int ret = OB_SUCCESS;
   all_filtered = false;
   bool tmp_all_active = true;
-  FOREACH_CNT_X(e, exprs, OB_SUCC(ret) && !all_filtered) {
+  int64_t start_idx = 0;
+  if (NULL != spec_.jit_filter_ && &exprs == &spec_.filters_) {
     int64_t output_rows = 0;
-    OB_ASSERT(ob_is_int_tc((*e)->datum_meta_.type_));
+    bool done = false;
+    if (OB_FAIL(spec_.jit_filter_->filter(eval_ctx_, skip, bsize, all_active, output_rows, done))) {
+      LOG_WARN("jit filter failed", K(ret), K_(eval_ctx));
+    } else if (done) {
+      start_idx = spec_.jit_filter_->get_filter_cnt();
+      all_filtered = (0 == output_rows);
+    }
+  }
+  for (int64_t i = start_idx; OB_SUCC(ret) && !all_filtered && i < exprs.count(); ++i) {
+    ObExpr *e = exprs.at(i);
+    int64_t output_rows = 0;
+    OB_ASSERT(ob_is_int_tc(e->datum_meta_.type_));
     ObIVector *vec = NULL;
-    if (OB_FAIL((*e)->eval_vector(eval_ctx_, skip, bsize, all_active))) {
+    if (OB_FAIL(e->eval_vector(eval_ctx_, skip, bsize, all_active))) {
       LOG_WARN("evaluate batch failed", K(ret), K_(eval_ctx));
-    } else if (FALSE_IT(vec = (*e)->get_vector(eval_ctx_))) {
+    } else if (FALSE_IT(vec = e->get_vector(eval_ctx_))) {
       // do nothing
-    } else if (!(*e)->is_batch_result()) {
+    } else if (!e->is_batch_result()) {
       ObUniformBase *const_vec = static_cast<ObUniformBase*>(vec);
       ObDatum &d = const_vec->get_datums()[0];
       if (d.null_ || 0 == *d.int_) {
@@ -46,6 +46,7 @@ class ObOperator;
 class ObOpInput;
 class ObTaskInfo;
 class ObExecFeedbackNode;
+class ObExprJitFilter;
 
 struct ObPhyOpSeriCtx
 {
@@ -350,6 +351,8 @@ public:
   bool need_check_output_datum_;
   bool use_rich_format_;
   ObCompressorType compress_type_;
+  // %filters_ compiled by ObExprJitFilter, owned by the plan and not serialized
+  const ObExprJitFilter *jit_filter_;
 
 private:
   DISALLOW_COPY_AND_ASSIGN(ObOpSpec);
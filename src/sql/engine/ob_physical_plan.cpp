@@ -20,6 +20,7 @@
 #include "share/ob_truncated_string.h"
 #include "sql/code_generator/ob_static_engine_cg.h"
 #include "sql/monitor/ob_sql_plan.h"
+#include "sql/engine/expr/ob_expr_jit_filter.h"
 
 namespace oceanbase
 {
@@ -135,7 +136,9 @@ ObPhysicalPlan::ObPhysicalPlan(MemoryContext &mem_context /* = CURRENT_CONTEXT *
     px_node_policy_(ObPxNodePolicy::INVALID),
     px_node_addrs_(&allocator_),
     px_node_count_(ObPxNodeHint::UNSET_PX_NODE_COUNT),
-    px_worker_share_plan_enabled_(false)
+    px_worker_share_plan_enabled_(false),
+    jit_filters_(&allocator_),
+    jit_filter_module_(NULL)
 {
 }
 
@@ -146,6 +149,7 @@ ObPhysicalPlan::~ObPhysicalPlan()
 
 void ObPhysicalPlan::reset()
 {
+  destroy_jit_filters();
   ObPlanCacheObject::reset();
   phy_hint_.reset();
   root_op_spec_ = NULL;
@@ -246,6 +250,7 @@ void ObPhysicalPlan::reset()
 }
 void ObPhysicalPlan::destroy()
 {
+  destroy_jit_filters();
 #ifndef NDEBUG
   bit_set_.reset();
 #endif
@@ -1526,6 +1531,36 @@ bool ObPhysicalPlan::try_record_plan_info()
   return b_ret;
 }
 
+void ObPhysicalPlan::destroy_jit_filters()
+{
+  for (int64_t i = 0; i < jit_filters_.count(); ++i) {
+    if (OB_NOT_NULL(jit_filters_.at(i))) {
+      jit_filters_.at(i)->~ObExprJitFilter();
+      jit_filters_.at(i) = NULL;
+    }
+  }
+  jit_filters_.reset();
+  if (OB_NOT_NULL(jit_filter_module_)) {
+    jit_filter_module_->~ObJitFilterModule();
+    jit_filter_module_ = NULL;
+  }
+}
+
+int ObPhysicalPlan::set_jit_filters(const common::ObIArray<ObExprJitFilter *> &jit_filters,
+                                    jit::ObJitFilterModule *jit_filter_module)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(jit_filter_module) || OB_NOT_NULL(jit_filter_module_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected jit filter module", K(ret), KP(jit_filter_module), KP_(jit_filter_module));
+  } else if (OB_FAIL(jit_filters_.assign(jit_filters))) {
+    LOG_WARN("failed to assign jit filters", K(ret));
+  } else {
+    jit_filter_module_ = jit_filter_module;
+  }
+  return ret;
+}
+
 int ObPhysicalPlan::set_px_node_addrs(
           const common::ObIArray<common::ObAddr> &px_node_addrs)
 {
@@ -45,12 +45,17 @@ namespace schema
   class ObSchemaGetterGuard;
 }
 }
+namespace jit
+{
+class ObJitFilterModule;
+}
 namespace sql
 {
 class ObTablePartitionInfo;
 class ObPhyOperatorMonnitorInfo;
 struct ObAuditRecordData;
 class ObOpSpec;
+class ObExprJitFilter;
 class ObEvolutionPlan;
 class ObSqlSchemaGuard;
 
@@ -448,6 +453,7 @@ public:
   inline const ObExprFrameInfo &get_expr_frame_info() const { return expr_frame_info_; }
 
   const ObOpSpec *get_root_op_spec() const { return root_op_spec_; }
+  ObOpSpec *get_root_op_spec() { return root_op_spec_; }
   void set_root_op_spec(ObOpSpec *spec) { root_op_spec_ = spec; is_new_engine_ = true; }
   inline bool need_consistent_snapshot() const { return need_consistent_snapshot_; }
   inline void set_need_consistent_snapshot(bool need_snapshot)
@@ -517,6 +523,9 @@ public:
   }
   bool px_worker_share_plan_enabled() const { return px_worker_share_plan_enabled_; }
   void set_px_worker_share_plan_enabled(bool v) { px_worker_share_plan_enabled_ = v; }
+  // takes over %jit_filters and %jit_filter_module that holds their code
+  int set_jit_filters(const common::ObIArray<ObExprJitFilter *> &jit_filters,
+                      jit::ObJitFilterModule *jit_filter_module);
 
   bool is_active_status() const { return ObPlanStat::ACTIVE == ATOMIC_LOAD(&stat_.adaptive_pc_info_.status_); }
   void set_active_status() { ATOMIC_STORE(&(stat_.adaptive_pc_info_.status_), ObPlanStat::ACTIVE);; }
@@ -533,6 +542,7 @@ private:
   static const int64_t COMMON_PARAM_NUM = 12;
   static const int64_t SAMPLE_TIMES = 10;
 private:
+  void destroy_jit_filters();
   DISALLOW_COPY_AND_ASSIGN(ObPhysicalPlan);
 private:
   ObPhyPlanHint phy_hint_; //hints for this plan
@@ -718,6 +728,10 @@ private:
   common::ObFixedArray<common::ObAddr, common::ObIAllocator> px_node_addrs_;
   int64_t px_node_count_;
   int64_t px_worker_share_plan_enabled_;
+  // filter kernels referenced by the specs, compiled with the plan in one module and destroyed
+  // with it
+  common::ObFixedArray<ObExprJitFilter *, common::ObIAllocator> jit_filters_;
+  jit::ObJitFilterModule *jit_filter_module_;
 };
 
 inline void ObPhysicalPlan::set_affected_last_insert_id(bool affected_last_insert_id)
@@ -467,6 +467,24 @@ int ObPushDownTopNFilterMsg::update_storage_white_filter_data(
   return ret;
 }
 
+int ObPushDownTopNFilterMsg::get_first_sort_key_bound(ObDatum &bound, ObObjMeta &bound_meta,
+                                                      bool &is_ascending, bool &has_bound) const
+{
+  int ret = OB_SUCCESS;
+  has_bound = false;
+  if (is_empty_ || heap_top_datums_.empty() || compares_.empty()) {
+  } else if (heap_top_datums_.at(0).is_null()) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("expect no null in topn runtime filter");
+  } else {
+    bound = heap_top_datums_.at(0);
+    bound_meta = compares_.at(0).build_meta_.obj_meta_;
+    is_ascending = compares_.at(0).is_ascending_;
+    has_bound = true;
+  }
+  return ret;
+}
+
 // private interface
 int ObPushDownTopNFilterMsg::merge_heap_top_datums(ObIArray<ObDatum> &incomming_datums)
 {
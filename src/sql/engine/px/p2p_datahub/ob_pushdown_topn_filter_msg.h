@@ -149,6 +149,11 @@ public:
   int update_storage_white_filter_data(ObDynamicFilterExecutor &dynamic_filter,
                                        ObRuntimeFilterParams &params, bool &is_update);
 
+  // heap top of the first sort key, rows with a greater (less if descending) first sort key are
+  // filtered out, has_bound is false before the heap top is collected
+  int get_first_sort_key_bound(ObDatum &bound, ObObjMeta &bound_meta, bool &is_ascending,
+                               bool &has_bound) const;
+
   inline int64_t get_current_data_version() { return ATOMIC_LOAD_ACQ(&data_version_); }
   inline bool is_null_first(int64_t col_idx) { 
     return (ObCmpNullPos::NULL_FIRST == compares_.at(col_idx).null_pos_);
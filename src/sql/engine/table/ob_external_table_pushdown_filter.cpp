@@ -0,0 +1,335 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define USING_LOG_PREFIX SQL_ENG
+#include "ob_external_table_pushdown_filter.h"
+#include "common/ob_smart_call.h"
+#include "storage/access/ob_dml_param.h"
+#include "storage/blocksstable/ob_storage_datum.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace sql
+{
+
+ObExternalTablePushdownFilter::ObExternalTablePushdownFilter()
+  : scan_param_(nullptr),
+    filter_(nullptr),
+    column_exprs_(nullptr),
+    file_col_idxs_(),
+    need_prepare_(true),
+    is_valid_(false)
+{
+}
+
+int ObExternalTablePushdownFilter::init(
+    const storage::ObTableScanParam *scan_param,
+    const ObIArray<ObExpr *> &column_exprs,
+    const ObIArray<ObExpr *> &file_column_exprs)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(scan_param) || OB_ISNULL(scan_param->ext_column_convert_exprs_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(scan_param));
+  } else if (OB_UNLIKELY(column_exprs.count() != scan_param->ext_column_convert_exprs_->count())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("column expr not equal to convert expr", K(ret), K(column_exprs.count()),
+             K(scan_param->ext_column_convert_exprs_->count()));
+  } else {
+    scan_param_ = scan_param;
+    column_exprs_ = &column_exprs;
+    file_col_idxs_.reuse();
+    for (int64_t i = 0; OB_SUCC(ret) && i < column_exprs.count(); ++i) {
+      const ObExpr *column_expr = column_exprs.at(i);
+      const ObExpr *convert_expr = scan_param->ext_column_convert_exprs_->at(i);
+      int64_t file_col_idx = -1;
+      if (OB_ISNULL(column_expr) || OB_ISNULL(convert_expr)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("unexpected null expr", K(ret), K(i), KP(column_expr), KP(convert_expr));
+      } else if (T_FUN_COLUMN_CONV == convert_expr->type_
+                 && 6 == convert_expr->arg_cnt_
+                 && OB_NOT_NULL(convert_expr->args_[4])
+                 && T_PSEUDO_EXTERNAL_FILE_COL == convert_expr->args_[4]->type_) {
+        // statistics are comparable with the filter params only if the file column is read as the
+        // type of the table column
+        const ObExpr *file_column_expr = convert_expr->args_[4];
+        if (file_column_expr->datum_meta_.type_ == column_expr->datum_meta_.type_
+            && file_column_expr->datum_meta_.cs_type_ == column_expr->datum_meta_.cs_type_) {
+          for (int64_t j = 0; file_col_idx < 0 && j < file_column_exprs.count(); ++j) {
+            if (file_column_exprs.at(j) == file_column_expr) {
+              file_col_idx = j;
+            }
+          }
+        }
+      }
+      if (OB_SUCC(ret) && OB_FAIL(file_col_idxs_.push_back(file_col_idx))) {
+        LOG_WARN("failed to push back file col idx", K(ret));
+      }
+    }
+    need_prepare_ = true;
+  }
+  return ret;
+}
+
+int ObExternalTablePushdownFilter::prepare()
+{
+  int ret = OB_SUCCESS;
+  filter_ = scan_param_->pd_storage_filters_;
+  is_valid_ = false;
+  if (nullptr == filter_) {
+    // no filter pushed down
+  } else if (OB_FAIL(filter_->init_evaluated_datums(is_valid_))) {
+    LOG_WARN("failed to init pushdown filter evaluated datums", K(ret));
+  }
+  if (OB_SUCC(ret)) {
+    need_prepare_ = false;
+  }
+  return ret;
+}
+
+int ObExternalTablePushdownFilter::can_skip(
+    const int64_t row_count,
+    ObExternalStatProvider &provider,
+    bool &skip)
+{
+  int ret = OB_SUCCESS;
+  skip = false;
+  if (OB_ISNULL(scan_param_)) {
+    // not inited, nothing to skip
+  } else if (need_prepare_ && OB_FAIL(prepare())) {
+    LOG_WARN("failed to prepare pushdown filter", K(ret));
+  } else if (!has_filter() || row_count <= 0) {
+  } else {
+    ObBoolMask bool_mask;
+    if (OB_FAIL(check_filter(*filter_, row_count, provider, bool_mask))) {
+      LOG_WARN("failed to check filter", K(ret));
+    } else {
+      skip = bool_mask.is_always_false();
+    }
+  }
+  return ret;
+}
+
+int ObExternalTablePushdownFilter::get_file_col_idx(const ObExpr *column_expr, int64_t &file_col_idx) const
+{
+  int ret = OB_SUCCESS;
+  file_col_idx = -1;
+  if (OB_ISNULL(column_exprs_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else {
+    for (int64_t i = 0; file_col_idx < 0 && i < column_exprs_->count(); ++i) {
+      if (column_exprs_->at(i) == column_expr) {
+        file_col_idx = file_col_idxs_.at(i);
+      }
+    }
+  }
+  return ret;
+}
+
+int ObExternalTablePushdownFilter::check_filter(
+    ObPushdownFilterExecutor &filter,
+    const int64_t row_count,
+    ObExternalStatProvider &provider,
+    ObBoolMask &bool_mask)
+{
+  int ret = OB_SUCCESS;
+  bool_mask.set_uncertain();
+  if (filter.is_logic_and_node() || filter.is_logic_or_node()) {
+    const bool is_and = filter.is_logic_and_node();
+    ObPushdownFilterExecutor **children = filter.get_childs();
+    if (is_and) {
+      bool_mask.set_always_true();
+    } else {
+      bool_mask.set_always_false();
+    }
+    for (uint32_t i = 0; OB_SUCC(ret) && i < filter.get_child_count(); ++i) {
+      ObBoolMask child_mask;
+      if (OB_ISNULL(children[i])) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("unexpected null child filter", K(ret), K(i));
+      } else if (OB_FAIL(SMART_CALL(check_filter(*children[i], row_count, provider, child_mask)))) {
+        LOG_WARN("failed to check child filter", K(ret), K(i));
+      } else if (is_and) {
+        bool_mask = bool_mask & child_mask;
+        if (bool_mask.is_always_false()) {
+          break;
+        }
+      } else {
+        bool_mask = bool_mask | child_mask;
+        if (bool_mask.is_always_true()) {
+          break;
+        }
+      }
+    }
+  } else if (WHITE_FILTER_EXECUTOR == filter.get_type()) {
+    // black filters, runtime filters and semistruct filters are uncertain
+    if (OB_FAIL(check_white_filter(static_cast<ObWhiteFilterExecutor &>(filter), row_count,
+                                   provider, bool_mask))) {
+      LOG_WARN("failed to check white filter", K(ret));
+    }
+  }
+  return ret;
+}
+
+int ObExternalTablePushdownFilter::check_white_filter(
+    ObWhiteFilterExecutor &filter,
+    const int64_t row_count,
+    ObExternalStatProvider &provider,
+    ObBoolMask &bool_mask)
+{
+  int ret = OB_SUCCESS;
+  const ObIArray<ObExpr *> &col_exprs = filter.get_filter_node().column_exprs_;
+  int64_t file_col_idx = -1;
+  ObExternalColumnStat stat;
+  bool_mask.set_uncertain();
+  if (1 != col_exprs.count()) {
+  } else if (OB_FAIL(get_file_col_idx(col_exprs.at(0), file_col_idx))) {
+    LOG_WARN("failed to get file col idx", K(ret));
+  } else if (file_col_idx < 0) {
+  } else if (filter.is_cmp_op_with_null_ref_value()) {
+    bool_mask.set_always_false();
+  } else if (OB_FAIL(provider.get_column_stat(file_col_idx, stat))) {
+    LOG_WARN("failed to get column stat", K(ret), K(file_col_idx));
+  } else {
+    const bool is_all_null = stat.null_count_ == row_count;
+    const bool is_all_not_null = 0 == stat.null_count_;
+    switch (filter.get_op_type()) {
+      case WHITE_OP_NU: {
+        if (is_all_not_null) {
+          bool_mask.set_always_false();
+        } else if (is_all_null) {
+          bool_mask.set_always_true();
+        }
+        break;
+      }
+      case WHITE_OP_NN: {
+        if (is_all_null) {
+          bool_mask.set_always_false();
+        } else if (is_all_not_null) {
+          bool_mask.set_always_true();
+        }
+        break;
+      }
+      default: {
+        // storage datums keep the fixed length values in their own buffers
+        blocksstable::ObStorageDatum min_datum;
+        blocksstable::ObStorageDatum max_datum;
+        if (is_all_null) {
+          bool_mask.set_always_false();
+        } else if (!stat.has_min_max_ || filter.null_param_contained()) {
+        } else if (OB_FAIL(min_datum.from_obj_enhance(stat.min_))) {
+          LOG_WARN("failed to convert min obj", K(ret), K(stat));
+        } else if (OB_FAIL(max_datum.from_obj_enhance(stat.max_))) {
+          LOG_WARN("failed to convert max obj", K(ret), K(stat));
+        } else if (OB_FAIL(check_min_max(filter, min_datum, max_datum, bool_mask))) {
+          LOG_WARN("failed to check min max", K(ret), K(stat));
+        }
+        break;
+      }
+    }
+  }
+  LOG_DEBUG("check white filter on external file stat", K(ret), K(file_col_idx), K(stat),
+            K(row_count), K(bool_mask));
+  return ret;
+}
+
+// Only proves the filter always false, a filter that holds on min and max may still be false on
+// the rows between them.
+int ObExternalTablePushdownFilter::check_min_max(
+    const ObWhiteFilterExecutor &filter,
+    const ObDatum &min_datum,
+    const ObDatum &max_datum,
+    ObBoolMask &bool_mask)
+{
+  int ret = OB_SUCCESS;
+  const ObIArray<ObDatum> &datums = filter.get_datums();
+  ObDatumCmpFuncType cmp_func = filter.cmp_func_;
+  int min_cmp = 0;
+  int max_cmp = 0;
+  bool_mask.set_uncertain();
+  if (OB_ISNULL(cmp_func) || datums.empty()) {
+  } else if (WHITE_OP_IN == filter.get_op_type()) {
+    bool may_hit = false;
+    for (int64_t i = 0; OB_SUCC(ret) && !may_hit && i < datums.count(); ++i) {
+      if (datums.at(i).is_null()) {
+      } else if (OB_FAIL(cmp_func(min_datum, datums.at(i), min_cmp))) {
+        LOG_WARN("failed to compare datum", K(ret), K(min_datum), K(datums.at(i)));
+      } else if (OB_FAIL(cmp_func(max_datum, datums.at(i), max_cmp))) {
+        LOG_WARN("failed to compare datum", K(ret), K(max_datum), K(datums.at(i)));
+      } else {
+        may_hit = min_cmp <= 0 && max_cmp >= 0;
+      }
+    }
+    if (OB_SUCC(ret) && !may_hit) {
+      bool_mask.set_always_false();
+    }
+  } else if (OB_FAIL(cmp_func(min_datum, datums.at(0), min_cmp))) {
+    LOG_WARN("failed to compare datum", K(ret), K(min_datum), K(datums.at(0)));
+  } else if (OB_FAIL(cmp_func(max_datum, datums.at(0), max_cmp))) {
+    LOG_WARN("failed to compare datum", K(ret), K(max_datum), K(datums.at(0)));
+  } else {
+    bool is_false = false;
+    switch (filter.get_op_type()) {
+      case WHITE_OP_EQ: {
+        is_false = min_cmp > 0 || max_cmp < 0;
+        break;
+      }
+      case WHITE_OP_NE: {
+        is_false = 0 == min_cmp && 0 == max_cmp;
+        break;
+      }
+      case WHITE_OP_GT: {
+        is_false = max_cmp <= 0;
+        break;
+      }
+      case WHITE_OP_GE: {
+        is_false = max_cmp < 0;
+        break;
+      }
+      case WHITE_OP_LT: {
+        is_false = min_cmp >= 0;
+        break;
+      }
+      case WHITE_OP_LE: {
+        is_false = min_cmp > 0;
+        break;
+      }
+      case WHITE_OP_BT: {
+        if (max_cmp < 0) {
+          is_false = true;
+        } else if (2 != datums.count()) {
+        } else if (OB_FAIL(cmp_func(min_datum, datums.at(1), min_cmp))) {
+          LOG_WARN("failed to compare datum", K(ret), K(min_datum), K(datums.at(1)));
+        } else {
+          is_false = min_cmp > 0;
+        }
+        break;
+      }
+      default: {
+        break;
+      }
+    }
+    if (OB_SUCC(ret) && is_false) {
+      bool_mask.set_always_false();
+    }
+  }
+  return ret;
+}
+
+} // namespace sql
+} // namespace oceanbase
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OB_EXTERNAL_TABLE_PUSHDOWN_FILTER_H_
+#define OB_EXTERNAL_TABLE_PUSHDOWN_FILTER_H_
+
+#include "lib/container/ob_se_array.h"
+#include "sql/engine/basic/ob_pushdown_filter.h"
+
+namespace oceanbase
+{
+namespace storage
+{
+class ObTableScanParam;
+}
+namespace sql
+{
+
+// Statistics of one file column in a row group or a stripe. min_ and max_ are in the type of the
+// file column expr, null_count_ is -1 if the file does not record it.
+struct ObExternalColumnStat final
+{
+public:
+  ObExternalColumnStat() : min_(), max_(), null_count_(-1), has_min_max_(false) {}
+  ~ObExternalColumnStat() = default;
+  void reset()
+  {
+    min_.reset();
+    max_.reset();
+    null_count_ = -1;
+    has_min_max_ = false;
+  }
+  TO_STRING_KV(K_(min), K_(max), K_(null_count), K_(has_min_max));
+public:
+  common::ObObj min_;
+  common::ObObj max_;
+  int64_t null_count_;
+  bool has_min_max_;
+};
+
+// Reads the column statistics of the row group or stripe being checked, implemented by the
+// Parquet and ORC row iterators.
+class ObExternalStatProvider
+{
+public:
+  // file_col_idx is the index of the column in the file column exprs of the iterator
+  virtual int get_column_stat(const int64_t file_col_idx, ObExternalColumnStat &stat) = 0;
+};
+
+// Checks the white filters of the pushdown filter tree of an external table scan against the
+// statistics of a row group or a stripe, so that the Parquet and ORC iterators skip the row
+// groups and stripes where the filters can not be true without reading them. The filters are
+// still evaluated by the table scan operator, the check here only has to be conservative.
+class ObExternalTablePushdownFilter final
+{
+public:
+  // _parquet_filter_pushdown_level and _orc_filter_pushdown_level from which the filters are
+  // checked against row group and stripe statistics
+  static const int64_t ROW_GROUP_FILTER_PD_LEVEL = 2;
+
+  ObExternalTablePushdownFilter();
+  ~ObExternalTablePushdownFilter() = default;
+  int init(const storage::ObTableScanParam *scan_param,
+           const common::ObIArray<ObExpr *> &column_exprs,
+           const common::ObIArray<ObExpr *> &file_column_exprs);
+  // filter params are evaluated again before the next check, called on rescan
+  void reuse() { need_prepare_ = true; }
+  bool has_filter() const { return nullptr != filter_ && is_valid_; }
+  // skip is true if no row of row_count rows with the statistics of provider passes the filters
+  int can_skip(const int64_t row_count, ObExternalStatProvider &provider, bool &skip);
+  TO_STRING_KV(KP_(filter), K_(file_col_idxs), K_(need_prepare), K_(is_valid));
+private:
+  int prepare();
+  int get_file_col_idx(const ObExpr *column_expr, int64_t &file_col_idx) const;
+  int check_filter(ObPushdownFilterExecutor &filter,
+                   const int64_t row_count,
+                   ObExternalStatProvider &provider,
+                   ObBoolMask &bool_mask);
+  int check_white_filter(ObWhiteFilterExecutor &filter,
+                         const int64_t row_count,
+                         ObExternalStatProvider &provider,
+                         ObBoolMask &bool_mask);
+  static int check_min_max(const ObWhiteFilterExecutor &filter,
+                           const common::ObDatum &min_datum,
+                           const common::ObDatum &max_datum,
+                           ObBoolMask &bool_mask);
+private:
+  const storage::ObTableScanParam *scan_param_;
+  ObPushdownFilterExecutor *filter_;
+  const common::ObIArray<ObExpr *> *column_exprs_;
+  // column_exprs_.at(i) is read from file column file_col_idxs_.at(i) without conversion, -1 if the
+  // column is converted or computed, whose filters can not use the file statistics
+  common::ObSEArray<int64_t, 16> file_col_idxs_;
+  bool need_prepare_;
+  bool is_valid_;
+  DISALLOW_COPY_AND_ASSIGN(ObExternalTablePushdownFilter);
+};
+
+} // namespace sql
+} // namespace oceanbase
+
+#endif // OB_EXTERNAL_TABLE_PUSHDOWN_FILTER_H_
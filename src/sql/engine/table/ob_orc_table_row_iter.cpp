@@ -159,6 +159,7 @@ int ObOrcTableRowIterator::init(const storage::ObTableScanParam *scan_param)
       OZ (file_url_ptrs_.allocate_array(allocator_, eval_ctx.max_batch_size_));
       OZ (file_url_lens_.allocate_array(allocator_, eval_ctx.max_batch_size_));
     }
+    OZ (pd_filter_.init(scan_param, column_exprs_, file_column_exprs_));
   }
   return ret;
 }
@@ -167,42 +168,132 @@ int ObOrcTableRowIterator::init(const storage::ObTableScanParam *scan_param)
 int ObOrcTableRowIterator::next_stripe()
 {
   int ret = OB_SUCCESS;
-  //init all meta
-  if (state_.cur_stripe_idx_ > state_.end_stripe_idx_) {
-    if (OB_FAIL(next_file())) {
-      if (OB_ITER_END != ret) {
-        LOG_WARN("fail to get next srtipe", K(ret));
+  int64_t cur_stripe = -1;
+  bool skip = true;
+  while (OB_SUCC(ret) && skip) {
+    //init all meta
+    if (state_.cur_stripe_idx_ > state_.end_stripe_idx_) {
+      if (OB_FAIL(next_file())) {
+        if (OB_ITER_END != ret) {
+          LOG_WARN("fail to get next srtipe", K(ret));
+        }
+      }
+    }
+    if (OB_SUCC(ret)) {
+      cur_stripe = (state_.cur_stripe_idx_++) - 1;
+      CK (cur_stripe < stripes_.count());
+      if (OB_SUCC(ret) && OB_FAIL(check_stripe_skippable(cur_stripe, skip))) {
+        LOG_WARN("failed to check stripe skippable", K(ret), K(cur_stripe));
       }
     }
   }
   if (OB_SUCC(ret)) {
-    int64_t cur_stripe = (state_.cur_stripe_idx_++) - 1;
-    CK (cur_stripe < stripes_.count());
-    if (OB_SUCC(ret)) {
-      LOG_TRACE("show current stripe info", K(stripes_.at(cur_stripe)));
-      try {
-        // for (int i = 0; OB_SUCC(ret) && i < column_readers_.count(); i++) {
-        //   if (column_readers_.at(i)) {
-        //     column_readers_.at(i)->seekToRow(stripes_.at(cur_stripe).first_row_id);
-        //   } else {
-        //     ret = OB_ERR_UNEXPECTED;
-        //     LOG_WARN("column reader is null", K(ret));
-        //   }
-        // }
-        if (row_reader_) {
-          row_reader_->seekToRow(stripes_.at(cur_stripe).first_row_id);
-        } else {
-          ret = OB_ERR_UNEXPECTED;
-          LOG_WARN("column reader is null", K(ret));
-        }
-        state_.cur_stripe_read_row_count_ = 0;
-        state_.cur_stripe_row_count_ = stripes_.at(cur_stripe).num_rows;
-      } catch(const std::exception& e) {
-        ret = OB_ERR_UNEXPECTED;
-        LOG_WARN("unexpected index", K(ret), "Info", e.what(), K(cur_stripe), K(column_indexs_));
-      } catch(...) {
+    LOG_TRACE("show current stripe info", K(stripes_.at(cur_stripe)));
+    try {
+      // for (int i = 0; OB_SUCC(ret) && i < column_readers_.count(); i++) {
+      //   if (column_readers_.at(i)) {
+      //     column_readers_.at(i)->seekToRow(stripes_.at(cur_stripe).first_row_id);
+      //   } else {
+      //     ret = OB_ERR_UNEXPECTED;
+      //     LOG_WARN("column reader is null", K(ret));
+      //   }
+      // }
+      if (row_reader_) {
+        row_reader_->seekToRow(stripes_.at(cur_stripe).first_row_id);
+      } else {
         ret = OB_ERR_UNEXPECTED;
-        LOG_WARN("unexpected index", K(ret), K(cur_stripe), K(column_indexs_));
+        LOG_WARN("column reader is null", K(ret));
+      }
+      state_.cur_stripe_read_row_count_ = 0;
+      state_.cur_stripe_row_count_ = stripes_.at(cur_stripe).num_rows;
+    } catch(const std::exception& e) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected index", K(ret), "Info", e.what(), K(cur_stripe), K(column_indexs_));
+    } catch(...) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected index", K(ret), K(cur_stripe), K(column_indexs_));
+    }
+  }
+  return ret;
+}
+
+int ObOrcTableRowIterator::check_stripe_skippable(const int64_t stripe_idx, bool &skip)
+{
+  int ret = OB_SUCCESS;
+  skip = false;
+  // statistics are only kept for file columns, and some writers do not write stripe statistics
+  if (file_column_exprs_.count() > 0 && reader_ && stripe_idx < reader_->getNumberOfStripeStatistics()) {
+    try {
+      std::unique_ptr<orc::StripeStatistics> stripe_stats = reader_->getStripeStatistics(stripe_idx);
+      const int64_t row_count = stripes_.at(stripe_idx).num_rows;
+      if (stripe_stats) {
+        StripeStatProvider provider(*stripe_stats, column_indexs_, file_column_exprs_, row_count, mem_attr_);
+        if (OB_FAIL(pd_filter_.can_skip(row_count, provider, skip))) {
+          LOG_WARN("failed to check stripe by pushdown filter", K(ret), K(stripe_idx));
+        } else if (skip) {
+          // keep the line numbers of the following rows as if the stripe was read
+          state_.cur_line_number_ += row_count;
+          LOG_TRACE("skip orc stripe by statistics", K(url_), K(stripe_idx), K(row_count));
+        }
+      }
+    } catch(const std::exception& e) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("failed to read stripe statistics", K(ret), "Info", e.what(), K(stripe_idx));
+    } catch(...) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("failed to read stripe statistics", K(ret), K(stripe_idx));
+    }
+  }
+  return ret;
+}
+
+int ObOrcTableRowIterator::StripeStatProvider::get_column_stat(
+    const int64_t file_col_idx, ObExternalColumnStat &stat)
+{
+  int ret = OB_SUCCESS;
+  const orc::ColumnStatistics *col_stats = nullptr;
+  stat.reset();
+  if (OB_UNLIKELY(file_col_idx < 0 || file_col_idx >= column_indexs_.count()
+                  || file_col_idx >= file_column_exprs_.count())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid file col idx", K(ret), K(file_col_idx), K(column_indexs_.count()));
+  } else if (column_indexs_.at(file_col_idx) >= stripe_stats_.getNumberOfColumns()
+             || OB_ISNULL(col_stats = stripe_stats_.getColumnStatistics(column_indexs_.at(file_col_idx)))) {
+    // no statistics of the column
+  } else {
+    const ObDatumMeta &datum_meta = file_column_exprs_.at(file_col_idx)->datum_meta_;
+    const orc::IntegerColumnStatistics *int_stats = nullptr;
+    const orc::StringColumnStatistics *str_stats = nullptr;
+    // number of values counts the not null values only
+    stat.null_count_ = row_count_ - static_cast<int64_t>(col_stats->getNumberOfValues());
+    if (OB_UNLIKELY(stat.null_count_ < 0 || stat.null_count_ > row_count_)) {
+      stat.null_count_ = -1;
+    }
+    if (ob_is_integer_type(datum_meta.type_) && !ob_is_unsigned_type(datum_meta.type_)
+        && nullptr != (int_stats = dynamic_cast<const orc::IntegerColumnStatistics *>(col_stats))) {
+      if (int_stats->hasMinimum() && int_stats->hasMaximum()) {
+        stat.min_.set_int(datum_meta.type_, int_stats->getMinimum());
+        stat.max_.set_int(datum_meta.type_, int_stats->getMaximum());
+        stat.has_min_max_ = true;
+      }
+    } else if (ObVarcharType == datum_meta.type_ && CS_TYPE_BINARY == datum_meta.cs_type_
+               && nullptr != (str_stats = dynamic_cast<const orc::StringColumnStatistics *>(col_stats))) {
+      // orc orders strings as unsigned bytes, which is the order of varbinary only
+      ObString min_str;
+      ObString max_str;
+      if (!str_stats->hasMinimum() || !str_stats->hasMaximum()) {
+      } else if (OB_FAIL(ob_write_string(allocator_, ObString(str_stats->getMinimum().length(),
+                         str_stats->getMinimum().data()), min_str))) {
+        LOG_WARN("failed to copy min string", K(ret));
+      } else if (OB_FAIL(ob_write_string(allocator_, ObString(str_stats->getMaximum().length(),
+                         str_stats->getMaximum().data()), max_str))) {
+        LOG_WARN("failed to copy max string", K(ret));
+      } else {
+        stat.min_.set_varchar(min_str);
+        stat.min_.set_collation_type(CS_TYPE_BINARY);
+        stat.max_.set_varchar(max_str);
+        stat.max_.set_collation_type(CS_TYPE_BINARY);
+        stat.has_min_max_ = true;
       }
     }
   }
@@ -370,6 +461,7 @@ int ObOrcTableRowIterator::next_file()
             CK (type != nullptr);
 
             if (OB_SUCC(ret)) {
+              column_indexs_.at(i) = static_cast<int>(col_id);
               load_funcs_.at(i) = DataLoader::select_load_function(file_column_exprs_.at(i)->datum_meta_, 
                                                                     *type);
             }
@@ -404,6 +496,8 @@ int ObOrcTableRowIterator::next_file()
             }
           }
         }
+        // keep the reader for the stripe statistics
+        reader_ = std::move(reader);
       } catch(const std::exception& e) {
         if (OB_SUCC(ret)) {
           ret = OB_INVALID_EXTERNAL_FILE;
@@ -1627,6 +1721,7 @@ int ObOrcTableRowIterator::get_next_row()
 void ObOrcTableRowIterator::reset() {
   // reset state_ to initial values for rescan
   state_.reuse();
+  pd_filter_.reuse();
 }
 
 DEF_TO_STRING(ObOrcIteratorState)
@@ -24,6 +24,7 @@
 #include "common/storage/ob_io_device.h"
 #include "share/backup/ob_backup_struct.h"
 #include "sql/engine/table/ob_external_table_access_service.h"
+#include "sql/engine/table/ob_external_table_pushdown_filter.h"
 #include <orc/OrcFile.hh>
 #include <orc/MemoryPool.hh>
 #include <orc/Writer.hh>
@@ -171,9 +172,34 @@ private:
     int64_t &row_count_;
     const orc::Type *col_type_;
   };
+  // column statistics of a stripe, orc orders integers and strings the same way as the signed ob
+  // integer types and varbinary, the other types are not used for pruning
+  class StripeStatProvider : public ObExternalStatProvider
+  {
+  public:
+    StripeStatProvider(const orc::StripeStatistics &stripe_stats,
+                       const common::ObIArrayWrap<int> &column_indexs,
+                       const ExprFixedArray &file_column_exprs,
+                       const int64_t row_count,
+                       const lib::ObMemAttr &mem_attr) :
+      stripe_stats_(stripe_stats),
+      column_indexs_(column_indexs),
+      file_column_exprs_(file_column_exprs),
+      row_count_(row_count),
+      allocator_(mem_attr)
+    {}
+    virtual int get_column_stat(const int64_t file_col_idx, ObExternalColumnStat &stat) override;
+  private:
+    const orc::StripeStatistics &stripe_stats_;
+    const common::ObIArrayWrap<int> &column_indexs_;
+    const ExprFixedArray &file_column_exprs_;
+    const int64_t row_count_;
+    common::ObArenaAllocator allocator_;
+  };
   private:
     int next_file();
     int next_stripe();
+    int check_stripe_skippable(const int64_t stripe_idx, bool &skip);
     int build_type_name_id_map(const orc::Type* type, ObIArray<ObString> &col_names);
     int compute_column_id_by_index_type(int64_t index, int64_t &orc_col_id);
     int to_dot_column_path(ObIArray<ObString> &col_names, ObString &path);
@@ -189,7 +215,7 @@ private:
     std::unique_ptr<orc::ColumnVectorBatch> orc_batch_;
     common::ObArrayWrap<StripeInformation> stripes_;
     ObExternalDataAccessDriver data_access_driver_;
-    common::ObArrayWrap<int> column_indexs_; //for getting statistics, may useless now.
+    common::ObArrayWrap<int> column_indexs_; //orc column ids for getting stripe statistics
     ExprFixedArray file_column_exprs_; //column value from parquet file
     ExprFixedArray file_meta_column_exprs_; //column value from file meta
     common::ObArrayWrap<DataLoader::LOAD_FUNC> load_funcs_;
@@ -199,7 +225,7 @@ private:
     common::ObArrayWrap<ObLength> file_url_lens_; //for file url expr
     hash::ObHashMap<int64_t, const orc::Type*> id_to_type_;
     hash::ObHashMap<ObString, int64_t> name_to_id_;
-    
+    ObExternalTablePushdownFilter pd_filter_;
 };
 
 }
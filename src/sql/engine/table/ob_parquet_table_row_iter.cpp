@@ -20,6 +20,7 @@
 #include "sql/engine/expr/ob_expr_get_path.h"
 #include "share/external_table/ob_external_table_utils.h"
 #include "sql/engine/expr/ob_datum_cast.h"
+#include "sql/engine/expr/ob_expr_lob_utils.h"
 #include <parquet/api/reader.h>
 
 namespace oceanbase
@@ -69,11 +70,16 @@ int ObParquetTableRowIterator::init(const storage::ObTableScanParam *scan_param)
     }
     OZ (file_column_exprs_.assign(file_column_exprs));
     OZ (file_meta_column_exprs_.assign(file_meta_column_exprs));
+    OZ (pd_filter_.init(scan_param, column_exprs_, file_column_exprs_));
 
     if (file_column_exprs_.count() > 0) {
       OZ (column_indexs_.allocate_array(allocator_, file_column_exprs_.count()));
       OZ (column_readers_.allocate_array(allocator_, file_column_exprs_.count()));
       OZ (load_funcs_.allocate_array(allocator_, file_column_exprs_.count()));
+      OZ (list_bufs_.allocate_array(allocator_, file_column_exprs_.count()));
+      for (int i = 0; OB_SUCC(ret) && i < list_bufs_.count(); i++) {
+        list_bufs_.at(i) = nullptr;
+      }
     }
     LOG_DEBUG("check exprs", K(file_column_exprs), K(file_meta_column_exprs), KPC(scan_param->ext_file_column_exprs_));
   }
@@ -109,8 +115,23 @@ int ObParquetTableRowIterator::compute_column_id_by_index_type(int index, int &f
     case sql::ColumnIndexType::NAME: {
       ObDataAccessPathExtraInfo *data_access_info =
         static_cast<ObDataAccessPathExtraInfo *>(file_column_exprs_.at(index)->extra_info_);
-      file_col_id = file_meta_->schema()->ColumnIndex(std::string(data_access_info->data_access_path_.ptr(),
-                                                          data_access_info->data_access_path_.length()));
+      std::string path(data_access_info->data_access_path_.ptr(),
+                       data_access_info->data_access_path_.length());
+      file_col_id = file_meta_->schema()->ColumnIndex(path);
+      if (file_col_id < 0 && ob_is_collection_sql_type(file_column_exprs_.at(index)->datum_meta_.type_)) {
+        // a list column is named by its group node, the elements are the only leaf under the group
+        const std::string prefix = path + ".";
+        int64_t leaf_cnt = 0;
+        for (int i = 0; i < file_meta_->schema()->num_columns(); i++) {
+          if (0 == file_meta_->schema()->Column(i)->path()->ToDotString().compare(0, prefix.length(), prefix)) {
+            file_col_id = i;
+            leaf_cnt++;
+          }
+        }
+        if (1 != leaf_cnt) {
+          file_col_id = -1;
+        }
+      }
       break;
     }
     case sql::ColumnIndexType::POSITION: {
@@ -243,12 +264,17 @@ int ObParquetTableRowIterator::next_file()
               ret = OB_ERR_UNEXPECTED;
               LOG_WARN("null column desc", K(ret), K(column_index));
             } else {
-              load_funcs_.at(i) = DataLoader::select_load_function(
-                                                  file_column_exprs_.at(i)->datum_meta_, col_desc);
+              if (ob_is_collection_sql_type(file_column_exprs_.at(i)->datum_meta_.type_)) {
+                OZ (select_list_load_function(i, col_desc));
+              } else {
+                load_funcs_.at(i) = DataLoader::select_load_function(
+                                                    file_column_exprs_.at(i)->datum_meta_, col_desc);
+              }
             }
             if (OB_SUCC(ret)) {
+              // only the lists of scalar elements are repeated
               if (OB_ISNULL(load_funcs_.at(i))
-                  || col_desc->max_repetition_level() != 0) {
+                  || col_desc->max_repetition_level() != (nullptr == list_bufs_.at(i) ? 0 : 1)) {
                 ret = OB_EXTERNAL_FILE_COLUMN_TYPE_MISMATCH;
                 std::string p_type = col_desc->logical_type()->ToString();
                 int64_t pos = 0;
@@ -302,16 +328,25 @@ int ObParquetTableRowIterator::next_file()
 int ObParquetTableRowIterator::next_row_group()
 {
   int ret = OB_SUCCESS;
-  //init all meta
-  while (OB_SUCC(ret) && state_.cur_row_group_idx_ > state_.end_row_group_idx_) {
-    if (OB_FAIL(next_file())) {
-      if (OB_ITER_END != ret) {
-        LOG_WARN("fail to next row group", K(ret));
+  int64_t cur_row_group = -1;
+  bool skip = true;
+  while (OB_SUCC(ret) && skip) {
+    //init all meta
+    while (OB_SUCC(ret) && state_.cur_row_group_idx_ > state_.end_row_group_idx_) {
+      if (OB_FAIL(next_file())) {
+        if (OB_ITER_END != ret) {
+          LOG_WARN("fail to next row group", K(ret));
+        }
+      }
+    }
+    if (OB_SUCC(ret)) {
+      cur_row_group = (state_.cur_row_group_idx_++) - 1;
+      if (OB_FAIL(check_row_group_skippable(cur_row_group, skip))) {
+        LOG_WARN("failed to check row group skippable", K(ret), K(cur_row_group));
       }
     }
   }
   if (OB_SUCC(ret)) {
-    int64_t cur_row_group = (state_.cur_row_group_idx_++) - 1;
     if (OB_FAIL(prefetch_parquet_row_group(file_meta_->RowGroup(cur_row_group)))) {
       LOG_WARN("failed to prefetch parquet row group", K(ret));
     } else {
@@ -321,6 +356,9 @@ int ObParquetTableRowIterator::next_row_group()
         state_.cur_row_group_row_count_ = file_meta_->RowGroup(cur_row_group)->num_rows();
         for (int i = 0; OB_SUCC(ret) && i < column_indexs_.count(); i++) {
           column_readers_.at(i) = rg_reader->Column(column_indexs_.at(i));
+          if (nullptr != list_bufs_.at(i)) {
+            list_bufs_.at(i)->reuse();
+          }
         }
       } catch(const std::exception& e) {
         ret = OB_ERR_UNEXPECTED;
@@ -334,6 +372,131 @@ int ObParquetTableRowIterator::next_row_group()
   return ret;
 }
 
+int ObParquetTableRowIterator::check_row_group_skippable(const int64_t row_group_idx, bool &skip)
+{
+  int ret = OB_SUCCESS;
+  skip = false;
+  // statistics are only kept for file columns
+  if (file_column_exprs_.count() > 0) {
+    try {
+      std::unique_ptr<parquet::RowGroupMetaData> row_group_meta = file_meta_->RowGroup(row_group_idx);
+      RowGroupStatProvider provider(*row_group_meta, column_indexs_, file_column_exprs_, mem_attr_);
+      if (OB_FAIL(pd_filter_.can_skip(row_group_meta->num_rows(), provider, skip))) {
+        LOG_WARN("failed to check row group by pushdown filter", K(ret), K(row_group_idx));
+      } else if (skip) {
+        // keep the line numbers of the following rows as if the row group was read
+        state_.cur_line_number_ += row_group_meta->num_rows();
+        LOG_TRACE("skip parquet row group by statistics", K(url_), K(row_group_idx),
+                  "row_count", row_group_meta->num_rows());
+      }
+    } catch(const std::exception& e) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("failed to read row group statistics", K(ret), "Info", e.what(), K(row_group_idx));
+    } catch(...) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("failed to read row group statistics", K(ret), K(row_group_idx));
+    }
+  }
+  return ret;
+}
+
+int ObParquetTableRowIterator::RowGroupStatProvider::get_column_stat(
+    const int64_t file_col_idx, ObExternalColumnStat &stat)
+{
+  int ret = OB_SUCCESS;
+  stat.reset();
+  if (OB_UNLIKELY(file_col_idx < 0 || file_col_idx >= column_indexs_.count()
+                  || file_col_idx >= file_column_exprs_.count())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid file col idx", K(ret), K(file_col_idx), K(column_indexs_.count()));
+  } else {
+    std::unique_ptr<parquet::ColumnChunkMetaData> col_meta =
+        row_group_meta_.ColumnChunk(column_indexs_.at(file_col_idx));
+    std::shared_ptr<parquet::Statistics> stats;
+    // is_stats_set is false for the statistics of writers known to be wrong. The statistics of a
+    // list column are of the elements rather than the rows.
+    if (col_meta && col_meta->is_stats_set()
+        && 0 == row_group_meta_.schema()->Column(column_indexs_.at(file_col_idx))->max_repetition_level()
+        && (stats = col_meta->statistics())) {
+      if (stats->HasNullCount()) {
+        stat.null_count_ = stats->null_count();
+      }
+      if (stats->HasMinMax()
+          && OB_FAIL(convert_min_max(*stats, file_column_exprs_.at(file_col_idx)->datum_meta_, stat))) {
+        LOG_WARN("failed to convert min max", K(ret), K(file_col_idx));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObParquetTableRowIterator::RowGroupStatProvider::convert_min_max(
+    const parquet::Statistics &stats,
+    const ObDatumMeta &datum_meta,
+    ObExternalColumnStat &stat)
+{
+  int ret = OB_SUCCESS;
+  const parquet::ColumnDescriptor *col_desc = stats.descr();
+  const parquet::LogicalType *log_type = col_desc->logical_type().get();
+  const bool no_log_type = log_type->is_none();
+  const bool is_unsigned_int = log_type->is_int()
+                               && !static_cast<const parquet::IntLogicalType*>(log_type)->is_signed();
+  const ObObjType ob_type = datum_meta.type_;
+  const bool is_int_type = ob_is_integer_type(ob_type) && (no_log_type || log_type->is_int())
+                           && ob_is_unsigned_type(ob_type) == is_unsigned_int;
+  stat.has_min_max_ = false;
+  if (parquet::Type::INT32 == col_desc->physical_type()) {
+    const parquet::Int32Statistics &int_stats = static_cast<const parquet::Int32Statistics &>(stats);
+    if (is_int_type && is_unsigned_int) {
+      stat.min_.set_uint(ob_type, static_cast<uint32_t>(int_stats.min()));
+      stat.max_.set_uint(ob_type, static_cast<uint32_t>(int_stats.max()));
+      stat.has_min_max_ = true;
+    } else if (is_int_type) {
+      stat.min_.set_int(ob_type, int_stats.min());
+      stat.max_.set_int(ob_type, int_stats.max());
+      stat.has_min_max_ = true;
+    } else if (ObDateType == ob_type && (no_log_type || log_type->is_date())) {
+      stat.min_.set_date(int_stats.min());
+      stat.max_.set_date(int_stats.max());
+      stat.has_min_max_ = true;
+    }
+  } else if (parquet::Type::INT64 == col_desc->physical_type()) {
+    const parquet::Int64Statistics &int_stats = static_cast<const parquet::Int64Statistics &>(stats);
+    if (is_int_type && is_unsigned_int) {
+      stat.min_.set_uint(ob_type, static_cast<uint64_t>(int_stats.min()));
+      stat.max_.set_uint(ob_type, static_cast<uint64_t>(int_stats.max()));
+      stat.has_min_max_ = true;
+    } else if (is_int_type) {
+      stat.min_.set_int(ob_type, int_stats.min());
+      stat.max_.set_int(ob_type, int_stats.max());
+      stat.has_min_max_ = true;
+    }
+  } else if (parquet::Type::BYTE_ARRAY == col_desc->physical_type()) {
+    // parquet orders byte arrays as unsigned bytes, which is the order of varbinary only, the other
+    // collations compare with pad space or case folding
+    if (ObVarcharType == ob_type && CS_TYPE_BINARY == datum_meta.cs_type_
+        && (no_log_type || log_type->is_string())) {
+      const parquet::ByteArrayStatistics &str_stats = static_cast<const parquet::ByteArrayStatistics &>(stats);
+      ObString min_str;
+      ObString max_str;
+      if (OB_FAIL(ob_write_string(allocator_, ObString(str_stats.min().len,
+                  reinterpret_cast<const char *>(str_stats.min().ptr)), min_str))) {
+        LOG_WARN("failed to copy min string", K(ret));
+      } else if (OB_FAIL(ob_write_string(allocator_, ObString(str_stats.max().len,
+                         reinterpret_cast<const char *>(str_stats.max().ptr)), max_str))) {
+        LOG_WARN("failed to copy max string", K(ret));
+      } else {
+        stat.min_.set_varchar(min_str);
+        stat.min_.set_collation_type(CS_TYPE_BINARY);
+        stat.max_.set_varchar(max_str);
+        stat.max_.set_collation_type(CS_TYPE_BINARY);
+        stat.has_min_max_ = true;
+      }
+    }
+  }
+  return ret;
+}
+
 int ObParquetTableRowIterator::DataLoader::load_data_for_col(LOAD_FUNC &func)
 {
   return (this->*func)();
@@ -496,6 +659,205 @@ ObParquetTableRowIterator::DataLoader::LOAD_FUNC ObParquetTableRowIterator::Data
 }
 
 
+ObParquetTableRowIterator::DataLoader::LOAD_FUNC ObParquetTableRowIterator::DataLoader::select_list_load_function(
+    const ObObjType elem_type, const bool is_vector, const parquet::ColumnDescriptor *col_desc,
+    int64_t &value_size)
+{
+  LOAD_FUNC func = NULL;
+  const parquet::LogicalType* log_type = col_desc->logical_type().get();
+  parquet::Type::type phy_type = col_desc->physical_type();
+  bool no_log_type = log_type->is_none();
+  if (parquet::Type::FLOAT == phy_type && no_log_type && ObFloatType == elem_type) {
+    func = &DataLoader::load_list_col<float, parquet::FloatReader>;
+    value_size = sizeof(float);
+  } else if (is_vector) {
+    // vectors are float only
+  } else if (parquet::Type::DOUBLE == phy_type && no_log_type && ObDoubleType == elem_type) {
+    func = &DataLoader::load_list_col<double, parquet::DoubleReader>;
+    value_size = sizeof(double);
+  } else if (no_log_type || (log_type->is_int()
+                             && static_cast<const parquet::IntLogicalType*>(log_type)->is_signed())) {
+    if (parquet::Type::INT32 == phy_type && ObInt32Type == elem_type) {
+      func = &DataLoader::load_list_col<int32_t, parquet::Int32Reader>;
+      value_size = sizeof(int32_t);
+    } else if (parquet::Type::INT64 == phy_type && ObIntType == elem_type) {
+      func = &DataLoader::load_list_col<int64_t, parquet::Int64Reader>;
+      value_size = sizeof(int64_t);
+    }
+  }
+  return func;
+}
+
+int ObParquetTableRowIterator::select_list_load_function(
+    const int64_t file_col_idx, const parquet::ColumnDescriptor *col_desc)
+{
+  int ret = OB_SUCCESS;
+  ObEvalCtx &eval_ctx = scan_param_->op_->get_eval_ctx();
+  ObExpr *file_col_expr = file_column_exprs_.at(file_col_idx);
+  uint16_t subschema_id = file_col_expr->obj_meta_.get_subschema_id();
+  ObSubSchemaValue value;
+  const ObSqlCollectionInfo *coll_info = NULL;
+  const ObCollectionArrayType *arr_type = NULL;
+  load_funcs_.at(file_col_idx) = NULL;
+  if (OB_FAIL(eval_ctx.exec_ctx_.get_sqludt_meta_by_subschema_id(subschema_id, value))) {
+    LOG_WARN("failed to get subschema ctx", K(ret), K(subschema_id));
+  } else if (OB_ISNULL(coll_info = reinterpret_cast<const ObSqlCollectionInfo *>(value.value_))
+             || OB_ISNULL(coll_info->collection_meta_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("null collection info", K(ret), K(subschema_id));
+  } else if (ObNestedType::OB_VECTOR_TYPE != coll_info->collection_meta_->type_id_
+             && ObNestedType::OB_ARRAY_TYPE != coll_info->collection_meta_->type_id_) {
+    // maps and sparse vectors are not lists, no load function
+  } else if (FALSE_IT(arr_type = static_cast<const ObCollectionArrayType *>(coll_info->collection_meta_))) {
+  } else if (OB_ISNULL(arr_type->element_type_)
+             || ObNestedType::OB_BASIC_TYPE != arr_type->element_type_->type_id_) {
+    // nested arrays are not supported
+  } else if (1 != col_desc->max_repetition_level()) {
+    // checked by the caller
+  } else {
+    const bool is_vector = ObNestedType::OB_VECTOR_TYPE == arr_type->type_id_;
+    const ObObjType elem_type =
+        static_cast<const ObCollectionBasicType *>(arr_type->element_type_)->basic_meta_.get_obj_type();
+    int64_t value_size = 0;
+    DataLoader::LOAD_FUNC func =
+        DataLoader::select_list_load_function(elem_type, is_vector, col_desc, value_size);
+    if (NULL == func) {
+    } else if (nullptr == list_bufs_.at(file_col_idx)) {
+      void *buf = NULL;
+      if (OB_ISNULL(buf = allocator_.alloc(sizeof(ListColumnBuffer)))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("failed to alloc list column buffer", K(ret));
+      } else {
+        list_bufs_.at(file_col_idx) = new(buf) ListColumnBuffer(allocator_);
+      }
+    }
+    if (OB_SUCC(ret) && NULL != func) {
+      if (OB_FAIL(list_bufs_.at(file_col_idx)->init(col_desc, value_size, is_vector,
+                                                    arr_type->dim_cnt_))) {
+        LOG_WARN("failed to init list column buffer", K(ret), K(file_col_idx));
+      } else {
+        load_funcs_.at(file_col_idx) = func;
+      }
+    }
+  }
+  return ret;
+}
+
+int ObParquetTableRowIterator::ListColumnBuffer::init(const parquet::ColumnDescriptor *col_desc,
+                                                      const int64_t value_size,
+                                                      const bool is_vector,
+                                                      const uint32_t dim)
+{
+  int ret = OB_SUCCESS;
+  // the definition level of the repeated node is the max level without the optional nodes below it
+  int16_t def_level = col_desc->max_definition_level();
+  const parquet::schema::Node *node = col_desc->schema_node().get();
+  while (nullptr != node && !node->is_repeated()) {
+    if (node->is_optional()) {
+      def_level--;
+    }
+    node = node->parent();
+  }
+  if (OB_ISNULL(node) || OB_UNLIKELY(value_size <= 0)
+      || OB_UNLIKELY(capacity_ > 0 && value_size != value_size_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected list column", K(ret), K(value_size), KP(node), KPC(this));
+  } else {
+    // the element type comes from the column, so the buffers are kept for the next files
+    if (0 == capacity_) {
+      capacity_ = DEFAULT_LEVEL_CNT;
+      if (OB_ISNULL(def_levels_ = static_cast<int16_t *>(allocator_.alloc(sizeof(int16_t) * capacity_)))
+          || OB_ISNULL(rep_levels_ = static_cast<int16_t *>(allocator_.alloc(sizeof(int16_t) * capacity_)))
+          || OB_ISNULL(values_ = static_cast<char *>(allocator_.alloc(value_size * capacity_)))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("failed to alloc list buffer", K(ret), K(capacity_), K(value_size));
+        capacity_ = 0;
+      }
+    }
+    value_size_ = value_size;
+    list_def_level_ = def_level;
+    is_vector_ = is_vector;
+    dim_ = dim;
+    reuse();
+  }
+  return ret;
+}
+
+int ObParquetTableRowIterator::ListColumnBuffer::prepare_read()
+{
+  int ret = OB_SUCCESS;
+  if (level_pos_ > 0) {
+    MEMMOVE(def_levels_, def_levels_ + level_pos_, sizeof(int16_t) * (level_cnt_ - level_pos_));
+    MEMMOVE(rep_levels_, rep_levels_ + level_pos_, sizeof(int16_t) * (level_cnt_ - level_pos_));
+    MEMMOVE(values_, values_ + value_pos_ * value_size_, value_size_ * (value_cnt_ - value_pos_));
+    level_cnt_ -= level_pos_;
+    value_cnt_ -= value_pos_;
+    level_pos_ = 0;
+    value_pos_ = 0;
+  }
+  if (level_cnt_ >= capacity_) {
+    // one row is longer than the buffer
+    const int64_t new_capacity = capacity_ * 2;
+    int16_t *def_levels = NULL;
+    int16_t *rep_levels = NULL;
+    char *values = NULL;
+    if (OB_ISNULL(def_levels = static_cast<int16_t *>(allocator_.alloc(sizeof(int16_t) * new_capacity)))
+        || OB_ISNULL(rep_levels = static_cast<int16_t *>(allocator_.alloc(sizeof(int16_t) * new_capacity)))
+        || OB_ISNULL(values = static_cast<char *>(allocator_.alloc(value_size_ * new_capacity)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to grow list buffer", K(ret), K(new_capacity), K(value_size_));
+    } else {
+      MEMCPY(def_levels, def_levels_, sizeof(int16_t) * level_cnt_);
+      MEMCPY(rep_levels, rep_levels_, sizeof(int16_t) * level_cnt_);
+      MEMCPY(values, values_, value_size_ * value_cnt_);
+      def_levels_ = def_levels;
+      rep_levels_ = rep_levels;
+      values_ = values;
+      capacity_ = new_capacity;
+    }
+  }
+  return ret;
+}
+
+int ObParquetTableRowIterator::ListColumnBuffer::get_next_row(const int16_t max_def_level,
+                                                              const bool has_unread,
+                                                              ListRow &row) const
+{
+  int ret = OB_SUCCESS;
+  // the levels of a row end before the next level of repetition level 0
+  int64_t row_end = level_pos_ + 1;
+  while (row_end < level_cnt_ && 0 != rep_levels_[row_end]) {
+    row_end++;
+  }
+  if (row_end >= level_cnt_ && has_unread) {
+    // the last row may go on in the levels not read yet
+    ret = OB_EAGAIN;
+  } else if (!has_buffered()) {
+    ret = OB_ITER_END;
+  } else {
+    const int16_t first_def = def_levels_[level_pos_];
+    row.is_null_ = first_def < list_def_level_ - 1;
+    row.elem_cnt_ = first_def < list_def_level_ ? 0 : row_end - level_pos_;
+    row.value_cnt_ = 0;
+    for (int64_t i = level_pos_; i < level_pos_ + row.elem_cnt_; i++) {
+      row.value_cnt_ += (def_levels_[i] == max_def_level);
+    }
+    row.def_levels_ = def_levels_ + level_pos_;
+    row.values_ = values_ + value_pos_ * value_size_;
+    row.level_end_ = row_end;
+    if (row.is_null_ || !is_vector_) {
+    } else if (OB_UNLIKELY(row.elem_cnt_ != dim_)) {
+      ret = OB_ERR_INVALID_VECTOR_DIM;
+      LOG_WARN("invalid vector dim", K(ret), K_(dim), K(row));
+      LOG_USER_ERROR(OB_ERR_INVALID_VECTOR_DIM, dim_, static_cast<uint32_t>(row.elem_cnt_));
+    } else if (OB_UNLIKELY(row.value_cnt_ != row.elem_cnt_)) {
+      ret = OB_ERR_NULL_VALUE;
+      LOG_WARN("null element in vector", K(ret), K(row));
+    }
+  }
+  return ret;
+}
+
 #define IS_PARQUET_COL_NOT_NULL (0 == max_def_level)
 #define IS_PARQUET_COL_VALUE_IS_NULL(V) (V < max_def_level)
 
@@ -1384,6 +1746,90 @@ int ObParquetTableRowIterator::DataLoader::load_double()
   return ret;
 }
 
+template <typename T, typename READER>
+int ObParquetTableRowIterator::DataLoader::load_list_col()
+{
+  int ret = OB_SUCCESS;
+  int16_t max_def_level = reader_->descr()->max_definition_level();
+  ObIVector *vec = file_col_expr_->get_vector(eval_ctx_);
+  row_count_ = 0;
+  if (OB_ISNULL(list_buf_) || OB_UNLIKELY(sizeof(T) != list_buf_->value_size_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected list buffer", K(ret), KPC(list_buf_));
+  }
+  while (OB_SUCC(ret) && row_count_ < batch_size_) {
+    ListColumnBuffer &buf = *list_buf_;
+    ListColumnBuffer::ListRow row;
+    if (OB_FAIL(buf.get_next_row(max_def_level, reader_->HasNext(), row))) {
+      if (OB_EAGAIN == ret) {
+        ret = OB_SUCCESS;
+        if (OB_FAIL((buf.read_levels<T, READER>(reader_)))) {
+          LOG_WARN("failed to read list levels", K(ret), K(buf));
+        }
+      } else if (OB_ITER_END == ret) {
+        ret = OB_SUCCESS;
+        break;
+      } else {
+        LOG_WARN("failed to get next list row", K(ret), K(buf));
+      }
+    } else {
+      const int64_t idx = row_offset_ + row_count_;
+      const int64_t elem_cnt = row.elem_cnt_;
+      const int64_t value_cnt = row.value_cnt_;
+      const T *values = reinterpret_cast<const T*>(row.values_);
+      if (row.is_null_) {
+        vec->set_null(idx);
+      } else {
+        // vector: | elements |, array: | element count | null flags | elements |
+        const int64_t res_size = buf.is_vector_
+            ? sizeof(T) * elem_cnt
+            : sizeof(uint32_t) + (sizeof(uint8_t) + sizeof(T)) * elem_cnt;
+        ObTextStringDatumResult res(file_col_expr_->datum_meta_.type_, file_col_expr_, &eval_ctx_, vec, idx);
+        char *res_buf = NULL;
+        int64_t res_buf_len = 0;
+        if (OB_FAIL(res.init_with_batch_idx(res_size, idx))) {
+          LOG_WARN("fail to init result", K(ret), K(res_size));
+        } else if (OB_FAIL(res.get_reserved_buffer(res_buf, res_buf_len))) {
+          LOG_WARN("fail to get reserved buffer", K(ret));
+        } else if (OB_UNLIKELY(res_buf_len < res_size)) {
+          ret = OB_ERR_UNEXPECTED;
+          LOG_WARN("get invalid res buf len", K(ret), K(res_buf_len), K(res_size));
+        } else if (buf.is_vector_) {
+          // the elements of a vector are a run of values in the page
+          MEMCPY(res_buf, values, sizeof(T) * elem_cnt);
+        } else {
+          const uint32_t length = static_cast<uint32_t>(elem_cnt);
+          uint8_t *null_flags = reinterpret_cast<uint8_t *>(res_buf + sizeof(uint32_t));
+          T *elems = reinterpret_cast<T *>(null_flags + elem_cnt);
+          MEMCPY(res_buf, &length, sizeof(uint32_t));
+          if (value_cnt == elem_cnt) {
+            MEMSET(null_flags, 0, elem_cnt);
+            MEMCPY(elems, values, sizeof(T) * elem_cnt);
+          } else {
+            for (int64_t i = 0, j = 0; i < elem_cnt; i++) {
+              const bool is_null = row.def_levels_[i] < max_def_level;
+              null_flags[i] = is_null;
+              elems[i] = is_null ? 0 : values[j++];
+            }
+          }
+        }
+        if (OB_SUCC(ret)) {
+          if (OB_FAIL(res.lseek(res_size, 0))) {
+            LOG_WARN("failed to lseek res", K(ret), K(res_size));
+          } else {
+            res.set_result();
+          }
+        }
+      }
+      if (OB_SUCC(ret)) {
+        buf.consume_row(row);
+        row_count_++;
+      }
+    }
+  }
+  return ret;
+}
+
 #undef IS_PARQUET_COL_NOT_NULL
 #undef IS_PARQUET_COL_VALUE_IS_NULL
 
@@ -1413,11 +1859,14 @@ int ObParquetTableRowIterator::get_next_rows(int64_t &count, int64_t capacity)
         int64_t load_row_count = 0;
         OZ (file_column_exprs_.at(i)->init_vector_for_write(
                 eval_ctx, file_column_exprs_.at(i)->get_default_res_format(), eval_ctx.max_batch_size_));
-        while (OB_SUCC(ret) && load_row_count < capacity && column_readers_.at(i).get()->HasNext()) {
+        while (OB_SUCC(ret) && load_row_count < capacity
+               && (column_readers_.at(i).get()->HasNext()
+                   || (nullptr != list_bufs_.at(i) && list_bufs_.at(i)->has_buffered()))) {
           int64_t temp_row_count = 0;
           DataLoader loader(eval_ctx, file_column_exprs_.at(i), column_readers_.at(i).get(),
                             def_levels_buf_, rep_levels_buf_, str_res_mem_,
-                            capacity - load_row_count, load_row_count, temp_row_count);
+                            capacity - load_row_count, load_row_count, temp_row_count,
+                            list_bufs_.at(i));
           MEMSET(def_levels_buf_.get_data(), 0, sizeof(def_levels_buf_.at(0)) * eval_ctx.max_batch_size_);
           MEMSET(rep_levels_buf_.get_data(), 0, sizeof(rep_levels_buf_.at(0)) * eval_ctx.max_batch_size_);
           OZ (loader.load_data_for_col(load_funcs_.at(i)));
@@ -1521,6 +1970,7 @@ void ObParquetTableRowIterator::reset() {
   // reset state_ to initial values for rescan
   state_.reuse();
   file_prefetch_buffer_.destroy();
+  pd_filter_.reuse();
 }
 
 int ObParquetTableRowIterator::prefetch_parquet_row_group(
@@ -31,6 +31,7 @@
 #include "share/backup/ob_backup_struct.h"
 #include "sql/engine/basic/ob_arrow_basic.h"
 #include "sql/engine/table/ob_external_table_access_service.h"
+#include "sql/engine/table/ob_external_table_pushdown_filter.h"
 
 namespace oceanbase {
 namespace sql {
@@ -83,6 +84,75 @@ public:
 
   virtual void reset() override;
 private:
+  // levels and values of a list column which are read from the column reader but not loaded yet.
+  // ReadBatch of a repeated column reads levels rather than rows, the levels of a row may span two
+  // reads and the rows after a batch are kept for the next batch.
+  struct ListColumnBuffer {
+    static const int64_t DEFAULT_LEVEL_CNT = 16 * 1024;
+    ListColumnBuffer(common::ObIAllocator &allocator) :
+      allocator_(allocator), def_levels_(nullptr), rep_levels_(nullptr), values_(nullptr),
+      capacity_(0), value_size_(0), list_def_level_(0), is_vector_(false), dim_(0),
+      level_cnt_(0), level_pos_(0), value_cnt_(0), value_pos_(0)
+    {}
+    // is_vector is true for the vector type, whose lists have dim not null elements
+    int init(const parquet::ColumnDescriptor *col_desc,
+             const int64_t value_size,
+             const bool is_vector,
+             const uint32_t dim);
+    // a row of the buffered levels
+    struct ListRow {
+      ListRow() : is_null_(false), elem_cnt_(0), value_cnt_(0), def_levels_(nullptr),
+                  values_(nullptr), level_end_(0) {}
+      TO_STRING_KV(K_(is_null), K_(elem_cnt), K_(value_cnt), K_(level_end));
+      bool is_null_;
+      int64_t elem_cnt_;
+      // not null elements, they are stored in values_ without gaps
+      int64_t value_cnt_;
+      // definition levels of the elements, an element is null if its level is below the max level
+      const int16_t *def_levels_;
+      const char *values_;
+      int64_t level_end_;
+    };
+    void reuse() { level_cnt_ = 0; level_pos_ = 0; value_cnt_ = 0; value_pos_ = 0; }
+    bool has_buffered() const { return level_pos_ < level_cnt_; }
+    // move the levels and values not loaded to the front, grow the buffers if they are full
+    int prepare_read();
+    // read more levels and values of the column after the buffered ones
+    template <typename T, typename READER>
+    int read_levels(parquet::ColumnReader *reader)
+    {
+      int ret = common::OB_SUCCESS;
+      int64_t values_read = 0;
+      if (OB_SUCC(prepare_read())) {
+        level_cnt_ += static_cast<READER *>(reader)->ReadBatch(
+            capacity_ - level_cnt_, def_levels_ + level_cnt_, rep_levels_ + level_cnt_,
+            reinterpret_cast<T *>(values_) + value_cnt_, &values_read);
+        value_cnt_ += values_read;
+      }
+      return ret;
+    }
+    // get the first buffered row, return OB_EAGAIN if the row may go on in the levels which are not
+    // read yet, and OB_ITER_END if no level is buffered. A vector row is checked against dim_.
+    int get_next_row(const int16_t max_def_level, const bool has_unread, ListRow &row) const;
+    void consume_row(const ListRow &row) { level_pos_ = row.level_end_; value_pos_ += row.value_cnt_; }
+    TO_STRING_KV(K_(capacity), K_(value_size), K_(list_def_level), K_(is_vector), K_(dim),
+                 K_(level_cnt), K_(level_pos), K_(value_cnt), K_(value_pos));
+    common::ObIAllocator &allocator_;
+    int16_t *def_levels_;
+    int16_t *rep_levels_;
+    char *values_;
+    int64_t capacity_;
+    int64_t value_size_;
+    // definition level of the repeated node, a row with a lower level is an empty list, or a null
+    // list if the level is lower than list_def_level_ - 1
+    int16_t list_def_level_;
+    bool is_vector_;
+    uint32_t dim_;
+    int64_t level_cnt_;
+    int64_t level_pos_;
+    int64_t value_cnt_;
+    int64_t value_pos_;
+  };
   // load vec data from parquet file to expr mem
   struct DataLoader {
     DataLoader(ObEvalCtx &eval_ctx,
@@ -93,7 +163,8 @@ private:
                common::ObIAllocator &str_res_mem,
                const int64_t batch_size,
                const int64_t row_offset,
-               int64_t &row_count):
+               int64_t &row_count,
+               ListColumnBuffer *list_buf = nullptr):
       eval_ctx_(eval_ctx),
       file_col_expr_(file_col_expr),
       reader_(reader),
@@ -102,11 +173,17 @@ private:
       row_count_(row_count),
       def_levels_buf_(def_levels_buf),
       rep_levels_buf_(rep_levels_buf),
-      str_res_mem_(str_res_mem)
+      str_res_mem_(str_res_mem),
+      list_buf_(list_buf)
     {}
     typedef int (DataLoader::*LOAD_FUNC)();
     static LOAD_FUNC select_load_function(const ObDatumMeta &datum_type,
                                           const parquet::ColumnDescriptor *col_desc);
+    // load function of the list column col_desc to the vector or array column of elem_type
+    static LOAD_FUNC select_list_load_function(const ObObjType elem_type,
+                                               const bool is_vector,
+                                               const parquet::ColumnDescriptor *col_desc,
+                                               int64_t &value_size);
     int16_t get_max_def_level();
     int load_data_for_col(LOAD_FUNC &func);
 
@@ -131,6 +208,8 @@ private:
     int load_timestamp_hive();
     int load_float();
     int load_double();
+    template <typename T, typename READER>
+    int load_list_col();
 
     int to_numeric(const int64_t idx, const int64_t int_value);
     int to_numeric_hive(const int64_t idx, const char *str, const int32_t length, char *buf, const int64_t data_len);
@@ -148,13 +227,42 @@ private:
     common::ObIArrayWrap<int16_t> &def_levels_buf_;
     common::ObIArrayWrap<int16_t> &rep_levels_buf_;
     common::ObIAllocator &str_res_mem_;
+    ListColumnBuffer *list_buf_;
+  };
+  // column chunk statistics of a row group for the pushdown filter
+  class RowGroupStatProvider : public ObExternalStatProvider
+  {
+  public:
+    RowGroupStatProvider(const parquet::RowGroupMetaData &row_group_meta,
+                         const common::ObIArrayWrap<int> &column_indexs,
+                         const ExprFixedArray &file_column_exprs,
+                         const lib::ObMemAttr &mem_attr) :
+      row_group_meta_(row_group_meta),
+      column_indexs_(column_indexs),
+      file_column_exprs_(file_column_exprs),
+      allocator_(mem_attr)
+    {}
+    virtual int get_column_stat(const int64_t file_col_idx, ObExternalColumnStat &stat) override;
+  private:
+    // min and max in the type of the file column expr, left unset for the types whose parquet
+    // sort order differs from the order of the ob type
+    int convert_min_max(const parquet::Statistics &stats,
+                        const ObDatumMeta &datum_meta,
+                        ObExternalColumnStat &stat);
+  private:
+    const parquet::RowGroupMetaData &row_group_meta_;
+    const common::ObIArrayWrap<int> &column_indexs_;
+    const ExprFixedArray &file_column_exprs_;
+    common::ObArenaAllocator allocator_;
   };
 private:
   int next_file();
   int next_row_group();
+  int check_row_group_skippable(const int64_t row_group_idx, bool &skip);
   int calc_pseudo_exprs(const int64_t read_count);
   int prefetch_parquet_row_group(std::unique_ptr<parquet::RowGroupMetaData> row_group_meta);
   int compute_column_id_by_index_type(int index, int &file_col_id);
+  int select_list_load_function(const int64_t file_col_idx, const parquet::ColumnDescriptor *col_desc);
 private:
   ObParquetIteratorState state_;
   lib::ObMemAttr mem_attr_;
@@ -170,6 +278,7 @@ private:
   common::ObArrayWrap<int> column_indexs_;
   common::ObArrayWrap<std::shared_ptr<parquet::ColumnReader>> column_readers_;
   common::ObArrayWrap<DataLoader::LOAD_FUNC> load_funcs_;
+  common::ObArrayWrap<ListColumnBuffer *> list_bufs_; //null for the columns which are not lists
   ObSqlString url_;
   ObBitVector *bit_vector_cache_;
   common::ObArrayWrap<int16_t> def_levels_buf_;
@@ -177,6 +286,7 @@ private:
   common::ObArrayWrap<char *> file_url_ptrs_; //for file url expr
   common::ObArrayWrap<ObLength> file_url_lens_; //for file url expr
   ObFilePrefetchBuffer file_prefetch_buffer_;
+  ObExternalTablePushdownFilter pd_filter_;
 };
 
 }
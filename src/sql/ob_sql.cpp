@@ -3133,16 +3133,11 @@ int ObSql::generate_plan(ParseResult &parse_result,
     ObOptimizer optimizer(optctx);
     bool use_jit = false;
     bool turn_on_jit = sql_ctx.need_late_compile_;
-    // if (OB_FAIL(ret)) {
-    // } else if (OB_FAIL(need_use_jit(turn_on_jit,
-    //                                 query_hint.use_jit_policy_,
-    //                                 *sql_ctx.session_info_,
-    //                                 use_jit))) {
-    //   use_jit = false;
-    //   LOG_WARN("failed to check for needing jitted expr", K(ret));
-    // } else {
-    //   // do nothing
-    // }
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(need_use_jit(result.get_session(), use_jit))) {
+      use_jit = false;
+      LOG_WARN("failed to check for needing jitted expr", K(ret));
+    }
 
     ObLogPlan *logical_plan = NULL;
     ObPhysicalPlan *phy_plan = NULL;
@@ -3605,6 +3600,13 @@ int ObSql::optimize_stmt(
   return ret;
 }
 
+int ObSql::need_use_jit(const ObSQLSessionInfo &session, bool &use_jit)
+{
+  int ret = OB_SUCCESS;
+  use_jit = ObJITEnableMode::FORCE == session.get_jit_filter_mode();
+  return ret;
+}
+
 int ObSql::code_generate(
     ObSqlCtx &sql_ctx,
     ObResultSet &result,
@@ -3625,11 +3627,8 @@ int ObSql::code_generate(
       ret = OB_INVALID_ARGUMENT;
       LOG_WARN("Logical_plan or phy_plan is NULL", K(ret), K(stmt), K(logical_plan), K(phy_plan),
                "session", sql_ctx.session_info_);
-  //} else if (OB_FAIL(need_use_jit(sql_ctx.need_late_compile_,
-  //                                (stmt->get_stmt_hint().get_query_hint()).use_jit_policy_,
-  //                                *sql_ctx.session_info_,
-  //                                use_jit))) {
-  //  LOG_WARN("failed to check for needing jitted expr", K(ret));
+  } else if (OB_FAIL(need_use_jit(*sql_ctx.session_info_, use_jit))) {
+    LOG_WARN("failed to check for needing jitted expr", K(ret));
   } else {
     ObCodeGenerator code_generator(use_jit,
                                    result.get_exec_context().get_min_cluster_version(),
@@ -366,6 +366,9 @@ private:
                            share::schema::ObStmtNeedPrivs &stmt_need_privs,
                            ObLogPlan *logical_plan,
                            ObPhysicalPlan *&phy_plan);
+  // Filters are compiled only if ob_enable_jit is FORCE. AUTO means compiling the plans late
+  // compiled by the plan cache, which is still off, see get_jit_enabled_mode().
+  static int need_use_jit(const ObSQLSessionInfo &session, bool &use_jit);
 
   int prepare_outline_for_phy_plan(ObLogPlan *logical_plan,
                                    ObPhysicalPlan *phy_plan);
@@ -19,6 +19,7 @@
 #include "sql/rewrite/ob_transform_utils.h"
 #include "sql/engine/px/p2p_datahub/ob_p2p_dh_mgr.h"
 #include "sql/optimizer/ob_log_table_scan.h"
+#include "sql/engine/expr/ob_expr_vector.h"
 
 using namespace oceanbase::sql;
 using namespace oceanbase::common;
@@ -779,6 +780,16 @@ int ObLogSort::is_expr_in_pushdown_whitelist(ObRawExpr *expr, bool &in_pushdown_
         in_pushdown_whitelist = true;
         break;
       }
+      // blocks far from the query vector can be skipped by the vector bound skip index
+      case T_FUN_SYS_L2_DISTANCE:
+      case T_FUN_SYS_VECTOR_DISTANCE: {
+        if (OB_FAIL(is_vector_bound_prunable_distance(expr, in_pushdown_whitelist))) {
+          LOG_WARN("failed to check vector bound prunable distance", K(ret));
+        } else if (!in_pushdown_whitelist) {
+          OPT_TRACE("[TopN Filter] distance not prunable by vector bound skip index");
+        }
+        break;
+      }
       default: {
         in_pushdown_whitelist = false;
         OPT_TRACE("[TopN Filter] this expr can not be pushdown", int64_t(expr->get_expr_type()));
@@ -789,6 +800,57 @@ int ObLogSort::is_expr_in_pushdown_whitelist(ObRawExpr *expr, bool &in_pushdown_
   return ret;
 }
 
+int ObLogSort::is_vector_bound_prunable_distance(ObRawExpr *expr, bool &is_prunable)
+{
+  int ret = OB_SUCCESS;
+  const ObDMLStmt *stmt = nullptr;
+  ObSqlSchemaGuard *schema_guard = nullptr;
+  is_prunable = false;
+  if (OB_ISNULL(expr) || OB_ISNULL(get_plan())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected null", K(ret), KP(expr), KP(get_plan()));
+  } else if (OB_ISNULL(stmt = get_plan()->get_stmt())
+             || OB_ISNULL(schema_guard = get_plan()->get_optimizer_context().get_sql_schema_guard())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected null", K(ret), KP(stmt), KP(schema_guard));
+  } else if (expr->get_param_count() < 2
+             || (T_FUN_SYS_L2_DISTANCE == expr->get_expr_type() && 2 != expr->get_param_count())
+             || expr->get_param_count() > 3) {
+    // not a distance between two vectors
+  } else if (3 == expr->get_param_count()
+             && (OB_ISNULL(expr->get_param_expr(2))
+                 || T_INT != expr->get_param_expr(2)->get_expr_type()
+                 || ObExprVectorDistance::EUCLIDEAN
+                    != static_cast<ObConstRawExpr *>(expr->get_param_expr(2))->get_value().get_int())) {
+    // vector bound only bounds the euclidean distance
+  } else {
+    ObRawExpr *left = expr->get_param_expr(0);
+    ObRawExpr *right = expr->get_param_expr(1);
+    ObColumnRefRawExpr *col_expr = nullptr;
+    const TableItem *table_item = nullptr;
+    const ObColumnSchemaV2 *column_schema = nullptr;
+    if (OB_ISNULL(left) || OB_ISNULL(right)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected null param", K(ret), KP(left), KP(right));
+    } else if (left->is_column_ref_expr() && right->is_const_expr()) {
+      col_expr = static_cast<ObColumnRefRawExpr *>(left);
+    } else if (right->is_column_ref_expr() && left->is_const_expr()) {
+      col_expr = static_cast<ObColumnRefRawExpr *>(right);
+    }
+    if (OB_FAIL(ret) || nullptr == col_expr) {
+    } else if (OB_ISNULL(table_item = stmt->get_table_item_by_id(col_expr->get_table_id()))
+               || !table_item->is_basic_table()) {
+      // not a column of a base table
+    } else if (OB_FAIL(schema_guard->get_column_schema(table_item->ref_id_, col_expr->get_column_id(),
+                                                       column_schema))) {
+      LOG_WARN("failed to get column schema", K(ret), K(table_item->ref_id_), K(col_expr->get_column_id()));
+    } else if (OB_NOT_NULL(column_schema)) {
+      is_prunable = column_schema->get_skip_index_attr().has_vector_bound();
+    }
+  }
+  return ret;
+}
+
 int ObLogSort::check_use_child_ordering(bool &used, int64_t &inherit_child_ordering_index)
 {
   int ret = OB_SUCCESS;
@@ -161,6 +161,9 @@ private:
       common::ObSEArray<ObRawExpr *, 8, common::ModulePageAllocator, true> &candidate_sk_exprs);
   int check_expr_can_pushdown(ObRawExpr *expr, uint64_t &table_id, bool &can_push_down);
   int is_expr_in_pushdown_whitelist(ObRawExpr *expr, bool &in_pushdown_whitelist);
+  // euclidean distance between a column with the vector bound skip index and a const vector,
+  // the topn filter on other distances can not skip any block and only costs
+  int is_vector_bound_prunable_distance(ObRawExpr *expr, bool &is_prunable);
 private:
   OrderItem hash_sortkey_;
   common::ObSEArray<OrderItem, 8, common::ModulePageAllocator, true> sort_keys_;
@@ -22,6 +22,7 @@
 #include "share/stat/ob_dbms_stats_utils.h"
 #include "sql/optimizer/ob_access_path_estimation.h"
 #include "sql/optimizer/ob_sel_estimator.h"
+#include "sql/optimizer/ob_storage_estimator.h"
 using namespace oceanbase::common;
 using namespace oceanbase::share::schema;
 namespace oceanbase
@@ -435,7 +436,9 @@ int OptTableMeta::init_column_meta(const OptSelectivityCtx &ctx,
     for (int64_t i = 0; OB_SUCC(ret) && i < column_ids.count(); ++i) {
       ObGlobalColumnStat s;
       column_metas.at(i).set_default_meta(rows_);
-      if (OB_FAIL(col_stats.push_back(s))) {
+      if (OB_FAIL(estimate_ndv_by_skip_index(ctx, column_ids.at(i), column_metas.at(i)))) {
+        LOG_WARN("failed to estimate ndv by skip index", K(ret));
+      } else if (OB_FAIL(col_stats.push_back(s))) {
         LOG_WARN("failed to push back column id", K(ret));
       }
     }
@@ -478,6 +481,51 @@ int OptTableMeta::init_column_meta(const OptSelectivityCtx &ctx,
   return ret;
 }
 
+int OptTableMeta::estimate_ndv_by_skip_index(const OptSelectivityCtx &ctx,
+                                             const uint64_t column_id,
+                                             OptColumnMeta &col_meta)
+{
+  int ret = OB_SUCCESS;
+  const ObTableSchema *table_schema = NULL;
+  const ObColumnSchemaV2 *column_schema = NULL;
+  ObSqlSchemaGuard *schema_guard = ctx.get_opt_ctx().get_sql_schema_guard();
+  ObSEArray<share::ObLSID, 4> ls_ids;
+  ObSEArray<ObTabletID, 4> tablet_ids;
+  int64_t ndv = -1;
+  if (NULL == table_partition_info_ || NULL == schema_guard || NULL == ctx.get_session_info()) {
+    // do nothing
+  } else if (OB_FAIL(schema_guard->get_table_schema(table_id_, ref_table_id_, ctx.get_stmt(), table_schema))) {
+    LOG_WARN("failed to get table schema", K(ret), K(ref_table_id_));
+  } else if (NULL == table_schema
+             || NULL == (column_schema = table_schema->get_column_schema(column_id))
+             || !column_schema->get_skip_index_attr().has_hll()) {
+    // do nothing
+  } else {
+    const ObCandiTabletLocIArray &tablet_locs =
+        table_partition_info_->get_phy_tbl_location_info().get_phy_part_loc_info_list();
+    for (int64_t i = 0; OB_SUCC(ret) && i < tablet_locs.count(); ++i) {
+      const ObOptTabletLoc &tablet_loc = tablet_locs.at(i).get_partition_location();
+      if (OB_FAIL(ls_ids.push_back(tablet_loc.get_ls_id()))) {
+        LOG_WARN("failed to push back ls id", K(ret));
+      } else if (OB_FAIL(tablet_ids.push_back(tablet_loc.get_tablet_id()))) {
+        LOG_WARN("failed to push back tablet id", K(ret));
+      }
+    }
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(ObStorageEstimator::estimate_skip_index_ndv(
+                   ctx.get_session_info()->get_effective_tenant_id(), ref_table_id_, column_id,
+                   ls_ids, tablet_ids, ndv))) {
+      // the tablets may not be local, fall back to the default ndv
+      LOG_TRACE("failed to estimate ndv by skip index", K(ret), K(ref_table_id_), K(column_id));
+      ret = OB_SUCCESS;
+    } else if (ndv > 0) {
+      col_meta.set_ndv(std::min(rows_, static_cast<double>(ndv)));
+      LOG_TRACE("use skip index hll ndv", K(ref_table_id_), K(column_id), K(ndv), K(rows_));
+    }
+  }
+  return ret;
+}
+
 int OptTableMeta::refine_column_meta(const OptSelectivityCtx &ctx,
                                    const uint64_t column_id,
                                    const ObGlobalColumnStat &stat,
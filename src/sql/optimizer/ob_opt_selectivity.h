@@ -543,6 +543,11 @@ private:
                        const ObIArray<uint64_t> &column_ids,
                        ObIArray<OptColumnMeta> &column_metas);
 
+  // use the ndv merged from the hll skip index of the local major sstables if there is no stat
+  int estimate_ndv_by_skip_index(const OptSelectivityCtx &ctx,
+                                 const uint64_t column_id,
+                                 OptColumnMeta &col_meta);
+
   int refine_column_meta(const OptSelectivityCtx &ctx,
                          const uint64_t column_id,
                          const ObGlobalColumnStat &stat,
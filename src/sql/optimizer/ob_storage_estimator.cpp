@@ -18,6 +18,7 @@
 #include "ob_storage_estimator.h"
 #include "storage/tx_storage/ob_access_service.h"
 #include "storage/tx/ob_ts_mgr.h"
+#include "storage/blocksstable/index_block/ob_index_block_util.h"
 
 namespace oceanbase {
 using namespace storage;
@@ -223,6 +224,47 @@ int ObStorageEstimator::storage_estimate_block_count_and_row_count(
   return ret;
 }
 
+int ObStorageEstimator::estimate_skip_index_ndv(const uint64_t tenant_id,
+                                                const uint64_t table_id,
+                                                const uint64_t column_id,
+                                                const ObIArray<share::ObLSID> &ls_ids,
+                                                const ObIArray<ObTabletID> &tablet_ids,
+                                                int64_t &ndv)
+{
+  int ret = OB_SUCCESS;
+  blocksstable::ObSkipIndexHLL hll;
+  bool is_valid = !tablet_ids.empty();
+  ndv = -1;
+  if (OB_UNLIKELY(ls_ids.count() != tablet_ids.count())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("ls count not match tablet count", K(ret), K(ls_ids.count()), K(tablet_ids.count()));
+  } else {
+    MTL_SWITCH(tenant_id) {
+      ObAccessService *access_service = NULL;
+      if (OB_ISNULL(access_service = MTL(ObAccessService *))) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("get unexpected null", K(ret), K(access_service));
+      }
+      for (int64_t i = 0; OB_SUCC(ret) && is_valid && i < tablet_ids.count(); ++i) {
+        if (OB_FAIL(access_service->estimate_skip_index_ndv(ls_ids.at(i),
+                                                            table_id,
+                                                            tablet_ids.at(i),
+                                                            column_id,
+                                                            hll,
+                                                            is_valid))) {
+          LOG_WARN("OPT:[STORAGE EST SKIP INDEX NDV FAILED]", "storage_ret", ret,
+                   K(ls_ids.at(i)), K(tablet_ids.at(i)));
+        }
+      }
+    }
+  }
+  if (OB_SUCC(ret) && is_valid) {
+    ndv = hll.estimate();
+  }
+  LOG_TRACE("OPT:storage estimate skip index ndv", K(ret), K(table_id), K(column_id), K(ndv));
+  return ret;
+}
+
 int ObStorageEstimator::storage_estimate_skip_rate(
     const obrpc::ObEstSkipRateArgElement &arg,
     obrpc::ObEstSkipRateResElement &res)
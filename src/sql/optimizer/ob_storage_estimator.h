@@ -24,6 +24,9 @@ namespace common {
 struct ObSimpleBatch;
 struct ObEstRowCountRecord;
 }
+namespace share {
+class ObLSID;
+}
 namespace storage {
 class ObIPartitionGroupGuard;
 class ObTableScanParam;
@@ -48,6 +51,14 @@ public:
   static int estimate_block_count_and_row_count(const obrpc::ObEstBlockArg &arg,
                                                 obrpc::ObEstBlockRes &res);
   static int estimate_skip_rate(const obrpc::ObEstSkipRateArg &arg, obrpc::ObEstSkipRateRes &res);
+  // merge the hll skip index of the column over the tablets and estimate the ndv,
+  // %ndv is -1 if some tablet has no hll for the column
+  static int estimate_skip_index_ndv(const uint64_t tenant_id,
+                                     const uint64_t table_id,
+                                     const uint64_t column_id,
+                                     const ObIArray<share::ObLSID> &ls_ids,
+                                     const ObIArray<ObTabletID> &tablet_ids,
+                                     int64_t &ndv);
 private:
 
   // compute memtable whole range row counts
@@ -1175,6 +1175,10 @@ static const NonReservedKeyword Mysql_none_reserved_keywords[] =
   {"INCONSISTENT", INCONSISTENT},
   {"INDIVIDUAL", INDIVIDUAL},
   {"hybrid_search", HYBRID_SEARCH},
+  {"ngram_bloom_filter", NGRAM_BLOOM_FILTER},
+  {"hll", HLL},
+  {"vector_bound", VECTOR_BOUND},
+  {"bloom_filter", BLOOM_FILTER},
 };
 
 /** https://dev.mysql.com/doc/refman/5.7/en/sql-syntax-prepared-statements.html
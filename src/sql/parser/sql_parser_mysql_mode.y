@@ -304,7 +304,7 @@ END_P SET_VAR DELIMITER
         GENERAL GEOMETRY GEOMCOLLECTION GEOMETRYCOLLECTION GET_FORMAT GLOBAL GRANTS GRANULARITY GROUP_CONCAT GROUPING GTS
         GLOBAL_NAME GLOBAL_ALIAS
 
-        HANDLER HASH HEAP HELP HISTOGRAM HOST HOSTS HOT_RETENTION HOUR HIDDEN HYBRID HYBRID_HIST HYBRID_SEARCH
+        HANDLER HASH HEAP HELP HISTOGRAM HLL HOST HOSTS HOT_RETENTION HOUR HIDDEN HYBRID HYBRID_HIST HYBRID_SEARCH
 
         ID IDC IDENTIFIED IGNORE_SERVER_IDS IK_MODE ILOG IMMEDIATE IMPORT INCLUDING INCR INDEXES INDEX_TABLE_ID INFO INITIAL_SIZE
         INNODB INSERT_METHOD INSTALL INSTANCE INVOKER IO IOPS_WEIGHT IO_THREAD IPC ISOLATE ISOLATION ISSUER
@@ -328,7 +328,7 @@ END_P SET_VAR DELIMITER
         MULTILINESTRING MULTIPOINT MULTIPOLYGON MULTIVALUE MUTEX MYSQL_ERRNO MIGRATION MAX_USED_PART_ID MAXIMIZE
         MATERIALIZED MEMBER MEMSTORE_PERCENT MINVALUE MY_NAME MERGE_ENGINE
 
-        NAME NAMES NAMESPACE NATIONAL NCHAR NDB NDBCLUSTER NESTED NEW NEXT NO NOAUDIT NODEGROUP NONE NORMAL NOW NOWAIT NEVER NGRAM_TOKEN_SIZE
+        NAME NAMES NAMESPACE NATIONAL NCHAR NDB NDBCLUSTER NESTED NEW NEXT NO NOAUDIT NODEGROUP NONE NORMAL NOW NOWAIT NEVER NGRAM_TOKEN_SIZE NGRAM_BLOOM_FILTER
         NOMINVALUE NOMAXVALUE NOORDER NOCYCLE NOCACHE NO_WAIT NULLS NUMBER NVARCHAR NTILE NTH_VALUE NOARCHIVELOG NETWORK NET_BANDWIDTH_WEIGHT NOPARALLEL
         NULL_IF_EXETERNAL
 
@@ -374,7 +374,7 @@ END_P SET_VAR DELIMITER
         UNUSUAL UPGRADE URL USE_BLOOM_FILTER UNKNOWN USE_FRM USER USER_RESOURCES UNBOUNDED UP UNLIMITED USER_SPECIFIED
 
         VALID VALUE VARIANCE VARIABLES VERBOSE VERIFY VIEW VISIBLE VIRTUAL_COLUMN_ID VALIDATE VAR_POP
-        VAR_SAMP VALIDATION VECTOR VECTOR_DISTANCE MICRO_INDEX_CLUSTERED VECTOR_SIMILARITY
+        VAR_SAMP VALIDATION VECTOR VECTOR_BOUND VECTOR_DISTANCE MICRO_INDEX_CLUSTERED VECTOR_SIMILARITY
 
         WAIT WARNINGS WASH WEEK WEIGHT_STRING WHENEVER WORK WRAPPER WINDOW WEAK WITH_COLUMN_GROUP WITHOUT
 
@@ -24815,6 +24815,22 @@ MIN_MAX
 {
   malloc_terminal_node($$, result->malloc_pool_, T_COL_SKIP_INDEX_SUM)
 }
+| NGRAM_BLOOM_FILTER
+{
+  malloc_terminal_node($$, result->malloc_pool_, T_COL_SKIP_INDEX_NGRAM_BLOOM_FILTER);
+}
+| HLL
+{
+  malloc_terminal_node($$, result->malloc_pool_, T_COL_SKIP_INDEX_HLL);
+}
+| VECTOR_BOUND
+{
+  malloc_terminal_node($$, result->malloc_pool_, T_COL_SKIP_INDEX_VECTOR_BOUND);
+}
+| BLOOM_FILTER
+{
+  malloc_terminal_node($$, result->malloc_pool_, T_COL_SKIP_INDEX_BLOOM_FILTER);
+}
 ;
 
 lob_chunk_size:
@@ -25348,6 +25364,7 @@ ACCESS_INFO
 |       HEAP
 |       HELP
 |       HISTOGRAM
+|       HLL
 |       HOST
 |       HOSTS
 |       HOUR
@@ -25517,6 +25534,7 @@ ACCESS_INFO
 |       NEW
 |       NEVER
 |       NEXT
+|       NGRAM_BLOOM_FILTER
 |       NGRAM_TOKEN_SIZE
 |       NO
 |       NOARCHIVELOG
@@ -25878,6 +25896,7 @@ ACCESS_INFO
 |       VAR_SAMP
 |       VERBOSE
 |       VECTOR
+|       VECTOR_BOUND
 |       VECTOR_DISTANCE
 |       VECTOR_SIMILARITY
 |       VIRTUAL_COLUMN_ID
@@ -11783,9 +11783,15 @@ int ObDDLResolver::resolve_column_skip_index(
   int ret = OB_SUCCESS;
   const ParseNode *type_list_node = nullptr;
   ObSkipIndexColumnAttr skip_index_column_attr;
+  uint64_t tenant_data_version = 0;
   if (OB_UNLIKELY(1 != skip_index_node.num_child_ || T_COL_SKIP_INDEX != skip_index_node.type_)) {
     ret = OB_INVALID_ARGUMENT;
     LOG_WARN("invalid skip index node", K(ret), K(skip_index_node.num_child_), K(skip_index_node.type_));
+  } else if (OB_ISNULL(session_info_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected null session info", K(ret));
+  } else if (OB_FAIL(GET_MIN_DATA_VERSION(session_info_->get_effective_tenant_id(), tenant_data_version))) {
+    LOG_WARN("get tenant data version failed", K(ret));
   } else {
     if (OB_ISNULL(type_list_node = skip_index_node.children_[0])) {
       // empty specified type list, e.g:
@@ -11795,7 +11801,8 @@ int ObDDLResolver::resolve_column_skip_index(
       ret = OB_ERR_UNEXPECTED;
       LOG_WARN("unexpected invalid type list node", K(ret),
           K(type_list_node->num_child_), K(type_list_node->type_));
-    } else if (is_skip_index_black_list_type(column_schema.get_data_type())) {
+    } else if (is_skip_index_black_list_type(column_schema.get_data_type())
+               && !can_agg_vector_bound(column_schema.get_data_type())) {
       ret = OB_NOT_SUPPORTED;
       LOG_USER_ERROR(OB_NOT_SUPPORTED, "build skip index on invalid type");
       LOG_WARN("not supported skip index on column with invalid column type", K(ret), K(column_schema));
@@ -11810,6 +11817,16 @@ int ObDDLResolver::resolve_column_skip_index(
         if (OB_ISNULL(type_node)) {
           ret = OB_ERR_UNEXPECTED;
           LOG_WARN("unexpected null skip index type node", K(ret), KP(type_node));
+        } else if ((T_COL_SKIP_INDEX_NGRAM_BLOOM_FILTER == type_node->type_
+                    || T_COL_SKIP_INDEX_HLL == type_node->type_
+                    || T_COL_SKIP_INDEX_VECTOR_BOUND == type_node->type_
+                    || T_COL_SKIP_INDEX_BLOOM_FILTER == type_node->type_)
+                   && tenant_data_version < DATA_VERSION_1_1_0_0) {
+          // older observers can not read these skip index types
+          ret = OB_NOT_SUPPORTED;
+          LOG_WARN("skip index type not supported before data version 1.1.0.0", K(ret),
+              K(type_node->type_), K(tenant_data_version));
+          LOG_USER_ERROR(OB_NOT_SUPPORTED, "tenant data version is less than 1.1.0.0, ngram bloom filter, hll, vector bound or bloom filter skip index");
         } else {
           switch (type_node->type_) {
           case T_COL_SKIP_INDEX_MIN_MAX: {
@@ -11820,6 +11837,28 @@ int ObDDLResolver::resolve_column_skip_index(
             skip_index_column_attr.set_sum();
             break;
           }
+          case T_COL_SKIP_INDEX_NGRAM_BLOOM_FILTER: {
+            skip_index_column_attr.set_ngram_bloom_filter();
+            break;
+          }
+          case T_COL_SKIP_INDEX_HLL: {
+            skip_index_column_attr.set_hll();
+            break;
+          }
+          case T_COL_SKIP_INDEX_VECTOR_BOUND: {
+            if (!can_agg_vector_bound(column_schema.get_data_type(), column_schema.get_extended_type_info())) {
+              ret = OB_NOT_SUPPORTED;
+              LOG_USER_ERROR(OB_NOT_SUPPORTED, "build vector bound skip index on column not in float vector type");
+              LOG_WARN("not supported vector bound skip index on column", K(ret), K(column_schema));
+            } else {
+              skip_index_column_attr.set_vector_bound();
+            }
+            break;
+          }
+          case T_COL_SKIP_INDEX_BLOOM_FILTER: {
+            skip_index_column_attr.set_bloom_filter();
+            break;
+          }
           default: {
             ret = OB_NOT_SUPPORTED;
             LOG_WARN("invalid skip index type", K(ret), K(i), K(type_node->type_));
@@ -11831,7 +11870,14 @@ int ObDDLResolver::resolve_column_skip_index(
       }
     }
 
-    if (OB_SUCC(ret)) {
+    if (OB_FAIL(ret)) {
+    } else if (is_skip_index_black_list_type(column_schema.get_data_type())
+               && skip_index_column_attr.has_skip_index()
+               && !skip_index_column_attr.is_vector_bound_only()) {
+      ret = OB_NOT_SUPPORTED;
+      LOG_USER_ERROR(OB_NOT_SUPPORTED, "build skip index other than vector bound on vector column");
+      LOG_WARN("not supported skip index on vector column", K(ret), K(skip_index_column_attr), K(column_schema));
+    } else {
       column_schema.set_skip_index_attr(skip_index_column_attr.get_packed_value());
     }
   }
@@ -1349,6 +1349,9 @@ public:
     jit_mode = ObJITEnableMode::OFF;
     return common::OB_SUCCESS;
   }
+  // ob_enable_jit for the filter kernels, plan cache late compilation stays off with
+  // get_jit_enabled_mode()
+  ObJITEnableMode get_jit_filter_mode() const { return sys_vars_cache_.get_ob_enable_jit(); }
 
   bool get_enable_exact_mode() const
   {
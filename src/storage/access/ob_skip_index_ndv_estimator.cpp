@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "ob_skip_index_ndv_estimator.h"
+
+namespace oceanbase
+{
+namespace storage
+{
+using namespace blocksstable;
+
+int ObSkipIndexNdvEstimator::init(const ObSSTable &sstable,
+                                  const ObTableSchema &schema,
+                                  const ObITableReadInfo *read_info,
+                                  const int64_t column_id)
+{
+  int ret = OB_SUCCESS;
+  ObSSTableMetaHandle sstable_meta_handle;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("Double init for skip index ndv estimator", KR(ret));
+  } else if (OB_UNLIKELY(!sstable.is_valid() || !sstable.is_major_sstable() || sstable.is_cg_sstable()
+                         || !schema.is_valid() || OB_ISNULL(read_info)
+                         || schema.get_column_idx(column_id) < 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument", KR(ret), K(sstable), K(schema), K(column_id));
+  } else if (OB_FAIL(sstable.get_meta(sstable_meta_handle))) {
+    LOG_WARN("Fail to get sstable meta handle", KR(ret));
+  } else if (OB_FALSE_IT(micro_block_count_
+                         = sstable_meta_handle.get_sstable_meta().get_data_micro_block_count())) {
+  } else if (micro_block_count_ > 0 && OB_FAIL(tree_cursor_.init(sstable, allocator_, read_info))) {
+    LOG_WARN("Fail to init tree cursor", KR(ret));
+  } else if (OB_FAIL(init_col_idx_in_storage(schema, column_id))) {
+    LOG_WARN("Fail to to init col_idx_in_storage", KR(ret), K(schema), K(column_id));
+  } else {
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+void ObSkipIndexNdvEstimator::reset()
+{
+  is_inited_ = false;
+  micro_block_count_ = 0;
+  col_idx_in_storage_ = -1;
+  tree_cursor_.reset();
+  allocator_.reset();
+}
+
+int ObSkipIndexNdvEstimator::init_col_idx_in_storage(const ObTableSchema &schema,
+                                                     const int64_t column_id)
+{
+  int ret = OB_SUCCESS;
+  // the storage order of the skip index is the same as that of mvcc_col_desc
+  common::ObSEArray<ObColDesc, 32> cols_desc;
+  if (OB_FAIL(schema.get_multi_version_column_descs(cols_desc))) {
+    LOG_WARN("Fail to to get cols_desc", KR(ret));
+  } else {
+    col_idx_in_storage_ = -1;
+    for (int64_t i = 0; i < cols_desc.count(); i++) {
+      if (cols_desc.at(i).col_id_ == column_id) {
+        col_idx_in_storage_ = i;
+        break;
+      }
+    }
+    if (OB_UNLIKELY(col_idx_in_storage_ < 0)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("Fail to calc col_idx_in_storage", KR(ret), K(cols_desc), K(column_id));
+    }
+  }
+  return ret;
+}
+
+int ObSkipIndexNdvEstimator::merge_hll(ObSkipIndexHLL &hll, bool &is_valid)
+{
+  int ret = OB_SUCCESS;
+  bool is_beyond_range = false;
+  is_valid = true;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not init", KR(ret));
+  } else if (0 == micro_block_count_) {
+    // empty sstable, nothing to merge
+  } else if (OB_FAIL(tree_cursor_.drill_down(ObDatumRowkey::MIN_ROWKEY,
+                                             ObIndexBlockTreeCursor::MACRO,
+                                             is_beyond_range))) {
+    LOG_WARN("Fail to drill down to macro level", KR(ret));
+  } else if (OB_UNLIKELY(is_beyond_range)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Fail to drill down to macro level", KR(ret));
+  } else {
+    int64_t macro_cnt = 0;
+    while (OB_SUCC(ret) && is_valid) {
+      if (OB_FAIL(read_macro_hll(hll, is_valid))) {
+        LOG_WARN("Fail to read hll of macro block", KR(ret), K(macro_cnt));
+      } else if (FALSE_IT(++macro_cnt)) {
+      } else {
+        ret = tree_cursor_.move_forward(false /* is_reverse_scan */);
+      }
+    }
+    if (OB_SUCC(ret) || OB_ITER_END == ret) {
+      ret = OB_SUCCESS;
+      tree_cursor_.reset();
+      LOG_DEBUG("Merge hll skip index", K(is_valid), K(macro_cnt), K(hll));
+    } else {
+      LOG_WARN("Fail to merge hll skip index", KR(ret), K(macro_cnt));
+    }
+  }
+  return ret;
+}
+
+int ObSkipIndexNdvEstimator::read_macro_hll(ObSkipIndexHLL &hll, bool &is_valid)
+{
+  int ret = OB_SUCCESS;
+  const ObSkipIndexColMeta hll_meta(col_idx_in_storage_, ObSkipIndexColType::SK_IDX_HLL);
+  const ObIndexBlockRowHeader *idx_row_header = nullptr;
+  const ObIndexBlockRowParser *idx_row_parser = nullptr;
+  const char *agg_row_buf = nullptr;
+  int64_t agg_row_size = 0;
+  ObAggRowReader reader;
+  ObStorageDatum hll_datum;
+  ObSkipIndexHLL macro_hll;
+  if (OB_FAIL(tree_cursor_.get_idx_row_header(idx_row_header))) {
+    LOG_WARN("Fail to get index row header", KR(ret));
+  } else if (OB_ISNULL(idx_row_header)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected null index row header", KR(ret));
+  } else if (!idx_row_header->is_pre_aggregated()) {
+    is_valid = false;
+  } else if (OB_FAIL(tree_cursor_.get_idx_parser(idx_row_parser))) {
+    LOG_WARN("Fail to get index row parser", KR(ret));
+  } else if (OB_FAIL(idx_row_parser->get_agg_row(agg_row_buf, agg_row_size))) {
+    LOG_WARN("Fail to get agg row", KR(ret));
+  } else if (OB_FAIL(reader.init(agg_row_buf, agg_row_size))) {
+    LOG_WARN("Fail to init agg row reader", KR(ret));
+  } else if (OB_FAIL(reader.read(hll_meta, hll_datum))) {
+    LOG_WARN("Fail to read skip index hll", KR(ret));
+  } else if (hll_datum.is_null() || hll_datum.is_nop()) {
+    is_valid = false;
+  } else if (OB_FAIL(macro_hll.from_datum(hll_datum))) {
+    LOG_WARN("Fail to read hll", KR(ret), K(hll_datum));
+  } else {
+    hll.merge(macro_hll);
+  }
+  return ret;
+}
+
+}; // namespace storage
+}; // namespace oceanbase
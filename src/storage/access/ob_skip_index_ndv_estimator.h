@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OB_SKIP_INDEX_NDV_ESTIMATOR_H_
+#define OB_SKIP_INDEX_NDV_ESTIMATOR_H_
+
+#include "storage/blocksstable/index_block/ob_index_block_tree_cursor.h"
+#include "storage/blocksstable/ob_sstable.h"
+
+namespace oceanbase
+{
+namespace storage
+{
+
+// Merges the hll skip index of a column over the macro blocks of a major sstable,
+// the macro level agg rows already merge the hll of their micro blocks.
+class ObSkipIndexNdvEstimator
+{
+public:
+  ObSkipIndexNdvEstimator()
+      : micro_block_count_(0), col_idx_in_storage_(-1), is_inited_(false)
+  {
+  }
+
+  ~ObSkipIndexNdvEstimator() { reset(); }
+
+  /**
+   * @param sstable The row store major sstable
+   * @param schema The schema of the table used to get column index in storage
+   * @param read_info used for tree_cursor
+   * @param column_id Which column to estimate the ndv
+   *
+   * @return OB_SUCCESS if init success
+   */
+  int init(const blocksstable::ObSSTable &sstable,
+           const ObTableSchema &schema,
+           const ObITableReadInfo *read_info,
+           const int64_t column_id);
+
+  /**
+   * @brief merge the hll of all macro blocks into %hll
+   *
+   * @param[out] is_valid false if some macro block does not carry the hll, e.g. reused from
+   *             the sstable before the skip index is added, %hll should not be used then
+   */
+  int merge_hll(blocksstable::ObSkipIndexHLL &hll, bool &is_valid);
+
+  void reset();
+
+private:
+  int init_col_idx_in_storage(const ObTableSchema &schema, const int64_t column_id);
+  int read_macro_hll(blocksstable::ObSkipIndexHLL &hll, bool &is_valid);
+
+private:
+  ObArenaAllocator allocator_;
+  int64_t micro_block_count_;
+  // the column index in storage, mvcc columns considered
+  int64_t col_idx_in_storage_;
+  blocksstable::ObIndexBlockTreeCursor tree_cursor_;
+  bool is_inited_;
+};
+
+}; // namespace storage
+}; // namespace oceanbase
+
+#endif /* OB_SKIP_INDEX_NDV_ESTIMATOR_H_ */
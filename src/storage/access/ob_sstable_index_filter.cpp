@@ -164,7 +164,10 @@ int ObSSTableIndexFilter::extract_skipping_filter_from_tree(
 {
   int ret = OB_SUCCESS;
   sql::ObPhysicalFilterExecutor &physical_filter = static_cast<sql::ObPhysicalFilterExecutor &>(filter);
-  if (physical_filter.is_filter_white_node() || static_cast<sql::ObBlackFilterExecutor &>(physical_filter).is_monotonic()) {
+  if (physical_filter.is_filter_white_node()
+      || static_cast<sql::ObBlackFilterExecutor &>(physical_filter).is_monotonic()
+      || ObSSTableIndexFilterExtracter::is_like_filter(physical_filter)
+      || ObSSTableIndexFilterExtracter::is_vector_distance_filter(physical_filter)) {
     IndexList index_list;
     if (OB_FAIL(find_skipping_index(read_info, physical_filter, index_list))) {
       LOG_WARN("Fail to find useful skipping index", K(ret));
@@ -207,8 +210,18 @@ int ObSSTableIndexFilter::find_skipping_index(
       ret = OB_ERR_UNEXPECTED;
       LOG_WARN("Unexpected column meta", K(column_id), K(index), KPC(read_info));
     } else {
-      const bool has_min_max = column_extend->at(index).skip_index_attr_.has_min_max();
-      if (has_min_max && OB_FAIL(index_list.push_back(blocksstable::ObSkipIndexType::MIN_MAX))) {
+      // min max goes first, bloom filters only tighten the result of it to always false
+      const share::schema::ObSkipIndexColumnAttr &skip_index_attr = column_extend->at(index).skip_index_attr_;
+      if (skip_index_attr.has_min_max() && OB_FAIL(index_list.push_back(blocksstable::ObSkipIndexType::MIN_MAX))) {
+        LOG_WARN("Fail to push back skip index type", K(ret));
+      } else if (skip_index_attr.has_ngram_bloom_filter()
+          && OB_FAIL(index_list.push_back(blocksstable::ObSkipIndexType::NGRAM_BLOOM_FILTER))) {
+        LOG_WARN("Fail to push back skip index type", K(ret));
+      } else if (skip_index_attr.has_vector_bound()
+          && OB_FAIL(index_list.push_back(blocksstable::ObSkipIndexType::VECTOR_BOUND))) {
+        LOG_WARN("Fail to push back skip index type", K(ret));
+      } else if (skip_index_attr.has_bloom_filter()
+          && OB_FAIL(index_list.push_back(blocksstable::ObSkipIndexType::BLOOM_FILTER))) {
         LOG_WARN("Fail to push back skip index type", K(ret));
       }
     }
@@ -288,7 +301,25 @@ int ObSSTableIndexFilterExtracter::extract_skipping_filter(
   int ret = OB_SUCCESS;
   switch (skip_index_type) {
     case blocksstable::ObSkipIndexType::MIN_MAX:
-      node.skip_index_type_ = blocksstable::ObSkipIndexType::MIN_MAX;
+      if (filter.is_filter_white_node()
+          || static_cast<const sql::ObBlackFilterExecutor &>(filter).is_monotonic()) {
+        node.skip_index_type_ = blocksstable::ObSkipIndexType::MIN_MAX;
+      }
+      break;
+    case blocksstable::ObSkipIndexType::NGRAM_BLOOM_FILTER:
+      if (is_like_filter(filter)) {
+        node.skip_index_type_ = blocksstable::ObSkipIndexType::NGRAM_BLOOM_FILTER;
+      }
+      break;
+    case blocksstable::ObSkipIndexType::VECTOR_BOUND:
+      if (is_vector_distance_filter(filter)) {
+        node.skip_index_type_ = blocksstable::ObSkipIndexType::VECTOR_BOUND;
+      }
+      break;
+    case blocksstable::ObSkipIndexType::BLOOM_FILTER:
+      if (is_bloom_filter_probe(filter)) {
+        node.skip_index_type_ = blocksstable::ObSkipIndexType::BLOOM_FILTER;
+      }
       break;
     default:
       // There are more skipping index types in the future.
@@ -298,5 +329,64 @@ int ObSSTableIndexFilterExtracter::extract_skipping_filter(
   return ret;
 }
 
+bool ObSSTableIndexFilterExtracter::is_bloom_filter_probe(const sql::ObPhysicalFilterExecutor &filter)
+{
+  bool bool_ret = false;
+  if (filter.is_filter_white_node() && !filter.is_filter_dynamic_node() && !filter.is_semistruct_filter_node()) {
+    const sql::ObWhiteFilterExecutor &white_filter = static_cast<const sql::ObWhiteFilterExecutor &>(filter);
+    const sql::ObExpr *expr = white_filter.get_filter_node().expr_;
+    const sql::ObWhiteFilterOperatorType op_type = white_filter.get_op_type();
+    if (OB_ISNULL(expr) || 2 != expr->arg_cnt_) {
+    } else if (sql::WHITE_OP_EQ == op_type) {
+      const int64_t col_arg_idx = T_REF_COLUMN == expr->args_[0]->type_ ? 0 : 1;
+      const ObObjMeta &col_meta = expr->args_[col_arg_idx]->obj_meta_;
+      const ObObjMeta &param_meta = expr->args_[1 - col_arg_idx]->obj_meta_;
+      bool_ret = T_REF_COLUMN == expr->args_[col_arg_idx]->type_
+          && blocksstable::can_agg_value_hash(col_meta.get_type())
+          && col_meta.get_type() == param_meta.get_type()
+          && col_meta.get_collation_type() == param_meta.get_collation_type();
+    } else if (sql::WHITE_OP_IN == op_type) {
+      const ObObjMeta &col_meta = expr->args_[0]->obj_meta_;
+      const sql::ObExpr *param_list = expr->args_[1];
+      bool_ret = T_REF_COLUMN == expr->args_[0]->type_
+          && blocksstable::can_agg_value_hash(col_meta.get_type())
+          && nullptr != param_list;
+      for (int64_t i = 0; bool_ret && i < param_list->arg_cnt_; ++i) {
+        const ObObjMeta &param_meta = param_list->args_[i]->obj_meta_;
+        bool_ret = col_meta.get_type() == param_meta.get_type()
+            && col_meta.get_collation_type() == param_meta.get_collation_type();
+      }
+    }
+  }
+  return bool_ret;
+}
+
+bool ObSSTableIndexFilterExtracter::is_like_filter(const sql::ObPhysicalFilterExecutor &filter)
+{
+  bool bool_ret = false;
+  if (filter.is_filter_black_node()) {
+    const sql::ObBlackFilterExecutor &black_filter = static_cast<const sql::ObBlackFilterExecutor &>(filter);
+    const sql::ObPushdownBlackFilterNode &filter_node = black_filter.get_filter_node();
+    const sql::ObExpr *expr = 1 == filter_node.filter_exprs_.count() ? filter_node.filter_exprs_.at(0) : nullptr;
+    bool_ret = 1 == filter_node.col_ids_.count()
+        && nullptr != expr
+        && T_OP_LIKE == expr->type_
+        && 3 == expr->arg_cnt_
+        && T_REF_COLUMN == expr->args_[0]->type_
+        && blocksstable::can_agg_ngram_bloom_filter(expr->args_[0]->obj_meta_.get_type(),
+                                                    expr->args_[0]->obj_meta_.get_collation_type())
+        && expr->args_[0]->obj_meta_.get_collation_type() == expr->args_[1]->obj_meta_.get_collation_type()
+        && expr->args_[1]->is_const_expr()
+        && expr->args_[2]->is_const_expr();
+  }
+  return bool_ret;
+}
+
+bool ObSSTableIndexFilterExtracter::is_vector_distance_filter(const sql::ObPhysicalFilterExecutor &filter)
+{
+  blocksstable::ObVectorDistanceFilterInfo info;
+  return blocksstable::ObSkipIndexFilterExecutor::extract_vector_distance_filter(filter, info);
+}
+
 } // namespace storage
 } // namespace oceanbase
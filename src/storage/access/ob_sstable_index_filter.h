@@ -139,6 +139,13 @@ public:
       const sql::ObPhysicalFilterExecutor &filter,
       const blocksstable::ObSkipIndexType skip_index_type,
       ObSkippingFilterNode &node);
+  // column = const or column in (const, ...) with consts of the same type and collation as the column
+  static bool is_bloom_filter_probe(const sql::ObPhysicalFilterExecutor &filter);
+  // column like const pattern
+  static bool is_like_filter(const sql::ObPhysicalFilterExecutor &filter);
+  // l2 distance between a vector column and a const vector compared with a const, or ordered by
+  // a topn filter
+  static bool is_vector_distance_filter(const sql::ObPhysicalFilterExecutor &filter);
 };
 } // namespace storage
 } // namespace oceanbase
@@ -37,10 +37,11 @@ const bool ObCSEncodingOpt::STREAM_ENCODINGS_DEFAULT[ObIntegerStream::EncodingTy
        true,  // DELTA_ZIGZAG_PFOR
        true,  // SIMD_FIXEDPFOR
        true,  // UNIVERSAL_COMPRESS
-       true  // XOR_FIXED_PFOR
+       true,  // XOR_FIXED_PFOR
+       true  // ALP_FIXED_PFOR
       };
 const bool ObCSEncodingOpt::STREAM_ENCODINGS_NONE[ObIntegerStream::EncodingType::MAX_TYPE]
-    = {false, false, false, false, false, false, false, false, false};
+    = {false, false, false, false, false, false, false, false, false, false};
 
 int ObPreviousCSEncoding::init(const int32_t col_count)
 {
@@ -71,6 +71,17 @@ public:
     return sc == ObLobSC || sc == ObJsonSC || sc == ObGeometrySC || ObRoaringBitmapSC == sc;
   }
 
+  // float and double are stored as uint, return the byte size of the floating point value
+  static OB_INLINE uint8_t get_float_value_size(const ObObjType type)
+  {
+    uint8_t size = 0;
+    if (ob_is_float_tc(type)) {
+      size = sizeof(float);
+    } else if (ob_is_double_tc(type)) {
+      size = sizeof(double);
+    }
+    return size;
+  }
   static int build_cs_column_encoding_ctx(const ObObjTypeStoreClass store_class,
                                           const int64_t type_store_size,
                                           ObColumnCSEncodingCtx &ctx);
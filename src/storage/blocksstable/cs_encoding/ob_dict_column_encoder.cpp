@@ -119,7 +119,8 @@ int ObDictColumnEncoder::build_ref_encoder_ctx_()
           false/*not monotonic*/,
           &ctx_->encoding_ctx_->cs_encoding_opt_,
           pre_col_encoding,
-          ref_stream_idx, ctx_->encoding_ctx_->compressor_type_, ctx_->allocator_))) {
+          ref_stream_idx, ctx_->encoding_ctx_->compressor_type_,
+          ctx_->encoding_ctx_->major_working_cluster_version_, ctx_->allocator_))) {
         LOG_WARN("fail to build_stream_encoder_info", K(ret));
       }
     }
@@ -104,9 +104,11 @@ int ObIntDictColumnEncoder::build_integer_dict_encoder_ctx_()
         is_monotonic_inc_integer_dict_,
         &ctx_->encoding_ctx_->cs_encoding_opt_,
         pre_col_encoding,
-        0/*stream_idx*/, ctx_->encoding_ctx_->compressor_type_, ctx_->allocator_))) {
+        0/*stream_idx*/, ctx_->encoding_ctx_->compressor_type_,
+        ctx_->encoding_ctx_->major_working_cluster_version_, ctx_->allocator_))) {
       LOG_WARN("fail to build_stream_encoder_info", K(ret));
     } else {
+      integer_dict_enc_ctx_.info_.float_value_size_ = ObCSEncodingUtil::get_float_value_size(column_type_.get_type());
       ++int_stream_count_;
     }
   }
@@ -120,8 +120,11 @@ int ObIntegerColumnEncoder::do_init_()
         false/*not monotonic*/,
         &ctx_->encoding_ctx_->cs_encoding_opt_,
         pre_col_encoding,
-        0/*stream_idx*/, ctx_->encoding_ctx_->compressor_type_, ctx_->allocator_))) {
+        0/*stream_idx*/, ctx_->encoding_ctx_->compressor_type_,
+        ctx_->encoding_ctx_->major_working_cluster_version_, ctx_->allocator_))) {
       LOG_WARN("fail to build_stream_encoder_info", K(ret));
+    } else {
+      enc_ctx_.info_.float_value_size_ = ObCSEncodingUtil::get_float_value_size(column_type_.get_type());
     }
   }
 
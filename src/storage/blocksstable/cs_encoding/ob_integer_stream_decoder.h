@@ -27,6 +27,7 @@
 #include "lib/codec/ob_double_delta_zigzag_pfor.h"
 #include "lib/codec/ob_universal_compression.h"
 #include "lib/codec/ob_xor_fixed_pfor.h"
+#include "lib/codec/ob_alp_fixed_pfor.h"
 #include "lib/codec/ob_tiered_codec.h"
 #include "sql/engine/basic/ob_pushdown_filter.h"
 #include "storage/blocksstable/encoding/ob_encoding_query_util.h"
@@ -217,6 +218,14 @@ private:
         }
         break;
       }
+      case ObIntegerStream::EncodingType::ALP_FIXED_PFOR : {
+        ObAlpFixedPfor codec;
+        codec.set_base_value(ctx.meta_.is_use_base() ? ctx.meta_.base_value_ : 0);
+        if (OB_FAIL((do_decode<T>(codec, data, ctx, int_arr)))) {
+          STORAGE_LOG(WARN,"fail to do alp fixed pfor decode", KR(ret), K(ctx));
+        }
+        break;
+      }
       default : {
         ret = OB_ERR_UNEXPECTED;
         STORAGE_LOG(WARN,"unexpected encoding type", KR(ret), K(ctx));
@@ -18,6 +18,7 @@
 #define OCEANBASE_INTEGER_STREAM_ENCODER_H_
 
 #include "share/ob_define.h"
+#include "common/ob_version_def.h"
 #include "storage/blocksstable/ob_data_buffer.h"
 #include "storage/blocksstable/encoding/ob_encoding_util.h"
 #include "storage/blocksstable/cs_encoding/ob_column_datum_iter.h"
@@ -29,6 +30,7 @@
 #include "lib/codec/ob_delta_zigzag_rle.h"
 #include "lib/codec/ob_delta_zigzag_pfor.h"
 #include "lib/codec/ob_xor_fixed_pfor.h"
+#include "lib/codec/ob_alp_fixed_pfor.h"
 #include "lib/codec/ob_universal_compression.h"
 #include "lib/codec/ob_tiered_codec.h"
 #include "storage/blocksstable/encoding/ob_encoding_query_util.h"
@@ -175,6 +177,14 @@ private:
         }
         break;
       }
+      case ObIntegerStream::EncodingType::ALP_FIXED_PFOR: {
+        ObAlpFixedPfor codec;
+        codec.set_base_value(ctx_->meta_.is_use_base() ? ctx_->meta_.base_value_ : 0);
+        if (OB_FAIL((do_encode<T>(codec, uint_arr, arr_count, buf_writer, is_detected)))) {
+          STORAGE_LOG(WARN, "fail to do alp fixed pfor encode", KR(ret), KPC(ctx_));
+        }
+        break;
+      }
       case ObIntegerStream::EncodingType::UNIVERSAL_COMPRESS: {
         ObUniversalCompression codec;
         codec.set_allocator(*ctx_->info_.allocator_);
@@ -424,6 +434,13 @@ private:
     if (ctx_->info_.encoding_opt_->is_enabled(ObIntegerStream::EncodingType::DELTA_ZIGZAG_PFOR)) {
       list[count++] = ObIntegerStream::EncodingType::DELTA_ZIGZAG_PFOR;
     }
+    // only useful when the stream holds the complete bit pattern of floating point values,
+    // and older observers can not decode it
+    if (sizeof(T) == ctx_->info_.float_value_size_
+        && ctx_->info_.major_working_cluster_version_ >= DATA_VERSION_1_1_0_0
+        && ctx_->info_.encoding_opt_->is_enabled(ObIntegerStream::EncodingType::ALP_FIXED_PFOR)) {
+      list[count++] = ObIntegerStream::EncodingType::ALP_FIXED_PFOR;
+    }
 
     if (ctx_->info_.is_monotonic_inc_) {
       // no other
@@ -1247,6 +1247,7 @@ int ObMicroBlockCSEncoder::store_stream_offsets_(int64_t &stream_offsets_length)
                                      nullptr/*previous_encoding*/,
                                      -1/*stream_idx*/,
                                      ctx_.compressor_type_,
+                                     ctx_.major_working_cluster_version_,
                                      &allocator_))) {
       LOG_WARN("fail to build_stream_encoder_info", K(ret));
     } else if (FALSE_IT(need_store_size = sizeof(ObIntegerStreamMeta) +
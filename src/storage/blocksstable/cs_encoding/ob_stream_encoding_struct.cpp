@@ -197,6 +197,7 @@ int ObIntegerStreamEncoderCtx::build_stream_encoder_info(
                                  const ObPreviousColumnEncoding *previous_encoding,
                                  const int32_t stream_idx,
                                  const ObCompressorType compressor_type,
+                                 const int64_t major_working_cluster_version,
                                  ObIAllocator *allocator_)
 {
   int ret = OB_SUCCESS;
@@ -207,6 +208,7 @@ int ObIntegerStreamEncoderCtx::build_stream_encoder_info(
   info_.previous_encoding_ = previous_encoding;
   info_.stream_idx_ = stream_idx;
   info_.compressor_type_ = compressor_type;
+  info_.major_working_cluster_version_ = major_working_cluster_version;
   info_.allocator_ = allocator_;
   return ret;
 }
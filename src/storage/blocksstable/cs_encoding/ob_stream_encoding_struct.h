@@ -75,7 +75,8 @@ struct ObIntegerStream
     SIMD_FIXEDPFOR             = 6,
     UNIVERSAL_COMPRESS         = 7,
     XOR_FIXED_PFOR             = 8,
-    MAX_TYPE                   = 9,
+    ALP_FIXED_PFOR             = 9,
+    MAX_TYPE                   = 10,
   };
 
 
@@ -91,6 +92,7 @@ struct ObIntegerStream
       case SIMD_FIXEDPFOR:             { return "SIMD_FIXEDPFOR"; }
       case UNIVERSAL_COMPRESS:         { return "UNIVERSAL_COMPRESS"; }
       case XOR_FIXED_PFOR:             { return "XOR_FIXED_PFOR"; }
+      case ALP_FIXED_PFOR:             { return "ALP_FIXED_PFOR"; }
       default:                         { return "MAX_TYPE"; }
     }
   }
@@ -288,17 +290,23 @@ struct ObIntegerStreamEncoderInfo
     stream_idx_ = -1;
     ObIAllocator *allocator_ = nullptr;
     compressor_type_ = ObCompressorType::INVALID_COMPRESSOR;
+    float_value_size_ = 0;
+    major_working_cluster_version_ = 0;
   }
   TO_STRING_KV(K_(has_null_datum), K_(is_monotonic_inc),
       KP_(encoding_opt), KPC_(previous_encoding), K_(stream_idx),
-      KP_(allocator), "compressor_type", all_compressor_name[compressor_type_]);
+      KP_(allocator), "compressor_type", all_compressor_name[compressor_type_],
+      K_(float_value_size), K_(major_working_cluster_version));
 
   bool has_null_datum_;
   bool is_monotonic_inc_;
+  // byte size of float/double whose bit pattern is stored in the stream, 0 if not floating point
+  uint8_t float_value_size_;
   const ObCSEncodingOpt *encoding_opt_;
   const ObPreviousColumnEncoding *previous_encoding_;
   int32_t stream_idx_;
   ObCompressorType compressor_type_;
+  int64_t major_working_cluster_version_;
   ObIAllocator *allocator_;
 };
 
@@ -332,6 +340,7 @@ struct ObIntegerStreamEncoderCtx
                                 const ObPreviousColumnEncoding *previous_encoding,
                                 const int32_t stream_idx,
                                 const ObCompressorType compressor_type,
+                                const int64_t major_working_cluster_version,
                                 ObIAllocator *allocator);
 
   int try_use_previous_encoding(bool &use_previous);
@@ -179,6 +179,7 @@ int ObStringStreamEncoder::do_encode_offset_stream_(ObIArray<uint32_t> &stream_o
                                 ctx_->info_.encoding_opt_,
                                 ctx_->info_.previous_encoding_, ctx_->info_.int_stream_idx_,
                                 ctx_->info_.compressor_type_,
+                                ctx_->info_.major_working_cluster_version_,
                                 ctx_->info_.allocator_))) {
       STORAGE_LOG(WARN, "fail to build_stream_encoder_info", K(ret));
     } else if (OB_FAIL(int_encoder.encode(int_ctx_, offset_arr, offset_arr_count_, *writer_))) {
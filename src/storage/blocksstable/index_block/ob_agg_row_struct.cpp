@@ -56,6 +56,7 @@ int ObAggRowWriter::init(const ObIArray<ObSkipIndexColMeta> &agg_col_arr,
                          ObIAllocator &allocator)
 {
   int ret = OB_SUCCESS;
+  int64_t bitmap_size = 0;
   if (OB_UNLIKELY(is_inited_)) {
     ret = OB_INIT_TWICE;
     LOG_WARN("agg row writer inited twice", K(ret));
@@ -66,7 +67,9 @@ int ObAggRowWriter::init(const ObIArray<ObSkipIndexColMeta> &agg_col_arr,
   } else if (FALSE_IT(major_working_cluster_version_ = major_working_cluster_version)) {
   } else if (OB_FAIL(sort_metas(agg_col_arr, allocator))) {
     LOG_WARN("failed to sort agg col metas", K(ret));
-  } else if (OB_FAIL(calc_serialize_agg_buf_size())) {
+  } else if (OB_FAIL(calc_bitmap_size(bitmap_size))) {
+    LOG_WARN("failed to calc bitmap size", K(ret));
+  } else if (OB_FAIL(calc_serialize_agg_buf_size(bitmap_size))) {
     LOG_WARN("failed to calc estimate data size", K(ret));
   } else {
     is_inited_ = true;
@@ -97,7 +100,29 @@ int ObAggRowWriter::sort_metas(const ObIArray<ObSkipIndexColMeta> &agg_col_arr,
   return ret;
 }
 
-int ObAggRowWriter::calc_serialize_agg_buf_size()
+// Keep the 1 byte bitmap older observers can read unless a stored col type does not fit in it,
+// nop and null cells are not stored and do not count.
+int ObAggRowWriter::calc_bitmap_size(int64_t &bitmap_size) const
+{
+  int ret = OB_SUCCESS;
+  bitmap_size = ObAggRowHeader::AGG_COL_TYPE_BITMAP_SIZE;
+  for (int64_t i = 0; OB_SUCC(ret) && i < column_count_; ++i) {
+    const uint8_t type = col_meta_list_.at(i).first.col_type_;
+    const ObStorageDatum &datum = agg_data_->get_agg_datum_row().storage_datums_[col_meta_list_.at(i).second];
+    if (type < ObAggRowHeader::AGG_COL_TYPE_BITMAP_SIZE * 8 || datum.is_nop_value() || datum.is_null()) {
+      // fits in the 1 byte bitmap or not stored
+    } else if (OB_UNLIKELY(!is_sketch_skip_index_supported(major_working_cluster_version_))) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("unexpected skip index col type for major working version", K(ret), K(type),
+          K_(major_working_cluster_version));
+    } else {
+      bitmap_size = ObAggRowHeader::AGG_COL_TYPE_WIDE_BITMAP_SIZE;
+    }
+  }
+  return ret;
+}
+
+int ObAggRowWriter::calc_serialize_agg_buf_size(const int64_t bitmap_size)
 {
   int ret = OB_SUCCESS;
   int64_t agg_header_size = 0;
@@ -105,7 +130,7 @@ int ObAggRowWriter::calc_serialize_agg_buf_size()
   header_.version_ = ObAggRowHeader::AGG_ROW_HEADER_VERSION_2;
   header_.pack_ = 0;
   header_.agg_col_idx_size_ = 0;
-  header_.bitmap_size_ = ObAggRowHeader::AGG_COL_TYPE_BITMAP_SIZE;
+  header_.bitmap_size_ = bitmap_size;
   uint32_t max_col_idx = col_meta_list_.at(column_count_ - 1).first.col_idx_;
   do {
     ++header_.agg_col_idx_size_;
@@ -131,7 +156,7 @@ int ObAggRowWriter::calc_serialize_agg_buf_size()
         cur_cell_size += datum.len_;
       }
     }
-    cur_cell_size += (2 * ObAggRowHeader::AGG_COL_TYPE_BITMAP_SIZE);
+    cur_cell_size += (2 * header_.bitmap_size_);
     int64_t cur_stored_col_cnt = end - start - nop_count;
     if (cur_stored_col_cnt > 0) {
       ++cur_stored_col_cnt; // reserve one more column to save cell size
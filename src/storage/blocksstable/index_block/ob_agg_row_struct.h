@@ -33,6 +33,7 @@ struct ObAggRowHeader final
   // at most 4096 cols, at most 1K agg data
 public:
   static const int64_t AGG_COL_TYPE_BITMAP_SIZE = 1; // 1 byte bitmap
+  static const int64_t AGG_COL_TYPE_WIDE_BITMAP_SIZE = 2; // 2 bytes bitmap, only if any stored col type >= 8
   static const int64_t AGG_COL_MAX_OFFSET_SIZE = 2; // total size of agg_data < 1K, at most 64K
   static const int64_t AGG_ROW_HEADER_VERSION = 1;
   static const int64_t AGG_ROW_HEADER_VERSION_2 = 2;
@@ -44,11 +45,13 @@ public:
   bool is_valid() const
   {
     return (version_ == AGG_ROW_HEADER_VERSION || version_ == AGG_ROW_HEADER_VERSION_2) && agg_col_cnt_ > 0 && agg_col_idx_size_ > 0 && agg_col_idx_off_size_ > 0
-           && bitmap_size_ == AGG_COL_TYPE_BITMAP_SIZE;
+           && (bitmap_size_ == AGG_COL_TYPE_BITMAP_SIZE || bitmap_size_ == AGG_COL_TYPE_WIDE_BITMAP_SIZE);
   }
   TO_STRING_KV(K_(version), K_(length), K_(agg_col_cnt), K_(agg_col_idx_size),
       K_(agg_col_idx_off_size), K_(cell_off_size), K_(bitmap_size));
 public:
+  static_assert(SK_IDX_MAX_COL_TYPE <= AGG_COL_TYPE_WIDE_BITMAP_SIZE * 8,
+      "skip index col type should fit in the type bitmap of an aggregated cell");
   int16_t version_;
   int16_t length_;
   int16_t agg_col_cnt_;
@@ -88,7 +91,8 @@ public:
   void reset();
 private:
   int sort_metas(const ObIArray<ObSkipIndexColMeta> &agg_col_arr, ObIAllocator &allocator);
-  int calc_serialize_agg_buf_size();
+  int calc_bitmap_size(int64_t &bitmap_size) const;
+  int calc_serialize_agg_buf_size(const int64_t bitmap_size);
   int write_cell(
       int64_t start,
       int64_t end,
@@ -909,6 +909,537 @@ int ObColSumAggregator::eval_double(const common::ObDatum &datum)
   return ret;
 }
 
+int ObColNgramBloomFilterAggregator::init(
+    const bool is_major,
+    const ObColDesc &col_desc,
+    const int64_t major_working_cluster_version,
+    ObStorageDatum &result,
+    ObSkipIndexDatumAttr &result_attr)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_major)) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("skip index ngram bloom filter aggregator on non-major data not supported", K(ret));
+  } else if (OB_FAIL(ObIColAggregator::init(is_major, col_desc, major_working_cluster_version, result, result_attr))) {
+    LOG_WARN("fail to init ObIColAggregator", K(ret));
+  } else if (!can_agg()) {
+    set_not_aggregate();
+    LOG_DEBUG("[SKIP INDEX] init col ngram bloom filter agg on unsupported type or version",
+        K(col_desc), K(major_working_cluster_version));
+  } else {
+    bloom_filter_.reset();
+  }
+  return ret;
+}
+
+void ObColNgramBloomFilterAggregator::reuse()
+{
+  ObIColAggregator::reuse();
+  bloom_filter_.reset();
+  if (!can_agg()) {
+    set_not_aggregate();
+  }
+}
+
+bool ObColNgramBloomFilterAggregator::can_agg() const
+{
+  return is_sketch_skip_index_supported(major_working_cluster_version_)
+      && can_agg_ngram_bloom_filter(col_desc_.col_type_.get_type(), col_desc_.col_type_.get_collation_type());
+}
+
+int ObColNgramBloomFilterAggregator::insert_raw_datum(const ObDatum &datum)
+{
+  int ret = OB_SUCCESS;
+  const ObString &str = datum.get_string();
+  bloom_filter_.insert_ngrams(str.ptr(), str.length());
+  if (bloom_filter_.is_saturated()) {
+    // too many distinct trigrams for the bloom filter to skip anything
+    set_not_aggregate();
+  }
+  return ret;
+}
+
+int ObColNgramBloomFilterAggregator::eval(const ObStorageDatum &datum, const ObSkipIndexDatumAttr &agg_datum_attr)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(result_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not init", K(ret));
+  } else if (!can_aggregate_ || datum.is_null()) {
+    // Skip
+  } else if (datum.is_nop()) {
+    set_not_aggregate();
+  } else if (OB_UNLIKELY(datum.is_ext())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected ext datum", K(ret), K(datum));
+  } else if (agg_datum_attr.is_raw_data_) {
+    if (OB_FAIL(insert_raw_datum(datum))) {
+      LOG_WARN("fail to insert datum to bloom filter", K(ret), K(datum));
+    }
+  } else {
+    ObSkipIndexBloomFilter agg_bloom_filter;
+    if (OB_FAIL(agg_bloom_filter.from_datum(datum))) {
+      LOG_WARN("fail to read aggregated bloom filter", K(ret), K(datum));
+    } else {
+      bloom_filter_.merge(agg_bloom_filter);
+      if (bloom_filter_.is_saturated()) {
+        set_not_aggregate();
+      }
+    }
+  }
+  return ret;
+}
+
+int ObColNgramBloomFilterAggregator::eval(ObIDatumIter &datum_iter)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(result_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not init", K(ret));
+  } else {
+    const ObDatum *iter_datum = nullptr;
+    while (OB_SUCC(ret) && can_aggregate_) {
+      if (OB_FAIL(datum_iter.get_next(iter_datum))) {
+        if (OB_UNLIKELY(OB_ITER_END != ret)) {
+          LOG_WARN("failed to get next iter datum", K(ret));
+        }
+      } else if (iter_datum->is_null()) {
+      } else if (iter_datum->is_nop()) {
+        set_not_aggregate();
+      } else if (OB_FAIL(insert_raw_datum(*iter_datum))) {
+        LOG_WARN("fail to insert datum to bloom filter", K(ret), KPC(iter_datum));
+      }
+    }
+    if (OB_ITER_END == ret) {
+      ret = OB_SUCCESS;
+    }
+  }
+  return ret;
+}
+
+int ObColNgramBloomFilterAggregator::get_result(const ObStorageDatum *&result)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(result_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not init", K(ret));
+  } else {
+    if (can_aggregate_) {
+      // always stored even if empty, a missing bloom filter is taken as not aggregated
+      result_->reuse();
+      MEMCPY(result_->buf_, bloom_filter_.get_data(), ObSkipIndexBloomFilter::get_data_size());
+      result_->pack_ = ObSkipIndexBloomFilter::get_data_size();
+    } else {
+      result_->set_nop();
+    }
+    result = result_;
+  }
+  return ret;
+}
+
+int ObColHLLAggregator::init(
+    const bool is_major,
+    const ObColDesc &col_desc,
+    const int64_t major_working_cluster_version,
+    ObStorageDatum &result,
+    ObSkipIndexDatumAttr &result_attr)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_major)) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("skip index hll aggregator on non-major data not supported", K(ret));
+  } else if (OB_FAIL(ObIColAggregator::init(is_major, col_desc, major_working_cluster_version, result, result_attr))) {
+    LOG_WARN("fail to init ObIColAggregator", K(ret));
+  } else if (!can_agg()) {
+    set_not_aggregate();
+    LOG_DEBUG("[SKIP INDEX] init col hll agg on unsupported type or version",
+        K(col_desc), K(major_working_cluster_version));
+  } else {
+    sql::ObExprBasicFuncs *basic_funcs = ObDatumFuncs::get_basic_func(
+        col_desc.col_type_.get_type(), col_desc.col_type_.get_collation_type());
+    hash_func_ = basic_funcs->murmur_hash_v2_;
+    hll_.reset();
+  }
+  return ret;
+}
+
+void ObColHLLAggregator::reuse()
+{
+  ObIColAggregator::reuse();
+  hll_.reset();
+  if (!can_agg()) {
+    set_not_aggregate();
+  }
+}
+
+bool ObColHLLAggregator::can_agg() const
+{
+  return is_sketch_skip_index_supported(major_working_cluster_version_)
+      && can_agg_value_hash(col_desc_.col_type_.get_type());
+}
+
+int ObColHLLAggregator::insert_raw_datum(const ObDatum &datum)
+{
+  int ret = OB_SUCCESS;
+  uint64_t hash = 0;
+  if (OB_FAIL(hash_func_(datum, ObSkipIndexHLL::VALUE_HASH_SEED, hash))) {
+    LOG_WARN("fail to calc hash for hll", K(ret), K(datum), K_(col_desc));
+  } else {
+    hll_.insert(hash);
+  }
+  return ret;
+}
+
+int ObColHLLAggregator::eval(const ObStorageDatum &datum, const ObSkipIndexDatumAttr &agg_datum_attr)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(result_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not init", K(ret));
+  } else if (!can_aggregate_ || datum.is_null()) {
+    // Skip
+  } else if (datum.is_nop()) {
+    set_not_aggregate();
+  } else if (OB_UNLIKELY(datum.is_ext())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected ext datum", K(ret), K(datum));
+  } else if (agg_datum_attr.is_raw_data_) {
+    if (OB_FAIL(insert_raw_datum(datum))) {
+      LOG_WARN("fail to insert datum to hll", K(ret), K(datum));
+    }
+  } else {
+    ObSkipIndexHLL agg_hll;
+    if (OB_FAIL(agg_hll.from_datum(datum))) {
+      LOG_WARN("fail to read aggregated hll", K(ret), K(datum));
+    } else {
+      hll_.merge(agg_hll);
+    }
+  }
+  return ret;
+}
+
+int ObColHLLAggregator::eval(ObIDatumIter &datum_iter)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(result_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not init", K(ret));
+  } else {
+    const ObDatum *iter_datum = nullptr;
+    while (OB_SUCC(ret) && can_aggregate_) {
+      if (OB_FAIL(datum_iter.get_next(iter_datum))) {
+        if (OB_UNLIKELY(OB_ITER_END != ret)) {
+          LOG_WARN("failed to get next iter datum", K(ret));
+        }
+      } else if (iter_datum->is_null()) {
+      } else if (iter_datum->is_nop()) {
+        set_not_aggregate();
+      } else if (OB_FAIL(insert_raw_datum(*iter_datum))) {
+        LOG_WARN("fail to insert datum to hll", K(ret), KPC(iter_datum));
+      }
+    }
+    if (OB_ITER_END == ret) {
+      ret = OB_SUCCESS;
+    }
+  }
+  return ret;
+}
+
+int ObColHLLAggregator::get_result(const ObStorageDatum *&result)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(result_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not init", K(ret));
+  } else {
+    if (can_aggregate_) {
+      result_->reuse();
+      hll_.pack(result_->buf_);
+      result_->pack_ = ObSkipIndexHLL::HLL_SIZE;
+    } else {
+      result_->set_nop();
+    }
+    result = result_;
+  }
+  return ret;
+}
+
+int ObColValueBloomFilterAggregator::init(
+    const bool is_major,
+    const ObColDesc &col_desc,
+    const int64_t major_working_cluster_version,
+    ObStorageDatum &result,
+    ObSkipIndexDatumAttr &result_attr)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_major)) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("skip index bloom filter aggregator on non-major data not supported", K(ret));
+  } else if (OB_FAIL(ObIColAggregator::init(is_major, col_desc, major_working_cluster_version, result, result_attr))) {
+    LOG_WARN("fail to init ObIColAggregator", K(ret));
+  } else if (!can_agg()) {
+    set_not_aggregate();
+    LOG_DEBUG("[SKIP INDEX] init col bloom filter agg on unsupported type or version",
+        K(col_desc), K(major_working_cluster_version));
+  } else {
+    sql::ObExprBasicFuncs *basic_funcs = ObDatumFuncs::get_basic_func(
+        col_desc.col_type_.get_type(), col_desc.col_type_.get_collation_type());
+    hash_func_ = basic_funcs->murmur_hash_v2_;
+    bloom_filter_.reset();
+  }
+  return ret;
+}
+
+void ObColValueBloomFilterAggregator::reuse()
+{
+  ObIColAggregator::reuse();
+  bloom_filter_.reset();
+  if (!can_agg()) {
+    set_not_aggregate();
+  }
+}
+
+bool ObColValueBloomFilterAggregator::can_agg() const
+{
+  return is_sketch_skip_index_supported(major_working_cluster_version_)
+      && can_agg_value_hash(col_desc_.col_type_.get_type());
+}
+
+int ObColValueBloomFilterAggregator::insert_raw_datum(const ObDatum &datum)
+{
+  int ret = OB_SUCCESS;
+  uint64_t hash = 0;
+  if (OB_FAIL(hash_func_(datum, ObSkipIndexValueBloomFilter::VALUE_HASH_SEED, hash))) {
+    LOG_WARN("fail to calc hash for bloom filter", K(ret), K(datum), K_(col_desc));
+  } else {
+    bloom_filter_.insert(hash);
+    if (bloom_filter_.is_saturated()) {
+      // too many distinct values for the bloom filter to skip anything
+      set_not_aggregate();
+    }
+  }
+  return ret;
+}
+
+int ObColValueBloomFilterAggregator::eval(const ObStorageDatum &datum, const ObSkipIndexDatumAttr &agg_datum_attr)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(result_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not init", K(ret));
+  } else if (!can_aggregate_ || datum.is_null()) {
+    // Skip
+  } else if (datum.is_nop()) {
+    set_not_aggregate();
+  } else if (OB_UNLIKELY(datum.is_ext())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected ext datum", K(ret), K(datum));
+  } else if (agg_datum_attr.is_raw_data_) {
+    if (OB_FAIL(insert_raw_datum(datum))) {
+      LOG_WARN("fail to insert datum to bloom filter", K(ret), K(datum));
+    }
+  } else {
+    ObSkipIndexValueBloomFilter agg_bloom_filter;
+    if (OB_FAIL(agg_bloom_filter.from_datum(datum))) {
+      LOG_WARN("fail to read aggregated bloom filter", K(ret), K(datum));
+    } else {
+      bloom_filter_.merge(agg_bloom_filter);
+      if (bloom_filter_.is_saturated()) {
+        set_not_aggregate();
+      }
+    }
+  }
+  return ret;
+}
+
+int ObColValueBloomFilterAggregator::eval(ObIDatumIter &datum_iter)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(result_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not init", K(ret));
+  } else {
+    const ObDatum *iter_datum = nullptr;
+    while (OB_SUCC(ret) && can_aggregate_) {
+      if (OB_FAIL(datum_iter.get_next(iter_datum))) {
+        if (OB_UNLIKELY(OB_ITER_END != ret)) {
+          LOG_WARN("failed to get next iter datum", K(ret));
+        }
+      } else if (iter_datum->is_null()) {
+      } else if (iter_datum->is_nop()) {
+        set_not_aggregate();
+      } else if (OB_FAIL(insert_raw_datum(*iter_datum))) {
+        LOG_WARN("fail to insert datum to bloom filter", K(ret), KPC(iter_datum));
+      }
+    }
+    if (OB_ITER_END == ret) {
+      ret = OB_SUCCESS;
+    }
+  }
+  return ret;
+}
+
+int ObColValueBloomFilterAggregator::get_result(const ObStorageDatum *&result)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(result_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not init", K(ret));
+  } else {
+    if (can_aggregate_) {
+      // always stored even if empty, a missing bloom filter is taken as not aggregated.
+      // Larger than the datum buffer, so the result points to the filter of the aggregator.
+      bloom_filter_.shrink();
+      result_->reuse();
+      result_->set_string(bloom_filter_.get_data(), bloom_filter_.get_data_size());
+    } else {
+      result_->set_nop();
+    }
+    result = result_;
+  }
+  return ret;
+}
+
+int ObColVectorBoundAggregator::init(
+    const bool is_major,
+    const ObColDesc &col_desc,
+    const int64_t major_working_cluster_version,
+    ObStorageDatum &result,
+    ObSkipIndexDatumAttr &result_attr)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_major)) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("skip index vector bound aggregator on non-major data not supported", K(ret));
+  } else if (OB_FAIL(ObIColAggregator::init(is_major, col_desc, major_working_cluster_version, result, result_attr))) {
+    LOG_WARN("fail to init ObIColAggregator", K(ret));
+  } else if (!can_agg()) {
+    set_not_aggregate();
+    LOG_DEBUG("[SKIP INDEX] init col vector bound agg on unsupported type or version",
+        K(col_desc), K(major_working_cluster_version));
+  } else {
+    // collection types are in the black list of min max
+    can_aggregate_ = true;
+    vector_bound_.reset();
+  }
+  return ret;
+}
+
+void ObColVectorBoundAggregator::reuse()
+{
+  ObIColAggregator::reuse();
+  vector_bound_.reset();
+  can_aggregate_ = can_agg();
+}
+
+bool ObColVectorBoundAggregator::can_agg() const
+{
+  return is_sketch_skip_index_supported(major_working_cluster_version_)
+      && can_agg_vector_bound(col_desc_.col_type_.get_type());
+}
+
+int ObColVectorBoundAggregator::add_raw_datum(const ObDatum &datum)
+{
+  int ret = OB_SUCCESS;
+  if (datum.is_null()) {
+    vector_bound_.set_has_null();
+  } else if (!datum.get_lob_data().in_row_) {
+    set_not_aggregate();
+  } else {
+    const ObLobCommon &lob_data = datum.get_lob_data();
+    const int64_t byte_size = lob_data.get_byte_size(datum.len_);
+    if (0 != byte_size % sizeof(float)) {
+      set_not_aggregate();
+    } else if (OB_FAIL(vector_bound_.add(lob_data.get_inrow_data_ptr(), byte_size / sizeof(float)))) {
+      if (OB_INVALID_ARGUMENT == ret) {
+        // nan or inf, nothing can be bounded
+        ret = OB_SUCCESS;
+        set_not_aggregate();
+      } else {
+        LOG_WARN("fail to add vector to vector bound", K(ret), K(datum));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObColVectorBoundAggregator::eval(const ObStorageDatum &datum, const ObSkipIndexDatumAttr &agg_datum_attr)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(result_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not init", K(ret));
+  } else if (!can_aggregate_) {
+    // Skip
+  } else if (datum.is_nop()) {
+    set_not_aggregate();
+  } else if (OB_UNLIKELY(datum.is_ext())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected ext datum", K(ret), K(datum));
+  } else if (agg_datum_attr.is_raw_data_) {
+    if (OB_FAIL(add_raw_datum(datum))) {
+      LOG_WARN("fail to add datum to vector bound", K(ret), K(datum));
+    }
+  } else if (datum.is_null()) {
+    // bound of a lower level block is always stored unless it is not aggregated
+    set_not_aggregate();
+  } else {
+    ObSkipIndexVectorBound agg_vector_bound;
+    if (OB_FAIL(agg_vector_bound.from_datum(datum))) {
+      LOG_WARN("fail to read aggregated vector bound", K(ret), K(datum));
+    } else {
+      vector_bound_.merge(agg_vector_bound);
+    }
+  }
+  return ret;
+}
+
+int ObColVectorBoundAggregator::eval(ObIDatumIter &datum_iter)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(result_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not init", K(ret));
+  } else {
+    const ObDatum *iter_datum = nullptr;
+    while (OB_SUCC(ret) && can_aggregate_) {
+      if (OB_FAIL(datum_iter.get_next(iter_datum))) {
+        if (OB_UNLIKELY(OB_ITER_END != ret)) {
+          LOG_WARN("failed to get next iter datum", K(ret));
+        }
+      } else if (iter_datum->is_nop()) {
+        set_not_aggregate();
+      } else if (OB_FAIL(add_raw_datum(*iter_datum))) {
+        LOG_WARN("fail to add datum to vector bound", K(ret), KPC(iter_datum));
+      }
+    }
+    if (OB_ITER_END == ret) {
+      ret = OB_SUCCESS;
+    }
+  }
+  return ret;
+}
+
+int ObColVectorBoundAggregator::get_result(const ObStorageDatum *&result)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(result_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not init", K(ret));
+  } else {
+    if (can_aggregate_) {
+      // always stored even if empty, so that blocks of null vectors are known
+      result_->reuse();
+      vector_bound_.pack(result_->buf_);
+      result_->pack_ = ObSkipIndexVectorBound::VECTOR_BOUND_SIZE;
+    } else {
+      result_->set_nop();
+    }
+    result = result_;
+  }
+  return ret;
+}
+
 ObIMultiColAggregator::ObIMultiColAggregator()
   : allocator_(nullptr),
     agg_result_row_(nullptr),
@@ -1336,7 +1867,8 @@ int ObISkipIndexAggregator::get_aggregated_row(const ObSkipIndexAggResult *&aggr
       } else if (OB_ISNULL(result)) {
         ret = OB_ERR_UNEXPECTED;
         LOG_WARN("Fail to get aggregated column result", K(ret), K(i));
-      } else if (OB_UNLIKELY(result->len_ > ObSkipIndexColMeta::MAX_SKIP_INDEX_COL_LENGTH
+      } else if (OB_UNLIKELY((result->len_ > ObSkipIndexColMeta::MAX_SKIP_INDEX_COL_LENGTH
+              && SK_IDX_BLOOM_FILTER != full_agg_metas_->at(i).col_type_)
           || result->is_outrow())) {
         ret = OB_ERR_UNEXPECTED;
         LOG_WARN("Unexpected aggregated result datum", K(ret), K(result), K(i), K_(full_agg_metas));
@@ -1404,6 +1936,22 @@ int ObISkipIndexAggregator::calc_max_agg_size(
             cur_max_cell_size += sum_store_size;
             break;
           }
+          case ObSkipIndexColType::SK_IDX_NGRAM_BLOOM_FILTER: {
+            cur_max_cell_size += ObSkipIndexBloomFilter::BLOOM_FILTER_SIZE;
+            break;
+          }
+          case ObSkipIndexColType::SK_IDX_HLL: {
+            cur_max_cell_size += ObSkipIndexHLL::HLL_SIZE;
+            break;
+          }
+          case ObSkipIndexColType::SK_IDX_VECTOR_BOUND: {
+            cur_max_cell_size += ObSkipIndexVectorBound::VECTOR_BOUND_SIZE;
+            break;
+          }
+          case ObSkipIndexColType::SK_IDX_BLOOM_FILTER: {
+            cur_max_cell_size += ObSkipIndexValueBloomFilter::MAX_SIZE;
+            break;
+          }
           default: {
             ret = OB_NOT_SUPPORTED;
             LOG_WARN("Not support skip index aggregate type", K(ret), K(idx_type));
@@ -1411,7 +1959,7 @@ int ObISkipIndexAggregator::calc_max_agg_size(
           }
           ++end;
         }
-        cur_max_cell_size += 2 * ObAggRowHeader::AGG_COL_TYPE_BITMAP_SIZE;
+        cur_max_cell_size += 2 * ObAggRowHeader::AGG_COL_TYPE_WIDE_BITMAP_SIZE;
 
         //reserve one more column to save cell size
         cur_max_cell_size += (end - start + 1) * agg_col_off_size;
@@ -1509,6 +2057,34 @@ int ObISkipIndexAggregator::init_col_aggregators(
         }
         break;
       }
+      case ObSkipIndexColType::SK_IDX_NGRAM_BLOOM_FILTER: {
+        if (OB_FAIL(init_col_aggregator<ObColNgramBloomFilterAggregator>(
+            is_major, full_col_descs.at(col_idx), major_working_cluster_version, agg_res_datum, agg_datum_attr, allocator))) {
+          LOG_WARN("Fail to allocate column aggregator", K(ret));
+        }
+        break;
+      }
+      case ObSkipIndexColType::SK_IDX_HLL: {
+        if (OB_FAIL(init_col_aggregator<ObColHLLAggregator>(
+            is_major, full_col_descs.at(col_idx), major_working_cluster_version, agg_res_datum, agg_datum_attr, allocator))) {
+          LOG_WARN("Fail to allocate column aggregator", K(ret));
+        }
+        break;
+      }
+      case ObSkipIndexColType::SK_IDX_VECTOR_BOUND: {
+        if (OB_FAIL(init_col_aggregator<ObColVectorBoundAggregator>(
+            is_major, full_col_descs.at(col_idx), major_working_cluster_version, agg_res_datum, agg_datum_attr, allocator))) {
+          LOG_WARN("Fail to allocate column aggregator", K(ret));
+        }
+        break;
+      }
+      case ObSkipIndexColType::SK_IDX_BLOOM_FILTER: {
+        if (OB_FAIL(init_col_aggregator<ObColValueBloomFilterAggregator>(
+            is_major, full_col_descs.at(col_idx), major_working_cluster_version, agg_res_datum, agg_datum_attr, allocator))) {
+          LOG_WARN("Fail to allocate column aggregator", K(ret));
+        }
+        break;
+      }
       default: {
         ret = OB_NOT_SUPPORTED;
         LOG_WARN("Not supported skip index aggregate type", K(ret), K(idx_type));
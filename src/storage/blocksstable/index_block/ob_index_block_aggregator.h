@@ -236,6 +236,107 @@ private:
   DISALLOW_COPY_AND_ASSIGN(ObColSumAggregator);
 };
 
+// Bloom filter of the byte trigrams of the values of a column.
+class ObColNgramBloomFilterAggregator final : public ObIColAggregator
+{
+public:
+  ObColNgramBloomFilterAggregator() : bloom_filter_() {}
+  virtual ~ObColNgramBloomFilterAggregator() {}
+  int init(
+      const bool is_major,
+      const ObColDesc &col_desc,
+      const int64_t major_working_cluster_version,
+      ObStorageDatum &result,
+      ObSkipIndexDatumAttr &result_attr) override;
+  void reset() override { new (this) ObColNgramBloomFilterAggregator(); }
+  void reuse() override;
+  int eval(const ObStorageDatum &datum, const ObSkipIndexDatumAttr &agg_datum_attr) override;
+  int eval(ObIDatumIter &datum_iter) override;
+  int get_result(const ObStorageDatum *&result) override;
+private:
+  bool can_agg() const;
+  int insert_raw_datum(const ObDatum &datum);
+private:
+  ObSkipIndexBloomFilter bloom_filter_;
+  DISALLOW_COPY_AND_ASSIGN(ObColNgramBloomFilterAggregator);
+};
+
+class ObColHLLAggregator final : public ObIColAggregator
+{
+public:
+  ObColHLLAggregator() : hash_func_(nullptr), hll_() {}
+  virtual ~ObColHLLAggregator() {}
+  int init(
+      const bool is_major,
+      const ObColDesc &col_desc,
+      const int64_t major_working_cluster_version,
+      ObStorageDatum &result,
+      ObSkipIndexDatumAttr &result_attr) override;
+  void reset() override { new (this) ObColHLLAggregator(); }
+  void reuse() override;
+  int eval(const ObStorageDatum &datum, const ObSkipIndexDatumAttr &agg_datum_attr) override;
+  int eval(ObIDatumIter &datum_iter) override;
+  int get_result(const ObStorageDatum *&result) override;
+private:
+  bool can_agg() const;
+  int insert_raw_datum(const ObDatum &datum);
+private:
+  sql::ObExprHashFuncType hash_func_;
+  ObSkipIndexHLL hll_;
+  DISALLOW_COPY_AND_ASSIGN(ObColHLLAggregator);
+};
+
+// Bloom filter of the values of a column, see ObSkipIndexValueBloomFilter.
+class ObColValueBloomFilterAggregator final : public ObIColAggregator
+{
+public:
+  ObColValueBloomFilterAggregator() : hash_func_(nullptr), bloom_filter_() {}
+  virtual ~ObColValueBloomFilterAggregator() {}
+  int init(
+      const bool is_major,
+      const ObColDesc &col_desc,
+      const int64_t major_working_cluster_version,
+      ObStorageDatum &result,
+      ObSkipIndexDatumAttr &result_attr) override;
+  void reset() override { new (this) ObColValueBloomFilterAggregator(); }
+  void reuse() override;
+  int eval(const ObStorageDatum &datum, const ObSkipIndexDatumAttr &agg_datum_attr) override;
+  int eval(ObIDatumIter &datum_iter) override;
+  int get_result(const ObStorageDatum *&result) override;
+private:
+  bool can_agg() const;
+  int insert_raw_datum(const ObDatum &datum);
+private:
+  sql::ObExprHashFuncType hash_func_;
+  ObSkipIndexValueBloomFilter bloom_filter_;
+  DISALLOW_COPY_AND_ASSIGN(ObColValueBloomFilterAggregator);
+};
+
+// Projection and norm ranges of the inrow float vectors of a column, see ObSkipIndexVectorBound.
+class ObColVectorBoundAggregator final : public ObIColAggregator
+{
+public:
+  ObColVectorBoundAggregator() : vector_bound_() {}
+  virtual ~ObColVectorBoundAggregator() {}
+  int init(
+      const bool is_major,
+      const ObColDesc &col_desc,
+      const int64_t major_working_cluster_version,
+      ObStorageDatum &result,
+      ObSkipIndexDatumAttr &result_attr) override;
+  void reset() override { new (this) ObColVectorBoundAggregator(); }
+  void reuse() override;
+  int eval(const ObStorageDatum &datum, const ObSkipIndexDatumAttr &agg_datum_attr) override;
+  int eval(ObIDatumIter &datum_iter) override;
+  int get_result(const ObStorageDatum *&result) override;
+private:
+  bool can_agg() const;
+  int add_raw_datum(const ObDatum &datum);
+private:
+  ObSkipIndexVectorBound vector_bound_;
+  DISALLOW_COPY_AND_ASSIGN(ObColVectorBoundAggregator);
+};
+
 template <typename T, int64_t MAX_COUNT, int64_t BLOCK_SIZE>
 class ObPodFix2dArray;
 class ObEncodingHashTable;
@@ -410,7 +511,11 @@ public:
 private:
   bool can_agg_with_dict(const ObSkipIndexColType idx_type)
   {
-    return ObSkipIndexColType::SK_IDX_MIN == idx_type || ObSkipIndexColType::SK_IDX_MAX == idx_type;
+    // sketches only depend on the distinct values
+    return ObSkipIndexColType::SK_IDX_MIN == idx_type || ObSkipIndexColType::SK_IDX_MAX == idx_type
+        || ObSkipIndexColType::SK_IDX_NGRAM_BLOOM_FILTER == idx_type
+        || ObSkipIndexColType::SK_IDX_HLL == idx_type
+        || ObSkipIndexColType::SK_IDX_BLOOM_FILTER == idx_type;
   }
   bool can_use_pre_agg_integer(const ObSkipIndexColMeta &col_meta);
   int do_col_agg_with_pre_agg_integer(
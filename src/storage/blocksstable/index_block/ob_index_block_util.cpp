@@ -18,6 +18,7 @@
 
 #include "share/schema/ob_schema_struct.h"
 #include "storage/blocksstable/index_block/ob_index_block_util.h"
+#include "lib/hash_func/murmur_hash.h"
 
 namespace oceanbase
 {
@@ -68,6 +69,30 @@ int ObSkipIndexColMeta::append_skip_index_meta(
     }
   }
 
+  if (OB_SUCC(ret) && skip_idx_attr.has_ngram_bloom_filter() && is_major) {
+    if (OB_FAIL(skip_idx_metas.push_back(ObSkipIndexColMeta(col_idx, ObSkipIndexColType::SK_IDX_NGRAM_BLOOM_FILTER)))) {
+      STORAGE_LOG(WARN, "failed to push ngram bloom filter skip index meta", K(ret));
+    }
+  }
+
+  if (OB_SUCC(ret) && skip_idx_attr.has_hll() && is_major) {
+    if (OB_FAIL(skip_idx_metas.push_back(ObSkipIndexColMeta(col_idx, ObSkipIndexColType::SK_IDX_HLL)))) {
+      STORAGE_LOG(WARN, "failed to push hll skip index meta", K(ret));
+    }
+  }
+
+  if (OB_SUCC(ret) && skip_idx_attr.has_vector_bound() && is_major) {
+    if (OB_FAIL(skip_idx_metas.push_back(ObSkipIndexColMeta(col_idx, ObSkipIndexColType::SK_IDX_VECTOR_BOUND)))) {
+      STORAGE_LOG(WARN, "failed to push vector bound skip index meta", K(ret));
+    }
+  }
+
+  if (OB_SUCC(ret) && skip_idx_attr.has_bloom_filter() && is_major) {
+    if (OB_FAIL(skip_idx_metas.push_back(ObSkipIndexColMeta(col_idx, ObSkipIndexColType::SK_IDX_BLOOM_FILTER)))) {
+      STORAGE_LOG(WARN, "failed to push bloom filter skip index meta", K(ret));
+    }
+  }
+
   if (OB_SUCC(ret) && skip_idx_attr.has_bm25_token_freq_param()) {
     if (OB_FAIL(skip_idx_metas.push_back(ObSkipIndexColMeta(col_idx, ObSkipIndexColType::SK_IDX_BM25_MAX_SCORE_TOKEN_FREQ)))) {
       STORAGE_LOG(WARN, "failed to push bm25 token freq skip index meta", K(ret));
@@ -110,6 +135,19 @@ int ObSkipIndexColMeta::calc_skip_index_maximum_size(
       sum_column_cnt += 1;
       has_null_count_column = true;
     }
+    int64_t sketch_size = 0;
+    if (skip_idx_attr.has_ngram_bloom_filter()) {
+      sketch_size += ObSkipIndexBloomFilter::BLOOM_FILTER_SIZE;
+    }
+    if (skip_idx_attr.has_hll()) {
+      sketch_size += ObSkipIndexHLL::HLL_SIZE;
+    }
+    if (skip_idx_attr.has_vector_bound()) {
+      sketch_size += ObSkipIndexVectorBound::VECTOR_BOUND_SIZE;
+    }
+    if (skip_idx_attr.has_bloom_filter()) {
+      sketch_size += ObSkipIndexValueBloomFilter::MAX_SIZE;
+    }
     const int64_t null_count_column_cnt = has_null_count_column ? 1 : 0;
     uint32_t data_type_upper_size = 0;
     uint32_t null_count_upper_size = 0;
@@ -122,12 +160,331 @@ int ObSkipIndexColMeta::calc_skip_index_maximum_size(
       LOG_WARN("failed to get sum store size", K(ret), K(obj_type));
     } else {
       max_size = normal_agg_column_cnt * data_type_upper_size + sum_column_cnt * sum_store_size
-          + null_count_column_cnt * null_count_upper_size;
+          + null_count_column_cnt * null_count_upper_size + sketch_size;
+    }
+  }
+  return ret;
+}
+
+void ObSkipIndexBloomFilter::insert_ngrams(const char *str, const int64_t len)
+{
+  for (int64_t i = 0; i + NGRAM_LEN <= len; ++i) {
+    insert(common::murmurhash64A(str + i, NGRAM_LEN, NGRAM_HASH_SEED));
+  }
+}
+
+bool ObSkipIndexBloomFilter::may_match_like_pattern(const ObString &pattern, const ObString &escape) const
+{
+  bool bool_ret = true;
+  if (escape.length() <= 1) {
+    const bool has_escape = 1 == escape.length();
+    const char escape_char = has_escape ? escape.ptr()[0] : '\0';
+    char ngram[NGRAM_LEN];
+    int64_t run_len = 0;
+    for (int64_t i = 0; bool_ret && i < pattern.length(); ++i) {
+      char c = pattern.ptr()[i];
+      if (has_escape && escape_char == c && i + 1 < pattern.length()) {
+        c = pattern.ptr()[++i];
+      } else if ('%' == c || '_' == c) {
+        run_len = 0;
+        continue;
+      }
+      // bytes of utf8 multi-byte chars never equal to the ascii wildcards
+      MEMMOVE(ngram, ngram + 1, NGRAM_LEN - 1);
+      ngram[NGRAM_LEN - 1] = c;
+      if (++run_len >= NGRAM_LEN) {
+        bool_ret = may_contain(common::murmurhash64A(ngram, NGRAM_LEN, NGRAM_HASH_SEED));
+      }
+    }
+  }
+  return bool_ret;
+}
+
+void ObSkipIndexBloomFilter::merge(const ObSkipIndexBloomFilter &other)
+{
+  for (int64_t i = 0; i < BLOOM_FILTER_SIZE; ++i) {
+    bits_[i] |= other.bits_[i];
+  }
+}
+
+int64_t ObSkipIndexBloomFilter::get_set_bit_cnt() const
+{
+  int64_t bit_cnt = 0;
+  for (int64_t i = 0; i < BLOOM_FILTER_SIZE; i += sizeof(uint64_t)) {
+    uint64_t word = 0;
+    MEMCPY(&word, bits_ + i, sizeof(uint64_t));
+    bit_cnt += __builtin_popcountll(word);
+  }
+  return bit_cnt;
+}
+
+int ObSkipIndexBloomFilter::from_datum(const ObDatum &datum)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(datum.is_null() || datum.is_ext() || BLOOM_FILTER_SIZE != datum.len_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid bloom filter datum", K(ret), K(datum));
+  } else {
+    MEMCPY(bits_, datum.ptr_, BLOOM_FILTER_SIZE);
+  }
+  return ret;
+}
+
+void ObSkipIndexValueBloomFilter::fold_to(const int64_t size)
+{
+  while (size_ > size) {
+    const int64_t half = size_ / 2;
+    for (int64_t i = 0; i < half; ++i) {
+      bits_[i] |= bits_[half + i];
+    }
+    MEMSET(bits_ + half, 0, half);
+    size_ = half;
+  }
+}
+
+void ObSkipIndexValueBloomFilter::merge(const ObSkipIndexValueBloomFilter &other)
+{
+  const uint8_t *other_bits = other.bits_;
+  ObSkipIndexValueBloomFilter folded_other;
+  if (other.size_ > size_) {
+    folded_other = other;
+    folded_other.fold_to(size_);
+    other_bits = folded_other.bits_;
+  } else {
+    fold_to(other.size_);
+  }
+  for (int64_t i = 0; i < size_; ++i) {
+    bits_[i] |= other_bits[i];
+  }
+}
+
+void ObSkipIndexValueBloomFilter::shrink()
+{
+  bool can_fold = true;
+  while (can_fold && size_ > MIN_SIZE) {
+    const int64_t half = size_ / 2;
+    int64_t folded_bit_cnt = 0;
+    for (int64_t i = 0; i < half; ++i) {
+      folded_bit_cnt += __builtin_popcount(bits_[i] | bits_[half + i]);
+    }
+    if (folded_bit_cnt > half * 8 / 2) {
+      can_fold = false;
+    } else {
+      fold_to(half);
+    }
+  }
+}
+
+int64_t ObSkipIndexValueBloomFilter::get_set_bit_cnt() const
+{
+  int64_t bit_cnt = 0;
+  for (int64_t i = 0; i < size_; i += sizeof(uint64_t)) {
+    uint64_t word = 0;
+    MEMCPY(&word, bits_ + i, sizeof(uint64_t));
+    bit_cnt += __builtin_popcountll(word);
+  }
+  return bit_cnt;
+}
+
+int ObSkipIndexValueBloomFilter::from_datum(const ObDatum &datum)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(datum.is_null() || datum.is_ext() || datum.len_ < MIN_SIZE || datum.len_ > MAX_SIZE
+      || 0 != (datum.len_ & (datum.len_ - 1)))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid value bloom filter datum", K(ret), K(datum));
+  } else {
+    reset();
+    MEMCPY(bits_, datum.ptr_, datum.len_);
+    size_ = datum.len_;
+  }
+  return ret;
+}
+
+void ObSkipIndexHLL::merge(const ObSkipIndexHLL &other)
+{
+  for (int64_t i = 0; i < REGISTER_CNT; ++i) {
+    registers_[i] = MAX(registers_[i], other.registers_[i]);
+  }
+}
+
+int64_t ObSkipIndexHLL::estimate() const
+{
+  static constexpr double ALPHA = 0.709; // bias correction for 64 registers
+  double sum = 0;
+  int64_t zero_cnt = 0;
+  for (int64_t i = 0; i < REGISTER_CNT; ++i) {
+    sum += 1.0 / static_cast<double>(1ULL << registers_[i]);
+    zero_cnt += 0 == registers_[i] ? 1 : 0;
+  }
+  double est = ALPHA * REGISTER_CNT * REGISTER_CNT / sum;
+  if (est <= 2.5 * REGISTER_CNT && zero_cnt > 0) {
+    // linear counting for small cardinality
+    est = REGISTER_CNT * std::log(static_cast<double>(REGISTER_CNT) / zero_cnt);
+  }
+  return static_cast<int64_t>(est + 0.5);
+}
+
+int ObSkipIndexHLL::from_datum(const ObDatum &datum)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(datum.is_null() || datum.is_ext() || HLL_SIZE != datum.len_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid hll datum", K(ret), K(datum));
+  } else {
+    const uint8_t *buf = reinterpret_cast<const uint8_t *>(datum.ptr_);
+    for (int64_t i = 0; i < REGISTER_CNT; ++i) {
+      const int64_t bit_pos = i * REGISTER_VALUE_BITS;
+      const uint16_t two_bytes = static_cast<uint16_t>(buf[bit_pos >> 3])
+          | (((bit_pos >> 3) + 1 < HLL_SIZE ? static_cast<uint16_t>(buf[(bit_pos >> 3) + 1]) : 0) << 8);
+      registers_[i] = (two_bytes >> (bit_pos & 7)) & MAX_REGISTER_VALUE;
     }
   }
   return ret;
 }
 
+void ObSkipIndexHLL::pack(char *buf) const
+{
+  uint8_t *dst = reinterpret_cast<uint8_t *>(buf);
+  MEMSET(dst, 0, HLL_SIZE);
+  for (int64_t i = 0; i < REGISTER_CNT; ++i) {
+    const int64_t bit_pos = i * REGISTER_VALUE_BITS;
+    const uint16_t value = static_cast<uint16_t>(registers_[i]) << (bit_pos & 7);
+    dst[bit_pos >> 3] |= static_cast<uint8_t>(value);
+    if ((bit_pos >> 3) + 1 < HLL_SIZE) {
+      dst[(bit_pos >> 3) + 1] |= static_cast<uint8_t>(value >> 8);
+    }
+  }
+}
+
+static OB_INLINE float round_down_to_float(const double value)
+{
+  const float ret = static_cast<float>(value);
+  return ret > value ? std::nextafter(ret, -FLT_MAX) : ret;
+}
+
+static OB_INLINE float round_up_to_float(const double value)
+{
+  const float ret = static_cast<float>(value);
+  return ret < value ? std::nextafter(ret, FLT_MAX) : ret;
+}
+
+static OB_INLINE double distance_to_range(const double value, const float min, const float max)
+{
+  return value < min ? min - value : (value > max ? value - max : 0);
+}
+
+void ObSkipIndexVectorBound::reset()
+{
+  for (int64_t i = 0; i < GROUP_CNT; ++i) {
+    proj_min_[i] = FLT_MAX;
+    proj_max_[i] = -FLT_MAX;
+  }
+  norm_min_ = FLT_MAX;
+  norm_max_ = -FLT_MAX;
+  has_null_ = false;
+}
+
+int ObSkipIndexVectorBound::add(const char *data, const int64_t dim)
+{
+  int ret = OB_SUCCESS;
+  double proj[GROUP_CNT];
+  double norm_square = 0;
+  for (int64_t i = 0; OB_SUCC(ret) && i < GROUP_CNT; ++i) {
+    const int64_t begin = get_group_begin(i, dim);
+    const int64_t end = get_group_begin(i + 1, dim);
+    double sum = 0;
+    for (int64_t j = begin; OB_SUCC(ret) && j < end; ++j) {
+      float value = 0;
+      MEMCPY(&value, data + j * sizeof(float), sizeof(float));
+      if (OB_UNLIKELY(!std::isfinite(value))) {
+        ret = OB_INVALID_ARGUMENT;
+        LOG_WARN("non-finite vector element", K(ret), K(j), K(dim));
+      } else {
+        sum += value;
+        norm_square += static_cast<double>(value) * value;
+      }
+    }
+    proj[i] = end > begin ? sum / std::sqrt(static_cast<double>(end - begin)) : 0;
+  }
+  const double norm = std::sqrt(norm_square);
+  if (OB_FAIL(ret)) {
+  } else if (OB_UNLIKELY(norm > FLT_MAX)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("vector norm out of float range", K(ret), K(norm), K(dim));
+  } else {
+    // |proj| <= norm, so none of the bounds overflows
+    for (int64_t i = 0; i < GROUP_CNT; ++i) {
+      proj_min_[i] = MIN(proj_min_[i], round_down_to_float(proj[i]));
+      proj_max_[i] = MAX(proj_max_[i], round_up_to_float(proj[i]));
+    }
+    norm_min_ = MIN(norm_min_, round_down_to_float(norm));
+    norm_max_ = MAX(norm_max_, round_up_to_float(norm));
+  }
+  return ret;
+}
+
+void ObSkipIndexVectorBound::merge(const ObSkipIndexVectorBound &other)
+{
+  for (int64_t i = 0; i < GROUP_CNT; ++i) {
+    proj_min_[i] = MIN(proj_min_[i], other.proj_min_[i]);
+    proj_max_[i] = MAX(proj_max_[i], other.proj_max_[i]);
+  }
+  norm_min_ = MIN(norm_min_, other.norm_min_);
+  norm_max_ = MAX(norm_max_, other.norm_max_);
+  has_null_ = has_null_ || other.has_null_;
+}
+
+double ObSkipIndexVectorBound::get_l2_distance_lower_bound(const float *query, const int64_t dim) const
+{
+  // l2 distance is accumulated in float, keep some room for its rounding error
+  static constexpr double DISTANCE_ROUNDING_SLACK = 1e-4;
+  double proj_distance_square = 0;
+  double norm_square = 0;
+  for (int64_t i = 0; i < GROUP_CNT; ++i) {
+    const int64_t begin = get_group_begin(i, dim);
+    const int64_t end = get_group_begin(i + 1, dim);
+    double sum = 0;
+    for (int64_t j = begin; j < end; ++j) {
+      sum += query[j];
+      norm_square += static_cast<double>(query[j]) * query[j];
+    }
+    const double proj = end > begin ? sum / std::sqrt(static_cast<double>(end - begin)) : 0;
+    const double proj_distance = distance_to_range(proj, proj_min_[i], proj_max_[i]);
+    proj_distance_square += proj_distance * proj_distance;
+  }
+  const double norm_distance = distance_to_range(std::sqrt(norm_square), norm_min_, norm_max_);
+  return MAX(std::sqrt(proj_distance_square), norm_distance) * (1 - DISTANCE_ROUNDING_SLACK);
+}
+
+int ObSkipIndexVectorBound::from_datum(const ObDatum &datum)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(datum.is_null() || datum.is_ext() || VECTOR_BOUND_SIZE != datum.len_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid vector bound datum", K(ret), K(datum));
+  } else {
+    const char *buf = datum.ptr_;
+    MEMCPY(proj_min_, buf, sizeof(proj_min_));
+    MEMCPY(proj_max_, buf + sizeof(proj_min_), sizeof(proj_max_));
+    MEMCPY(&norm_min_, buf + sizeof(proj_min_) + sizeof(proj_max_), sizeof(float));
+    MEMCPY(&norm_max_, buf + sizeof(proj_min_) + sizeof(proj_max_) + sizeof(float), sizeof(float));
+    has_null_ = std::signbit(norm_min_);
+    norm_min_ = std::fabs(norm_min_);
+  }
+  return ret;
+}
+
+void ObSkipIndexVectorBound::pack(char *buf) const
+{
+  // norm_min_ is either a norm or FLT_MAX, so the sign bit is free
+  const float stored_norm_min = has_null_ ? -norm_min_ : norm_min_;
+  MEMCPY(buf, proj_min_, sizeof(proj_min_));
+  MEMCPY(buf + sizeof(proj_min_), proj_max_, sizeof(proj_max_));
+  MEMCPY(buf + sizeof(proj_min_) + sizeof(proj_max_), &stored_norm_min, sizeof(float));
+  MEMCPY(buf + sizeof(proj_min_) + sizeof(proj_max_) + sizeof(float), &norm_max_, sizeof(float));
+}
+
 int get_prefix_for_string_tc_datum(
     const ObDatum &orig_datum,
     const ObObjType obj_type,
@@ -19,6 +19,8 @@
 
 #include "share/datum/ob_datum.h"
 #include "common/ob_version_def.h"
+#include "lib/container/ob_array_wrap.h"
+#include "lib/container/ob_iarray.h"
 
 namespace oceanbase
 {
@@ -31,12 +33,17 @@ struct ObSkipIndexColumnAttr;
 }
 namespace blocksstable
 {
-// Only MIN_MAX skipping index is supported now.
+// MIN_MAX skips by min / max / null count, NGRAM_BLOOM_FILTER skips blocks that can not
+// contain the literals of a LIKE pattern,
+// VECTOR_BOUND skips blocks with all vectors too far from the query vector of an l2 distance
+// range filter or of a topn filter ordered by l2 distance,
+// BLOOM_FILTER skips blocks that can not contain any value of an EQ / IN filter.
 enum ObSkipIndexType : uint8_t
 {
   MIN_MAX,
-  BLOOM_FILTER,
   NGRAM_BLOOM_FILTER,
+  VECTOR_BOUND,
+  BLOOM_FILTER,
   MAX_TYPE
 };
 
@@ -49,6 +56,10 @@ enum ObSkipIndexColType : uint8_t
   SK_IDX_SUM,
   SK_IDX_BM25_MAX_SCORE_TOKEN_FREQ,
   SK_IDX_BM25_MAX_SCORE_DOC_LEN,
+  SK_IDX_NGRAM_BLOOM_FILTER,
+  SK_IDX_HLL,
+  SK_IDX_VECTOR_BOUND,
+  SK_IDX_BLOOM_FILTER,
   SK_IDX_MAX_COL_TYPE
 };
 
@@ -57,7 +68,9 @@ struct ObSkipIndexColMeta
   // For data with length larger than 40 bytes(normally string), we will store the prefix as min/max
   static constexpr int64_t MAX_SKIP_INDEX_COL_LENGTH = 40;
   static constexpr int64_t SKIP_INDEX_ROW_SIZE_LIMIT = 1 << 10; // 1kb
-  static constexpr int64_t MAX_AGG_COLUMN_PER_ROW = 6; // min (loose_min) / max (loose_max) / null count / sum / bm25 params
+  // min (loose_min) / max (loose_max) / null count / sum / bm25 params / ngram bloom filter / hll / vector bound
+  // / bloom filter
+  static constexpr int64_t MAX_AGG_COLUMN_PER_ROW = 10;
   static constexpr ObObjDatumMapType NULL_CNT_COL_TYPE = OBJ_DATUM_8BYTE_DATA;
   static_assert(common::OBJ_DATUM_NUMBER_RES_SIZE == MAX_SKIP_INDEX_COL_LENGTH,
       "Buffer size of ObStorageDatum and maximum size of skip index data is equal to maximum size of ObNumber");
@@ -187,6 +200,50 @@ OB_INLINE static bool can_agg_sum(const ObObjType &obj_type)
       && ob_obj_type_class(obj_type) != ObObjTypeClass::ObBitTC;
 }
 
+// Values are hashed with the hash function of the column type, which agrees with the equality
+// of the type. Float / double (-0.0 and 0.0), decimal int (stored width depends on precision)
+// and lob types are not supported.
+OB_INLINE static bool can_agg_value_hash(const ObObjType &obj_type)
+{
+  const ObObjTypeClass tc = ob_obj_type_class(obj_type);
+  return ObIntTC == tc || ObUIntTC == tc || ObNumberTC == tc || ObDateTimeTC == tc
+      || ObDateTC == tc || ObTimeTC == tc || ObYearTC == tc || ObStringTC == tc
+      || ObMySQLDateTC == tc || ObMySQLDateTimeTC == tc;
+}
+
+// Ngram bloom filter, hll, vector bound and bloom filter can not be read by observers of an older data version,
+// so they are only written once the major working version allows it.
+OB_INLINE static bool is_sketch_skip_index_supported(const int64_t major_working_cluster_version)
+{
+  return major_working_cluster_version >= DATA_VERSION_1_1_0_0;
+}
+
+// Trigrams are built on bytes, so LIKE can only be checked with them under collations comparing
+// bytes.
+OB_INLINE static bool can_agg_ngram_bloom_filter(const ObObjType &obj_type, const ObCollationType cs_type)
+{
+  return ob_is_string_tc(obj_type) && (CS_TYPE_BINARY == cs_type || CS_TYPE_UTF8MB4_BIN == cs_type);
+}
+
+// Dense float vectors, stored as the raw float array in a lob. The element type of a vector
+// column is only known from its extended type info, VECTOR(dim) for float vectors.
+OB_INLINE static bool can_agg_vector_bound(const ObObjType &obj_type)
+{
+  return ob_is_collection_sql_type(obj_type);
+}
+
+OB_INLINE static bool can_agg_vector_bound(
+    const ObObjType &obj_type,
+    const common::ObIArray<common::ObString> &extended_type_info)
+{
+  bool bool_ret = false;
+  if (can_agg_vector_bound(obj_type) && 1 == extended_type_info.count()) {
+    const common::ObString &type_info = extended_type_info.at(0);
+    bool_ret = type_info.prefix_match("VECTOR(") && nullptr == type_info.find(',');
+  }
+  return bool_ret;
+}
+
 OB_INLINE static int get_sum_store_size(const ObObjType &obj_type, uint32_t &sum_size)
 {
   int ret = OB_SUCCESS;
@@ -218,6 +275,196 @@ OB_INLINE static int get_sum_store_size(const ObObjType &obj_type, uint32_t &sum
   return ret;
 }
 
+// 256 bits bloom filter of the byte trigrams of the values in a block.
+// It is stored as nop once more than half of the bits are set, so it is mostly useful for
+// micro blocks of short strings with a few dozen distinct trigrams.
+struct ObSkipIndexBloomFilter final
+{
+public:
+  static constexpr int64_t BLOOM_FILTER_SIZE = 32;
+  static constexpr int64_t BIT_CNT = BLOOM_FILTER_SIZE * 8;
+  static constexpr int64_t HASH_CNT = 3;
+  static constexpr int64_t NGRAM_LEN = 3;
+  static constexpr uint64_t NGRAM_HASH_SEED = 0x9e3779b97f4a7c15;
+  static_assert(BIT_CNT == 256, "each hash takes 8 bits of the 64 bits hash value");
+  ObSkipIndexBloomFilter() { reset(); }
+  ~ObSkipIndexBloomFilter() = default;
+  OB_INLINE void reset() { MEMSET(bits_, 0, sizeof(bits_)); }
+  OB_INLINE void insert(const uint64_t hash)
+  {
+    for (int64_t i = 0; i < HASH_CNT; ++i) {
+      const uint8_t bit = static_cast<uint8_t>(hash >> (i * 8));
+      bits_[bit >> 3] |= static_cast<uint8_t>(1 << (bit & 7));
+    }
+  }
+  OB_INLINE bool may_contain(const uint64_t hash) const
+  {
+    bool bool_ret = true;
+    for (int64_t i = 0; bool_ret && i < HASH_CNT; ++i) {
+      const uint8_t bit = static_cast<uint8_t>(hash >> (i * 8));
+      bool_ret = 0 != (bits_[bit >> 3] & (1 << (bit & 7)));
+    }
+    return bool_ret;
+  }
+  void insert_ngrams(const char *str, const int64_t len);
+  // false if a trigram of the literal runs between wildcards of a LIKE pattern is absent,
+  // a multi-byte %escape is not supported and the pattern is taken as matching then
+  bool may_match_like_pattern(const ObString &pattern, const ObString &escape) const;
+  void merge(const ObSkipIndexBloomFilter &other);
+  int64_t get_set_bit_cnt() const;
+  OB_INLINE bool is_saturated() const { return get_set_bit_cnt() > BIT_CNT / 2; }
+  int from_datum(const ObDatum &datum);
+  OB_INLINE const char *get_data() const { return reinterpret_cast<const char *>(bits_); }
+  OB_INLINE static int64_t get_data_size() { return BLOOM_FILTER_SIZE; }
+  TO_STRING_KV("set_bit_cnt", get_set_bit_cnt());
+private:
+  uint8_t bits_[BLOOM_FILTER_SIZE];
+};
+
+// Bloom filter of the value hashes in a block, sized to the block.
+// Values are inserted into MAX_SIZE bytes and the filter is folded in halves (bit i and bit
+// i + size / 2 or-ed together) while it stays at most half full, so a micro block keeps about
+// 5 bits per distinct value and the cell does not grow with the rows of the block. A bit index
+// is the hash masked by the bit count, so a folded filter answers the same as the full one
+// with more false positives, and filters of different sizes merge at the smaller one.
+// It is stored as nop once more than half of the bits of MAX_SIZE are set, that is beyond
+// about 470 distinct values, and upper level blocks merging many such filters mostly end up as
+// nop, the pruning is done on the micro blocks.
+struct ObSkipIndexValueBloomFilter final
+{
+public:
+  static constexpr int64_t MAX_SIZE = 256;
+  static constexpr int64_t MIN_SIZE = 8;
+  static constexpr int64_t HASH_CNT = 3;
+  static constexpr int64_t HASH_BITS = 21;
+  static constexpr uint64_t VALUE_HASH_SEED = 0;
+  static_assert(MAX_SIZE * 8 <= (1L << HASH_BITS), "each hash takes HASH_BITS bits of the 64 bits hash value");
+  static_assert(0 == (MAX_SIZE & (MAX_SIZE - 1)) && 0 == (MIN_SIZE & (MIN_SIZE - 1)),
+      "sizes should be powers of 2 to be folded");
+  ObSkipIndexValueBloomFilter() { reset(); }
+  ~ObSkipIndexValueBloomFilter() = default;
+  OB_INLINE void reset()
+  {
+    MEMSET(bits_, 0, sizeof(bits_));
+    size_ = MAX_SIZE;
+  }
+  OB_INLINE void insert(const uint64_t hash)
+  {
+    const uint64_t mask = size_ * 8 - 1;
+    for (int64_t i = 0; i < HASH_CNT; ++i) {
+      const uint64_t bit = (hash >> (i * HASH_BITS)) & mask;
+      bits_[bit >> 3] |= static_cast<uint8_t>(1 << (bit & 7));
+    }
+  }
+  OB_INLINE bool may_contain(const uint64_t hash) const
+  {
+    const uint64_t mask = size_ * 8 - 1;
+    bool bool_ret = true;
+    for (int64_t i = 0; bool_ret && i < HASH_CNT; ++i) {
+      const uint64_t bit = (hash >> (i * HASH_BITS)) & mask;
+      bool_ret = 0 != (bits_[bit >> 3] & (1 << (bit & 7)));
+    }
+    return bool_ret;
+  }
+  // folds to the smaller size of the two before or-ing
+  void merge(const ObSkipIndexValueBloomFilter &other);
+  // folds in halves while the result is at most half full
+  void shrink();
+  int64_t get_set_bit_cnt() const;
+  OB_INLINE bool is_saturated() const { return get_set_bit_cnt() > size_ * 8 / 2; }
+  int from_datum(const ObDatum &datum);
+  OB_INLINE const char *get_data() const { return reinterpret_cast<const char *>(bits_); }
+  OB_INLINE int64_t get_data_size() const { return size_; }
+  TO_STRING_KV(K_(size), "set_bit_cnt", get_set_bit_cnt());
+private:
+  void fold_to(const int64_t size);
+private:
+  uint8_t bits_[MAX_SIZE];
+  int64_t size_;
+};
+
+// HyperLogLog of the values in a block with 64 registers of 5 bits, about 13% standard error.
+struct ObSkipIndexHLL final
+{
+public:
+  static constexpr int64_t REGISTER_IDX_BITS = 6;
+  static constexpr int64_t REGISTER_CNT = 1L << REGISTER_IDX_BITS;
+  static constexpr int64_t REGISTER_VALUE_BITS = 5;
+  static constexpr uint8_t MAX_REGISTER_VALUE = (1 << REGISTER_VALUE_BITS) - 1;
+  static constexpr int64_t HLL_SIZE = REGISTER_CNT * REGISTER_VALUE_BITS / 8;
+  static constexpr uint64_t VALUE_HASH_SEED = 0;
+  static_assert(HLL_SIZE <= ObSkipIndexColMeta::MAX_SKIP_INDEX_COL_LENGTH, "hll should fit in a skip index cell");
+  ObSkipIndexHLL() { reset(); }
+  ~ObSkipIndexHLL() = default;
+  OB_INLINE void reset() { MEMSET(registers_, 0, sizeof(registers_)); }
+  OB_INLINE void insert(const uint64_t hash)
+  {
+    const int64_t idx = hash & (REGISTER_CNT - 1);
+    const uint64_t w = hash >> REGISTER_IDX_BITS;
+    const uint8_t rank = 0 == w ? MAX_REGISTER_VALUE
+        : static_cast<uint8_t>(MIN(__builtin_ctzll(w) + 1, MAX_REGISTER_VALUE));
+    if (rank > registers_[idx]) {
+      registers_[idx] = rank;
+    }
+  }
+  void merge(const ObSkipIndexHLL &other);
+  int64_t estimate() const;
+  int from_datum(const ObDatum &datum);
+  // writes HLL_SIZE bytes
+  void pack(char *buf) const;
+  TO_STRING_KV("ndv", estimate());
+private:
+  uint8_t registers_[REGISTER_CNT];
+};
+
+// Bounds of the vectors in a block, which can not afford a full dimension centroid in a skip
+// index cell. The dimensions are split into GROUP_CNT contiguous groups and each vector x is
+// projected on the orthonormal directions u_j = (sum of unit vectors of group j) / sqrt(|group j|).
+// The l2 distance from q to any x in the block is at least
+//   max(sqrt(sum_j dist(u_j * q, [proj_min_j, proj_max_j])^2), dist(|q|, [norm_min, norm_max]))
+// by Bessel's inequality and the triangle inequality.
+// Stored as the GROUP_CNT projection ranges and the norm range in floats, the sign bit of the
+// stored min norm tells whether the block has null vectors.
+struct ObSkipIndexVectorBound final
+{
+public:
+  static constexpr int64_t GROUP_CNT = 4;
+  static constexpr int64_t VECTOR_BOUND_SIZE = (GROUP_CNT + 1) * 2 * sizeof(float);
+  static_assert(VECTOR_BOUND_SIZE <= ObSkipIndexColMeta::MAX_SKIP_INDEX_COL_LENGTH,
+      "vector bound should fit in a skip index cell");
+  ObSkipIndexVectorBound() { reset(); }
+  ~ObSkipIndexVectorBound() = default;
+  void reset();
+  // no vector but nulls in the block
+  OB_INLINE bool is_empty() const { return norm_min_ > norm_max_; }
+  OB_INLINE bool has_null() const { return has_null_; }
+  OB_INLINE void set_has_null() { has_null_ = true; }
+  // data is the raw float array of a vector, not necessarily aligned,
+  // returns OB_INVALID_ARGUMENT on nan / inf elements
+  int add(const char *data, const int64_t dim);
+  void merge(const ObSkipIndexVectorBound &other);
+  // a lower bound of the l2 distance from query to the vectors in the block, slightly loosened
+  // to cover the rounding of the distance computed in float
+  double get_l2_distance_lower_bound(const float *query, const int64_t dim) const;
+  int from_datum(const ObDatum &datum);
+  // writes VECTOR_BOUND_SIZE bytes
+  void pack(char *buf) const;
+  TO_STRING_KV("proj_min", common::ObArrayWrap<float>(proj_min_, GROUP_CNT),
+               "proj_max", common::ObArrayWrap<float>(proj_max_, GROUP_CNT),
+               K_(norm_min), K_(norm_max), K_(has_null));
+private:
+  OB_INLINE static int64_t get_group_begin(const int64_t group_idx, const int64_t dim)
+  {
+    return group_idx * dim / GROUP_CNT;
+  }
+private:
+  float proj_min_[GROUP_CNT];
+  float proj_max_[GROUP_CNT];
+  float norm_min_;
+  float norm_max_;
+  bool has_null_;
+};
+
 OB_INLINE static bool non_baseline_enabled_agg_type(const ObSkipIndexColType &col_type)
 {
   return ObSkipIndexColType::SK_IDX_BM25_MAX_SCORE_TOKEN_FREQ == col_type
@@ -16,6 +16,11 @@
 
 #define USING_LOG_PREFIX STORAGE
 #include "storage/blocksstable/index_block/ob_skip_index_filter_executor.h"
+#include "share/datum/ob_datum_funcs.h"
+#include "sql/engine/expr/ob_array_expr_utils.h"
+#include "sql/engine/expr/ob_expr_topn_filter.h"
+#include "sql/engine/expr/ob_expr_vector.h"
+#include "sql/engine/ob_exec_context.h"
 namespace oceanbase
 {
 namespace blocksstable
@@ -126,6 +131,35 @@ int ObSkipIndexFilterExecutor::falsifiable_pushdown_filter(
         }
         break;
       }
+      case ObSkipIndexType::NGRAM_BLOOM_FILTER: {
+        if (OB_UNLIKELY(!filter.is_filter_black_node())) {
+          ret = OB_INVALID_ARGUMENT;
+          LOG_WARN("Invalid filter for ngram bloom filter skip index", K(ret), K(filter));
+        } else if (OB_FAIL(filter_on_ngram_bloom_filter(col_idx, obj_meta,
+            static_cast<sql::ObBlackFilterExecutor &>(filter)))) {
+          LOG_WARN("Failed to filter on ngram bloom filter", K(ret), K(col_idx));
+        }
+        break;
+      }
+      case ObSkipIndexType::VECTOR_BOUND: {
+        if (OB_UNLIKELY(!filter.is_filter_black_node())) {
+          ret = OB_INVALID_ARGUMENT;
+          LOG_WARN("Invalid filter for vector bound skip index", K(ret), K(filter));
+        } else if (OB_FAIL(filter_on_vector_bound(col_idx, static_cast<sql::ObBlackFilterExecutor &>(filter)))) {
+          LOG_WARN("Failed to filter on vector bound", K(ret), K(col_idx));
+        }
+        break;
+      }
+      case ObSkipIndexType::BLOOM_FILTER: {
+        if (OB_UNLIKELY(!filter.is_filter_white_node())) {
+          ret = OB_INVALID_ARGUMENT;
+          LOG_WARN("Invalid filter for bloom filter skip index", K(ret), K(filter));
+        } else if (OB_FAIL(filter_on_bloom_filter(col_idx, obj_meta,
+            static_cast<sql::ObWhiteFilterExecutor &>(filter)))) {
+          LOG_WARN("Failed to filter on bloom filter", K(ret), K(col_idx));
+        }
+        break;
+      }
       default :
         ret = OB_NOT_SUPPORTED;
         LOG_WARN("unsupported skip index type", K(ret), K(index_type));
@@ -675,5 +709,297 @@ int ObSkipIndexFilterExecutor::black_filter_on_min_max(
   return ret;
 }
 
+int ObSkipIndexFilterExecutor::filter_on_bloom_filter(
+    const uint32_t col_idx,
+    const ObObjMeta &obj_meta,
+    sql::ObWhiteFilterExecutor &filter)
+{
+  int ret = OB_SUCCESS;
+  sql::ObBoolMask &fal_desc = filter.get_filter_bool_mask();
+  const common::ObIArray<common::ObDatum> &datums = filter.get_datums();
+  ObStorageDatum bloom_datum;
+  ObSkipIndexValueBloomFilter bloom_filter;
+  if (filter.null_param_contained() || datums.empty() || obj_meta.is_fixed_len_char_type()) {
+    // values may differ from the stored ones in trailing spaces, leave it to min max
+  } else if (FALSE_IT(meta_.col_idx_ = col_idx)) {
+  } else if (FALSE_IT(meta_.col_type_ = SK_IDX_BLOOM_FILTER)) {
+  } else if (OB_FAIL(agg_row_reader_.read(meta_, bloom_datum))) {
+    LOG_WARN("Failed read agg bloom filter", K(ret), K(meta_));
+  } else if (bloom_datum.is_null() || bloom_datum.is_nop()) {
+    // not aggregated or saturated
+  } else if (OB_FAIL(bloom_filter.from_datum(bloom_datum))) {
+    LOG_WARN("Failed to read bloom filter", K(ret), K(bloom_datum));
+  } else {
+    const sql::ObExprBasicFuncs *basic_funcs =
+        ObDatumFuncs::get_basic_func(obj_meta.get_type(), obj_meta.get_collation_type());
+    bool may_contain = false;
+    if (OB_ISNULL(basic_funcs)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("Unexpected null basic funcs", K(ret), K(obj_meta));
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && !may_contain && i < datums.count(); ++i) {
+      uint64_t hash = 0;
+      if (OB_FAIL(basic_funcs->murmur_hash_v2_(datums.at(i), ObSkipIndexValueBloomFilter::VALUE_HASH_SEED, hash))) {
+        LOG_WARN("Failed to calc hash", K(ret), K(datums.at(i)));
+      } else {
+        may_contain = bloom_filter.may_contain(hash);
+      }
+    }
+    if (OB_SUCC(ret) && !may_contain) {
+      fal_desc.set_always_false();
+    }
+  }
+  LOG_DEBUG("[SKIP INDEX] filter on bloom filter", K(ret), K(col_idx), K(bloom_filter), K(fal_desc));
+  return ret;
+}
+
+int ObSkipIndexFilterExecutor::filter_on_ngram_bloom_filter(
+    const uint32_t col_idx,
+    const ObObjMeta &obj_meta,
+    sql::ObBlackFilterExecutor &filter)
+{
+  int ret = OB_SUCCESS;
+  sql::ObBoolMask &fal_desc = filter.get_filter_bool_mask();
+  sql::ObEvalCtx &eval_ctx = filter.get_op().get_eval_ctx();
+  const sql::ObExpr *like_expr = nullptr;
+  ObDatum *pattern = nullptr;
+  ObDatum *escape = nullptr;
+  ObStorageDatum bloom_datum;
+  ObSkipIndexBloomFilter bloom_filter;
+  if (OB_UNLIKELY(1 != filter.get_filter_node().filter_exprs_.count())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid filter for ngram bloom filter", K(ret), K(filter));
+  } else if (OB_ISNULL(like_expr = filter.get_filter_node().filter_exprs_.at(0))
+      || OB_UNLIKELY(3 != like_expr->arg_cnt_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Unexpected like expr", K(ret), KP(like_expr));
+  } else if (obj_meta.is_fixed_len_char_type()) {
+    // trailing spaces are trimmed or padded, leave it to the filter
+  } else if (OB_FAIL(like_expr->args_[1]->eval(eval_ctx, pattern))) {
+    LOG_WARN("Failed to eval like pattern", K(ret));
+  } else if (OB_FAIL(like_expr->args_[2]->eval(eval_ctx, escape))) {
+    LOG_WARN("Failed to eval like escape", K(ret));
+  } else if (pattern->is_null() || escape->is_null()) {
+  } else if (FALSE_IT(meta_.col_idx_ = col_idx)) {
+  } else if (FALSE_IT(meta_.col_type_ = SK_IDX_NGRAM_BLOOM_FILTER)) {
+  } else if (OB_FAIL(agg_row_reader_.read(meta_, bloom_datum))) {
+    LOG_WARN("Failed read agg ngram bloom filter", K(ret), K(meta_));
+  } else if (bloom_datum.is_null() || bloom_datum.is_nop()) {
+    // not aggregated or saturated
+  } else if (OB_FAIL(bloom_filter.from_datum(bloom_datum))) {
+    LOG_WARN("Failed to read ngram bloom filter", K(ret), K(bloom_datum));
+  } else if (!bloom_filter.may_match_like_pattern(pattern->get_string(), escape->get_string())) {
+    fal_desc.set_always_false();
+  }
+  LOG_DEBUG("[SKIP INDEX] filter on ngram bloom filter", K(ret), K(col_idx), K(bloom_filter), K(fal_desc));
+  return ret;
+}
+
+bool ObSkipIndexFilterExecutor::extract_vector_distance_filter(
+    const sql::ObPhysicalFilterExecutor &filter,
+    ObVectorDistanceFilterInfo &info)
+{
+  bool bool_ret = false;
+  if (filter.is_filter_black_node()) {
+    const sql::ObBlackFilterExecutor &black_filter = static_cast<const sql::ObBlackFilterExecutor &>(filter);
+    const sql::ObPushdownBlackFilterNode &filter_node = black_filter.get_filter_node();
+    const sql::ObExpr *expr = 1 == filter_node.filter_exprs_.count() ? filter_node.filter_exprs_.at(0) : nullptr;
+    const sql::ObExpr *distance_expr = nullptr;
+    if (1 != filter_node.col_ids_.count() || nullptr == expr) {
+    } else if (T_OP_PUSHDOWN_TOPN_FILTER == expr->type_ && expr->arg_cnt_ > 0) {
+      distance_expr = expr->args_[0];
+      info.topn_filter_expr_ = expr;
+    } else if (2 != expr->arg_cnt_) {
+    } else if (T_OP_LT == expr->type_ || T_OP_LE == expr->type_) {
+      distance_expr = expr->args_[0];
+      info.radius_expr_ = expr->args_[1];
+      info.is_radius_inclusive_ = T_OP_LE == expr->type_;
+    } else if (T_OP_GT == expr->type_ || T_OP_GE == expr->type_) {
+      distance_expr = expr->args_[1];
+      info.radius_expr_ = expr->args_[0];
+      info.is_radius_inclusive_ = T_OP_GE == expr->type_;
+    }
+    if (nullptr == distance_expr) {
+    } else if (nullptr != info.radius_expr_
+        && (!info.radius_expr_->is_static_const_
+            || !(ob_is_double_tc(info.radius_expr_->datum_meta_.type_)
+                 || ob_is_float_tc(info.radius_expr_->datum_meta_.type_)))) {
+    } else if (!((T_FUN_SYS_L2_DISTANCE == distance_expr->type_ && 2 == distance_expr->arg_cnt_)
+                 || (T_FUN_SYS_VECTOR_DISTANCE == distance_expr->type_
+                     && (2 == distance_expr->arg_cnt_
+                         || (3 == distance_expr->arg_cnt_ && distance_expr->args_[2]->is_static_const_))))) {
+    } else {
+      const int64_t col_arg_idx = T_REF_COLUMN == distance_expr->args_[0]->type_ ? 0 : 1;
+      const sql::ObExpr *col_expr = distance_expr->args_[col_arg_idx];
+      const sql::ObExpr *query_expr = distance_expr->args_[1 - col_arg_idx];
+      if (T_REF_COLUMN == col_expr->type_
+          && can_agg_vector_bound(col_expr->datum_meta_.type_)
+          && query_expr->is_static_const_) {
+        info.col_expr_ = col_expr;
+        info.query_expr_ = query_expr;
+        info.metric_expr_ = 3 == distance_expr->arg_cnt_ ? distance_expr->args_[2] : nullptr;
+        bool_ret = true;
+      }
+    }
+  }
+  return bool_ret;
+}
+
+int ObSkipIndexFilterExecutor::filter_on_vector_bound(
+    const uint32_t col_idx,
+    sql::ObBlackFilterExecutor &filter)
+{
+  int ret = OB_SUCCESS;
+  sql::ObBoolMask &fal_desc = filter.get_filter_bool_mask();
+  sql::ObEvalCtx &eval_ctx = filter.get_op().get_eval_ctx();
+  ObVectorDistanceFilterInfo info;
+  ObStorageDatum bound_datum;
+  ObSkipIndexVectorBound vector_bound;
+  double max_distance = 0;
+  bool is_inclusive = false;
+  bool has_max_distance = false;
+  if (OB_UNLIKELY(!extract_vector_distance_filter(filter, info))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid filter for vector bound", K(ret), K(filter));
+  } else if (OB_FAIL(get_max_distance(info, eval_ctx, max_distance, is_inclusive, has_max_distance))) {
+    LOG_WARN("Failed to get max distance", K(ret), K(info));
+  } else if (!has_max_distance) {
+  } else if (FALSE_IT(meta_.col_idx_ = col_idx)) {
+  } else if (FALSE_IT(meta_.col_type_ = SK_IDX_VECTOR_BOUND)) {
+  } else if (OB_FAIL(agg_row_reader_.read(meta_, bound_datum))) {
+    LOG_WARN("Failed read agg vector bound", K(ret), K(meta_));
+  } else if (bound_datum.is_null() || bound_datum.is_nop()) {
+    // not aggregated, outrow or non-finite vectors
+  } else if (OB_FAIL(vector_bound.from_datum(bound_datum))) {
+    LOG_WARN("Failed to read vector bound", K(ret), K(bound_datum));
+  } else if (vector_bound.has_null() && nullptr != info.topn_filter_expr_) {
+    // rows with null sort key are never filtered out by the topn filter
+  } else if (vector_bound.is_empty()) {
+    // distance to null vectors is null
+    fal_desc.set_always_false();
+  } else if (OB_FAIL(prepare_query_vector(filter, info, eval_ctx))) {
+    LOG_WARN("Failed to prepare query vector", K(ret), K(info));
+  } else if (nullptr != query_vector_) {
+    const double lower_bound = vector_bound.get_l2_distance_lower_bound(query_vector_, query_vector_dim_);
+    if (is_inclusive ? lower_bound > max_distance : lower_bound >= max_distance) {
+      fal_desc.set_always_false();
+    }
+  }
+  LOG_DEBUG("[SKIP INDEX] filter on vector bound", K(ret), K(col_idx), K(vector_bound),
+      K(max_distance), K(is_inclusive), K(fal_desc));
+  return ret;
+}
+
+int ObSkipIndexFilterExecutor::get_max_distance(
+    const ObVectorDistanceFilterInfo &info,
+    sql::ObEvalCtx &eval_ctx,
+    double &max_distance,
+    bool &is_inclusive,
+    bool &has_max_distance)
+{
+  int ret = OB_SUCCESS;
+  ObDatum *datum = nullptr;
+  bool is_l2_distance = true;
+  has_max_distance = false;
+  if (nullptr != info.metric_expr_) {
+    if (OB_FAIL(info.metric_expr_->eval(eval_ctx, datum))) {
+      LOG_WARN("Failed to eval distance metric", K(ret));
+    } else {
+      is_l2_distance = !datum->is_null() && sql::ObExprVectorDistance::EUCLIDEAN == datum->get_int();
+    }
+  }
+  if (OB_FAIL(ret) || !is_l2_distance) {
+  } else if (nullptr != info.radius_expr_) {
+    if (OB_FAIL(info.radius_expr_->eval(eval_ctx, datum))) {
+      LOG_WARN("Failed to eval distance radius", K(ret));
+    } else if (!datum->is_null()) {
+      max_distance = ob_is_float_tc(info.radius_expr_->datum_meta_.type_) ? datum->get_float() : datum->get_double();
+      is_inclusive = info.is_radius_inclusive_;
+      has_max_distance = !std::isnan(max_distance);
+    }
+  } else if (nullptr != info.topn_filter_expr_) {
+    ObDatum bound;
+    ObObjMeta bound_meta;
+    bool is_ascending = false;
+    bool has_bound = false;
+    if (OB_FAIL(sql::ObExprTopNFilter::get_first_sort_key_bound(
+        *info.topn_filter_expr_, eval_ctx, bound, bound_meta, is_ascending, has_bound))) {
+      LOG_WARN("Failed to get topn filter bound", K(ret));
+    } else if (has_bound && is_ascending && ob_is_double_tc(bound_meta.get_type())) {
+      max_distance = bound.get_double();
+      // rows equal to the heap top may be kept
+      is_inclusive = true;
+      has_max_distance = true;
+    }
+  }
+  return ret;
+}
+
+int ObSkipIndexFilterExecutor::prepare_query_vector(
+    const sql::ObBlackFilterExecutor &filter,
+    const ObVectorDistanceFilterInfo &info,
+    sql::ObEvalCtx &eval_ctx)
+{
+  int ret = OB_SUCCESS;
+  if (&filter != query_vector_filter_) {
+    sql::ObEvalCtx::TempAllocGuard tmp_alloc_g(eval_ctx);
+    common::ObArenaAllocator &tmp_allocator = tmp_alloc_g.get_allocator();
+    common::ObIArrayType *query_array = nullptr;
+    bool is_null = false;
+    int64_t col_dim = 0;
+    if (OB_NOT_NULL(query_vector_)) {
+      allocator_->free(query_vector_);
+      query_vector_ = nullptr;
+    }
+    query_vector_dim_ = 0;
+    query_vector_filter_ = &filter;
+    if (OB_FAIL(get_vector_column_dim(*info.col_expr_, eval_ctx, col_dim))) {
+      LOG_WARN("Failed to get vector column dim", K(ret));
+    } else if (OB_FAIL(sql::ObArrayExprUtils::get_type_vector(*info.query_expr_, eval_ctx, tmp_allocator, query_array, is_null))) {
+      LOG_WARN("Failed to get query vector", K(ret));
+    } else if (is_null || OB_ISNULL(query_array) || 0 == query_array->size()
+        || query_array->get_array_type()->is_sparse_vector_type() || query_array->contain_null()) {
+      // nothing to skip by
+    } else if (col_dim != query_array->size()) {
+      // the bound is grouped by the column dim, and the distance expr reports the mismatch itself
+      LOG_DEBUG("[SKIP INDEX] query vector dim differs from column", K(col_dim), K(query_array->size()));
+    } else if (OB_ISNULL(query_vector_ = static_cast<float *>(allocator_->alloc(sizeof(float) * query_array->size())))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("Failed to alloc query vector", K(ret), K(query_array->size()));
+    } else {
+      MEMCPY(query_vector_, query_array->get_data(), sizeof(float) * query_array->size());
+      query_vector_dim_ = query_array->size();
+    }
+    if (OB_FAIL(ret)) {
+      query_vector_filter_ = nullptr;
+    }
+  }
+  return ret;
+}
+
+int ObSkipIndexFilterExecutor::get_vector_column_dim(
+    const sql::ObExpr &col_expr,
+    sql::ObEvalCtx &eval_ctx,
+    int64_t &dim)
+{
+  int ret = OB_SUCCESS;
+  sql::ObSubSchemaValue value;
+  dim = 0;
+  if (!col_expr.obj_meta_.is_collection_sql_type()) {
+  } else if (OB_FAIL(eval_ctx.exec_ctx_.get_sqludt_meta_by_subschema_id(col_expr.obj_meta_.get_subschema_id(), value))) {
+    LOG_WARN("Failed to get subschema meta", K(ret), K(col_expr.obj_meta_));
+  } else if (OB_UNLIKELY(value.type_ >= sql::OB_SUBSCHEMA_MAX_TYPE)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Invalid subschema type", K(ret), K(value));
+  } else {
+    const common::ObSqlCollectionInfo *coll_info = reinterpret_cast<const common::ObSqlCollectionInfo *>(value.value_);
+    if (OB_NOT_NULL(coll_info) && OB_NOT_NULL(coll_info->collection_meta_)
+        && common::ObNestedType::OB_VECTOR_TYPE == coll_info->collection_meta_->type_id_) {
+      dim = static_cast<const common::ObCollectionArrayType *>(coll_info->collection_meta_)->dim_cnt_;
+    }
+  }
+  return ret;
+}
+
 } // end namespace blocksstable
 } // end namespace oceanbase
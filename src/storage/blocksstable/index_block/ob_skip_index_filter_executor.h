@@ -28,11 +28,30 @@ namespace oceanbase
 namespace blocksstable
 {
 class ObAggRowReader;
+
+// l2 distance between a vector column and a const vector, which is either compared with a const
+// radius or the first sort key of a topn filter
+struct ObVectorDistanceFilterInfo
+{
+  ObVectorDistanceFilterInfo()
+      : col_expr_(nullptr), query_expr_(nullptr), metric_expr_(nullptr), radius_expr_(nullptr),
+        topn_filter_expr_(nullptr), is_radius_inclusive_(false) {}
+  TO_STRING_KV(KP_(col_expr), KP_(query_expr), KP_(metric_expr), KP_(radius_expr), KP_(topn_filter_expr),
+               K_(is_radius_inclusive));
+  const sql::ObExpr *col_expr_;
+  const sql::ObExpr *query_expr_;
+  const sql::ObExpr *metric_expr_; // metric of vector_distance, null for l2_distance
+  const sql::ObExpr *radius_expr_;
+  const sql::ObExpr *topn_filter_expr_;
+  bool is_radius_inclusive_;
+};
+
 class ObSkipIndexFilterExecutor final
 {
 public:
   ObSkipIndexFilterExecutor()
-      : agg_row_reader_(), meta_(), skip_bit_(nullptr), allocator_(nullptr), is_inited_(false) {}
+      : agg_row_reader_(), meta_(), skip_bit_(nullptr), allocator_(nullptr),
+        query_vector_filter_(nullptr), query_vector_(nullptr), query_vector_dim_(0), is_inited_(false) {}
   ~ObSkipIndexFilterExecutor() { reset(); }
   void reset()
   {
@@ -42,7 +61,13 @@ public:
         allocator_->free(skip_bit_);
         skip_bit_ = nullptr;
       }
+      if (OB_NOT_NULL(query_vector_)) {
+        allocator_->free(query_vector_);
+        query_vector_ = nullptr;
+      }
     }
+    query_vector_filter_ = nullptr;
+    query_vector_dim_ = 0;
     allocator_ = nullptr;
     is_inited_ = false;
   }
@@ -54,6 +79,8 @@ public:
                                   sql::ObPhysicalFilterExecutor &filter,
                                   common::ObIAllocator &allocator,
                                   const bool use_vectorize);
+  static bool extract_vector_distance_filter(const sql::ObPhysicalFilterExecutor &filter,
+                                             ObVectorDistanceFilterInfo &info);
 
 private:
   int filter_on_min_max(const uint32_t col_idx,
@@ -140,11 +167,36 @@ private:
                               sql::ObBlackFilterExecutor &filter,
                               common::ObIAllocator &allocator,
                               const bool use_vectorize);
+  // only set always false when none of the values is in the bloom filter, otherwise keep the
+  // bool mask given by min max
+  int filter_on_bloom_filter(const uint32_t col_idx,
+                             const ObObjMeta &obj_meta,
+                             sql::ObWhiteFilterExecutor &filter);
+  int filter_on_ngram_bloom_filter(const uint32_t col_idx,
+                                   const ObObjMeta &obj_meta,
+                                   sql::ObBlackFilterExecutor &filter);
+  // set always false when the lower bound of the l2 distance from the query vector to the block
+  // is beyond the radius or the heap top of the topn filter
+  int filter_on_vector_bound(const uint32_t col_idx, sql::ObBlackFilterExecutor &filter);
+  int get_max_distance(const ObVectorDistanceFilterInfo &info,
+                       sql::ObEvalCtx &eval_ctx,
+                       double &max_distance,
+                       bool &is_inclusive,
+                       bool &has_max_distance);
+  // dim of a vector column, 0 for other column types
+  static int get_vector_column_dim(const sql::ObExpr &col_expr, sql::ObEvalCtx &eval_ctx, int64_t &dim);
+  // the query vector is a static const, so it is only read once for a filter
+  int prepare_query_vector(const sql::ObBlackFilterExecutor &filter,
+                           const ObVectorDistanceFilterInfo &info,
+                           sql::ObEvalCtx &eval_ctx);
 private:
   ObAggRowReader agg_row_reader_;
   ObSkipIndexColMeta meta_;
   sql::ObBitVector *skip_bit_;      // to be compatible with the black filter filter() method
   common::ObIAllocator *allocator_;
+  const sql::ObBlackFilterExecutor *query_vector_filter_;
+  float *query_vector_;
+  int64_t query_vector_dim_;
   bool is_inited_;
   DISALLOW_COPY_AND_ASSIGN(ObSkipIndexFilterExecutor);
 };
@@ -45,6 +45,10 @@ int ObFTDictHub::init()
 int ObFTDictHub::destroy()
 {
   int ret = OB_SUCCESS;
+  for (int64_t i = 0; i < MAX_IMAGE_COUNT; ++i) {
+    images_[i].destroy();
+    image_states_[i] = IMAGE_NOT_LOADED;
+  }
   is_inited_ = false;
   return ret;
 }
@@ -96,9 +100,14 @@ int ObFTDictHub::load_cache(const ObFTDictDesc &desc, ObFTCacheRangeContainer &c
   ObFTDictInfo info;
   container.reset();
   ObFTDictInfoKey key(static_cast<uint64_t>(desc.type_), MTL_ID());
+  bool is_image_loaded = false;
   if (!is_inited_) {
     ret = OB_NOT_INIT;
     LOG_WARN("dict hub not init", K(ret));
+  } else if (OB_FAIL(load_image(desc, container, is_image_loaded))) {
+    LOG_WARN("Failed to load dict image", K(ret));
+  } else if (is_image_loaded) {
+    // shared image of the built-in dict
   } else {
     {
       ObBucketHashRLockGuard guard(rw_dict_lock_, key.hash());
@@ -124,6 +133,38 @@ int ObFTDictHub::load_cache(const ObFTDictDesc &desc, ObFTCacheRangeContainer &c
   return ret;
 }
 
+int ObFTDictHub::load_image(const ObFTDictDesc &desc,
+                            ObFTCacheRangeContainer &container,
+                            bool &is_loaded)
+{
+  int ret = OB_SUCCESS;
+  const int64_t idx = static_cast<int64_t>(desc.type_);
+  is_loaded = false;
+  if (!ObFTDictImage::is_enabled() || idx <= 0 || idx >= MAX_IMAGE_COUNT) {
+    // load from the dict table
+  } else {
+    if (IMAGE_NOT_LOADED == ATOMIC_LOAD(&image_states_[idx])) {
+      lib::ObMutexGuard guard(image_lock_);
+      if (IMAGE_NOT_LOADED != image_states_[idx]) {
+        // loaded by others
+      } else if (OB_FAIL(images_[idx].load(desc))) {
+        // the dict table is still there, do not try again until restart
+        LOG_WARN("Failed to load dict image, use dict table instead", K(ret), K(idx));
+        ret = OB_SUCCESS;
+        ATOMIC_STORE(&image_states_[idx], IMAGE_FAILED);
+      } else {
+        ATOMIC_STORE(&image_states_[idx], IMAGE_LOADED);
+      }
+    }
+    if (IMAGE_LOADED != ATOMIC_LOAD(&image_states_[idx])) {
+    } else if (OB_FAIL(images_[idx].fill_container(desc, container))) {
+      LOG_WARN("Failed to fill container from dict image", K(ret), K(idx));
+    } else {
+      is_loaded = true;
+    }
+  }
+  return ret;
+}
 
 int ObFTDictHub::get_dict_info(const ObFTDictInfoKey &key, ObFTDictInfo &info)
 {
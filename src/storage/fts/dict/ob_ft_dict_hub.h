@@ -19,7 +19,9 @@
 
 #include "lib/charset/ob_charset.h"
 #include "lib/lock/ob_bucket_lock.h"
+#include "lib/lock/ob_mutex.h"
 #include "storage/fts/dict/ob_ft_dict_def.h"
+#include "storage/fts/dict/ob_ft_dict_image.h"
 
 namespace oceanbase
 {
@@ -100,7 +102,7 @@ class ObFTCacheRangeContainer;
 class ObFTDictHub
 {
 public:
-  ObFTDictHub() : is_inited_(false), dict_map_(), rw_dict_lock_() {}
+  ObFTDictHub() : is_inited_(false), dict_map_(), rw_dict_lock_(), image_lock_(), image_states_(), images_() {}
   ~ObFTDictHub() {}
 
   int init();
@@ -116,12 +118,27 @@ private:
 
   int put_dict_info(const ObFTDictInfoKey &key, const ObFTDictInfo &info);
 
+  // fill container with the ranges of the image of a built-in dict, is_loaded is false if the
+  // image is disabled or fails to load, then the dict is loaded from the dict table of the tenant
+  int load_image(const ObFTDictDesc &desc, ObFTCacheRangeContainer &container, bool &is_loaded);
 
 private:
+  enum ObFTDictImageState : int8_t
+  {
+    IMAGE_NOT_LOADED = 0,
+    IMAGE_LOADED = 1,
+    IMAGE_FAILED = 2,
+  };
+  static constexpr int64_t MAX_IMAGE_COUNT = static_cast<int64_t>(ObFTDictType::DICT_IK_STOP) + 1;
+
   bool is_inited_;
   // holds info of dict
   hash::ObHashMap<ObFTDictInfoKey, ObFTDictInfo> dict_map_;
   ObBucketLock rw_dict_lock_;
+  // images of the built-in dicts shared by all tenants, indexed by dict type
+  lib::ObMutex image_lock_;
+  int8_t image_states_[MAX_IMAGE_COUNT];
+  ObFTDictImage images_[MAX_IMAGE_COUNT];
 };
 
 } //  namespace storage
@@ -0,0 +1,463 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define USING_LOG_PREFIX STORAGE_FTS
+
+#include "storage/fts/dict/ob_ft_dict_image.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "lib/checksum/ob_crc64.h"
+#include "lib/container/ob_array.h"
+#include "lib/file/file_directory_utils.h"
+#include "lib/file/ob_file.h"
+#include "lib/oblog/ob_log_module.h"
+#include "lib/time/ob_time_utility.h"
+#include "lib/utility/ob_sort.h"
+#include "share/config/ob_server_config.h"
+#include "storage/fts/dict/ob_ft_cache_container.h"
+#include "storage/fts/dict/ob_ft_dict_iterator.h"
+#include "storage/fts/dict/ob_ft_range_dict.h"
+#include "storage/ob_file_system_router.h"
+
+namespace oceanbase
+{
+namespace storage
+{
+namespace
+{
+// Built-in words in the binary order of the words, which is the order the range dats are split
+// and searched in, empty and duplicated words are dropped.
+class ObFTRawDictIterator final : public ObIFTDictIterator
+{
+public:
+  ObFTRawDictIterator() : words_(), pos_(0)
+  {
+    words_.set_attr(lib::ObMemAttr(OB_SERVER_TENANT_ID, "FTDictImage"));
+  }
+  ~ObFTRawDictIterator() override {}
+
+  // OB_ITER_END if there is no word
+  int init(const ObIKDictLoader::RawDict &raw_dict)
+  {
+    int ret = OB_SUCCESS;
+    if (OB_FAIL(words_.reserve(raw_dict.array_size_))) {
+      LOG_WARN("Failed to reserve words", K(ret), K(raw_dict.array_size_));
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < raw_dict.array_size_; ++i) {
+      const ObString word(raw_dict.data_[i]);
+      if (!word.empty() && OB_FAIL(words_.push_back(word))) {
+        LOG_WARN("Failed to push back word", K(ret));
+      }
+    }
+    if (OB_SUCC(ret)) {
+      lib::ob_sort(words_.begin(), words_.end());
+      int64_t cnt = 0;
+      for (int64_t i = 0; i < words_.count(); ++i) {
+        if (0 == cnt || words_.at(cnt - 1) != words_.at(i)) {
+          words_.at(cnt++) = words_.at(i);
+        }
+      }
+      while (words_.count() > cnt) {
+        words_.pop_back();
+      }
+      pos_ = 0;
+      if (words_.empty()) {
+        ret = OB_ITER_END;
+      }
+    }
+    return ret;
+  }
+
+  int next() override
+  {
+    return ++pos_ < words_.count() ? OB_SUCCESS : OB_ITER_END;
+  }
+
+  int get_key(ObString &str) override
+  {
+    int ret = OB_SUCCESS;
+    if (OB_UNLIKELY(pos_ >= words_.count())) {
+      ret = OB_ITER_END;
+    } else {
+      str = words_.at(pos_);
+    }
+    return ret;
+  }
+
+  int get_value() override { return OB_SUCCESS; }
+
+private:
+  ObArray<ObString> words_;
+  int64_t pos_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObFTRawDictIterator);
+};
+} // namespace
+
+void ObFTDictImageHeader::init(const ObFTDictType dict_type,
+                               const int64_t word_count,
+                               const int64_t word_checksum,
+                               const int64_t range_count,
+                               const int64_t data_size,
+                               const int64_t data_checksum)
+{
+  reset();
+  magic_ = MAGIC;
+  version_ = VERSION;
+  dict_type_ = static_cast<int64_t>(dict_type);
+  word_count_ = word_count;
+  word_checksum_ = word_checksum;
+  range_count_ = range_count;
+  data_size_ = data_size;
+  data_checksum_ = data_checksum;
+  header_checksum_ = calc_header_checksum();
+}
+
+int64_t ObFTDictImageHeader::calc_header_checksum() const
+{
+  return static_cast<int64_t>(ob_crc64(this, offsetof(ObFTDictImageHeader, header_checksum_)));
+}
+
+bool ObFTDictImageHeader::is_valid() const
+{
+  return MAGIC == magic_
+         && VERSION == version_
+         && range_count_ >= 0
+         && data_size_ >= range_count_ * static_cast<int64_t>(sizeof(int64_t))
+         && calc_header_checksum() == header_checksum_;
+}
+
+ObFTDictImage::ObFTDictImage()
+    : base_(nullptr), file_size_(0), header_(),
+      alloc_(lib::ObMemAttr(OB_SERVER_TENANT_ID, "FTDictImage")), values_()
+{
+}
+
+bool ObFTDictImage::is_enabled() { return GCONF._enable_ft_ik_dict_image; }
+
+int ObFTDictImage::load(const ObFTDictDesc &desc)
+{
+  int ret = OB_SUCCESS;
+  ObIKDictLoader::RawDict raw_dict;
+  const char *name = nullptr;
+  int64_t word_checksum = 0;
+  char path[common::MAX_PATH_SIZE] = {0};
+  const int64_t start_time = ObTimeUtility::current_time();
+
+  if (OB_UNLIKELY(is_loaded())) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("Dict image is loaded twice.", K(ret), KPC(this));
+  } else if (OB_FAIL(get_raw_dict(desc.type_, raw_dict, name))) {
+    LOG_WARN("Failed to get built-in dict.", K(ret));
+  } else if (OB_FALSE_IT(word_checksum = calc_word_checksum(raw_dict))) {
+  } else if (OB_FAIL(get_image_path(name, path, sizeof(path)))) {
+    LOG_WARN("Failed to get dict image path.", K(ret));
+  } else if (OB_FAIL(map(path, desc.type_, raw_dict.array_size_, word_checksum))) {
+    if (OB_ENTRY_NOT_EXIST != ret) {
+      LOG_WARN("Invalid dict image, rebuild it.", K(ret), KCSTRING(path));
+    }
+    if (OB_FAIL(build(desc, raw_dict, word_checksum, path))) {
+      LOG_WARN("Failed to build dict image.", K(ret), KCSTRING(path));
+    } else if (OB_FAIL(map(path, desc.type_, raw_dict.array_size_, word_checksum))) {
+      LOG_WARN("Failed to map dict image.", K(ret), KCSTRING(path));
+    }
+  }
+
+  if (OB_FAIL(ret)) {
+    destroy();
+  } else {
+    LOG_INFO("Load dict image.", KCSTRING(path), K_(header),
+             "cost_us", ObTimeUtility::current_time() - start_time);
+  }
+  return ret;
+}
+
+void ObFTDictImage::destroy()
+{
+  for (int64_t i = 0; i < values_.count(); ++i) {
+    if (OB_NOT_NULL(values_.at(i))) {
+      values_.at(i)->~ObDictCacheValue();
+    }
+  }
+  values_.reset();
+  alloc_.reset();
+  if (OB_NOT_NULL(base_)) {
+    ::munmap(base_, file_size_);
+    base_ = nullptr;
+  }
+  file_size_ = 0;
+  header_.reset();
+}
+
+int ObFTDictImage::fill_container(const ObFTDictDesc &desc, ObFTCacheRangeContainer &container) const
+{
+  int ret = OB_SUCCESS;
+  container.reset();
+  if (OB_UNLIKELY(!is_loaded())) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Dict image is not loaded.", K(ret));
+  } else if (OB_UNLIKELY(static_cast<int64_t>(desc.type_) != header_.dict_type_)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Dict type mismatch.", K(ret), K(header_));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < values_.count(); ++i) {
+    ObFTCacheRangeHandle *info = nullptr;
+    if (OB_FAIL(container.fetch_info_for_dict(info))) {
+      LOG_WARN("Failed to fetch info for dict.", K(ret));
+    } else {
+      // no kv cache handle to hold, the dat is pinned by the image
+      info->type_ = desc.type_;
+      info->value_ = values_.at(i);
+    }
+  }
+  if (OB_FAIL(ret)) {
+    container.reset();
+  }
+  return ret;
+}
+
+int ObFTDictImage::get_raw_dict(const ObFTDictType type,
+                                ObIKDictLoader::RawDict &raw_dict,
+                                const char *&name)
+{
+  int ret = OB_SUCCESS;
+  switch (type) {
+  case ObFTDictType::DICT_IK_MAIN: {
+    raw_dict = ObIKDictLoader::dict_text();
+    name = "ik_main";
+  } break;
+  case ObFTDictType::DICT_IK_QUAN: {
+    raw_dict = ObIKDictLoader::dict_quen_text();
+    name = "ik_quantifier";
+  } break;
+  case ObFTDictType::DICT_IK_STOP: {
+    raw_dict = ObIKDictLoader::dict_stop();
+    name = "ik_stopword";
+  } break;
+  default:
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("Not supported dict type.", K(ret), "type", static_cast<int64_t>(type));
+  }
+  return ret;
+}
+
+int64_t ObFTDictImage::calc_word_checksum(const ObIKDictLoader::RawDict &raw_dict)
+{
+  uint64_t checksum = 0;
+  for (int64_t i = 0; i < raw_dict.array_size_; ++i) {
+    // the terminating zero separates the words
+    checksum = ob_crc64(checksum, raw_dict.data_[i], STRLEN(raw_dict.data_[i]) + 1);
+  }
+  return static_cast<int64_t>(checksum);
+}
+
+int ObFTDictImage::get_image_path(const char *name, char *path, const int64_t path_len)
+{
+  int ret = OB_SUCCESS;
+  int64_t pos = 0;
+  if (OB_FAIL(databuff_printf(path, path_len, pos, "%s/ft_dict/%s.img",
+                              OB_FILE_SYSTEM_ROUTER.get_data_dir(), name))) {
+    LOG_WARN("Failed to print dict image path.", K(ret), KCSTRING(name));
+  }
+  return ret;
+}
+
+int ObFTDictImage::append(const int fd,
+                          const void *data,
+                          const int64_t size,
+                          int64_t &data_size,
+                          int64_t &data_checksum)
+{
+  int ret = OB_SUCCESS;
+  if (size != unintr_pwrite(fd, data, size, ObFTDictImageHeader::DATA_OFFSET + data_size)) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("Failed to write dict image.", K(ret), K(size), K(data_size), KERRMSG);
+  } else {
+    data_checksum = static_cast<int64_t>(ob_crc64(static_cast<uint64_t>(data_checksum), data, size));
+    data_size += size;
+  }
+  return ret;
+}
+
+int ObFTDictImage::build(const ObFTDictDesc &desc,
+                         const ObIKDictLoader::RawDict &raw_dict,
+                         const int64_t word_checksum,
+                         const char *path)
+{
+  int ret = OB_SUCCESS;
+  static const char PADDING[sizeof(int64_t)] = {0};
+  char dir[common::MAX_PATH_SIZE] = {0};
+  char tmp_path[common::MAX_PATH_SIZE] = {0};
+  int64_t pos = 0;
+  int fd = -1;
+  ObArenaAllocator tmp_alloc(lib::ObMemAttr(OB_SERVER_TENANT_ID, "FTDictImgTmp"));
+  ObFTRawDictIterator iter;
+  ObSEArray<int64_t, 16> offsets;
+  ObFTDictImageHeader header;
+  int64_t data_size = 0;
+  int64_t data_checksum = 0;
+  bool build_next_range = true;
+
+  if (OB_FAIL(iter.init(raw_dict))) {
+    if (OB_ITER_END == ret) {
+      ret = OB_SUCCESS;
+      build_next_range = false;
+    } else {
+      LOG_WARN("Failed to init built-in dict iterator.", K(ret));
+    }
+  }
+
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(databuff_printf(dir, sizeof(dir), pos, "%s/ft_dict",
+                                     OB_FILE_SYSTEM_ROUTER.get_data_dir()))) {
+    LOG_WARN("Failed to print dict image dir.", K(ret));
+  } else if (OB_FAIL(FileDirectoryUtils::create_full_path(dir))) {
+    LOG_WARN("Failed to create dict image dir.", K(ret), KCSTRING(dir));
+  } else if (OB_FALSE_IT(pos = 0)) {
+  } else if (OB_FAIL(databuff_printf(tmp_path, sizeof(tmp_path), pos, "%s.%ld.tmp",
+                                     path, ObTimeUtility::current_time()))) {
+    LOG_WARN("Failed to print tmp dict image path.", K(ret));
+  } else if ((fd = ::open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR)) < 0) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("Failed to create dict image.", K(ret), KCSTRING(tmp_path), KERRMSG);
+  }
+
+  while (OB_SUCC(ret) && build_next_range) {
+    ObFTDAT *dat = nullptr;
+    size_t dat_size = 0;
+    if (OB_FAIL(ObFTRangeDict::build_range_dat(desc, iter, tmp_alloc, dat, dat_size, build_next_range))) {
+      LOG_WARN("Failed to build range dat.", K(ret));
+    } else if (OB_FAIL(offsets.push_back(data_size))) {
+      LOG_WARN("Failed to push back offset.", K(ret));
+    } else if (OB_FAIL(append(fd, dat, dat_size, data_size, data_checksum))) {
+      LOG_WARN("Failed to append range dat.", K(ret));
+    } else if (0 != data_size % sizeof(int64_t)
+               && OB_FAIL(append(fd, PADDING, sizeof(int64_t) - data_size % sizeof(int64_t),
+                                 data_size, data_checksum))) {
+      LOG_WARN("Failed to append padding.", K(ret));
+    }
+    tmp_alloc.reuse();
+  }
+
+  if (OB_FAIL(ret)) {
+  } else if (!offsets.empty()
+             && OB_FAIL(append(fd, &offsets.at(0), offsets.count() * sizeof(int64_t),
+                               data_size, data_checksum))) {
+    LOG_WARN("Failed to append range offsets.", K(ret));
+  } else if (OB_FALSE_IT(header.init(desc.type_, raw_dict.array_size_, word_checksum,
+                                     offsets.count(), data_size, data_checksum))) {
+  } else if (sizeof(header) != unintr_pwrite(fd, &header, sizeof(header), 0)) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("Failed to write dict image header.", K(ret), KCSTRING(tmp_path), KERRMSG);
+  } else if (0 != ::fsync(fd)) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("Failed to sync dict image.", K(ret), KCSTRING(tmp_path), KERRMSG);
+  } else if (0 != ::close(fd)) {
+    fd = -1;
+    ret = OB_IO_ERROR;
+    LOG_WARN("Failed to close dict image.", K(ret), KCSTRING(tmp_path), KERRMSG);
+  } else if (OB_FALSE_IT(fd = -1)) {
+  } else if (0 != ::rename(tmp_path, path)) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("Failed to rename dict image.", K(ret), KCSTRING(tmp_path), KCSTRING(path), KERRMSG);
+  } else {
+    LOG_INFO("Build dict image.", K(header), KCSTRING(path));
+  }
+
+  if (fd >= 0) {
+    ::close(fd);
+  }
+  if (OB_FAIL(ret) && '\0' != tmp_path[0]) {
+    ::unlink(tmp_path);
+  }
+  return ret;
+}
+
+int ObFTDictImage::map(const char *path,
+                       const ObFTDictType type,
+                       const int64_t word_count,
+                       const int64_t word_checksum)
+{
+  int ret = OB_SUCCESS;
+  int fd = -1;
+  struct stat st;
+  if ((fd = ::open(path, O_RDONLY)) < 0) {
+    if (ENOENT == errno) {
+      ret = OB_ENTRY_NOT_EXIST;
+    } else {
+      ret = OB_IO_ERROR;
+      LOG_WARN("Failed to open dict image.", K(ret), KCSTRING(path), KERRMSG);
+    }
+  } else if (0 != ::fstat(fd, &st)) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("Failed to stat dict image.", K(ret), KCSTRING(path), KERRMSG);
+  } else if (sizeof(header_) != unintr_pread(fd, &header_, sizeof(header_), 0)) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("Failed to read dict image header.", K(ret), KCSTRING(path), KERRMSG);
+  } else if (!header_.is_valid()
+             || st.st_size != ObFTDictImageHeader::DATA_OFFSET + header_.data_size_
+             || static_cast<int64_t>(type) != header_.dict_type_) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("Invalid dict image.", K(ret), KCSTRING(path), K_(header), K(st.st_size));
+  } else if (word_count != header_.word_count_ || word_checksum != header_.word_checksum_) {
+    // built from the words of another binary
+    ret = OB_ENTRY_NOT_EXIST;
+  } else if (MAP_FAILED == (base_ = static_cast<char *>(::mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0)))) {
+    base_ = nullptr;
+    ret = OB_IO_ERROR;
+    LOG_WARN("Failed to map dict image.", K(ret), KCSTRING(path), K(st.st_size), KERRMSG);
+  } else {
+    file_size_ = st.st_size;
+    const char *data = base_ + ObFTDictImageHeader::DATA_OFFSET;
+    const int64_t offsets_pos = header_.data_size_ - header_.range_count_ * sizeof(int64_t);
+    const int64_t *offsets = reinterpret_cast<const int64_t *>(data + offsets_pos);
+    const int64_t checksum = static_cast<int64_t>(ob_crc64(data, header_.data_size_));
+    if (checksum != header_.data_checksum_) {
+      ret = OB_CHECKSUM_ERROR;
+      LOG_WARN("Dict image checksum mismatch.", K(ret), KCSTRING(path), K(checksum), K_(header));
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < header_.range_count_; ++i) {
+      ObFTDAT *dat = reinterpret_cast<ObFTDAT *>(base_ + ObFTDictImageHeader::DATA_OFFSET + offsets[i]);
+      ObDictCacheValue *value = nullptr;
+      if (OB_UNLIKELY(offsets[i] < 0 || offsets[i] + static_cast<int64_t>(sizeof(ObFTDAT)) > offsets_pos
+                      || offsets[i] + dat->mem_block_size_ > offsets_pos)) {
+        ret = OB_INVALID_DATA;
+        LOG_WARN("Invalid range offset.", K(ret), K(i), K(offsets[i]), K(offsets_pos));
+      } else if (OB_ISNULL(value = OB_NEWx(ObDictCacheValue, &alloc_, dat))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("Failed to alloc dict value.", K(ret));
+      } else if (OB_FAIL(values_.push_back(value))) {
+        value->~ObDictCacheValue();
+        LOG_WARN("Failed to push back dict value.", K(ret));
+      }
+    }
+  }
+  if (fd >= 0) {
+    // the mapping stays valid after the file is closed
+    ::close(fd);
+  }
+  if (OB_FAIL(ret)) {
+    destroy();
+  }
+  return ret;
+}
+
+} //  namespace storage
+} //  namespace oceanbase
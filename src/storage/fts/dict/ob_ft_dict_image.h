@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _OCEANBASE_STORAGE_FTS_DICT_OB_FT_DICT_IMAGE_H_
+#define _OCEANBASE_STORAGE_FTS_DICT_OB_FT_DICT_IMAGE_H_
+
+#include "lib/allocator/page_arena.h"
+#include "lib/container/ob_se_array.h"
+#include "storage/fts/dict/ob_ft_cache.h"
+#include "storage/fts/dict/ob_ft_dict_def.h"
+#include "storage/fts/dict/ob_ik_dic.h"
+
+namespace oceanbase
+{
+namespace storage
+{
+class ObFTCacheRangeContainer;
+
+// Header of a dictionary image file.
+// File layout: one header page, the range dats one after another (8 bytes aligned), then the
+// offsets of the range dats from the end of the header page.
+struct ObFTDictImageHeader
+{
+public:
+  static const int64_t MAGIC = 0x474D495443494446; // "FDICTIMG"
+  static const int64_t VERSION = 1;
+  static const int64_t DATA_OFFSET = 4096;
+
+  ObFTDictImageHeader() { reset(); }
+  void reset() { MEMSET(this, 0, sizeof(*this)); }
+  void init(const ObFTDictType dict_type,
+            const int64_t word_count,
+            const int64_t word_checksum,
+            const int64_t range_count,
+            const int64_t data_size,
+            const int64_t data_checksum);
+  bool is_valid() const;
+  TO_STRING_KV(K_(magic), K_(version), K_(dict_type), K_(word_count), K_(word_checksum),
+               K_(range_count), K_(data_size), K_(data_checksum), K_(header_checksum));
+
+private:
+  int64_t calc_header_checksum() const;
+
+public:
+  int64_t magic_;
+  int64_t version_;
+  int64_t dict_type_;
+  // count and crc64 of the built-in words the image is built from
+  int64_t word_count_;
+  int64_t word_checksum_;
+  int64_t range_count_;
+  int64_t data_size_;
+  int64_t data_checksum_;
+  int64_t header_checksum_;
+};
+
+/**
+ * @class ObFTDictImage
+ * @brief Read-only image of a built-in IK dictionary, shared by all tenants and parsers.
+ *
+ * @desc:
+ * - The range dats of the built-in words are built once and saved to
+ *   <data_dir>/ft_dict/<dict name>.img, later loads map the file and use the dats in place.
+ * - An image built from other words, e.g. by an older binary, is rebuilt.
+ * - The dats live as long as the image, so they are handed to the range containers without
+ *   going through the kv cache.
+ */
+class ObFTDictImage final
+{
+public:
+  ObFTDictImage();
+  ~ObFTDictImage() { destroy(); }
+
+  static bool is_enabled();
+
+  int load(const ObFTDictDesc &desc);
+  void destroy();
+  bool is_loaded() const { return nullptr != base_; }
+  int fill_container(const ObFTDictDesc &desc, ObFTCacheRangeContainer &container) const;
+
+  TO_STRING_KV(KP_(base), K_(file_size), K_(header), K(values_.count()));
+
+private:
+  static int get_raw_dict(const ObFTDictType type,
+                          ObIKDictLoader::RawDict &raw_dict,
+                          const char *&name);
+  static int64_t calc_word_checksum(const ObIKDictLoader::RawDict &raw_dict);
+  static int get_image_path(const char *name, char *path, const int64_t path_len);
+  static int build(const ObFTDictDesc &desc,
+                   const ObIKDictLoader::RawDict &raw_dict,
+                   const int64_t word_checksum,
+                   const char *path);
+  static int append(const int fd,
+                    const void *data,
+                    const int64_t size,
+                    int64_t &data_size,
+                    int64_t &data_checksum);
+  // OB_ENTRY_NOT_EXIST if there is no image of the words
+  int map(const char *path,
+          const ObFTDictType type,
+          const int64_t word_count,
+          const int64_t word_checksum);
+
+private:
+  char *base_;
+  int64_t file_size_;
+  ObFTDictImageHeader header_;
+  ObArenaAllocator alloc_;
+  ObSEArray<ObDictCacheValue *, 16> values_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObFTDictImage);
+};
+
+} //  namespace storage
+} //  namespace oceanbase
+
+#endif // _OCEANBASE_STORAGE_FTS_DICT_OB_FT_DICT_IMAGE_H_
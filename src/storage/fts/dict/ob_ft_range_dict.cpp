@@ -41,29 +41,26 @@ namespace oceanbase
 {
 namespace storage
 {
-int ObFTRangeDict::build_one_range(const ObFTDictDesc &desc,
-                                   const int32_t range_id,
+int ObFTRangeDict::build_range_dat(const ObFTDictDesc &desc,
                                    ObIFTDictIterator &iter,
-                                   ObFTCacheRangeContainer &container,
+                                   ObIAllocator &alloc,
+                                   ObFTDAT *&dat_buff,
+                                   size_t &buffer_size,
                                    bool &build_next_range)
 {
   int ret = OB_SUCCESS;
   build_next_range = true;
+  dat_buff = nullptr;
+  buffer_size = 0;
 
-  ObArenaAllocator tmp_alloc(lib::ObMemAttr(MTL_ID(), "Temp trie"));
-
-  ObFTDATBuilder<void> builder(tmp_alloc);
-  storage::ObFTTrie<void> trie(tmp_alloc, desc.coll_type_);
+  ObFTDATBuilder<void> builder(alloc);
+  storage::ObFTTrie<void> trie(alloc, desc.coll_type_);
 
   int count = 0;
   bool range_end = false;
 
   int64_t first_char_len = 0;
   ObFTSingleWord end_char;
-  ObFTSingleWord start_char;
-
-  ObFTDAT *dat_buff = nullptr;
-  size_t buffer_size = 0;
 
   while (OB_SUCC(ret) && !range_end) {
     ObString key;
@@ -95,7 +92,6 @@ int ObFTRangeDict::build_one_range(const ObFTDictDesc &desc,
     build_next_range = false; // no more data
     ret = OB_SUCCESS;
   }
-  ObFTCacheRangeHandle *info = nullptr;
 
   if (OB_FAIL(ret)) {
     // to do clean up
@@ -105,6 +101,27 @@ int ObFTRangeDict::build_one_range(const ObFTDictDesc &desc,
     LOG_WARN("Failed to build datrie.", K(ret));
   } else if (OB_FAIL(builder.get_mem_block(dat_buff, buffer_size))) {
     LOG_WARN("Failed to get mem block.", K(ret));
+  }
+  return ret;
+}
+
+int ObFTRangeDict::build_one_range(const ObFTDictDesc &desc,
+                                   const int32_t range_id,
+                                   ObIFTDictIterator &iter,
+                                   ObFTCacheRangeContainer &container,
+                                   bool &build_next_range)
+{
+  int ret = OB_SUCCESS;
+  build_next_range = true;
+
+  ObArenaAllocator tmp_alloc(lib::ObMemAttr(MTL_ID(), "Temp trie"));
+
+  ObFTDAT *dat_buff = nullptr;
+  size_t buffer_size = 0;
+  ObFTCacheRangeHandle *info = nullptr;
+
+  if (OB_FAIL(build_range_dat(desc, iter, tmp_alloc, dat_buff, buffer_size, build_next_range))) {
+    LOG_WARN("Failed to build range dat.", K(ret));
   } else if (OB_FAIL(container.fetch_info_for_dict(info))) {
     LOG_WARN("Failed to fetch info for dict.", K(ret));
   } else if (OB_FAIL(ObFTCacheDict::make_and_fetch_cache_entry(desc,
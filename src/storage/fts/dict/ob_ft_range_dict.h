@@ -68,6 +68,15 @@ public:
                             ObFTCacheRangeContainer &range_container);
   static int build_cache(const ObFTDictDesc &desc, ObFTCacheRangeContainer &range_container);
 
+  // build the dat of the next range of iter in alloc, a range ends at a change of the first char
+  // after DEFAULT_KEY_PER_RANGE keys.
+  static int build_range_dat(const ObFTDictDesc &desc,
+                             ObIFTDictIterator &iter,
+                             ObIAllocator &alloc,
+                             ObFTDAT *&dat_buff,
+                             size_t &buffer_size,
+                             bool &build_next_range);
+
 private:
   // build cache
   static int build_ranges(const ObFTDictDesc &desc,
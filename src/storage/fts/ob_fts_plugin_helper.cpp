@@ -263,17 +263,15 @@ int ObFTParseHelper::segment(
       ret = OB_ERR_UNEXPECTED;
       LOG_WARN("unexpected error, token iterator is nullptr", K(ret), KP(iter));
     } else {
-      const char *word = nullptr;
-      int64_t word_len = 0;
-      int64_t char_cnt = 0;
-      int64_t word_freq = 0;
+      ObFTToken tokens[TOKEN_BATCH_SIZE];
+      int64_t token_cnt = 0;
       while (OB_SUCC(ret)) {
-        if (OB_FAIL(iter->get_next_token(word, word_len, char_cnt, word_freq))) {
+        if (OB_FAIL(iter->get_next_tokens(tokens, TOKEN_BATCH_SIZE, token_cnt))) {
           if (OB_ITER_END != ret) {
-            LOG_WARN("fail to get next token", K(ret), KPC(iter));
+            LOG_WARN("fail to get next tokens", K(ret), KPC(iter));
           }
-        } else if (OB_FAIL(add_word.process_word(word, word_len, char_cnt, word_freq))) {
-          LOG_WARN("fail to process one word", K(ret), KP(word), K(word_len), K(char_cnt), K(word_freq));
+        } else if (OB_FAIL(add_word.process_words(tokens, token_cnt))) {
+          LOG_WARN("fail to process words", K(ret), K(token_cnt));
         }
       }
       if (OB_ITER_END == ret) {
@@ -230,6 +230,8 @@ private:
   bool is_inited_;
 
 private:
+  // tokens taken from the token iterator in one call
+  static const int64_t TOKEN_BATCH_SIZE = 64;
   static constexpr const char *ENTRY_NAME_DOC_LEN = "doc_len";
   static constexpr const char *ENTRY_NAME_TOKENS = "tokens";
   DISALLOW_COPY_AND_ASSIGN(ObFTParseHelper);
@@ -19,6 +19,7 @@
 
 #include "share/rc/ob_tenant_base.h"
 #include "plugin/sys/ob_plugin_mgr.h"
+#include "plugin/interface/ob_plugin_ftparser_intf.h"
 #include "storage/fts/ob_fts_stop_word.h"
 #include "storage/fts/ob_fts_plugin_helper.h"
 #include "storage/fts/ob_fts_parser_property.h"
@@ -173,6 +174,22 @@ int ObAddWord::process_word(
   return ret;
 }
 
+int ObAddWord::process_words(const plugin::ObFTToken *tokens, const int64_t count)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(tokens) || OB_UNLIKELY(count < 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid arguments", K(ret), KP(tokens), K(count));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < count; ++i) {
+    const plugin::ObFTToken &token = tokens[i];
+    if (OB_FAIL(process_word(token.word_, token.word_len_, token.char_cnt_, token.word_freq_))) {
+      LOG_WARN("fail to process one word", K(ret), K(i), K(token));
+    }
+  }
+  return ret;
+}
+
 bool ObAddWord::is_min_max_word(const int64_t c_len) const
 {
   return flag_.min_max_word() && (c_len < min_token_size_ || c_len > max_token_size_);
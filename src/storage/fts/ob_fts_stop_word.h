@@ -24,6 +24,10 @@
 
 namespace oceanbase
 {
+namespace plugin
+{
+struct ObFTToken;
+} // end namespace plugin
 namespace storage
 {
 
@@ -108,6 +112,7 @@ public:
       const int64_t word_len,
       const int64_t char_cnt,
       const int64_t word_freq);
+  int process_words(const plugin::ObFTToken *tokens, const int64_t count);
   virtual int64_t get_add_word_count() const { return non_stopword_cnt_; }
   VIRTUAL_TO_STRING_KV(
       K_(word_meta),
@@ -37,6 +37,7 @@ ObSpaceFTParser::ObSpaceFTParser()
     start_(nullptr),
     next_(nullptr),
     end_(nullptr),
+    is_ascii_compatible_(false),
     is_inited_(false)
 {}
 
@@ -51,6 +52,7 @@ void ObSpaceFTParser::reset()
   start_ = nullptr;
   next_ = nullptr;
   end_ = nullptr;
+  is_ascii_compatible_ = false;
   is_inited_ = false;
 }
 
@@ -71,6 +73,7 @@ int ObSpaceFTParser::init(ObFTParserParam *param)
     start_ = param->fulltext_;
     next_ = start_;
     end_ = start_ + param->ft_length_;
+    is_ascii_compatible_ = ObFTAsciiCharUtil::is_ascii_compatible(cs_);
     is_inited_ = true;
   }
   if (OB_FAIL(ret) && OB_UNLIKELY(!is_inited_)) {
@@ -98,8 +101,16 @@ int ObSpaceFTParser::get_next_token(const char *&word,
     const char *next = next_;
     const char *end = end_;
     const ObCharsetInfo *cs = cs_;
+    const bool ascii_fast_path = is_ascii_compatible_;
     do {
       while (next < end) {
+        if (ascii_fast_path && ObFTAsciiCharUtil::is_ascii(*next)) {
+          next = ObFTAsciiCharUtil::skip_ascii_delimiters(next, end);
+          if (next >= end || ObFTAsciiCharUtil::is_ascii(*next)) {
+            // end or an ASCII word char
+            break;
+          }
+        }
         int ctype;
         mbl = cs->cset->ctype(cs, &ctype, (uchar *)next, (uchar *)end);
         if (true_word_char(ctype, *next)) {
@@ -113,6 +124,15 @@ int ObSpaceFTParser::get_next_token(const char *&word,
         int64_t c_nums = 0;
         start = next;
         while (next < end) {
+          if (ascii_fast_path && ObFTAsciiCharUtil::is_ascii(*next)) {
+            const char *run_end = ObFTAsciiCharUtil::skip_ascii_word_chars(next, end);
+            c_nums += run_end - next;
+            next = run_end;
+            if (next >= end || ObFTAsciiCharUtil::is_ascii(*next)) {
+              // end or an ASCII delimiter
+              break;
+            }
+          }
           int ctype;
           mbl = cs->cset->ctype(cs, &ctype, (uchar *)next, (uchar *)end);
           if (!true_word_char(ctype, *next)) {
@@ -143,6 +163,32 @@ int ObSpaceFTParser::get_next_token(const char *&word,
   return ret;
 }
 
+// the class is final, so the calls of get_next_token here are not virtual
+int ObSpaceFTParser::get_next_tokens(plugin::ObFTToken *tokens, const int64_t capacity, int64_t &count)
+{
+  int ret = OB_SUCCESS;
+  count = 0;
+  if (OB_ISNULL(tokens) || OB_UNLIKELY(capacity <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid arguments", K(ret), KP(tokens), K(capacity));
+  } else {
+    while (OB_SUCC(ret) && count < capacity) {
+      plugin::ObFTToken &token = tokens[count];
+      if (OB_FAIL(get_next_token(token.word_, token.word_len_, token.char_cnt_, token.word_freq_))) {
+        if (OB_ITER_END != ret) {
+          LOG_WARN("fail to get next token", K(ret), K(count));
+        }
+      } else {
+        ++count;
+      }
+    }
+    if (OB_ITER_END == ret && count > 0) {
+      ret = OB_SUCCESS;
+    }
+  }
+  return ret;
+}
+
 ObWhiteSpaceFTParserDesc::ObWhiteSpaceFTParserDesc()
   : is_inited_(false)
 {
@@ -40,13 +40,15 @@ public:
       int64_t &word_len,
       int64_t &char_len,
       int64_t &word_freq) override;
+  virtual int get_next_tokens(plugin::ObFTToken *tokens, const int64_t capacity, int64_t &count) override;
 
-  VIRTUAL_TO_STRING_KV(KP_(cs), KP_(start), KP_(next), KP_(end), K_(is_inited));
+  VIRTUAL_TO_STRING_KV(KP_(cs), KP_(start), KP_(next), KP_(end), K_(is_ascii_compatible), K_(is_inited));
 private:
   const ObCharsetInfo *cs_;
   const char *start_;
   const char *next_;
   const char *end_;
+  bool is_ascii_compatible_;
   bool is_inited_;
 };
 
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define USING_LOG_PREFIX STORAGE_FTS
+
+#include "storage/fts/utils/ob_ft_char_utils.h"
+
+#include "lib/atomic/ob_atomic.h"
+#include "lib/oblog/ob_log.h"
+#if defined(__x86_64__)
+#include <emmintrin.h>
+#endif
+
+namespace oceanbase
+{
+namespace storage
+{
+
+const bool ObFTAsciiCharUtil::ASCII_WORD_CHARS[256] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1,
+  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+int8_t ObFTAsciiCharUtil::compatible_cache_[MAX_CACHED_CHARSET_NUMBER] = {0};
+
+bool ObFTAsciiCharUtil::is_ascii_compatible(const ObCharsetInfo *cs)
+{
+  bool bret = false;
+  if (OB_ISNULL(cs)) {
+  } else if (cs->number >= MAX_CACHED_CHARSET_NUMBER) {
+    bret = check_ascii_compatible(cs);
+  } else {
+    int8_t cached = ATOMIC_LOAD(&compatible_cache_[cs->number]);
+    if (0 == cached) {
+      cached = check_ascii_compatible(cs) ? 1 : 2;
+      ATOMIC_STORE(&compatible_cache_[cs->number], cached);
+    }
+    bret = (1 == cached);
+  }
+  return bret;
+}
+
+bool ObFTAsciiCharUtil::check_ascii_compatible(const ObCharsetInfo *cs)
+{
+  // utf16 and utf32 have no one byte chars, the other charsets are checked char by char
+  bool bret = (1 == cs->mbminlen);
+  for (int c = 0; bret && c < 0x80; ++c) {
+    uchar ch = static_cast<uchar>(c);
+    int ctype = 0;
+    const int mbl = cs->cset->ctype(cs, &ctype, &ch, &ch + 1);
+    bret = (1 == mbl) && (static_cast<bool>(true_word_char(ctype, ch)) == is_ascii_word_char(ch));
+  }
+  LOG_TRACE("check ascii compatible charset", K(bret), K(cs->number), KCSTRING(cs->csname));
+  return bret;
+}
+
+#if defined(__x86_64__)
+// bit i is set if byte i is a letter, a digit or '_'. Bytes not lower than 0x80 are negative as
+// int8, so they are out of all the ranges.
+static OB_INLINE int ascii_word_char_mask(const __m128i bytes)
+{
+  const __m128i digits = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8('0' - 1)),
+                                       _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), bytes));
+  const __m128i uppers = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8('A' - 1)),
+                                       _mm_cmpgt_epi8(_mm_set1_epi8('Z' + 1), bytes));
+  const __m128i lowers = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8('a' - 1)),
+                                       _mm_cmpgt_epi8(_mm_set1_epi8('z' + 1), bytes));
+  const __m128i underscores = _mm_cmpeq_epi8(bytes, _mm_set1_epi8('_'));
+  return _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(digits, uppers), _mm_or_si128(lowers, underscores)));
+}
+#endif
+
+const char *ObFTAsciiCharUtil::skip_ascii_delimiters(const char *begin, const char *end)
+{
+  const char *pos = begin;
+#if defined(__x86_64__)
+  static constexpr int SSE2_BYTES = sizeof(__m128i);
+  int stop_mask = 0;
+  while (0 == stop_mask && pos + SSE2_BYTES <= end) {
+    const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pos));
+    // the movemask of the bytes marks the non ASCII bytes
+    stop_mask = ascii_word_char_mask(bytes) | _mm_movemask_epi8(bytes);
+    if (0 == stop_mask) {
+      pos += SSE2_BYTES;
+    }
+  }
+  if (0 != stop_mask) {
+    pos += __builtin_ctz(stop_mask);
+  } else {
+#endif
+    while (pos < end && is_ascii(*pos) && !is_ascii_word_char(*pos)) {
+      ++pos;
+    }
+#if defined(__x86_64__)
+  }
+#endif
+  return pos;
+}
+
+const char *ObFTAsciiCharUtil::skip_ascii_word_chars(const char *begin, const char *end)
+{
+  const char *pos = begin;
+#if defined(__x86_64__)
+  static constexpr int SSE2_BYTES = sizeof(__m128i);
+  int stop_mask = 0;
+  while (0 == stop_mask && pos + SSE2_BYTES <= end) {
+    const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pos));
+    stop_mask = ~ascii_word_char_mask(bytes) & 0xFFFF;
+    if (0 == stop_mask) {
+      pos += SSE2_BYTES;
+    }
+  }
+  if (0 != stop_mask) {
+    pos += __builtin_ctz(stop_mask);
+  } else {
+#endif
+    while (pos < end && is_ascii_word_char(*pos)) {
+      ++pos;
+    }
+#if defined(__x86_64__)
+  }
+#endif
+  return pos;
+}
+
+} // namespace storage
+} // namespace oceanbase
@@ -17,6 +17,39 @@
 #ifndef _OCEANBASE_STORAGE_FTS_UTILS_CHAR_UTILS_H_
 #define _OCEANBASE_STORAGE_FTS_UTILS_CHAR_UTILS_H_
 
+#include "lib/charset/ob_ctype.h"
+
 #define true_word_char(ctype, character) ((ctype) & (_MY_U | _MY_L | _MY_NMR) || (character) == '_')
 
+namespace oceanbase
+{
+namespace storage
+{
+// ASCII fast path of the word char classification of the whitespace and ngram parsers. In the
+// charsets checked by is_ascii_compatible, a byte lower than 0x80 at a char boundary is a one byte
+// char whose ctype is the ASCII one, so runs of ASCII chars are classified by a table and scanned
+// 16 bytes at a time instead of calling the ctype of the charset for every char.
+class ObFTAsciiCharUtil final
+{
+public:
+  static bool is_ascii(const char c) { return 0 == (static_cast<uint8_t>(c) & 0x80); }
+  // letters, digits and '_', the same as true_word_char for ASCII chars
+  static bool is_ascii_word_char(const char c) { return ASCII_WORD_CHARS[static_cast<uint8_t>(c)]; }
+  static bool is_ascii_compatible(const ObCharsetInfo *cs);
+  // first position in [begin, end) which is a word char or not ASCII, end if there is none
+  static const char *skip_ascii_delimiters(const char *begin, const char *end);
+  // first position in [begin, end) which is not an ASCII word char, end if there is none
+  static const char *skip_ascii_word_chars(const char *begin, const char *end);
+private:
+  static bool check_ascii_compatible(const ObCharsetInfo *cs);
+private:
+  static const int64_t MAX_CACHED_CHARSET_NUMBER = 512;
+  static const bool ASCII_WORD_CHARS[256];
+  // 0 for not checked, 1 for compatible, 2 for not compatible
+  static int8_t compatible_cache_[MAX_CACHED_CHARSET_NUMBER];
+};
+
+} // namespace storage
+} // namespace oceanbase
+
 #endif // _OCEANBASE_STORAGE_FTS_UTILS_CHAR_UTILS_H_
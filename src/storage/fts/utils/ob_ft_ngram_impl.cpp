@@ -32,7 +32,9 @@ oceanbase::storage::ObFTNgramImpl::ObFTNgramImpl()
     : cs_(nullptr),
       fulltext_start_(nullptr),
       fulltext_end_(nullptr),
+      cur_(nullptr),
       window_(),
+      is_ascii_compatible_(false),
       is_inited_(false)
 {
 }
@@ -56,6 +58,7 @@ int ObFTNgramImpl::init(const ObCharsetInfo *const cs,
     fulltext_start_ = fulltext;
     fulltext_end_ = fulltext + fulltext_len;
     cur_ = fulltext_start_;
+    is_ascii_compatible_ = ObFTAsciiCharUtil::is_ascii_compatible(cs);
     window_.reset();
     window_.min_ngram_size_ = min;
     window_.max_ngram_size_ = max;
@@ -69,7 +72,9 @@ void ObFTNgramImpl::reset()
   cs_ = nullptr;
   fulltext_start_ = nullptr;
   fulltext_end_ = nullptr;
+  cur_ = nullptr;
   window_.reset();
+  is_ascii_compatible_ = false;
   is_inited_ = false;
 }
 
@@ -104,6 +109,17 @@ int ObFTNgramImpl::get_next_token(const char *&word,
             // meet end and end it.
             window_.meet_delimiter_ = true;
             window_.is_last_batch_ = true;
+          } else if (is_ascii_compatible_ && ObFTAsciiCharUtil::is_ascii(*cur_)) {
+            // one byte char, classified without the ctype of the charset
+            if (ObFTAsciiCharUtil::is_ascii_word_char(*cur_)) {
+              Word word;
+              word.len = 1;
+              word.ptr = cur_;
+              window_.add_word(word);
+            } else {
+              window_.meet_delimiter_ = true;
+            }
+            ++cur_;
           } else {
             const int64_t c_len = ob_mbcharlen_ptr(cs_, cur_, fulltext_end_);
             if (cur_ + c_len > fulltext_end_ || 0 == c_len) {
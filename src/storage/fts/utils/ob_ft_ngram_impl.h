@@ -90,6 +90,7 @@ private:
   const char *fulltext_end_;
   const char *cur_;
   Window window_;
+  bool is_ascii_compatible_;
 
   bool is_inited_;
 };
@@ -31,6 +31,7 @@
 #include "storage/access/ob_table_estimator.h"
 #include "storage/access/ob_index_sstable_estimator.h"
 #include "storage/access/ob_skip_index_sortedness.h"
+#include "storage/access/ob_skip_index_ndv_estimator.h"
 #include "storage/column_store/ob_column_oriented_sstable.h"
 #include "storage/blocksstable/ob_sstable.h"
 #include "storage/ddl/ob_direct_insert_sstable_ctx_new.h"
@@ -8855,6 +8856,68 @@ int ObLSTabletService::estimate_skip_index_sortedness(
   return ret;
 }
 
+int ObLSTabletService::estimate_skip_index_ndv(
+    const uint64_t table_id,
+    const common::ObTabletID &tablet_id,
+    const uint64_t column_id,
+    ObSkipIndexHLL &hll,
+    bool &is_valid)
+{
+  int ret = OB_SUCCESS;
+  const int64_t tenant_id = MTL_ID();
+  ObTabletHandle tablet_handle;
+  ObTabletMemberWrapper<ObTabletTableStore> table_store_wrapper;
+  ObSSTable *latest_major_sstable = nullptr;
+  ObMultiVersionSchemaService *schema_service = MTL(ObTenantSchemaService *)->get_schema_service();
+  ObSchemaGetterGuard schema_guard;
+  const ObTableSchema *table_schema = nullptr;
+  const ObColumnSchemaV2 *column_schema = nullptr;
+  ObSkipIndexNdvEstimator estimator;
+  is_valid = false;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("Not init", KR(ret), K_(is_inited));
+  } else if (OB_FAIL(get_tablet(tablet_id, tablet_handle))) {
+    LOG_WARN("Fail to get tablet", KR(ret), K(tablet_id));
+  } else if (OB_FAIL(tablet_handle.get_obj()->fetch_table_store(table_store_wrapper))) {
+    LOG_WARN("Fail to fetch table store", KR(ret));
+  } else if (FALSE_IT(latest_major_sstable = static_cast<ObSSTable *>(
+                          table_store_wrapper.get_member()->get_major_sstables().get_boundary_table(
+                              true)))) {
+  } else if (OB_ISNULL(latest_major_sstable)) {
+    // no major sstable, nothing to estimate
+  } else if (latest_major_sstable->is_co_sstable()
+             && !static_cast<ObCOSSTableV2 *>(latest_major_sstable)->is_cgs_empty_co_table()) {
+    // hll is only read from row store major sstable
+  } else if (latest_major_sstable->is_empty()) {
+    is_valid = true;
+  } else if (OB_ISNULL(schema_service)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Fail to get schema service", KR(ret));
+  } else if (OB_FAIL(schema_service->get_tenant_schema_guard(tenant_id, schema_guard))) {
+    LOG_WARN("Fail to get schema guard", KR(ret), K(tenant_id));
+  } else if (OB_FAIL(schema_guard.get_table_schema(tenant_id, table_id, table_schema))) {
+    LOG_WARN("Fail to get table schema", KR(ret), K(tenant_id), K(tablet_id));
+  } else if (OB_ISNULL(table_schema)) {
+    ret = OB_TABLE_NOT_EXIST;
+    LOG_WARN("Table schema not exist", KR(ret), K(table_id));
+  } else if (OB_ISNULL(column_schema = table_schema->get_column_schema(column_id))) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("Fail to get column schema", KR(ret), KPC(table_schema), K(column_id));
+  } else if (!column_schema->get_skip_index_attr().has_hll()
+             || column_schema->is_virtual_generated_column()) {
+    // no hll skip index on the column
+  } else if (OB_FAIL(estimator.init(*latest_major_sstable,
+                                    *table_schema,
+                                    &tablet_handle.get_obj()->get_rowkey_read_info(),
+                                    column_id))) {
+    LOG_WARN("Fail to init skip index ndv estimator", KR(ret), KPC(latest_major_sstable), K(column_id));
+  } else if (OB_FAIL(estimator.merge_hll(hll, is_valid))) {
+    LOG_WARN("Fail to merge skip index hll", KR(ret), K(tablet_id), K(column_id));
+  }
+  return ret;
+}
+
 int ObLSTabletService::scan_block_stat(
     const ObTabletHandle &tablet_handle,
     ObBlockStatScanParam &scan_param,
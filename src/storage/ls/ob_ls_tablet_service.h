@@ -65,6 +65,7 @@ class ObMigrationSSTableParam;
 struct ObDatumRowkey;
 enum ObDmlFlag;
 class ObDatumRowStore;
+struct ObSkipIndexHLL;
 }
 
 namespace compaction
@@ -459,6 +460,14 @@ public:
       const common::ObIArray<uint64_t> &sample_count,
       common::ObIArray<double> &sortedness,
       common::ObIArray<uint64_t> &res_sample_counts);
+  // merges the hll skip index of the latest row store major sstable into %hll,
+  // %is_valid is false if there is no such major sstable or some macro block has no hll
+  int estimate_skip_index_ndv(
+      const uint64_t table_id,
+      const common::ObTabletID &tablet_id,
+      const uint64_t column_id,
+      blocksstable::ObSkipIndexHLL &hll,
+      bool &is_valid);
   int scan_block_stat(
       const ObTabletHandle &tablet_handle,
       ObBlockStatScanParam &scan_param,
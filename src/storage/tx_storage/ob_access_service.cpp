@@ -1468,6 +1468,38 @@ int ObAccessService::estimate_skip_index_sortedness(
   return ret;
 }
 
+int ObAccessService::estimate_skip_index_ndv(
+    const share::ObLSID &ls_id,
+    const uint64_t table_id,
+    const common::ObTabletID &tablet_id,
+    const uint64_t column_id,
+    blocksstable::ObSkipIndexHLL &hll,
+    bool &is_valid) const
+{
+  int ret = OB_SUCCESS;
+  ObLSHandle ls_handle;
+  ObLS *ls = nullptr;
+  ObLSTabletService *tablet_service = nullptr;
+  if (IS_NOT_INIT) {
+    ret = OB_ERROR;
+    LOG_WARN("Ob access service is not running", KR(ret));
+  } else if (OB_UNLIKELY(!ls_id.is_valid()) || OB_UNLIKELY(!tablet_id.is_valid())) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("Invalid argument", KR(ret), K(ls_id), K(tablet_id));
+  } else if (OB_FAIL(ls_svr_->get_ls(ls_id, ls_handle, ObLSGetMod::DAS_MOD))) {
+    LOG_WARN("Fail to get log stream", KR(ret), K(ls_id));
+  } else if (OB_ISNULL(ls = ls_handle.get_ls())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_ERROR("Ls should not be null", KR(ret), K(ls_id));
+  } else if (OB_ISNULL(tablet_service = ls->get_tablet_svr())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_ERROR("Tablet service should not be null", KR(ret), K(ls_id));
+  } else if (OB_FAIL(tablet_service->estimate_skip_index_ndv(table_id, tablet_id, column_id, hll, is_valid))) {
+    LOG_WARN("Fail to estimate skip index ndv", KR(ret), K(ls_id), K(tablet_id), K(column_id));
+  }
+  return ret;
+}
+
 int ObAccessService::inner_tablet_scan(
     const share::ObLSID &ls_id,
     const common::ObTabletID &tablet_id,
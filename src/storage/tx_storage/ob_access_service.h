@@ -33,6 +33,10 @@ class ObNewRowIterator;
 namespace share {
 class ObLSID;
 }
+namespace blocksstable
+{
+struct ObSkipIndexHLL;
+}
 namespace transaction
 {
 class ObTxDesc;
@@ -228,6 +232,14 @@ public:
       common::ObIArray<double> &sortedness,
       common::ObIArray<uint64_t> &res_sample_counts) const;
 
+  int estimate_skip_index_ndv(
+      const share::ObLSID &ls_id,
+      const uint64_t table_id,
+      const common::ObTabletID &tablet_id,
+      const uint64_t column_id,
+      blocksstable::ObSkipIndexHLL &hll,
+      bool &is_valid) const;
+
   int inner_tablet_scan(
       const share::ObLSID &ls_id,
       const common::ObTabletID &tablet_id,
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include "lib/allocator/page_arena.h"
+#include "share/cache/ob_kv_storecache.h"
+#include "share/ob_simple_mem_limit_getter.h"
+#include "share/ai_service/ob_ai_func_result_cache.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace share
+{
+static ObSimpleMemLimitGetter getter;
+
+class TestAIFuncResultCache : public ::testing::Test
+{
+public:
+  TestAIFuncResultCache() : tenant_id_(OB_SYS_TENANT_ID) {}
+  virtual ~TestAIFuncResultCache() {}
+  static void SetUpTestCase()
+  {
+    ASSERT_EQ(OB_SUCCESS, ObTimerService::get_instance().start());
+  }
+  static void TearDownTestCase()
+  {
+    ObTimerService::get_instance().stop();
+    ObTimerService::get_instance().wait();
+    ObTimerService::get_instance().destroy();
+  }
+  virtual void SetUp()
+  {
+    const int64_t bucket_num = 1024;
+    const int64_t max_cache_size = 1024 * 1024 * 1024;
+    const int64_t block_size = lib::ACHUNK_SIZE;
+    ASSERT_EQ(OB_SUCCESS, getter.add_tenant(tenant_id_, 8 * 1024 * 1024, 16 * 1024 * 1024));
+    int ret = ObKVGlobalCache::get_instance().init(&getter, bucket_num, max_cache_size, block_size);
+    if (OB_INIT_TWICE == ret) {
+      ret = OB_SUCCESS;
+    }
+    ASSERT_EQ(OB_SUCCESS, ret);
+    ASSERT_EQ(OB_SUCCESS, cache_.init("ai_func_result_cache"));
+  }
+  virtual void TearDown()
+  {
+    cache_.destroy();
+    ObKVGlobalCache::get_instance().destroy();
+    getter.reset();
+  }
+  ObAIFuncResultCacheKey make_key(const int64_t func_type, const char *model, const char *input)
+  {
+    ObAIFuncResultCacheKey key(tenant_id_, func_type);
+    key.append_param(ObString(model));
+    key.append_param(ObString("https://example.com/v1"));
+    key.append_input(ObString(input));
+    return key;
+  }
+
+protected:
+  uint64_t tenant_id_;
+  ObAIFuncResultCache cache_;
+  ObArenaAllocator allocator_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(TestAIFuncResultCache);
+};
+
+TEST_F(TestAIFuncResultCache, key)
+{
+  const ObAIFuncResultCacheKey key = make_key(EndpointType::DENSE_EMBEDDING, "m1", "hello");
+  ASSERT_TRUE(key.is_valid());
+  ASSERT_TRUE(key == make_key(EndpointType::DENSE_EMBEDDING, "m1", "hello"));
+  ASSERT_EQ(key.hash(), make_key(EndpointType::DENSE_EMBEDDING, "m1", "hello").hash());
+  // any difference in function, model or input gives another key
+  ASSERT_FALSE(key == make_key(EndpointType::RERANK, "m1", "hello"));
+  ASSERT_FALSE(key == make_key(EndpointType::DENSE_EMBEDDING, "m2", "hello"));
+  ASSERT_FALSE(key == make_key(EndpointType::DENSE_EMBEDDING, "m1", "hellO"));
+  // params are length prefixed, moving bytes between two params changes the key
+  ObAIFuncResultCacheKey key1(tenant_id_, EndpointType::DENSE_EMBEDDING);
+  key1.append_param(ObString("ab"));
+  key1.append_param(ObString("c"));
+  key1.append_input(ObString("x"));
+  ObAIFuncResultCacheKey key2(tenant_id_, EndpointType::DENSE_EMBEDDING);
+  key2.append_param(ObString("a"));
+  key2.append_param(ObString("bc"));
+  key2.append_input(ObString("x"));
+  ASSERT_FALSE(key1 == key2);
+  // so are inputs, a rerank query and its documents can not be split in another way
+  ObAIFuncResultCacheKey rerank_key1(tenant_id_, EndpointType::RERANK);
+  rerank_key1.append_input(ObString("query"));
+  rerank_key1.append_input(ObString("doc1"));
+  rerank_key1.append_input(ObString("doc2"));
+  ObAIFuncResultCacheKey rerank_key2(tenant_id_, EndpointType::RERANK);
+  rerank_key2.append_input(ObString("query"));
+  rerank_key2.append_input(ObString("doc1doc2"));
+  ObAIFuncResultCacheKey rerank_key3(tenant_id_, EndpointType::RERANK);
+  rerank_key3.append_input(ObString("querydoc1"));
+  rerank_key3.append_input(ObString("doc2"));
+  ASSERT_FALSE(rerank_key1 == rerank_key2);
+  ASSERT_FALSE(rerank_key1 == rerank_key3);
+  ASSERT_FALSE(rerank_key2 == rerank_key3);
+  // no input
+  ObAIFuncResultCacheKey empty_key(tenant_id_, EndpointType::DENSE_EMBEDDING);
+  ASSERT_FALSE(empty_key.is_valid());
+  ASSERT_FALSE(ObAIFuncResultCacheKey().is_valid());
+}
+
+TEST_F(TestAIFuncResultCache, deterministic_only)
+{
+  ASSERT_TRUE(ObAIFuncResultCacheKey::is_cacheable_func_type(EndpointType::DENSE_EMBEDDING));
+  ASSERT_TRUE(ObAIFuncResultCacheKey::is_cacheable_func_type(EndpointType::RERANK));
+  ASSERT_FALSE(ObAIFuncResultCacheKey::is_cacheable_func_type(EndpointType::COMPLETION));
+  ASSERT_FALSE(ObAIFuncResultCacheKey::is_cacheable_func_type(EndpointType::SPARSE_EMBEDDING));
+  ASSERT_FALSE(ObAIFuncResultCacheKey::is_cacheable_func_type(EndpointType::INVALID_TYPE));
+
+  const ObAIFuncResultCacheKey key = make_key(EndpointType::COMPLETION, "m1", "tell me a joke");
+  ASSERT_FALSE(key.is_valid());
+  ObString result;
+  ASSERT_EQ(OB_INVALID_ARGUMENT, cache_.put_result(key, ObString("a joke")));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, cache_.get_result(key, allocator_, result));
+}
+
+TEST_F(TestAIFuncResultCache, put_and_get)
+{
+  const ObAIFuncResultCacheKey key = make_key(EndpointType::DENSE_EMBEDDING, "m1", "hello");
+  const ObString value("[0.1,0.2,0.3]");
+  ObString result;
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache_.get_result(key, allocator_, result));
+  ASSERT_EQ(OB_SUCCESS, cache_.put_result(key, value));
+  ASSERT_EQ(OB_SUCCESS, cache_.get_result(key, allocator_, result));
+  ASSERT_TRUE(value == result);
+  ASSERT_NE(value.ptr(), result.ptr());
+
+  // overwrite
+  const ObString new_value("[0.4,0.5,0.6]");
+  ASSERT_EQ(OB_SUCCESS, cache_.put_result(key, new_value));
+  ASSERT_EQ(OB_SUCCESS, cache_.get_result(key, allocator_, result));
+  ASSERT_TRUE(new_value == result);
+
+  // another input misses
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST,
+            cache_.get_result(make_key(EndpointType::DENSE_EMBEDDING, "m1", "world"), allocator_, result));
+
+  // empty results are rejected, too large ones are silently skipped
+  ASSERT_EQ(OB_INVALID_ARGUMENT, cache_.put_result(key, ObString()));
+  const ObAIFuncResultCacheKey large_key = make_key(EndpointType::RERANK, "m1", "large");
+  const int64_t large_len = ObAIFuncResultCache::MAX_RESULT_LENGTH + 1;
+  char *large_buf = static_cast<char *>(allocator_.alloc(large_len));
+  ASSERT_NE(nullptr, large_buf);
+  MEMSET(large_buf, 'a', large_len);
+  ASSERT_EQ(OB_SUCCESS, cache_.put_result(large_key, ObString(large_len, large_buf)));
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, cache_.get_result(large_key, allocator_, result));
+}
+
+} // namespace share
+} // namespace oceanbase
+
+int main(int argc, char** argv)
+{
+  system("rm -f test_ai_func_result_cache.log*");
+  OB_LOGGER.set_file_name("test_ai_func_result_cache.log", true, true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,401 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define USING_LOG_PREFIX SHARE
+#include <gtest/gtest.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define private public
+#include "share/ob_local_io_uring.h"
+#include "share/ob_local_device.h"
+#undef private
+#include "share/config/ob_server_config.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace share
+{
+
+static const char *TEST_FILE = "./test_local_io_uring.data";
+
+// the kernel of the test machine may have no io_uring, or io_uring may be disabled for the
+// process, the ring cases return at once then
+static bool is_io_uring_supported()
+{
+  ObLocalIOUring uring;
+  return OB_SUCCESS == uring.init(8, 0);
+}
+
+#define SKIP_IF_NO_IO_URING()                                         \
+  if (!is_supported_) {                                               \
+    LOG_INFO("io_uring is not supported by the kernel, skip the case"); \
+    return;                                                           \
+  }
+
+class TestLocalIOUring : public ::testing::Test
+{
+public:
+  TestLocalIOUring() : fd_(-1) {}
+  virtual ~TestLocalIOUring() {}
+  static void SetUpTestCase()
+  {
+    is_supported_ = is_io_uring_supported();
+  }
+  virtual void SetUp()
+  {
+    ::unlink(TEST_FILE);
+    fd_ = ::open(TEST_FILE, O_RDWR | O_CREAT, 0644);
+    ASSERT_GE(fd_, 0);
+  }
+  virtual void TearDown()
+  {
+    if (fd_ >= 0) {
+      ::close(fd_);
+      fd_ = -1;
+    }
+    ::unlink(TEST_FILE);
+  }
+  static void fill(char *buf, const int64_t size, const int64_t seed)
+  {
+    for (int64_t i = 0; i < size; ++i) {
+      buf[i] = static_cast<char>(seed * 131 + i * 7);
+    }
+  }
+  // submits one iocb for each block, data of the i-th iocb is the address of the i-th block
+  void submit_blocks(ObLocalIOUring &uring, const bool is_write, char *bufs, const int64_t cnt)
+  {
+    for (int64_t i = 0; i < cnt; ++i) {
+      struct iocb iocb;
+      char *buf = bufs + i * BLOCK_SIZE;
+      if (is_write) {
+        ::io_prep_pwrite(&iocb, fd_, buf, BLOCK_SIZE, i * BLOCK_SIZE);
+      } else {
+        ::io_prep_pread(&iocb, fd_, buf, BLOCK_SIZE, i * BLOCK_SIZE);
+      }
+      iocb.data = buf;
+      ASSERT_EQ(OB_SUCCESS, uring.submit(iocb));
+    }
+  }
+  // harvests cnt completions in rounds of at most max_nr, each block completes exactly once
+  void harvest(ObLocalIOUring &uring, char *bufs, const int64_t cnt, const int64_t max_nr)
+  {
+    struct io_event events[MAX_BLOCK_CNT];
+    bool done[MAX_BLOCK_CNT] = {false};
+    int64_t total_cnt = 0;
+    while (total_cnt < cnt) {
+      int64_t complete_cnt = 0;
+      struct timespec timeout = {1, 0};
+      ASSERT_EQ(OB_SUCCESS, uring.get_events(1, max_nr, events, &timeout, complete_cnt));
+      ASSERT_GT(complete_cnt, 0);
+      ASSERT_LE(complete_cnt, max_nr);
+      for (int64_t i = 0; i < complete_cnt; ++i) {
+        const int64_t idx = (static_cast<char *>(events[i].data) - bufs) / BLOCK_SIZE;
+        ASSERT_GE(idx, 0);
+        ASSERT_LT(idx, cnt);
+        ASSERT_FALSE(done[idx]);
+        ASSERT_EQ(BLOCK_SIZE, static_cast<int64_t>(events[i].res));
+        ASSERT_EQ(0UL, events[i].res2);
+        ASSERT_EQ(nullptr, events[i].obj);
+        done[idx] = true;
+      }
+      total_cnt += complete_cnt;
+    }
+    ASSERT_EQ(cnt, total_cnt);
+  }
+  void write_and_read(ObLocalIOUring &uring, const int64_t cnt, const int64_t max_nr)
+  {
+    ASSERT_LE(cnt, MAX_BLOCK_CNT);
+    fill(write_bufs_, cnt * BLOCK_SIZE, cnt);
+    MEMSET(read_bufs_, 0, sizeof(read_bufs_));
+    submit_blocks(uring, true, write_bufs_, cnt);
+    harvest(uring, write_bufs_, cnt, max_nr);
+    submit_blocks(uring, false, read_bufs_, cnt);
+    harvest(uring, read_bufs_, cnt, max_nr);
+    ASSERT_EQ(0, MEMCMP(write_bufs_, read_bufs_, cnt * BLOCK_SIZE));
+  }
+
+protected:
+  static const int64_t BLOCK_SIZE = 4096;
+  static const int64_t MAX_BLOCK_CNT = 64;
+  static bool is_supported_;
+  int fd_;
+  char write_bufs_[MAX_BLOCK_CNT * BLOCK_SIZE];
+  char read_bufs_[MAX_BLOCK_CNT * BLOCK_SIZE];
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(TestLocalIOUring);
+};
+
+bool TestLocalIOUring::is_supported_ = false;
+
+TEST_F(TestLocalIOUring, invalid_argument)
+{
+  ObLocalIOUring uring;
+  struct iocb iocb;
+  struct io_event events[1];
+  int64_t complete_cnt = 0;
+  ::io_prep_pread(&iocb, fd_, write_bufs_, BLOCK_SIZE, 0);
+  ASSERT_EQ(OB_INVALID_ARGUMENT, uring.init(0, 0));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, uring.init(8, -1));
+  ASSERT_EQ(OB_NOT_INIT, uring.submit(iocb));
+  ASSERT_EQ(OB_NOT_INIT, uring.get_events(0, 1, events, nullptr, complete_cnt));
+  ASSERT_EQ(OB_NOT_INIT, uring.register_file(fd_));
+  SKIP_IF_NO_IO_URING();
+
+  ASSERT_EQ(OB_SUCCESS, uring.init(8, 0));
+  ASSERT_EQ(OB_INIT_TWICE, uring.init(8, 0));
+  ASSERT_FALSE(uring.is_sqpoll());
+  ASSERT_EQ(OB_INVALID_ARGUMENT, uring.get_events(0, 1, nullptr, nullptr, complete_cnt));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, uring.get_events(2, 1, events, nullptr, complete_cnt));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, uring.register_file(-1));
+  // only reads and writes are translated
+  ::io_prep_fsync(&iocb, fd_);
+  ASSERT_EQ(OB_NOT_SUPPORTED, uring.submit(iocb));
+  ASSERT_EQ(0U, uring.pending_cnt_);
+  uring.destroy();
+  ASSERT_FALSE(uring.is_inited_);
+  ASSERT_EQ(-1, uring.ring_fd_);
+  ASSERT_EQ(OB_NOT_INIT, uring.submit(iocb));
+}
+
+TEST_F(TestLocalIOUring, read_and_write)
+{
+  SKIP_IF_NO_IO_URING();
+  ObLocalIOUring uring;
+  ASSERT_EQ(OB_SUCCESS, uring.init(16, 0));
+  // one request at a time, then a batch harvested in rounds
+  write_and_read(uring, 1, 1);
+  write_and_read(uring, 16, 16);
+  write_and_read(uring, 16, 3);
+
+  // the error of a request comes back in res as a negated errno
+  struct iocb iocb;
+  struct io_event events[1];
+  int64_t complete_cnt = 0;
+  const int bad_fd = ::dup(fd_);
+  ASSERT_GE(bad_fd, 0);
+  ::close(bad_fd);
+  ::io_prep_pread(&iocb, bad_fd, read_bufs_, BLOCK_SIZE, 0);
+  iocb.data = read_bufs_;
+  ASSERT_EQ(OB_SUCCESS, uring.submit(iocb));
+  ASSERT_EQ(OB_SUCCESS, uring.get_events(1, 1, events, nullptr, complete_cnt));
+  ASSERT_EQ(1, complete_cnt);
+  ASSERT_EQ(static_cast<void *>(read_bufs_), events[0].data);
+  ASSERT_EQ(-EBADF, static_cast<int64_t>(events[0].res));
+
+  // a short read at the end of the file
+  ::io_prep_pread(&iocb, fd_, read_bufs_, BLOCK_SIZE, 16 * BLOCK_SIZE - 100);
+  iocb.data = read_bufs_;
+  ASSERT_EQ(OB_SUCCESS, uring.submit(iocb));
+  ASSERT_EQ(OB_SUCCESS, uring.get_events(1, 1, events, nullptr, complete_cnt));
+  ASSERT_EQ(1, complete_cnt);
+  ASSERT_EQ(100, static_cast<int64_t>(events[0].res));
+}
+
+TEST_F(TestLocalIOUring, more_requests_than_ring)
+{
+  SKIP_IF_NO_IO_URING();
+  ObLocalIOUring uring;
+  ASSERT_EQ(OB_SUCCESS, uring.init(4, 0));
+  // the completion queue is smaller than the requests in flight, entries the kernel can not take
+  // stay pending and go with a later enter
+  ASSERT_LT(uring.cq_entries_, MAX_BLOCK_CNT);
+  fill(write_bufs_, MAX_BLOCK_CNT * BLOCK_SIZE, 1);
+  int64_t submit_cnt = 0;
+  int64_t complete_cnt = 0;
+  bool done[MAX_BLOCK_CNT] = {false};
+  struct io_event events[MAX_BLOCK_CNT];
+  while (complete_cnt < MAX_BLOCK_CNT) {
+    int ret = OB_SUCCESS;
+    while (submit_cnt < MAX_BLOCK_CNT) {
+      struct iocb iocb;
+      char *buf = write_bufs_ + submit_cnt * BLOCK_SIZE;
+      ::io_prep_pwrite(&iocb, fd_, buf, BLOCK_SIZE, submit_cnt * BLOCK_SIZE);
+      iocb.data = buf;
+      if (OB_FAIL(uring.submit(iocb))) {
+        // the submission queue is full
+        ASSERT_EQ(OB_EAGAIN, ret);
+        break;
+      }
+      ++submit_cnt;
+    }
+    int64_t cnt = 0;
+    ASSERT_EQ(OB_SUCCESS, uring.get_events(1, MAX_BLOCK_CNT, events, nullptr, cnt));
+    ASSERT_GT(cnt, 0);
+    for (int64_t i = 0; i < cnt; ++i) {
+      const int64_t idx = (static_cast<char *>(events[i].data) - write_bufs_) / BLOCK_SIZE;
+      ASSERT_LT(idx, submit_cnt);
+      ASSERT_FALSE(done[idx]);
+      ASSERT_EQ(BLOCK_SIZE, static_cast<int64_t>(events[i].res));
+      done[idx] = true;
+    }
+    complete_cnt += cnt;
+  }
+  ASSERT_EQ(0U, uring.pending_cnt_);
+  MEMSET(read_bufs_, 0, sizeof(read_bufs_));
+  ASSERT_EQ(MAX_BLOCK_CNT * BLOCK_SIZE, ::pread(fd_, read_bufs_, MAX_BLOCK_CNT * BLOCK_SIZE, 0));
+  ASSERT_EQ(0, MEMCMP(write_bufs_, read_bufs_, MAX_BLOCK_CNT * BLOCK_SIZE));
+}
+
+TEST_F(TestLocalIOUring, batched_submit)
+{
+  SKIP_IF_NO_IO_URING();
+  ObLocalIOUring uring;
+  const uint32_t batch_cnt = ObLocalIOUring::MAX_PENDING_CNT;
+  ASSERT_EQ(OB_SUCCESS, uring.init(MAX_BLOCK_CNT, 0));
+  fill(write_bufs_, MAX_BLOCK_CNT * BLOCK_SIZE, 5);
+  // nothing is in flight, the first request enters the kernel at once
+  submit_blocks(uring, true, write_bufs_, 1);
+  ASSERT_EQ(0U, uring.pending_cnt_);
+  ASSERT_EQ(1U, ATOMIC_LOAD(uring.sq_head_));
+  // the following requests wait for the poll thread
+  submit_blocks(uring, true, write_bufs_ + BLOCK_SIZE, batch_cnt - 1);
+  ASSERT_EQ(batch_cnt - 1, uring.pending_cnt_);
+  ASSERT_EQ(1U, ATOMIC_LOAD(uring.sq_head_));
+  // get_events submits them with one enter
+  harvest(uring, write_bufs_, batch_cnt, MAX_BLOCK_CNT);
+  ASSERT_EQ(0U, uring.pending_cnt_);
+  ASSERT_EQ(batch_cnt, ATOMIC_LOAD(uring.sq_head_));
+
+  // a full batch is submitted by the submitter
+  submit_blocks(uring, true, write_bufs_, batch_cnt + 1);
+  ASSERT_EQ(0U, uring.pending_cnt_);
+  ASSERT_EQ(2 * batch_cnt + 1, ATOMIC_LOAD(uring.sq_head_));
+  harvest(uring, write_bufs_, batch_cnt + 1, MAX_BLOCK_CNT);
+  MEMSET(read_bufs_, 0, sizeof(read_bufs_));
+  ASSERT_EQ((batch_cnt + 1) * BLOCK_SIZE, ::pread(fd_, read_bufs_, (batch_cnt + 1) * BLOCK_SIZE, 0));
+  ASSERT_EQ(0, MEMCMP(write_bufs_, read_bufs_, (batch_cnt + 1) * BLOCK_SIZE));
+}
+
+TEST_F(TestLocalIOUring, wait_timeout)
+{
+  SKIP_IF_NO_IO_URING();
+  ObLocalIOUring uring;
+  ASSERT_EQ(OB_SUCCESS, uring.init(8, 0));
+  struct io_event events[8];
+  struct timespec timeout = {0, 10 * 1000 * 1000};
+  int64_t complete_cnt = -1;
+  const int64_t begin_us = ObTimeUtility::current_time();
+  ASSERT_EQ(OB_SUCCESS, uring.get_events(1, 8, events, &timeout, complete_cnt));
+  ASSERT_EQ(0, complete_cnt);
+  ASSERT_GE(ObTimeUtility::current_time() - begin_us, 10 * 1000);
+  // no wait without min_nr
+  ASSERT_EQ(OB_SUCCESS, uring.get_events(0, 8, events, nullptr, complete_cnt));
+  ASSERT_EQ(0, complete_cnt);
+}
+
+TEST_F(TestLocalIOUring, registered_file)
+{
+  SKIP_IF_NO_IO_URING();
+  ObLocalIOUring uring;
+  ASSERT_EQ(OB_SUCCESS, uring.init(16, 0));
+  ASSERT_EQ(OB_SUCCESS, uring.register_file(fd_));
+  ASSERT_EQ(fd_, uring.registered_fd_);
+  // only one file is registered
+  ASSERT_EQ(OB_INVALID_ARGUMENT, uring.register_file(fd_));
+  write_and_read(uring, 16, 5);
+
+  // requests on other files do not use the fixed file
+  const char *other_file = "./test_local_io_uring.other";
+  const int other_fd = ::open(other_file, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  ASSERT_GE(other_fd, 0);
+  struct iocb iocb;
+  struct io_event events[1];
+  int64_t complete_cnt = 0;
+  fill(write_bufs_, BLOCK_SIZE, 3);
+  ::io_prep_pwrite(&iocb, other_fd, write_bufs_, BLOCK_SIZE, 0);
+  iocb.data = write_bufs_;
+  ASSERT_EQ(OB_SUCCESS, uring.submit(iocb));
+  ASSERT_EQ(OB_SUCCESS, uring.get_events(1, 1, events, nullptr, complete_cnt));
+  ASSERT_EQ(1, complete_cnt);
+  ASSERT_EQ(BLOCK_SIZE, static_cast<int64_t>(events[0].res));
+  MEMSET(read_bufs_, 0, BLOCK_SIZE);
+  ASSERT_EQ(BLOCK_SIZE, ::pread(other_fd, read_bufs_, BLOCK_SIZE, 0));
+  ASSERT_EQ(0, MEMCMP(write_bufs_, read_bufs_, BLOCK_SIZE));
+  ::close(other_fd);
+  ::unlink(other_file);
+}
+
+TEST_F(TestLocalIOUring, sqpoll)
+{
+  SKIP_IF_NO_IO_URING();
+  ObLocalIOUring uring;
+  if (OB_SUCCESS != uring.init(16, 10)) {
+    // SQPOLL needs privileges on kernels before 5.11
+    LOG_INFO("io_uring SQPOLL is not allowed, skip the case");
+    return;
+  }
+  ASSERT_TRUE(uring.is_sqpoll());
+  write_and_read(uring, 16, 16);
+  // let the polling thread go idle, the next submit must wake it up
+  ::usleep(50 * 1000);
+  write_and_read(uring, 16, 4);
+  ASSERT_EQ(0U, uring.pending_cnt_);
+}
+
+TEST_F(TestLocalIOUring, device_fallback)
+{
+  ObLocalDevice device;
+  ObIODOpts opts;
+  ObIOContext *io_context = nullptr;
+  ASSERT_EQ(OB_SUCCESS, device.init(opts));
+  GCONF._enable_io_uring.set_value("True");
+
+  // the block file can not be registered, the context stays on libaio
+  const int bad_fd = ::dup(fd_);
+  ASSERT_GE(bad_fd, 0);
+  ::close(bad_fd);
+  device.block_fd_ = bad_fd;
+  ASSERT_EQ(OB_SUCCESS, device.io_setup(8, io_context));
+  ASSERT_NE(nullptr, io_context);
+  ObLocalIOContext *local_context = static_cast<ObLocalIOContext *>(io_context);
+  ASSERT_EQ(nullptr, local_context->uring_);
+  ASSERT_NE(nullptr, local_context->io_context_);
+  ASSERT_EQ(OB_SUCCESS, device.io_destroy(io_context));
+  device.block_fd_ = -1;
+
+  // the ring is used when it can be set up
+  io_context = nullptr;
+  ASSERT_EQ(OB_SUCCESS, device.io_setup(8, io_context));
+  local_context = static_cast<ObLocalIOContext *>(io_context);
+  if (is_supported_) {
+    ASSERT_NE(nullptr, local_context->uring_);
+  } else {
+    ASSERT_EQ(nullptr, local_context->uring_);
+    ASSERT_NE(nullptr, local_context->io_context_);
+  }
+  ASSERT_EQ(OB_SUCCESS, device.io_destroy(io_context));
+
+  // libaio without the switch
+  GCONF._enable_io_uring.set_value("False");
+  io_context = nullptr;
+  ASSERT_EQ(OB_SUCCESS, device.io_setup(8, io_context));
+  local_context = static_cast<ObLocalIOContext *>(io_context);
+  ASSERT_EQ(nullptr, local_context->uring_);
+  ASSERT_EQ(OB_SUCCESS, device.io_destroy(io_context));
+  device.destroy();
+}
+
+} // namespace share
+} // namespace oceanbase
+
+int main(int argc, char** argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define USING_LOG_PREFIX SHARE
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "share/vector_index/ob_vector_embedding_handler.h"
+#include "share/rc/ob_tenant_base.h"
+#include "lib/string/ob_sql_string.h"
+#undef protected
+#undef private
+
+namespace oceanbase {
+namespace share {
+
+// requests are only added to the curl multi handle, nothing is sent to this url
+static const char *TEST_MODEL_URL = "http://127.0.0.1:1/v1/embeddings";
+static const int64_t TEST_DIM = 2;
+
+class TestEmbeddingHandler : public ::testing::Test
+{
+public:
+  TestEmbeddingHandler() : allocator_("EmbedTest") {}
+  ~TestEmbeddingHandler() {}
+  static void SetUpTestCase()
+  {
+    static ObTenantBase tenant_ctx(OB_SYS_TENANT_ID);
+    ObTenantEnv::set_tenant(&tenant_ctx);
+  }
+  virtual void TearDown()
+  {
+    chunks_.reset();
+    allocator_.reset();
+  }
+  void init_task(ObEmbeddingTask &task, const std::vector<const char *> &texts, const uint32_t batch_size)
+  {
+    chunks_.reset();
+    for (size_t i = 0; i < texts.size(); ++i) {
+      ASSERT_EQ(OB_SUCCESS, chunks_.push_back(ObString(texts[i])));
+    }
+    ASSERT_EQ(OB_SUCCESS, task.init(ObString(TEST_MODEL_URL), ObString("test-model"), ObString("test"),
+                                    ObString("test-key"), chunks_, TEST_DIM, 0));
+    task.use_base64_format_ = false;
+    task.batch_size_ = batch_size;
+    task.original_batch_size_ = batch_size;
+  }
+  // response of unique chunks [start, end), the vector of unique chunk i is (i, -i)
+  void set_response(ObEmbeddingTask::HttpRequest &request, const int64_t start, const int64_t end)
+  {
+    ObSqlString json;
+    ASSERT_EQ(OB_SUCCESS, json.append("{\"data\":["));
+    for (int64_t i = start; i < end; ++i) {
+      ASSERT_EQ(OB_SUCCESS, json.append_fmt("%s{\"embedding\":[%ld,%ld]}", i == start ? "" : ",", i, -i));
+    }
+    ASSERT_EQ(OB_SUCCESS, json.append("]}"));
+    char *data = static_cast<char *>(allocator_.alloc(json.length() + 1));
+    ASSERT_TRUE(nullptr != data);
+    MEMCPY(data, json.ptr(), json.length() + 1);
+    request.response_.data = data;
+    request.response_.size = json.length();
+  }
+  void complete_request(ObEmbeddingTask &task, const int64_t slot_idx)
+  {
+    ObEmbeddingTask::HttpRequest *request = task.requests_.at(slot_idx);
+    ASSERT_TRUE(request->in_progress_);
+    request->in_progress_ = false;
+    request->is_ready_ = true;
+    set_response(*request, request->start_idx_, request->end_idx_);
+  }
+  // as check_http_progress does for a failed batch whose backoff is over
+  void fail_request(ObEmbeddingTask &task, const int64_t slot_idx, const bool shrink_batch)
+  {
+    ObEmbeddingTask::HttpRequest *request = task.requests_.at(slot_idx);
+    ASSERT_TRUE(request->in_progress_);
+    request->in_progress_ = false;
+    if (shrink_batch) {
+      ASSERT_EQ(OB_SUCCESS, task.adjust_batch_size_for_retry(request->start_idx_, request->end_idx_));
+    }
+    request->need_retry_ = true;
+    request->retry_time_us_ = 0;
+  }
+  static void check_range(const ObEmbeddingTask &task, const int64_t slot_idx,
+                          const int64_t start, const int64_t end)
+  {
+    const ObEmbeddingTask::HttpRequest *request = task.requests_.at(slot_idx);
+    ASSERT_TRUE(request->in_progress_) << "slot " << slot_idx;
+    ASSERT_EQ(start, request->start_idx_) << "slot " << slot_idx;
+    ASSERT_EQ(end, request->end_idx_) << "slot " << slot_idx;
+  }
+
+protected:
+  ObArenaAllocator allocator_;
+  ObArray<ObString> chunks_;
+};
+
+TEST_F(TestEmbeddingHandler, dedup_fan_out)
+{
+  ObEmbeddingTask task(allocator_);
+  init_task(task, {"a", "b", "a", "c", "b", "a"}, 10);
+  ASSERT_EQ(6, task.total_chunks_);
+  ASSERT_EQ(3, task.unique_chunks_.count());
+  const int64_t expect_idx[] = {0, 1, 0, 2, 1, 0};
+  ASSERT_EQ(6, task.chunk_unique_idx_.count());
+  for (int64_t i = 0; i < 6; ++i) {
+    ASSERT_EQ(expect_idx[i], task.chunk_unique_idx_.at(i));
+  }
+  // no more request slots than unique chunks
+  ASSERT_EQ(3, task.max_inflight_requests_);
+  ASSERT_EQ(3, task.requests_.count());
+
+  // the output stops at the first row whose text is not embedded yet
+  float vectors[3][TEST_DIM] = {{0, 0}, {1, -1}, {2, -2}};
+  task.unique_vectors_.at(1) = vectors[1];
+  ASSERT_EQ(OB_SUCCESS, task.fill_output_vectors());
+  ASSERT_EQ(0, task.output_vectors_.count());
+  task.unique_vectors_.at(0) = vectors[0];
+  ASSERT_EQ(OB_SUCCESS, task.fill_output_vectors());
+  ASSERT_EQ(3, task.output_vectors_.count());
+  task.unique_vectors_.at(2) = vectors[2];
+  ASSERT_EQ(OB_SUCCESS, task.fill_output_vectors());
+  ASSERT_EQ(6, task.output_vectors_.count());
+  for (int64_t i = 0; i < 6; ++i) {
+    ASSERT_EQ(vectors[expect_idx[i]], task.output_vectors_.at(i));
+  }
+}
+
+TEST_F(TestEmbeddingHandler, pipelined_responses)
+{
+  ObEmbeddingTask task(allocator_);
+  init_task(task, {"t0", "t1", "t2", "t3", "t1", "t4"}, 2);
+  ASSERT_EQ(5, task.unique_chunks_.count());
+  ASSERT_EQ(4, task.requests_.count());
+  // every slot takes the next batch of unique chunks
+  ASSERT_EQ(OB_SUCCESS, task.dispatch_requests());
+  ASSERT_EQ(3, task.get_inflight_request_count());
+  check_range(task, 0, 0, 2);
+  check_range(task, 1, 2, 4);
+  check_range(task, 2, 4, 5);
+  ASSERT_TRUE(task.requests_.at(3)->is_idle());
+  ASSERT_EQ(5, task.next_unique_idx_);
+
+  // the second batch completes first, its vectors wait for the first batch
+  complete_request(task, 1);
+  ASSERT_EQ(OB_SUCCESS, task.process_http_response());
+  ASSERT_EQ(2, task.unique_ready_cnt_);
+  ASSERT_EQ(0, task.output_vectors_.count());
+  ASSERT_TRUE(task.requests_.at(1)->is_idle());
+  complete_request(task, 0);
+  ASSERT_EQ(OB_SUCCESS, task.process_http_response());
+  ASSERT_EQ(4, task.unique_ready_cnt_);
+  // t4 is not embedded yet
+  ASSERT_EQ(5, task.output_vectors_.count());
+  const float expect[] = {0, 1, 2, 3, 1};
+  for (int64_t i = 0; i < 5; ++i) {
+    ASSERT_EQ(expect[i], task.output_vectors_.at(i)[0]);
+    ASSERT_EQ(-expect[i], task.output_vectors_.at(i)[1]);
+  }
+  // nothing left to send
+  ASSERT_EQ(OB_SUCCESS, task.dispatch_requests());
+  ASSERT_EQ(1, task.get_inflight_request_count());
+  ASSERT_TRUE(task.has_pending_request());
+  complete_request(task, 2);
+  ASSERT_EQ(OB_SUCCESS, task.process_http_response());
+  ASSERT_EQ(5, task.unique_ready_cnt_);
+  ASSERT_EQ(6, task.output_vectors_.count());
+  ASSERT_EQ(4, task.output_vectors_.at(5)[0]);
+  ASSERT_FALSE(task.has_pending_request());
+}
+
+TEST_F(TestEmbeddingHandler, response_count_mismatch)
+{
+  ObEmbeddingTask task(allocator_);
+  init_task(task, {"t0", "t1", "t2"}, 3);
+  ASSERT_EQ(OB_SUCCESS, task.dispatch_requests());
+  check_range(task, 0, 0, 3);
+  ObEmbeddingTask::HttpRequest *request = task.requests_.at(0);
+  request->in_progress_ = false;
+  request->is_ready_ = true;
+  set_response(*request, 0, 2);
+  ASSERT_EQ(OB_ERR_UNEXPECTED, task.process_http_response());
+  ASSERT_EQ(0, task.output_vectors_.count());
+}
+
+TEST_F(TestEmbeddingHandler, endpoint_limiter)
+{
+  ObEmbeddingEndpointLimiter limiter;
+  const ObString url(TEST_MODEL_URL);
+  const ObString other_url("http://127.0.0.1:2/v1/embeddings");
+  // without init every task keeps one request in flight
+  ASSERT_FALSE(limiter.try_acquire(url, 4));
+  ASSERT_EQ(OB_SUCCESS, limiter.init(OB_SYS_TENANT_ID));
+  ASSERT_EQ(OB_INIT_TWICE, limiter.init(OB_SYS_TENANT_ID));
+  ASSERT_TRUE(limiter.try_acquire(url, 2));
+  ASSERT_TRUE(limiter.try_acquire(url, 2));
+  ASSERT_FALSE(limiter.try_acquire(url, 2));
+  ASSERT_TRUE(limiter.try_acquire(other_url, 2));
+  // acquire ignores the limit
+  limiter.acquire(url);
+  ASSERT_EQ(3, limiter.get_inflight_count(url));
+  ASSERT_EQ(1, limiter.get_inflight_count(other_url));
+  limiter.release(url);
+  limiter.release(url);
+  ASSERT_EQ(1, limiter.get_inflight_count(url));
+  ASSERT_TRUE(limiter.try_acquire(url, 2));
+  limiter.release(url);
+  limiter.release(url);
+  limiter.release(other_url);
+  ASSERT_EQ(0, limiter.get_inflight_count(url));
+  ASSERT_EQ(0, limiter.get_inflight_count(other_url));
+  // releasing more than acquired keeps the count at 0
+  limiter.release(url);
+  ASSERT_EQ(0, limiter.get_inflight_count(url));
+}
+
+TEST_F(TestEmbeddingHandler, inflight_limit)
+{
+  ObEmbeddingEndpointLimiter limiter;
+  const ObString url(TEST_MODEL_URL);
+  const int64_t limit = GCONF._embedding_max_inflight_requests;
+  ASSERT_EQ(OB_SUCCESS, limiter.init(OB_SYS_TENANT_ID));
+  {
+    ObEmbeddingTask task(allocator_);
+    init_task(task, {"t0", "t1", "t2", "t3", "t4", "t5", "t6", "t7"}, 1);
+    task.endpoint_limiter_ = &limiter;
+    const int64_t slot_cnt = task.requests_.count();
+    ASSERT_EQ(OB_MIN(limit, 8), slot_cnt);
+    // other tasks keep the endpoint busy, the task still sends one request
+    for (int64_t i = 0; i < limit; ++i) {
+      limiter.acquire(url);
+    }
+    ASSERT_EQ(OB_SUCCESS, task.dispatch_requests());
+    ASSERT_EQ(1, task.get_inflight_request_count());
+    ASSERT_TRUE(task.requests_.at(0)->hold_endpoint_slot_);
+    ASSERT_EQ(limit + 1, limiter.get_inflight_count(url));
+    ASSERT_EQ(1, task.next_unique_idx_);
+    ASSERT_EQ(OB_SUCCESS, task.dispatch_requests());
+    ASSERT_EQ(1, task.get_inflight_request_count());
+    // the other tasks are done, the idle slots are filled up to the limit
+    for (int64_t i = 0; i < limit; ++i) {
+      limiter.release(url);
+    }
+    ASSERT_EQ(OB_SUCCESS, task.dispatch_requests());
+    ASSERT_EQ(slot_cnt, task.get_inflight_request_count());
+    ASSERT_EQ(slot_cnt, limiter.get_inflight_count(url));
+    for (int64_t i = 0; i < slot_cnt; ++i) {
+      check_range(task, i, i, i + 1);
+    }
+    // a completed request gives its slot back
+    complete_request(task, 0);
+    task.requests_.at(0)->hold_endpoint_slot_ = false;
+    limiter.release(url);
+    ASSERT_EQ(slot_cnt - 1, limiter.get_inflight_count(url));
+  }
+  // the slots of a task are released when it is destroyed
+  ASSERT_EQ(0, limiter.get_inflight_count(url));
+}
+
+TEST_F(TestEmbeddingHandler, batch_shrink_retry)
+{
+  ObEmbeddingTask task(allocator_);
+  init_task(task, {"t0", "t1", "t2", "t3", "t4", "t5", "t6", "t7", "t8", "t9"}, 4);
+  ASSERT_EQ(4, task.requests_.count());
+  ASSERT_EQ(OB_SUCCESS, task.dispatch_requests());
+  check_range(task, 0, 0, 4);
+  check_range(task, 1, 4, 8);
+  check_range(task, 2, 8, 10);
+  ASSERT_TRUE(task.requests_.at(3)->is_idle());
+
+  // the failed batch is cut to the smaller batch size, the rest is requeued
+  fail_request(task, 0, true);
+  ASSERT_EQ(3U, task.batch_size_);
+  ASSERT_TRUE(task.batch_size_adjusted_);
+  ASSERT_EQ(3, task.requests_.at(0)->end_idx_);
+  ASSERT_EQ(1, task.requeued_ranges_.count());
+  ASSERT_EQ(3, task.requeued_ranges_.at(0).first);
+  ASSERT_EQ(4, task.requeued_ranges_.at(0).second);
+  ASSERT_TRUE(task.has_pending_request());
+  ASSERT_TRUE(task.has_due_retry_request());
+
+  // the retry is sent again and an idle slot takes the requeued range before new chunks
+  ASSERT_EQ(OB_SUCCESS, task.dispatch_requests());
+  check_range(task, 0, 0, 3);
+  check_range(task, 3, 3, 4);
+  ASSERT_TRUE(task.requeued_ranges_.empty());
+  ASSERT_EQ(10, task.next_unique_idx_);
+
+  // a requeued range is split again when the batch size went down further
+  fail_request(task, 1, true);
+  ASSERT_EQ(2U, task.batch_size_);
+  ASSERT_EQ(6, task.requests_.at(1)->end_idx_);
+  task.batch_size_ = 1;
+  complete_request(task, 2);
+  ASSERT_EQ(OB_SUCCESS, task.process_http_response());
+  ASSERT_EQ(OB_SUCCESS, task.dispatch_requests());
+  check_range(task, 1, 4, 6);
+  check_range(task, 2, 6, 7);
+  ASSERT_EQ(1, task.requeued_ranges_.count());
+  ASSERT_EQ(7, task.requeued_ranges_.at(0).first);
+  ASSERT_EQ(8, task.requeued_ranges_.at(0).second);
+
+  // a single text can not be shrunk
+  int64_t end_idx = 6;
+  ASSERT_EQ(OB_ERR_UNEXPECTED, task.adjust_batch_size_for_retry(5, end_idx));
+  ASSERT_EQ(6, end_idx);
+  end_idx = 5;
+  ASSERT_EQ(OB_INVALID_ARGUMENT, task.adjust_batch_size_for_retry(5, end_idx));
+
+  // the batch size grows back after successful requests
+  task.reset_retry_state();
+  ASSERT_EQ(2U, task.batch_size_);
+  task.reset_retry_state();
+  task.reset_retry_state();
+  ASSERT_EQ(4U, task.batch_size_);
+  ASSERT_FALSE(task.batch_size_adjusted_);
+}
+
+} // namespace share
+} // namespace oceanbase
+
+int main(int argc, char** argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define USING_LOG_PREFIX SHARE
+#include <gtest/gtest.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "lib/file/file_directory_utils.h"
+#include "storage/ob_file_system_router.h"
+#include "share/vector_index/ob_vector_index_snapshot_image.h"
+
+namespace oceanbase {
+namespace share {
+
+static const char *TEST_DATA_DIR = "./test_vector_index_snapshot_image_data";
+static const uint64_t TEST_TENANT_ID = 1002;
+
+class TestVecIdxSnapImage : public ::testing::Test
+{
+public:
+  TestVecIdxSnapImage() {}
+  ~TestVecIdxSnapImage() {}
+  static void SetUpTestCase()
+  {
+    char clog_dir[common::MAX_PATH_SIZE] = {0};
+    snprintf(clog_dir, sizeof(clog_dir), "%s/clog/", TEST_DATA_DIR);
+    (void)common::FileDirectoryUtils::delete_directory_rec(TEST_DATA_DIR);
+    ASSERT_EQ(OB_SUCCESS, common::FileDirectoryUtils::create_full_path(clog_dir));
+    ASSERT_EQ(OB_SUCCESS, storage::ObFileSystemRouter::get_instance().init(TEST_DATA_DIR, clog_dir));
+  }
+  static void TearDownTestCase()
+  {
+    (void)common::FileDirectoryUtils::delete_directory_rec(TEST_DATA_DIR);
+  }
+  virtual void SetUp()
+  {
+    data_.reset();
+    for (int64_t i = 0; i < DATA_SIZE; ++i) {
+      data_buf_[i] = static_cast<char>(i * 31 + 7);
+    }
+    data_.assign_ptr(data_buf_, DATA_SIZE);
+  }
+  // write data_ in several appends as the deserialize callback does
+  void write_image(const ObTabletID &tablet_id, const ObString &key)
+  {
+    ObVecIdxSnapImageWriter writer;
+    ASSERT_EQ(OB_SUCCESS, writer.open(TEST_TENANT_ID, tablet_id, key));
+    for (int64_t pos = 0; pos < DATA_SIZE; pos += APPEND_SIZE) {
+      writer.append(data_buf_ + pos, MIN(APPEND_SIZE, DATA_SIZE - pos));
+    }
+    ASSERT_EQ(OB_SUCCESS, writer.finish());
+  }
+  void get_path(const ObTabletID &tablet_id, char *path, const int64_t path_len)
+  {
+    ASSERT_EQ(OB_SUCCESS, ObVecIdxSnapImageUtil::get_image_path(TEST_TENANT_ID, tablet_id, path, path_len));
+  }
+  bool is_exist(const ObTabletID &tablet_id)
+  {
+    char path[common::MAX_PATH_SIZE] = {0};
+    get_path(tablet_id, path, sizeof(path));
+    return 0 == ::access(path, F_OK);
+  }
+  void overwrite(const ObTabletID &tablet_id, const int64_t offset, const char value)
+  {
+    char path[common::MAX_PATH_SIZE] = {0};
+    get_path(tablet_id, path, sizeof(path));
+    int fd = ::open(path, O_WRONLY);
+    ASSERT_GE(fd, 0);
+    ASSERT_EQ(1, ::pwrite(fd, &value, 1, offset));
+    ::close(fd);
+  }
+
+protected:
+  static const int64_t DATA_SIZE = 100 * 1024 + 17;
+  static const int64_t APPEND_SIZE = 4096;
+  char data_buf_[DATA_SIZE];
+  ObString data_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(TestVecIdxSnapImage);
+};
+
+TEST_F(TestVecIdxSnapImage, write_and_map)
+{
+  const ObTabletID tablet_id(200001);
+  const ObString key("200001_hnsw_data_part00000");
+  write_image(tablet_id, key);
+  ASSERT_TRUE(is_exist(tablet_id));
+
+  ObVecIdxSnapImageReader reader;
+  ASSERT_EQ(OB_SUCCESS, reader.open(TEST_TENANT_ID, tablet_id, key));
+  int64_t read_size = 0;
+  char *chunk = nullptr;
+  int64_t chunk_size = 0;
+  int ret = OB_SUCCESS;
+  while (OB_SUCC(reader.get_next_chunk(chunk, chunk_size))) {
+    ASSERT_LE(read_size + chunk_size, DATA_SIZE);
+    ASSERT_EQ(0, MEMCMP(chunk, data_buf_ + read_size, chunk_size));
+    read_size += chunk_size;
+  }
+  ASSERT_EQ(OB_ITER_END, ret);
+  ASSERT_EQ(DATA_SIZE, read_size);
+  reader.close();
+
+  // the same stream through the istream callback used by vsag deserialize
+  char buf[1024] = {0};
+  ObVecIdxSnapImageReader cb_reader;
+  ASSERT_EQ(OB_SUCCESS, cb_reader.open(TEST_TENANT_ID, tablet_id, key));
+  ObVecIdxSnapImageReadCallback callback;
+  ObVecIdxSnapImageReadCallback::CbParam cb_param(&cb_reader);
+  ObIStreamBuf::Callback func = callback;
+  ObIStreamBuf streambuf(buf, sizeof(buf), cb_param, func);
+  std::istream in(&streambuf);
+  std::string result(DATA_SIZE, '\0');
+  in.read(&result[0], DATA_SIZE);
+  ASSERT_EQ(OB_SUCCESS, streambuf.get_error_code());
+  ASSERT_EQ(0, MEMCMP(result.data(), data_buf_, DATA_SIZE));
+}
+
+TEST_F(TestVecIdxSnapImage, stale_key)
+{
+  const ObTabletID tablet_id(200002);
+  write_image(tablet_id, ObString("200002_hnsw_data_part00000"));
+  ObVecIdxSnapImageReader reader;
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, reader.open(TEST_TENANT_ID, tablet_id, ObString("200002_hnsw_data_part00001")));
+  // no image at all
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, reader.open(TEST_TENANT_ID, ObTabletID(299999), ObString("any")));
+}
+
+TEST_F(TestVecIdxSnapImage, checksum_reject)
+{
+  const ObTabletID tablet_id(200003);
+  const ObString key("200003_hnsw_data_part00000");
+  ObVecIdxSnapImageReader reader;
+
+  // flipped byte in the data
+  write_image(tablet_id, key);
+  overwrite(tablet_id, ObVecIdxSnapImageHeader::DATA_OFFSET + DATA_SIZE / 2, ~data_buf_[DATA_SIZE / 2]);
+  ASSERT_EQ(OB_CHECKSUM_ERROR, reader.open(TEST_TENANT_ID, tablet_id, key));
+
+  // flipped byte in the header
+  write_image(tablet_id, key);
+  overwrite(tablet_id, offsetof(ObVecIdxSnapImageHeader, data_size_), 0x7f);
+  ASSERT_EQ(OB_INVALID_DATA, reader.open(TEST_TENANT_ID, tablet_id, key));
+
+  // torn file
+  write_image(tablet_id, key);
+  char path[common::MAX_PATH_SIZE] = {0};
+  get_path(tablet_id, path, sizeof(path));
+  ASSERT_EQ(0, ::truncate(path, ObVecIdxSnapImageHeader::DATA_OFFSET + DATA_SIZE - 1));
+  ASSERT_EQ(OB_INVALID_DATA, reader.open(TEST_TENANT_ID, tablet_id, key));
+
+  // a good image is accepted again after rewrite
+  write_image(tablet_id, key);
+  ASSERT_EQ(OB_SUCCESS, reader.open(TEST_TENANT_ID, tablet_id, key));
+}
+
+TEST_F(TestVecIdxSnapImage, abort_and_remove)
+{
+  const ObTabletID tablet_id(200004);
+  const ObString key("200004_hnsw_data_part00000");
+  {
+    ObVecIdxSnapImageWriter writer;
+    ASSERT_EQ(OB_SUCCESS, writer.open(TEST_TENANT_ID, tablet_id, key));
+    writer.append(data_buf_, APPEND_SIZE);
+    writer.abort();
+  }
+  ASSERT_FALSE(is_exist(tablet_id));
+
+  write_image(tablet_id, key);
+  ASSERT_TRUE(is_exist(tablet_id));
+  ObVecIdxSnapImageUtil::remove_image(TEST_TENANT_ID, tablet_id);
+  ASSERT_FALSE(is_exist(tablet_id));
+
+  write_image(tablet_id, key);
+  ObVecIdxSnapImageUtil::remove_tenant_images(TEST_TENANT_ID);
+  ASSERT_FALSE(is_exist(tablet_id));
+  // removing again is harmless
+  ObVecIdxSnapImageUtil::remove_image(TEST_TENANT_ID, tablet_id);
+  ObVecIdxSnapImageUtil::remove_tenant_images(TEST_TENANT_ID);
+}
+
+} // namespace share
+} // namespace oceanbase
+
+int main(int argc, char** argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -243,6 +243,90 @@ TEST_F(TestVsagAdaptor, test_hnsw)
   ASSERT_EQ(0, default_allocator.total_);
 }
 
+TEST_F(TestVsagAdaptor, test_hnsw_batch_search)
+{
+  ASSERT_TRUE(obvsag::is_init());
+  obvsag::VectorIndexPtr index_handler = nullptr;
+  int dim = 128;
+  int max_degree = 16;
+  int ef_search = 200;
+  int ef_construction = 100;
+  DefaultVsagAllocator default_allocator;
+  const char* const METRIC_L2 = "l2";
+  const char* const DATATYPE_FLOAT32 = "float32";
+  ASSERT_EQ(0, obvsag::create_index(index_handler,
+                                    obvsag::HNSW_TYPE,
+                                    DATATYPE_FLOAT32,
+                                    METRIC_L2,
+                                    dim,
+                                    max_degree,
+                                    ef_construction,
+                                    ef_search,
+                                    &default_allocator));
+  int num_vectors = 2000;
+  auto ids = new int64_t[num_vectors];
+  auto vectors = new float[dim * num_vectors];
+  std::mt19937 rng;
+  rng.seed(47);
+  std::uniform_real_distribution<> distrib_real;
+  for (int64_t i = 0; i < num_vectors; ++i) {
+    ids[i] = i;
+  }
+  for (int64_t i = 0; i < dim * num_vectors; ++i) {
+    vectors[i] = distrib_real(rng);
+  }
+  ASSERT_EQ(0, obvsag::build_index(index_handler, vectors, ids, dim, num_vectors));
+
+  // the last query_count base vectors are used as queries, each one must find itself first
+  const int64_t query_count = 8;
+  const int64_t topk = 10;
+  float *queries = vectors + dim * (num_vectors - query_count);
+  const float *dists[query_count];
+  const int64_t *result_ids[query_count];
+  int64_t result_sizes[query_count];
+  roaring::api::roaring64_bitmap_t* r1 = roaring::api::roaring64_bitmap_create();
+  TestFilter testfilter(r1);
+  ASSERT_EQ(0, obvsag::batch_knn_search(index_handler, queries, dim, query_count, topk,
+                                        dists, result_ids, result_sizes, 100, &testfilter));
+  for (int64_t i = 0; i < query_count; ++i) {
+    ASSERT_EQ(topk, result_sizes[i]);
+    ASSERT_EQ(num_vectors - query_count + i, result_ids[i][0]);
+    // batch result is the same as the single query result
+    const float *single_dist = nullptr;
+    const int64_t *single_ids = nullptr;
+    int64_t single_size = 0;
+    const char *extra_info = nullptr;
+    ASSERT_EQ(0, obvsag::knn_search(index_handler, queries + i * dim, dim, topk,
+                                    single_dist, single_ids, single_size,
+                                    100, false/*need_extra_info*/, extra_info, &testfilter, false, false, nullptr, 1));
+    ASSERT_EQ(single_size, result_sizes[i]);
+    for (int64_t j = 0; j < single_size; ++j) {
+      ASSERT_EQ(single_ids[j], result_ids[i][j]);
+    }
+    default_allocator.Deallocate((void*)single_ids);
+    default_allocator.Deallocate((void*)single_dist);
+    default_allocator.Deallocate((void*)result_ids[i]);
+    default_allocator.Deallocate((void*)dists[i]);
+  }
+  // with a zero distance threshold only the query vector itself is left
+  ASSERT_EQ(0, obvsag::batch_knn_search(index_handler, queries, dim, query_count, topk,
+                                        dists, result_ids, result_sizes, 100, &testfilter,
+                                        false, false, nullptr, 1, 0));
+  for (int64_t i = 0; i < query_count; ++i) {
+    ASSERT_EQ(1, result_sizes[i]);
+    ASSERT_EQ(num_vectors - query_count + i, result_ids[i][0]);
+    default_allocator.Deallocate((void*)result_ids[i]);
+    default_allocator.Deallocate((void*)dists[i]);
+  }
+  ASSERT_NE(0, obvsag::batch_knn_search(index_handler, queries, dim, 0, topk,
+                                        dists, result_ids, result_sizes, 100));
+  roaring::api::roaring64_bitmap_free(r1);
+  delete[] ids;
+  delete[] vectors;
+  obvsag::delete_index(index_handler);
+  ASSERT_EQ(0, default_allocator.total_);
+}
+
 TEST_F(TestVsagAdaptor, test_hnswsq)
 {
   ASSERT_TRUE(obvsag::is_init());
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define USING_LOG_PREFIX LIB
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include "lib/oblog/ob_log.h"
+#include "lib/time/ob_time_utility.h"
+#include "share/vector_type/ob_vector_batch_distance.h"
+#include "share/vector_type/ob_vector_l2_distance.h"
+#include "share/vector_type/ob_vector_ip_distance.h"
+#include "share/vector_type/ob_vector_cosine_distance.h"
+
+namespace oceanbase
+{
+namespace common
+{
+
+class TestVectorBatchDistance : public ::testing::Test
+{
+public:
+  TestVectorBatchDistance() {}
+  ~TestVectorBatchDistance() {}
+
+  void fill_random(std::vector<float> &data)
+  {
+    std::mt19937 gen(20251017);
+    std::uniform_real_distribution<float> dist(-1.0, 1.0);
+    for (int64_t i = 0; i < data.size(); ++i) {
+      data[i] = dist(gen);
+    }
+  }
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(TestVectorBatchDistance);
+};
+
+// the batch kernels must agree with the per-pair functions for specialized and generic dims
+TEST_F(TestVectorBatchDistance, test_batch_match_pairwise)
+{
+  const int64_t dims[] = {3, 17, 128, 130, 384, 768, 1024, 1536};
+  const int64_t count = 37;
+  for (int64_t d = 0; d < sizeof(dims) / sizeof(dims[0]); ++d) {
+    const int64_t dim = dims[d];
+    std::vector<float> query(dim);
+    std::vector<float> rows(dim * count);
+    std::vector<float> l2(count);
+    std::vector<float> ip(count);
+    std::vector<float> cosine(count);
+    fill_random(query);
+    fill_random(rows);
+    ASSERT_EQ(OB_SUCCESS, ObVectorBatchDistance<float>::l2_square_batch(query.data(), rows.data(), dim, count, l2.data()));
+    ASSERT_EQ(OB_SUCCESS, ObVectorBatchDistance<float>::ip_batch(query.data(), rows.data(), dim, count, ip.data()));
+    ASSERT_EQ(OB_SUCCESS, ObVectorBatchDistance<float>::cosine_distance_batch(query.data(), rows.data(), dim, count, cosine.data()));
+    for (int64_t i = 0; i < count; ++i) {
+      const float *row = rows.data() + i * dim;
+      double expect_l2 = 0;
+      double expect_ip = 0;
+      double expect_cosine = 0;
+      ASSERT_EQ(OB_SUCCESS, ObVectorL2Distance<float>::l2_square_func(query.data(), row, dim, expect_l2));
+      ASSERT_EQ(OB_SUCCESS, ObVectorIpDistance<float>::ip_distance_func(query.data(), row, dim, expect_ip));
+      ASSERT_EQ(OB_SUCCESS, ObVectorCosineDistance<float>::cosine_distance_func(query.data(), row, dim, expect_cosine));
+      ASSERT_NEAR(expect_l2, l2[i], 1e-3 * expect_l2) << "dim=" << dim << " row=" << i;
+      ASSERT_NEAR(expect_ip, ip[i], 1e-3 * dim) << "dim=" << dim << " row=" << i;
+      ASSERT_NEAR(expect_cosine, cosine[i], 1e-4) << "dim=" << dim << " row=" << i;
+    }
+  }
+}
+
+TEST_F(TestVectorBatchDistance, test_invalid_argument)
+{
+  float query[4] = {1, 2, 3, 4};
+  float dists[1] = {0};
+  ASSERT_EQ(OB_INVALID_ARGUMENT, ObVectorBatchDistance<float>::l2_square_batch(query, query, 0, 1, dists));
+  ASSERT_EQ(OB_ERR_NULL_VALUE, ObVectorBatchDistance<float>::ip_batch(query, nullptr, 4, 1, dists));
+  ASSERT_EQ(OB_SUCCESS, ObVectorBatchDistance<float>::ip_batch(query, nullptr, 4, 0, nullptr));
+  float zero[4] = {0, 0, 0, 0};
+  ASSERT_EQ(OB_ERR_NULL_VALUE, ObVectorBatchDistance<float>::cosine_distance_batch(zero, query, 4, 1, dists));
+  ASSERT_EQ(OB_SUCCESS, ObVectorBatchDistance<float>::cosine_distance_batch(query, zero, 4, 1, dists));
+  ASSERT_EQ(FLT_MAX, dists[0]);
+}
+
+// microbenchmark: one query against a block of rows, per-pair path vs batch kernels,
+// run it with --gtest_also_run_disabled_tests
+TEST_F(TestVectorBatchDistance, DISABLED_bench_batch_vs_pairwise)
+{
+  const int64_t dims[] = {128, 384, 768, 1024, 1536, 1000};
+  const int64_t count = 4096;
+  const int64_t loops = 20;
+  for (int64_t d = 0; d < sizeof(dims) / sizeof(dims[0]); ++d) {
+    const int64_t dim = dims[d];
+    std::vector<float> query(dim);
+    std::vector<float> rows(dim * count);
+    std::vector<float> dists(count);
+    fill_random(query);
+    fill_random(rows);
+    int64_t start = ObTimeUtility::current_time();
+    for (int64_t l = 0; l < loops; ++l) {
+      ASSERT_EQ(OB_SUCCESS, ObVectorBatchDistance<float>::l2_square_pairwise(query.data(), rows.data(), dim, count, dists.data()));
+    }
+    const int64_t pairwise_us = ObTimeUtility::current_time() - start;
+    start = ObTimeUtility::current_time();
+    for (int64_t l = 0; l < loops; ++l) {
+      ASSERT_EQ(OB_SUCCESS, ObVectorBatchDistance<float>::l2_square_batch(query.data(), rows.data(), dim, count, dists.data()));
+    }
+    const int64_t l2_batch_us = ObTimeUtility::current_time() - start;
+    start = ObTimeUtility::current_time();
+    for (int64_t l = 0; l < loops; ++l) {
+      ASSERT_EQ(OB_SUCCESS, ObVectorBatchDistance<float>::ip_batch(query.data(), rows.data(), dim, count, dists.data()));
+    }
+    const int64_t ip_batch_us = ObTimeUtility::current_time() - start;
+    start = ObTimeUtility::current_time();
+    for (int64_t l = 0; l < loops; ++l) {
+      ASSERT_EQ(OB_SUCCESS, ObVectorBatchDistance<float>::cosine_distance_batch(query.data(), rows.data(), dim, count, dists.data()));
+    }
+    const int64_t cosine_batch_us = ObTimeUtility::current_time() - start;
+    std::cout << "dim=" << dim << " rows=" << count * loops
+              << " l2_pairwise_us=" << pairwise_us
+              << " l2_batch_us=" << l2_batch_us
+              << " ip_batch_us=" << ip_batch_us
+              << " cosine_batch_us=" << cosine_batch_us << std::endl;
+  }
+}
+
+}  // namespace common
+}  // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  OB_LOGGER.set_log_level("INFO");
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define USING_LOG_PREFIX LIB
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include "lib/oblog/ob_log.h"
+#include "lib/allocator/page_arena.h"
+#include "share/vector_type/ob_vector_pq_fast_scan.h"
+#include "share/vector_type/ob_vector_l2_distance.h"
+
+namespace oceanbase
+{
+namespace common
+{
+
+class TestVectorPQFastScan : public ::testing::Test
+{
+public:
+  TestVectorPQFastScan() : gen_(20251017) {}
+  ~TestVectorPQFastScan() {}
+
+protected:
+  std::mt19937 gen_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(TestVectorPQFastScan);
+};
+
+// the exact adc distance of every row must lie within the bounds of its scanned distance
+TEST_F(TestVectorPQFastScan, test_bounds_cover_exact)
+{
+  const int64_t ms[] = {1, 8, 16, 48, 96, 256};
+  const int64_t row_cnts[] = {1, 16, 17, 32};
+  std::uniform_real_distribution<float> dist(-3.0, 5.0);
+  for (int64_t mi = 0; mi < sizeof(ms) / sizeof(ms[0]); ++mi) {
+    const int64_t m = ms[mi];
+    ObArenaAllocator allocator;
+    ObPQFastScanner scanner;
+    ASSERT_EQ(OB_SUCCESS, scanner.init(allocator, m));
+    std::vector<float> sim_table(m * ObPQFastScanner::KSUB);
+    for (int64_t i = 0; i < sim_table.size(); ++i) {
+      sim_table[i] = dist(gen_);
+    }
+    ASSERT_EQ(OB_SUCCESS, scanner.build_lut(sim_table.data()));
+    for (int64_t ri = 0; ri < sizeof(row_cnts) / sizeof(row_cnts[0]); ++ri) {
+      const int64_t row_cnt = row_cnts[ri];
+      std::vector<uint8_t> codes(row_cnt * m);
+      for (int64_t i = 0; i < codes.size(); ++i) {
+        codes[i] = gen_() % ObPQFastScanner::KSUB;
+      }
+      for (int64_t r = 0; r < row_cnt; ++r) {
+        scanner.add_code(codes.data() + r * m);
+      }
+      ASSERT_EQ(row_cnt, scanner.get_row_count());
+      uint16_t dists[ObPQFastScanner::BLOCK_SIZE];
+      scanner.scan_block(dists);
+      ASSERT_EQ(0, scanner.get_row_count());
+      for (int64_t r = 0; r < row_cnt; ++r) {
+        const float exact = ObVectorL2Distance<float>::distance_one_code(m, 4, sim_table.data(), codes.data() + r * m);
+        float lower_bound = 0;
+        float upper_bound = 0;
+        scanner.get_bounds(dists[r], lower_bound, upper_bound);
+        ASSERT_LE(lower_bound, exact) << "m=" << m << " row=" << r;
+        ASSERT_GE(upper_bound, exact) << "m=" << m << " row=" << r;
+      }
+    }
+  }
+}
+
+TEST_F(TestVectorPQFastScan, test_invalid_argument)
+{
+  ObArenaAllocator allocator;
+  ObPQFastScanner scanner;
+  ASSERT_FALSE(ObPQFastScanner::is_supported(16, 8));
+  ASSERT_FALSE(ObPQFastScanner::is_supported(ObPQFastScanner::MAX_M + 1, 4));
+  ASSERT_EQ(OB_NOT_INIT, scanner.build_lut(nullptr));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, scanner.init(allocator, 0));
+  ASSERT_EQ(OB_SUCCESS, scanner.init(allocator, 16));
+  ASSERT_EQ(OB_INIT_TWICE, scanner.init(allocator, 16));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, scanner.build_lut(nullptr));
+}
+
+}  // namespace common
+}  // namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  OB_LOGGER.set_log_level("INFO");
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define USING_LOG_PREFIX SQL
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "sql/das/iter/ob_das_ivf_scan_iter.h"
+#include "sql/das/iter/ob_das_vec_scan_utils.h"
+#include "share/rc/ob_tenant_base.h"
+#undef protected
+#undef private
+
+namespace oceanbase {
+namespace sql {
+
+static const uint64_t TEST_TABLET_ID = 200001;
+// rowkey of the cid_vec table: [cid, pk1, pk2]
+static const int64_t TEST_ROWKEY_CNT = 3;
+
+class TestDASIvfScanIter : public ::testing::Test
+{
+public:
+  TestDASIvfScanIter() : allocator_("IvfScanTest") {}
+  ~TestDASIvfScanIter() {}
+  static void SetUpTestCase()
+  {
+    static ObTenantBase tenant_ctx(OB_SYS_TENANT_ID);
+    ObTenantEnv::set_tenant(&tenant_ctx);
+  }
+  virtual void TearDown()
+  {
+    allocator_.reset();
+  }
+  void init_mem_context(ObDASIvfBaseScanIter &iter)
+  {
+    lib::ContextParam param;
+    param.set_mem_attr(MTL_ID(), "IVF", ObCtxIds::DEFAULT_CTX_ID);
+    ASSERT_EQ(OB_SUCCESS, CURRENT_CONTEXT->CREATE_CONTEXT(iter.mem_context_, param));
+  }
+  void destroy_mem_context(ObDASIvfBaseScanIter &iter)
+  {
+    DESTROY_CONTEXT(iter.mem_context_);
+    iter.mem_context_ = nullptr;
+  }
+  char *alloc_cid_buf()
+  {
+    return static_cast<char *>(allocator_.alloc(OB_DOC_ID_COLUMN_BYTE_LENGTH * ObDASIvfBaseScanIter::IVF_PROBE_BATCH_CNT));
+  }
+  // rowkey of a row of the list cid in the cid_vec table
+  void build_row_rowkey(const ObString &cid, const int64_t pk, ObRowkey &rowkey)
+  {
+    ObObj *objs = static_cast<ObObj *>(allocator_.alloc(sizeof(ObObj) * TEST_ROWKEY_CNT));
+    ASSERT_TRUE(nullptr != objs);
+    objs[0].set_varbinary(cid);
+    objs[1].set_int(pk);
+    objs[2].set_int(pk);
+    rowkey.assign(objs, TEST_ROWKEY_CNT);
+  }
+
+protected:
+  ObArenaAllocator allocator_;
+};
+
+TEST_F(TestDASIvfScanIter, append_probe_cid_str)
+{
+  ObDASIvfScanIter iter;
+  char *buf = alloc_cid_buf();
+  ASSERT_TRUE(nullptr != buf);
+  ObSEArray<ObString, ObDASIvfBaseScanIter::IVF_PROBE_BATCH_CNT> cid_strs;
+  for (int64_t i = 0; i < ObDASIvfBaseScanIter::IVF_PROBE_BATCH_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, iter.append_probe_cid_str(ObCenterId(TEST_TABLET_ID, i + 1), buf, cid_strs));
+  }
+  // one multi-range scan reads at most IVF_PROBE_BATCH_CNT lists
+  ASSERT_EQ(OB_INVALID_ARGUMENT, iter.append_probe_cid_str(ObCenterId(TEST_TABLET_ID, 100), buf, cid_strs));
+  ASSERT_EQ(16, cid_strs.count());
+
+  // every cid has its own slice of buf
+  for (int64_t i = 0; i < cid_strs.count(); ++i) {
+    ObCenterId center_id;
+    ASSERT_TRUE(buf + i * OB_DOC_ID_COLUMN_BYTE_LENGTH == cid_strs.at(i).ptr());
+    ASSERT_EQ(OB_DOC_ID_COLUMN_BYTE_LENGTH, cid_strs.at(i).length());
+    ASSERT_EQ(OB_SUCCESS, ObVectorClusterHelper::get_center_id_from_string(center_id, cid_strs.at(i)));
+    ASSERT_EQ(TEST_TABLET_ID, center_id.tablet_id_);
+    ASSERT_EQ(static_cast<uint64_t>(i + 1), center_id.center_id_);
+  }
+
+  // the buffer is reused by the next batch
+  cid_strs.reuse();
+  ASSERT_EQ(OB_SUCCESS, iter.append_probe_cid_str(ObCenterId(TEST_TABLET_ID, 17), buf, cid_strs));
+  ASSERT_TRUE(buf == cid_strs.at(0).ptr());
+  ASSERT_EQ(OB_INVALID_ARGUMENT, iter.append_probe_cid_str(ObCenterId(TEST_TABLET_ID, 18), nullptr, cid_strs));
+  ASSERT_EQ(1, cid_strs.count());
+}
+
+TEST_F(TestDASIvfScanIter, multi_cid_ranges)
+{
+  ObDASIvfScanIter iter;
+  init_mem_context(iter);
+  char *buf = alloc_cid_buf();
+  ASSERT_TRUE(nullptr != buf);
+  // lists are probed in distance order, not in cid order
+  const uint64_t center_ids[] = {7, 3, 12, 1, 16, 5, 9, 2, 14, 11, 4, 8, 15, 6, 13, 10};
+  const int64_t cid_cnt = sizeof(center_ids) / sizeof(center_ids[0]);
+  ObSEArray<ObString, ObDASIvfBaseScanIter::IVF_PROBE_BATCH_CNT> cid_strs;
+  for (int64_t i = 0; i < cid_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, iter.append_probe_cid_str(ObCenterId(TEST_TABLET_ID, center_ids[i]), buf, cid_strs));
+  }
+
+  // the key ranges of one scan, like scan_cid_ranges builds them
+  for (int64_t i = 0; i < cid_strs.count(); ++i) {
+    ObNewRange range;
+    ASSERT_EQ(OB_SUCCESS, iter.build_cid_vec_query_range(cid_strs.at(i), TEST_ROWKEY_CNT, range));
+    ASSERT_EQ(OB_SUCCESS, ObDasVecScanUtils::set_lookup_range(range, iter.cid_vec_scan_param_, OB_INVALID_ID));
+  }
+  const ObIArray<ObNewRange> &ranges = iter.cid_vec_scan_param_.key_ranges_;
+  ASSERT_EQ(cid_cnt, ranges.count());
+
+  for (int64_t i = 0; i < ranges.count(); ++i) {
+    ASSERT_FALSE(ranges.at(i).is_whole_range());
+    ASSERT_LT(ranges.at(i).start_key_.compare(ranges.at(i).end_key_), 0);
+    // the rows of one list are inside the range of its cid only, so ranges never overlap
+    ObRowkey first_row;
+    ObRowkey last_row;
+    build_row_rowkey(cid_strs.at(i), INT64_MIN + 1, first_row);
+    build_row_rowkey(cid_strs.at(i), INT64_MAX - 1, last_row);
+    for (int64_t j = 0; j < ranges.count(); ++j) {
+      const ObNewRange &range = ranges.at(j);
+      const bool in_range = range.start_key_.compare(first_row) < 0 && last_row.compare(range.end_key_) < 0;
+      ASSERT_EQ(i == j, in_range) << "row of list " << i << ", range " << j;
+      if (i != j) {
+        // the range of a larger cid begins after the range of a smaller one ends
+        const bool is_before = ranges.at(i).end_key_.compare(range.start_key_) < 0;
+        ASSERT_EQ(center_ids[i] < center_ids[j], is_before);
+      }
+    }
+  }
+
+  // no cid when the index is created with the table, the whole table is scanned
+  ObNewRange whole_range;
+  ASSERT_EQ(OB_SUCCESS, iter.build_cid_vec_query_range(ObString(), TEST_ROWKEY_CNT, whole_range));
+  ASSERT_TRUE(whole_range.is_whole_range());
+
+  ObDasVecScanUtils::release_scan_param(iter.cid_vec_scan_param_);
+  destroy_mem_context(iter);
+}
+
+TEST_F(TestDASIvfScanIter, pq_switch_probe_list)
+{
+  static const int64_t DIM = 4;
+  static const int64_t LIST_CNT = 3;
+  ObDASIvfPQScanIter iter;
+  iter.dim_ = DIM;
+  iter.m_ = 2;
+  iter.nbits_ = 8;
+  float search_vec[DIM] = {1.0, 2.0, 3.0, 4.0};
+  float cid_vecs[LIST_CNT][DIM] = {{0.0, 0.0, 0.0, 0.0}, {1.0, 1.0, 1.0, 1.0}, {0.5, 0.5, 0.5, 0.5}};
+  for (int64_t i = 0; i < LIST_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, iter.near_cid_vec_.push_back(std::make_pair(ObCenterId(TEST_TABLET_ID, i + 1), cid_vecs[i])));
+    ASSERT_EQ(OB_SUCCESS, iter.near_cid_vec_dis_.push_back(0.5f + i));
+  }
+  // the scan reads lists 1 and 2
+  char *buf = alloc_cid_buf();
+  ASSERT_TRUE(nullptr != buf);
+  ObSEArray<ObString, ObDASIvfBaseScanIter::IVF_PROBE_BATCH_CNT> cid_strs;
+  ASSERT_EQ(OB_SUCCESS, iter.append_probe_cid_str(iter.near_cid_vec_.at(1).first, buf, cid_strs));
+  ASSERT_EQ(OB_SUCCESS, iter.append_probe_cid_str(iter.near_cid_vec_.at(2).first, buf, cid_strs));
+  ObString list0_cid;
+  ASSERT_EQ(OB_SUCCESS, ObVectorClusterHelper::set_center_id_to_string(iter.near_cid_vec_.at(0).first, list0_cid, &allocator_));
+
+  {
+    // inner product, the residual is the search vector itself
+    iter.dis_type_ = ObExprVectorDistance::ObVecDisType::DOT;
+    ObDASIvfPQScanIter::PQProbeCtx ctx;
+    ASSERT_EQ(OB_SUCCESS, iter.switch_probe_list(cid_strs.at(1), cid_strs, 1, search_vec, ctx));
+    ASSERT_EQ(2, ctx.list_idx_);
+    ASSERT_FLOAT_EQ(2.5f, ctx.dis0_);
+    ASSERT_EQ(iter.m_, ctx.splited_residual_.count());
+    ASSERT_TRUE(search_vec == ctx.splited_residual_.at(0));
+    ASSERT_TRUE(search_vec + DIM / iter.m_ == ctx.splited_residual_.at(1));
+
+    // more rows of the same list keep the state
+    ctx.dis0_ = -1.0f;
+    ASSERT_EQ(OB_SUCCESS, iter.switch_probe_list(cid_strs.at(1), cid_strs, 1, search_vec, ctx));
+    ASSERT_EQ(2, ctx.list_idx_);
+    ASSERT_FLOAT_EQ(-1.0f, ctx.dis0_);
+
+    ASSERT_EQ(OB_SUCCESS, iter.switch_probe_list(cid_strs.at(0), cid_strs, 1, search_vec, ctx));
+    ASSERT_EQ(1, ctx.list_idx_);
+    ASSERT_FLOAT_EQ(1.5f, ctx.dis0_);
+    ASSERT_EQ(iter.m_, ctx.splited_residual_.count());
+
+    // a cid out of the scanned lists
+    ASSERT_EQ(OB_ERR_UNEXPECTED, iter.switch_probe_list(list0_cid, cid_strs, 1, search_vec, ctx));
+    // lists past the end of near_cid_vec_
+    ASSERT_EQ(OB_ERR_UNEXPECTED, iter.switch_probe_list(cid_strs.at(1), cid_strs, LIST_CNT - 1, search_vec, ctx));
+  }
+  {
+    // l2, the residual is r(x) = x - cid_vec of the list
+    iter.dis_type_ = ObExprVectorDistance::ObVecDisType::EUCLIDEAN;
+    float residual[DIM] = {0};
+    ObDASIvfPQScanIter::PQProbeCtx ctx;
+    ctx.residual_ = residual;
+    ASSERT_EQ(OB_SUCCESS, iter.switch_probe_list(cid_strs.at(0), cid_strs, 1, search_vec, ctx));
+    ASSERT_EQ(1, ctx.list_idx_);
+    ASSERT_FLOAT_EQ(0.0f, ctx.dis0_);
+    ASSERT_TRUE(residual == ctx.splited_residual_.at(0));
+    for (int64_t i = 0; i < DIM; ++i) {
+      ASSERT_FLOAT_EQ(search_vec[i] - cid_vecs[1][i], residual[i]);
+    }
+    ASSERT_EQ(OB_SUCCESS, iter.switch_probe_list(cid_strs.at(1), cid_strs, 1, search_vec, ctx));
+    ASSERT_EQ(2, ctx.list_idx_);
+    ASSERT_EQ(iter.m_, ctx.splited_residual_.count());
+    for (int64_t i = 0; i < DIM; ++i) {
+      ASSERT_FLOAT_EQ(search_vec[i] - cid_vecs[2][i], residual[i]);
+    }
+  }
+}
+
+TEST_F(TestDASIvfScanIter, packed_rows_score_parity)
+{
+  // the generic variant, a specialized one and one with a tail shorter than a simd register
+  const int64_t dims[] = {3, 128, 100};
+  const ObExprVectorDistance::ObVecDisType dis_types[] = {
+      ObExprVectorDistance::ObVecDisType::EUCLIDEAN, ObExprVectorDistance::ObVecDisType::EUCLIDEAN_SQUARED,
+      ObExprVectorDistance::ObVecDisType::DOT, ObExprVectorDistance::ObVecDisType::COSINE,
+      ObExprVectorDistance::ObVecDisType::MANHATTAN};
+  const int64_t dim_cnt = sizeof(dims) / sizeof(dims[0]);
+  const int64_t dis_type_cnt = sizeof(dis_types) / sizeof(dis_types[0]);
+  // rows of the scanned batch, even rows are skipped like null vectors
+  static const int64_t BATCH_ROW_CNT = 15;
+  ObDASIvfScanIter iter;
+  for (int64_t d = 0; d < dim_cnt; ++d) {
+    const int64_t dim = dims[d];
+    float *search_vec = static_cast<float *>(allocator_.alloc(sizeof(float) * dim));
+    float *batch_vecs = static_cast<float *>(allocator_.alloc(sizeof(float) * dim * BATCH_ROW_CNT));
+    ASSERT_TRUE(nullptr != search_vec && nullptr != batch_vecs);
+    for (int64_t j = 0; j < dim; ++j) {
+      search_vec[j] = static_cast<float>(sin(0.3 * j + 0.1));
+    }
+    for (int64_t j = 0; j < dim * BATCH_ROW_CNT; ++j) {
+      batch_vecs[j] = static_cast<float>(cos(0.7 * j) * (1 + j % 5));
+    }
+    ObIvfPackedRows<float> packed_rows;
+    ASSERT_EQ(OB_SUCCESS, packed_rows.init(allocator_, dim, BATCH_ROW_CNT));
+    ASSERT_EQ(0, reinterpret_cast<int64_t>(packed_rows.get_vecs()) % 64);
+    for (int64_t i = 1; i < BATCH_ROW_CNT; i += 2) {
+      packed_rows.add_row(i, batch_vecs + i * dim);
+    }
+    ASSERT_EQ(BATCH_ROW_CNT / 2, packed_rows.get_row_count());
+
+    iter.dim_ = dim;
+    for (int64_t t = 0; t < dis_type_cnt; ++t) {
+      iter.dis_type_ = dis_types[t];
+      ASSERT_EQ(OB_SUCCESS, iter.calc_packed_distances(search_vec, packed_rows));
+      for (int64_t k = 0; k < packed_rows.get_row_count(); ++k) {
+        const int64_t batch_idx = packed_rows.get_batch_idx(k);
+        double expected = 0;
+        ASSERT_EQ(2 * k + 1, batch_idx);
+        ASSERT_EQ(OB_SUCCESS, ObExprVectorDistance::DisFunc<float>::distance_funcs[dis_types[t]](
+            search_vec, batch_vecs + batch_idx * dim, dim, expected));
+        ASSERT_NEAR(expected, packed_rows.get_distance(k), 1e-5 * MAX(1.0, fabs(expected)))
+            << "dim " << dim << ", dis_type " << dis_types[t] << ", row " << k;
+      }
+    }
+    packed_rows.reuse();
+    ASSERT_EQ(0, packed_rows.get_row_count());
+  }
+}
+
+} // namespace sql
+} // namespace oceanbase
+
+int main(int argc, char** argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
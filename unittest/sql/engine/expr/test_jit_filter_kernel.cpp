@@ -0,0 +1,555 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define USING_LOG_PREFIX SQL
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include "lib/container/ob_se_array.h"
+#include "share/datum/ob_datum.h"
+#include "objit/ob_jit_filter_kernel.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace jit;
+namespace sql
+{
+
+static const int64_t BATCH_SIZE = 256;
+static const int64_t WORD_CNT = BATCH_SIZE / 64;
+
+// a leaf of fixed length values and a null bitmap
+struct TestColumn
+{
+  TestColumn() : is_double_(false)
+  {
+    MEMSET(ints_, 0, sizeof(ints_));
+    MEMSET(nulls_, 0, sizeof(nulls_));
+  }
+  void set_int(const int64_t i, const int64_t v) { ints_[i] = v; }
+  void set_double(const int64_t i, const double v) { is_double_ = true; doubles_[i] = v; }
+  void set_null(const int64_t i) { nulls_[i / 64] |= (1ULL << (i % 64)); }
+  bool is_null(const int64_t i) const { return 0 != (nulls_[i / 64] & (1ULL << (i % 64))); }
+  ObJitLeafVector to_vector() const
+  {
+    ObJitLeafVector vec;
+    vec.data_ = is_double_ ? reinterpret_cast<const char *>(doubles_)
+                           : reinterpret_cast<const char *>(ints_);
+    vec.nulls_ = nulls_;
+    return vec;
+  }
+
+  bool is_double_;
+  union {
+    int64_t ints_[BATCH_SIZE];
+    double doubles_[BATCH_SIZE];
+  };
+  uint64_t nulls_[WORD_CNT];
+};
+
+// value of a node in a row evaluated by TestFilterDag::eval()
+struct TestValue
+{
+  TestValue() : int_(0), double_(0), null_(false) {}
+  bool is_true() const { return !null_ && 0 != int_; }
+  int64_t int_;
+  double double_;
+  bool null_;
+};
+
+// the node dag of a kernel, and a plain interpreter with the semantics of the sql exprs
+struct TestFilterDag
+{
+  int64_t leaf(const int64_t leaf_idx, const ObJitValueType type)
+  {
+    ObJitFilterNode node;
+    node.op_ = ObJitFilterOp::LEAF;
+    node.type_ = type;
+    node.leaf_idx_ = leaf_idx;
+    nodes_.push_back(node);
+    return nodes_.count() - 1;
+  }
+  int64_t op(const ObJitFilterOp op, const ObJitValueType type, std::initializer_list<int64_t> args)
+  {
+    ObJitFilterNode node;
+    node.op_ = op;
+    node.type_ = type;
+    node.arg_start_ = args_.count();
+    node.arg_cnt_ = args.size();
+    for (int64_t arg : args) {
+      args_.push_back(arg);
+    }
+    nodes_.push_back(node);
+    return nodes_.count() - 1;
+  }
+  int64_t int_op(const ObJitFilterOp op, std::initializer_list<int64_t> args)
+  {
+    return this->op(op, ObJitValueType::INT64, args);
+  }
+  void add_root(const int64_t node_idx) { roots_.push_back(node_idx); }
+
+  // evaluates the row, %bail is set if the kernel should bail out on the row
+  bool eval(const TestColumn *cols, const int64_t row, bool &bail) const
+  {
+    ObSEArray<TestValue, 32> values;
+    bool pass = true;
+    bail = false;
+    for (int64_t i = 0; i < nodes_.count(); ++i) {
+      const ObJitFilterNode &node = nodes_.at(i);
+      const bool is_double = ObJitValueType::DOUBLE == node.type_;
+      TestValue v;
+      #define ARG(j) (values.at(args_.at(node.arg_start_ + (j))))
+      switch (node.op_) {
+        case ObJitFilterOp::LEAF: {
+          const TestColumn &col = cols[node.leaf_idx_];
+          v.null_ = col.is_null(row);
+          v.int_ = col.ints_[row];
+          v.double_ = col.doubles_[row];
+          break;
+        }
+        case ObJitFilterOp::ADD:
+        case ObJitFilterOp::SUB:
+        case ObJitFilterOp::MUL: {
+          v.null_ = ARG(0).null_ || ARG(1).null_;
+          bool overflow = false;
+          if (is_double) {
+            v.double_ = ObJitFilterOp::ADD == node.op_ ? ARG(0).double_ + ARG(1).double_
+                : (ObJitFilterOp::SUB == node.op_ ? ARG(0).double_ - ARG(1).double_
+                                                  : ARG(0).double_ * ARG(1).double_);
+            overflow = !std::isfinite(v.double_);
+          } else {
+            overflow = ObJitFilterOp::ADD == node.op_ ? __builtin_add_overflow(ARG(0).int_, ARG(1).int_, &v.int_)
+                : (ObJitFilterOp::SUB == node.op_ ? __builtin_sub_overflow(ARG(0).int_, ARG(1).int_, &v.int_)
+                                                  : __builtin_mul_overflow(ARG(0).int_, ARG(1).int_, &v.int_));
+          }
+          bail |= overflow && !v.null_;
+          break;
+        }
+        case ObJitFilterOp::EQ:
+        case ObJitFilterOp::NE:
+        case ObJitFilterOp::LT:
+        case ObJitFilterOp::LE:
+        case ObJitFilterOp::GT:
+        case ObJitFilterOp::GE: {
+          const ObJitFilterNode &arg_node = nodes_.at(args_.at(node.arg_start_));
+          int cmp = 0;
+          v.null_ = ARG(0).null_ || ARG(1).null_;
+          if (ObJitValueType::DOUBLE == arg_node.type_) {
+            bail |= (std::isnan(ARG(0).double_) || std::isnan(ARG(1).double_)) && !v.null_;
+            cmp = ARG(0).double_ < ARG(1).double_ ? -1 : (ARG(0).double_ > ARG(1).double_ ? 1 : 0);
+          } else {
+            cmp = ARG(0).int_ < ARG(1).int_ ? -1 : (ARG(0).int_ > ARG(1).int_ ? 1 : 0);
+          }
+          v.int_ = ObJitFilterOp::EQ == node.op_ ? 0 == cmp
+              : ObJitFilterOp::NE == node.op_ ? 0 != cmp
+              : ObJitFilterOp::LT == node.op_ ? cmp < 0
+              : ObJitFilterOp::LE == node.op_ ? cmp <= 0
+              : ObJitFilterOp::GT == node.op_ ? cmp > 0
+              : cmp >= 0;
+          break;
+        }
+        case ObJitFilterOp::AND:
+        case ObJitFilterOp::OR: {
+          const bool is_and = ObJitFilterOp::AND == node.op_;
+          bool decided = false;
+          bool has_null = false;
+          for (int64_t j = 0; j < node.arg_cnt_; ++j) {
+            decided |= !ARG(j).null_ && (is_and ? 0 == ARG(j).int_ : 0 != ARG(j).int_);
+            has_null |= ARG(j).null_;
+          }
+          v.int_ = is_and ? !decided : decided;
+          v.null_ = !decided && has_null;
+          break;
+        }
+        case ObJitFilterOp::NOT: {
+          v.int_ = 0 == ARG(0).int_;
+          v.null_ = ARG(0).null_;
+          break;
+        }
+        case ObJitFilterOp::CASE: {
+          const int64_t pair_cnt = node.arg_cnt_ / 2;
+          bool matched = false;
+          v.null_ = true;
+          for (int64_t j = 0; !matched && j < pair_cnt; ++j) {
+            if (ARG(2 * j).is_true()) {
+              matched = true;
+              v = ARG(2 * j + 1);
+            }
+          }
+          if (!matched && 1 == node.arg_cnt_ % 2) {
+            v = ARG(node.arg_cnt_ - 1);
+          }
+          break;
+        }
+        case ObJitFilterOp::INT_TO_DOUBLE: {
+          v.double_ = static_cast<double>(ARG(0).int_);
+          v.null_ = ARG(0).null_;
+          break;
+        }
+        default:
+          break;
+      }
+      #undef ARG
+      values.push_back(v);
+    }
+    for (int64_t i = 0; i < roots_.count(); ++i) {
+      pass = pass && values.at(roots_.at(i)).is_true();
+    }
+    return pass;
+  }
+
+  ObSEArray<ObJitFilterNode, 32> nodes_;
+  ObSEArray<int64_t, 64> args_;
+  ObSEArray<int64_t, 8> roots_;
+};
+
+class TestJitFilterKernel : public ::testing::Test
+{
+public:
+  TestJitFilterKernel() : allocator_("JitFilterTest") {}
+  virtual ~TestJitFilterKernel() {}
+  static ObJitDatumLayout datum_layout()
+  {
+    ObDatum datum;
+    datum.set_null();
+    ObJitDatumLayout layout;
+    layout.size_ = sizeof(ObDatum);
+    layout.ptr_offset_ = reinterpret_cast<const char *>(&datum.ptr())
+        - reinterpret_cast<const char *>(&datum);
+    layout.desc_offset_ = reinterpret_cast<const char *>(&datum.desc())
+        - reinterpret_cast<const char *>(&datum);
+    layout.null_mask_ = datum.pack_;
+    return layout;
+  }
+  int add_kernel(ObJitFilterModule &module, const TestFilterDag &dag, const int64_t leaf_cnt,
+                 ObJitFilterKernel &kernel)
+  {
+    return module.add_kernel(dag.nodes_, dag.args_, dag.roots_, leaf_cnt, datum_layout(), kernel);
+  }
+  // runs the kernel on the rows not in %skip and checks it against the interpreter
+  void check(const ObJitFilterKernel &kernel, const TestFilterDag &dag, const TestColumn *cols,
+             const int64_t leaf_cnt, const uint64_t *skip)
+  {
+    ObJitLeafVector vecs[8];
+    uint64_t res_skip[WORD_CNT];
+    uint64_t expect_skip[WORD_CNT];
+    int64_t expect_cnt = 0;
+    bool expect_bail = false;
+    for (int64_t i = 0; i < leaf_cnt; ++i) {
+      vecs[i] = cols[i].to_vector();
+    }
+    MEMCPY(res_skip, skip, sizeof(res_skip));
+    MEMCPY(expect_skip, skip, sizeof(expect_skip));
+    for (int64_t row = 0; row < BATCH_SIZE; ++row) {
+      if (0 != (skip[row / 64] & (1ULL << (row % 64)))) {
+        // skipped rows are not evaluated
+      } else {
+        bool bail = false;
+        if (dag.eval(cols, row, bail)) {
+          ++expect_cnt;
+        } else {
+          expect_skip[row / 64] |= (1ULL << (row % 64));
+        }
+        expect_bail |= bail;
+      }
+    }
+    const int64_t cnt = kernel.run(vecs, res_skip, BATCH_SIZE);
+    if (expect_bail) {
+      ASSERT_EQ(ObJitFilterKernel::BAIL_OUT, cnt);
+    } else {
+      ASSERT_EQ(expect_cnt, cnt);
+      ASSERT_EQ(0, MEMCMP(expect_skip, res_skip, sizeof(res_skip)));
+    }
+  }
+
+protected:
+  ObArenaAllocator allocator_;
+};
+
+TEST_F(TestJitFilterKernel, three_valued_logic)
+{
+  // rows of a and b go through {0, 1, null} x {0, 1, null}
+  TestColumn cols[2];
+  for (int64_t row = 0; row < BATCH_SIZE; ++row) {
+    const int64_t a = row % 3;
+    const int64_t b = (row / 3) % 3;
+    if (2 == a) {
+      cols[0].set_null(row);
+    } else {
+      cols[0].set_int(row, a);
+    }
+    if (2 == b) {
+      cols[1].set_null(row);
+    } else {
+      cols[1].set_int(row, b);
+    }
+  }
+  // one kernel for each filter, all in the same module
+  const ObJitFilterOp ops[] = { ObJitFilterOp::AND, ObJitFilterOp::OR };
+  TestFilterDag dags[4];
+  ObJitFilterKernel kernels[4];
+  ObJitFilterModule module(allocator_);
+  for (int64_t i = 0; i < 4; ++i) {
+    TestFilterDag &dag = dags[i];
+    const int64_t a = dag.leaf(0, ObJitValueType::INT64);
+    const int64_t b = dag.leaf(1, ObJitValueType::INT64);
+    const int64_t logic = dag.int_op(ops[i % 2], {a, b});
+    // NOT(a AND b) passes null AND false, NOT(a OR b) rejects null OR true
+    dag.add_root(i < 2 ? logic : dag.int_op(ObJitFilterOp::NOT, {logic}));
+    ASSERT_EQ(OB_SUCCESS, add_kernel(module, dag, 2, kernels[i]));
+    ASSERT_FALSE(kernels[i].is_compiled());
+  }
+  ASSERT_EQ(4, module.get_kernel_cnt());
+  ASSERT_EQ(OB_SUCCESS, module.compile());
+  uint64_t skip[WORD_CNT] = {0};
+  for (int64_t i = 0; i < 4; ++i) {
+    ASSERT_TRUE(kernels[i].is_compiled());
+    check(kernels[i], dags[i], cols, 2, skip);
+  }
+
+  // spot checks of the truth tables, row = a + 3 * b
+  uint64_t res_skip[WORD_CNT] = {0};
+  ObJitLeafVector vecs[2] = { cols[0].to_vector(), cols[1].to_vector() };
+  kernels[0].run(vecs, res_skip, 9);
+  ASSERT_EQ(1ULL << 4, ~res_skip[0] & 0x1ff);        // only 1 AND 1
+  MEMSET(res_skip, 0, sizeof(res_skip));
+  kernels[2].run(vecs, res_skip, 9);
+  // NOT(a AND b) is true when a or b is 0, even if the other is null
+  ASSERT_EQ((1ULL << 0) | (1ULL << 1) | (1ULL << 2) | (1ULL << 3) | (1ULL << 6),
+            ~res_skip[0] & 0x1ff);
+  MEMSET(res_skip, 0, sizeof(res_skip));
+  kernels[3].run(vecs, res_skip, 9);
+  // NOT(a OR b) is true only when both are 0
+  ASSERT_EQ(1ULL << 0, ~res_skip[0] & 0x1ff);
+}
+
+TEST_F(TestJitFilterKernel, bail_out)
+{
+  TestColumn cols[2];
+  TestColumn dcols[2];
+  for (int64_t row = 0; row < BATCH_SIZE; ++row) {
+    cols[0].set_int(row, row);
+    cols[1].set_int(row, 1);
+    dcols[0].set_double(row, row * 0.5);
+    dcols[1].set_double(row, 2.0);
+  }
+  TestFilterDag int_dag;
+  {
+    const int64_t a = int_dag.leaf(0, ObJitValueType::INT64);
+    const int64_t b = int_dag.leaf(1, ObJitValueType::INT64);
+    int_dag.add_root(int_dag.int_op(ObJitFilterOp::GT, {int_dag.int_op(ObJitFilterOp::ADD, {a, b}), b}));
+  }
+  TestFilterDag double_dag;
+  {
+    const int64_t a = double_dag.leaf(0, ObJitValueType::DOUBLE);
+    const int64_t b = double_dag.leaf(1, ObJitValueType::DOUBLE);
+    const int64_t mul = double_dag.op(ObJitFilterOp::MUL, ObJitValueType::DOUBLE, {a, b});
+    double_dag.add_root(double_dag.int_op(ObJitFilterOp::LT, {mul, b}));
+  }
+  ObJitFilterModule module(allocator_);
+  ObJitFilterKernel int_kernel;
+  ObJitFilterKernel double_kernel;
+  ASSERT_EQ(OB_SUCCESS, add_kernel(module, int_dag, 2, int_kernel));
+  ASSERT_EQ(OB_SUCCESS, add_kernel(module, double_dag, 2, double_kernel));
+  ASSERT_EQ(OB_SUCCESS, module.compile());
+  uint64_t skip[WORD_CNT] = {0};
+  ObJitLeafVector vecs[2];
+  uint64_t res_skip[WORD_CNT] = {0};
+  check(int_kernel, int_dag, cols, 2, skip);
+  check(double_kernel, double_dag, dcols, 2, skip);
+
+  // integer overflow
+  cols[0].set_int(100, INT64_MAX);
+  check(int_kernel, int_dag, cols, 2, skip);
+  vecs[0] = cols[0].to_vector();
+  vecs[1] = cols[1].to_vector();
+  ASSERT_EQ(ObJitFilterKernel::BAIL_OUT, int_kernel.run(vecs, res_skip, BATCH_SIZE));
+  // not raised on a null row, as the exprs do not raise it either
+  cols[1].set_null(100);
+  vecs[1] = cols[1].to_vector();
+  MEMSET(res_skip, 0, sizeof(res_skip));
+  ASSERT_NE(ObJitFilterKernel::BAIL_OUT, int_kernel.run(vecs, res_skip, BATCH_SIZE));
+  check(int_kernel, int_dag, cols, 2, skip);
+  // nor on a skipped row
+  cols[1].nulls_[1] = 0;
+  skip[100 / 64] |= (1ULL << (100 % 64));
+  check(int_kernel, int_dag, cols, 2, skip);
+  vecs[1] = cols[1].to_vector();
+  MEMCPY(res_skip, skip, sizeof(res_skip));
+  ASSERT_NE(ObJitFilterKernel::BAIL_OUT, int_kernel.run(vecs, res_skip, BATCH_SIZE));
+  MEMSET(skip, 0, sizeof(skip));
+
+  // inf
+  dcols[0].set_double(7, 1e308);
+  check(double_kernel, double_dag, dcols, 2, skip);
+  vecs[0] = dcols[0].to_vector();
+  vecs[1] = dcols[1].to_vector();
+  MEMSET(res_skip, 0, sizeof(res_skip));
+  ASSERT_EQ(ObJitFilterKernel::BAIL_OUT, double_kernel.run(vecs, res_skip, BATCH_SIZE));
+  // nan
+  dcols[0].set_double(7, NAN);
+  check(double_kernel, double_dag, dcols, 2, skip);
+  vecs[0] = dcols[0].to_vector();
+  MEMSET(res_skip, 0, sizeof(res_skip));
+  ASSERT_EQ(ObJitFilterKernel::BAIL_OUT, double_kernel.run(vecs, res_skip, BATCH_SIZE));
+  dcols[0].set_null(7);
+  check(double_kernel, double_dag, dcols, 2, skip);
+}
+
+TEST_F(TestJitFilterKernel, compare_with_interpreter)
+{
+  // (a + b > c) AND (CASE WHEN a < 0 THEN d ELSE double(a) * e END <= e) OR NOT (b = c),
+  // and c - a * b <> 0 as the second filter
+  TestFilterDag dag;
+  const int64_t a = dag.leaf(0, ObJitValueType::INT64);
+  const int64_t b = dag.leaf(1, ObJitValueType::INT64);
+  const int64_t c = dag.leaf(2, ObJitValueType::INT64);
+  const int64_t d = dag.leaf(3, ObJitValueType::DOUBLE);
+  const int64_t e = dag.leaf(4, ObJitValueType::DOUBLE);
+  const int64_t gt = dag.int_op(ObJitFilterOp::GT, {dag.int_op(ObJitFilterOp::ADD, {a, b}), c});
+  const int64_t when = dag.int_op(ObJitFilterOp::LT, {a, dag.int_op(ObJitFilterOp::SUB, {b, b})});
+  const int64_t a_double = dag.op(ObJitFilterOp::INT_TO_DOUBLE, ObJitValueType::DOUBLE, {a});
+  const int64_t els = dag.op(ObJitFilterOp::MUL, ObJitValueType::DOUBLE, {a_double, e});
+  const int64_t case_node = dag.op(ObJitFilterOp::CASE, ObJitValueType::DOUBLE, {when, d, els});
+  const int64_t le = dag.int_op(ObJitFilterOp::LE, {case_node, e});
+  const int64_t and_node = dag.int_op(ObJitFilterOp::AND, {gt, le});
+  const int64_t not_node = dag.int_op(ObJitFilterOp::NOT, {dag.int_op(ObJitFilterOp::EQ, {b, c})});
+  dag.add_root(dag.int_op(ObJitFilterOp::OR, {and_node, not_node}));
+  const int64_t mul = dag.int_op(ObJitFilterOp::MUL, {a, b});
+  dag.add_root(dag.int_op(ObJitFilterOp::NE, {dag.int_op(ObJitFilterOp::SUB, {c, mul}), b}));
+
+  ObJitFilterModule module(allocator_);
+  ObJitFilterKernel kernel;
+  ASSERT_EQ(OB_SUCCESS, add_kernel(module, dag, 5, kernel));
+  ASSERT_EQ(OB_SUCCESS, module.compile());
+
+  std::mt19937_64 rng(20251017);
+  std::uniform_int_distribution<int64_t> int_dist(-20, 20);
+  std::uniform_real_distribution<double> double_dist(-20.0, 20.0);
+  for (int64_t round = 0; round < 50; ++round) {
+    TestColumn cols[5];
+    uint64_t skip[WORD_CNT] = {0};
+    for (int64_t row = 0; row < BATCH_SIZE; ++row) {
+      for (int64_t i = 0; i < 5; ++i) {
+        if (0 == rng() % 7) {
+          cols[i].set_null(row);
+        } else if (i < 3) {
+          cols[i].set_int(row, int_dist(rng));
+        } else {
+          cols[i].set_double(row, double_dist(rng));
+        }
+      }
+      if (0 == rng() % 5) {
+        skip[row / 64] |= (1ULL << (row % 64));
+      }
+    }
+    check(kernel, dag, cols, 5, skip);
+  }
+}
+
+TEST_F(TestJitFilterKernel, uniform_leaf)
+{
+  // a column of datums compared with a const datum
+  ObDatum datums[BATCH_SIZE];
+  int64_t values[BATCH_SIZE];
+  for (int64_t row = 0; row < BATCH_SIZE; ++row) {
+    values[row] = row;
+    if (0 == row % 10) {
+      datums[row].set_null();
+    } else {
+      datums[row].ptr_ = reinterpret_cast<const char *>(&values[row]);
+      datums[row].pack_ = sizeof(int64_t);
+    }
+  }
+  int64_t const_value = 100;
+  ObDatum const_datum;
+  const_datum.ptr_ = reinterpret_cast<const char *>(&const_value);
+  const_datum.pack_ = sizeof(int64_t);
+  TestFilterDag dag;
+  dag.add_root(dag.int_op(ObJitFilterOp::GE, {dag.leaf(0, ObJitValueType::INT64),
+                                              dag.leaf(1, ObJitValueType::INT64)}));
+  ObJitFilterModule module(allocator_);
+  ObJitFilterKernel kernel;
+  ASSERT_EQ(OB_SUCCESS, add_kernel(module, dag, 2, kernel));
+  ASSERT_EQ(OB_SUCCESS, module.compile());
+  ObJitLeafVector vecs[2];
+  vecs[0].datums_ = reinterpret_cast<const char *>(datums);
+  vecs[1].datums_ = reinterpret_cast<const char *>(&const_datum);
+  vecs[1].idx_mask_ = 0;
+  uint64_t skip[WORD_CNT] = {0};
+  int64_t expect_cnt = 0;
+  for (int64_t row = 100; row < BATCH_SIZE; ++row) {
+    expect_cnt += (0 != row % 10);
+  }
+  ASSERT_EQ(expect_cnt, kernel.run(vecs, skip, BATCH_SIZE));
+  for (int64_t row = 0; row < BATCH_SIZE; ++row) {
+    ASSERT_EQ(row < 100 || 0 == row % 10, 0 != (skip[row / 64] & (1ULL << (row % 64))));
+  }
+}
+
+TEST_F(TestJitFilterKernel, module)
+{
+  ObJitFilterModule module(allocator_);
+  ObJitFilterKernel kernel;
+  ObJitFilterKernel bad_kernel;
+  ObJitFilterKernel late_kernel;
+  TestFilterDag dag;
+  dag.add_root(dag.int_op(ObJitFilterOp::NE, {dag.leaf(0, ObJitValueType::INT64),
+                                              dag.leaf(1, ObJitValueType::INT64)}));
+  // an empty module compiles nothing
+  {
+    ObJitFilterModule empty_module(allocator_);
+    ASSERT_EQ(OB_SUCCESS, empty_module.compile());
+    ASSERT_EQ(0, empty_module.get_kernel_cnt());
+  }
+  // invalid dags are rejected and leave the module usable
+  TestFilterDag bad_dag;
+  const int64_t x = bad_dag.leaf(0, ObJitValueType::INT64);
+  bad_dag.add_root(bad_dag.op(ObJitFilterOp::ADD, ObJitValueType::DOUBLE, {x, x}));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, add_kernel(module, bad_dag, 1, bad_kernel));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, add_kernel(module, dag, 1, bad_kernel));
+  ASSERT_EQ(OB_SUCCESS, add_kernel(module, dag, 2, kernel));
+  // a kernel is added once
+  ASSERT_EQ(OB_ERR_UNEXPECTED, add_kernel(module, dag, 2, kernel));
+  ASSERT_EQ(1, module.get_kernel_cnt());
+  ASSERT_EQ(OB_SUCCESS, module.compile());
+  ASSERT_TRUE(module.is_compiled());
+  ASSERT_TRUE(kernel.is_compiled());
+  ASSERT_FALSE(bad_kernel.is_compiled());
+  // nothing is added after compile
+  ASSERT_EQ(OB_ERR_UNEXPECTED, add_kernel(module, dag, 2, late_kernel));
+  ASSERT_EQ(OB_INIT_TWICE, module.compile());
+
+  TestColumn cols[2];
+  for (int64_t row = 0; row < BATCH_SIZE; ++row) {
+    cols[0].set_int(row, row % 4);
+    cols[1].set_int(row, row % 3);
+  }
+  uint64_t skip[WORD_CNT] = {0};
+  check(kernel, dag, cols, 2, skip);
+}
+
+} // namespace sql
+} // namespace oceanbase
+
+int main(int argc, char** argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  oceanbase::jit::ObLLVMHelper::initialize();
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
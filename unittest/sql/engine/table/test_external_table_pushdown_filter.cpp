@@ -0,0 +1,653 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define USING_LOG_PREFIX SQL
+#include <gtest/gtest.h>
+#include <parquet/api/reader.h>
+#include <parquet/arrow/writer.h>
+#define private public
+#define protected public
+#include "sql/engine/table/ob_external_table_pushdown_filter.h"
+#include "sql/engine/table/ob_parquet_table_row_iter.h"
+#include "sql/engine/table/ob_orc_table_row_iter.h"
+#include "sql/engine/ob_exec_context.h"
+#include "storage/ob_storage_util.h"
+#undef protected
+#undef private
+
+namespace oceanbase
+{
+using namespace common;
+namespace sql
+{
+
+static const char *TEST_PARQUET_FILE = "test_external_table_pushdown_filter.parquet";
+static const char *TEST_ORC_FILE = "test_external_table_pushdown_filter.orc";
+// parquet file columns
+static const int64_t PQ_I32_COL = 0;
+static const int64_t PQ_U64_COL = 1;
+static const int64_t PQ_I64_COL = 2;
+static const int64_t PQ_BIN_COL = 3;
+static const int64_t PQ_NULL_COL = 4;
+static const int64_t PQ_NO_STAT_COL = 5;
+static const int64_t PQ_COL_CNT = 6;
+static const int64_t PQ_ROW_GROUP_ROWS = 100;
+static const int64_t PQ_ROW_CNT = 2 * PQ_ROW_GROUP_ROWS;
+static const uint64_t PQ_U64_BASE = (1ULL << 63) + 7;
+// orc file columns, column 0 is the root struct
+static const int64_t ORC_COL_CNT = 3;
+static const int64_t ORC_ROW_CNT = 100;
+
+class MockStatProvider : public ObExternalStatProvider
+{
+public:
+  virtual int get_column_stat(const int64_t file_col_idx, ObExternalColumnStat &stat) override
+  {
+    int ret = OB_SUCCESS;
+    if (file_col_idx < 0 || file_col_idx >= static_cast<int64_t>(stats_.size())) {
+      ret = OB_INVALID_ARGUMENT;
+    } else {
+      stat = stats_[file_col_idx];
+    }
+    return ret;
+  }
+  std::vector<ObExternalColumnStat> stats_;
+};
+
+class TestExternalTablePushdownFilter : public ::testing::Test
+{
+public:
+  TestExternalTablePushdownFilter()
+    : allocator_("ExtPdFilterTest"),
+      exec_ctx_(allocator_),
+      eval_ctx_(exec_ctx_),
+      expr_spec_(allocator_),
+      op_(eval_ctx_, expr_spec_)
+  {}
+  virtual ~TestExternalTablePushdownFilter() {}
+  virtual void TearDown()
+  {
+    pq_reader_.reset();
+    orc_reader_.reset();
+    ::remove(TEST_PARQUET_FILE);
+    ::remove(TEST_ORC_FILE);
+    col_exprs_.reset();
+    allocator_.reset();
+  }
+  ObExpr *add_col_expr(const ObObjType type, const ObCollationType cs_type)
+  {
+    ObExpr *expr = OB_NEWx(ObExpr, &allocator_);
+    expr->type_ = T_PSEUDO_EXTERNAL_FILE_COL;
+    expr->datum_meta_.type_ = type;
+    expr->datum_meta_.cs_type_ = cs_type;
+    expr->obj_meta_.set_type(type);
+    expr->obj_meta_.set_collation_type(cs_type);
+    EXPECT_EQ(OB_SUCCESS, col_exprs_.push_back(expr));
+    return expr;
+  }
+  ObWhiteFilterExecutor *make_filter(const ObWhiteFilterOperatorType op_type,
+                                     ObExpr *col_expr,
+                                     const std::vector<ObObj> &params)
+  {
+    ObPushdownWhiteFilterNode *node = OB_NEWx(ObPushdownWhiteFilterNode, &allocator_, allocator_);
+    node->op_type_ = op_type;
+    EXPECT_EQ(OB_SUCCESS, node->column_exprs_.init(1));
+    EXPECT_EQ(OB_SUCCESS, node->column_exprs_.push_back(col_expr));
+    ObWhiteFilterExecutor *filter = OB_NEWx(ObWhiteFilterExecutor, &allocator_, allocator_, *node, op_);
+    EXPECT_EQ(OB_SUCCESS, filter->datum_params_.init(params.size()));
+    for (size_t i = 0; i < params.size(); ++i) {
+      ObDatum datum;
+      datum.ptr_ = static_cast<char *>(allocator_.alloc(sizeof(int64_t)));
+      EXPECT_EQ(OB_SUCCESS, datum.from_obj(params[i]));
+      EXPECT_EQ(OB_SUCCESS, filter->datum_params_.push_back(datum));
+      if (datum.is_null()) {
+        filter->null_param_contained_ = true;
+      }
+    }
+    filter->cmp_func_ = storage::get_datum_cmp_func(col_expr->obj_meta_, col_expr->obj_meta_);
+    return filter;
+  }
+  ObWhiteFilterExecutor *make_int_filter(const ObWhiteFilterOperatorType op_type,
+                                         ObExpr *col_expr,
+                                         const std::vector<int64_t> &values)
+  {
+    std::vector<ObObj> params(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+      params[i].set_int(values[i]);
+    }
+    return make_filter(op_type, col_expr, params);
+  }
+  ObWhiteFilterExecutor *make_bin_filter(const ObWhiteFilterOperatorType op_type,
+                                         ObExpr *col_expr,
+                                         const std::vector<const char *> &values)
+  {
+    std::vector<ObObj> params(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+      params[i].set_varchar(values[i]);
+      params[i].set_collation_type(CS_TYPE_BINARY);
+    }
+    return make_filter(op_type, col_expr, params);
+  }
+  // the filter is checked as if the column exprs were read from the file columns of the same index
+  void init_pd_filter(ObExternalTablePushdownFilter &pd_filter, ObPushdownFilterExecutor *filter)
+  {
+    pd_filter.scan_param_ = &scan_param_;
+    pd_filter.column_exprs_ = &col_exprs_;
+    pd_filter.file_col_idxs_.reuse();
+    for (int64_t i = 0; i < col_exprs_.count(); ++i) {
+      ASSERT_EQ(OB_SUCCESS, pd_filter.file_col_idxs_.push_back(i));
+    }
+    pd_filter.filter_ = filter;
+    pd_filter.need_prepare_ = false;
+    pd_filter.is_valid_ = true;
+  }
+  bool can_skip(ObPushdownFilterExecutor *filter, const int64_t row_count, ObExternalStatProvider &provider)
+  {
+    ObExternalTablePushdownFilter pd_filter;
+    bool skip = false;
+    init_pd_filter(pd_filter, filter);
+    EXPECT_EQ(OB_SUCCESS, pd_filter.can_skip(row_count, provider, skip));
+    return skip;
+  }
+  static ObExternalColumnStat int_stat(const int64_t min, const int64_t max, const int64_t null_count)
+  {
+    ObExternalColumnStat stat;
+    stat.min_.set_int(min);
+    stat.max_.set_int(max);
+    stat.null_count_ = null_count;
+    stat.has_min_max_ = true;
+    return stat;
+  }
+  static ObExternalColumnStat bin_stat(const char *min, const char *max, const int64_t null_count)
+  {
+    ObExternalColumnStat stat;
+    stat.min_.set_varchar(min);
+    stat.min_.set_collation_type(CS_TYPE_BINARY);
+    stat.max_.set_varchar(max);
+    stat.max_.set_collation_type(CS_TYPE_BINARY);
+    stat.null_count_ = null_count;
+    stat.has_min_max_ = true;
+    return stat;
+  }
+  // two row groups, the second column is uint64 beyond INT64_MAX and the statistics of the last
+  // column are not written
+  void write_parquet_file()
+  {
+    arrow::MemoryPool *pool = arrow::default_memory_pool();
+    arrow::Int32Builder i32_builder(pool);
+    arrow::UInt64Builder u64_builder(pool);
+    arrow::Int64Builder i64_builder(pool);
+    arrow::BinaryBuilder bin_builder(pool);
+    arrow::Int32Builder null_builder(pool);
+    arrow::Int32Builder no_stat_builder(pool);
+    for (int64_t i = 0; i < PQ_ROW_CNT; ++i) {
+      char key[16];
+      snprintf(key, sizeof(key), "key%03ld", i);
+      ASSERT_TRUE(i32_builder.Append(static_cast<int32_t>(i - PQ_ROW_GROUP_ROWS)).ok());
+      ASSERT_TRUE(u64_builder.Append(PQ_U64_BASE + i).ok());
+      ASSERT_TRUE(i64_builder.Append(i * 1000).ok());
+      ASSERT_TRUE(bin_builder.Append(key, static_cast<int32_t>(strlen(key))).ok());
+      ASSERT_TRUE(null_builder.AppendNull().ok());
+      ASSERT_TRUE(no_stat_builder.Append(static_cast<int32_t>(i)).ok());
+    }
+    std::vector<std::shared_ptr<arrow::Array>> arrays(PQ_COL_CNT);
+    ASSERT_TRUE(i32_builder.Finish(&arrays[PQ_I32_COL]).ok());
+    ASSERT_TRUE(u64_builder.Finish(&arrays[PQ_U64_COL]).ok());
+    ASSERT_TRUE(i64_builder.Finish(&arrays[PQ_I64_COL]).ok());
+    ASSERT_TRUE(bin_builder.Finish(&arrays[PQ_BIN_COL]).ok());
+    ASSERT_TRUE(null_builder.Finish(&arrays[PQ_NULL_COL]).ok());
+    ASSERT_TRUE(no_stat_builder.Finish(&arrays[PQ_NO_STAT_COL]).ok());
+    std::shared_ptr<arrow::Schema> schema = arrow::schema({arrow::field("i32", arrow::int32()),
+                                                           arrow::field("u64", arrow::uint64()),
+                                                           arrow::field("i64", arrow::int64()),
+                                                           arrow::field("bin", arrow::binary()),
+                                                           arrow::field("nulls", arrow::int32()),
+                                                           arrow::field("no_stat", arrow::int32())});
+    std::shared_ptr<arrow::Table> table = arrow::Table::Make(schema, arrays);
+    std::shared_ptr<arrow::io::FileOutputStream> outfile;
+    PARQUET_ASSIGN_OR_THROW(outfile, arrow::io::FileOutputStream::Open(TEST_PARQUET_FILE));
+    std::shared_ptr<parquet::WriterProperties> props =
+        parquet::WriterProperties::Builder().disable_statistics("no_stat")->build();
+    PARQUET_THROW_NOT_OK(parquet::arrow::WriteTable(*table, pool, outfile, PQ_ROW_GROUP_ROWS, props));
+    PARQUET_THROW_NOT_OK(outfile->Close());
+    pq_reader_ = parquet::ParquetFileReader::OpenFile(TEST_PARQUET_FILE);
+    ASSERT_EQ(2, pq_reader_->metadata()->num_row_groups());
+  }
+  // a single stripe of struct<i:bigint,s:string,n:int>, n is null in all rows
+  void write_orc_file()
+  {
+    std::unique_ptr<orc::OutputStream> out = orc::writeLocalFile(TEST_ORC_FILE);
+    std::unique_ptr<orc::Type> type(orc::Type::buildTypeFromString("struct<i:bigint,s:string,n:int>"));
+    orc::WriterOptions options;
+    std::unique_ptr<orc::Writer> writer = orc::createWriter(*type, out.get(), options);
+    std::unique_ptr<orc::ColumnVectorBatch> batch = writer->createRowBatch(ORC_ROW_CNT);
+    orc::StructVectorBatch *root = dynamic_cast<orc::StructVectorBatch *>(batch.get());
+    orc::LongVectorBatch *i_col = dynamic_cast<orc::LongVectorBatch *>(root->fields[0]);
+    orc::StringVectorBatch *s_col = dynamic_cast<orc::StringVectorBatch *>(root->fields[1]);
+    orc::LongVectorBatch *n_col = dynamic_cast<orc::LongVectorBatch *>(root->fields[2]);
+    char keys[ORC_ROW_CNT][16];
+    for (int64_t i = 0; i < ORC_ROW_CNT; ++i) {
+      snprintf(keys[i], sizeof(keys[i]), "key%03ld", i);
+      i_col->data[i] = i - ORC_ROW_CNT / 2;
+      s_col->data[i] = keys[i];
+      s_col->length[i] = static_cast<int64_t>(strlen(keys[i]));
+      n_col->notNull[i] = 0;
+    }
+    n_col->hasNulls = true;
+    root->numElements = i_col->numElements = s_col->numElements = n_col->numElements = ORC_ROW_CNT;
+    writer->add(*batch);
+    writer->close();
+    orc::ReaderOptions reader_options;
+    orc_reader_ = orc::createReader(orc::readLocalFile(TEST_ORC_FILE), reader_options);
+    ASSERT_EQ(1U, orc_reader_->getNumberOfStripes());
+    ASSERT_EQ(1U, orc_reader_->getNumberOfStripeStatistics());
+  }
+
+protected:
+  ObArenaAllocator allocator_;
+  ObExecContext exec_ctx_;
+  ObEvalCtx eval_ctx_;
+  ObPushdownExprSpec expr_spec_;
+  ObPushdownOperator op_;
+  storage::ObTableScanParam scan_param_;
+  ObSEArray<ObExpr *, 8> col_exprs_;
+  std::unique_ptr<parquet::ParquetFileReader> pq_reader_;
+  std::unique_ptr<orc::Reader> orc_reader_;
+};
+
+TEST_F(TestExternalTablePushdownFilter, int_min_max)
+{
+  ObExpr *col = add_col_expr(ObIntType, CS_TYPE_BINARY);
+  MockStatProvider provider;
+  provider.stats_.push_back(int_stat(10, 20, 0));
+  const int64_t row_count = 100;
+  ASSERT_TRUE(can_skip(make_int_filter(WHITE_OP_EQ, col, {5}), row_count, provider));
+  ASSERT_TRUE(can_skip(make_int_filter(WHITE_OP_EQ, col, {21}), row_count, provider));
+  ASSERT_FALSE(can_skip(make_int_filter(WHITE_OP_EQ, col, {10}), row_count, provider));
+  ASSERT_FALSE(can_skip(make_int_filter(WHITE_OP_EQ, col, {15}), row_count, provider));
+  ASSERT_FALSE(can_skip(make_int_filter(WHITE_OP_NE, col, {15}), row_count, provider));
+  ASSERT_TRUE(can_skip(make_int_filter(WHITE_OP_GT, col, {20}), row_count, provider));
+  ASSERT_FALSE(can_skip(make_int_filter(WHITE_OP_GT, col, {19}), row_count, provider));
+  ASSERT_TRUE(can_skip(make_int_filter(WHITE_OP_GE, col, {21}), row_count, provider));
+  ASSERT_FALSE(can_skip(make_int_filter(WHITE_OP_GE, col, {20}), row_count, provider));
+  ASSERT_TRUE(can_skip(make_int_filter(WHITE_OP_LT, col, {10}), row_count, provider));
+  ASSERT_FALSE(can_skip(make_int_filter(WHITE_OP_LT, col, {11}), row_count, provider));
+  ASSERT_TRUE(can_skip(make_int_filter(WHITE_OP_LE, col, {9}), row_count, provider));
+  ASSERT_FALSE(can_skip(make_int_filter(WHITE_OP_LE, col, {10}), row_count, provider));
+  ASSERT_TRUE(can_skip(make_int_filter(WHITE_OP_BT, col, {21, 30}), row_count, provider));
+  ASSERT_TRUE(can_skip(make_int_filter(WHITE_OP_BT, col, {0, 9}), row_count, provider));
+  ASSERT_FALSE(can_skip(make_int_filter(WHITE_OP_BT, col, {0, 10}), row_count, provider));
+  ASSERT_TRUE(can_skip(make_int_filter(WHITE_OP_IN, col, {1, 2, 30}), row_count, provider));
+  ASSERT_FALSE(can_skip(make_int_filter(WHITE_OP_IN, col, {1, 15, 30}), row_count, provider));
+  // no null in the row group
+  ASSERT_TRUE(can_skip(make_int_filter(WHITE_OP_NU, col, {}), row_count, provider));
+  ASSERT_FALSE(can_skip(make_int_filter(WHITE_OP_NN, col, {}), row_count, provider));
+
+  // all not null values are the same
+  provider.stats_[0] = int_stat(15, 15, 10);
+  ASSERT_TRUE(can_skip(make_int_filter(WHITE_OP_NE, col, {15}), row_count, provider));
+  ASSERT_FALSE(can_skip(make_int_filter(WHITE_OP_NE, col, {16}), row_count, provider));
+  ASSERT_FALSE(can_skip(make_int_filter(WHITE_OP_NU, col, {}), row_count, provider));
+  ASSERT_FALSE(can_skip(make_int_filter(WHITE_OP_NN, col, {}), row_count, provider));
+}
+
+TEST_F(TestExternalTablePushdownFilter, null_only_group)
+{
+  ObExpr *col = add_col_expr(ObIntType, CS_TYPE_BINARY);
+  MockStatProvider provider;
+  ObExternalColumnStat stat;
+  const int64_t row_count = 100;
+  stat.null_count_ = row_count;
+  provider.stats_.push_back(stat);
+  ASSERT_TRUE(can_skip(make_int_filter(WHITE_OP_EQ, col, {0}), row_count, provider));
+  ASSERT_TRUE(can_skip(make_int_filter(WHITE_OP_NE, col, {0}), row_count, provider));
+  ASSERT_TRUE(can_skip(make_int_filter(WHITE_OP_GT, col, {0}), row_count, provider));
+  ASSERT_TRUE(can_skip(make_int_filter(WHITE_OP_IN, col, {0, 1}), row_count, provider));
+  ASSERT_TRUE(can_skip(make_int_filter(WHITE_OP_NN, col, {}), row_count, provider));
+  ASSERT_FALSE(can_skip(make_int_filter(WHITE_OP_NU, col, {}), row_count, provider));
+  // a row group with more rows is not null only
+  ASSERT_FALSE(can_skip(make_int_filter(WHITE_OP_EQ, col, {0}), row_count + 1, provider));
+  ASSERT_FALSE(can_skip(make_int_filter(WHITE_OP_NN, col, {}), row_count + 1, provider));
+  // comparing with null is never true, whatever the statistics are
+  std::vector<ObObj> null_param(1);
+  null_param[0].set_null();
+  provider.stats_[0] = int_stat(10, 20, 0);
+  ASSERT_TRUE(can_skip(make_filter(WHITE_OP_EQ, col, null_param), row_count, provider));
+  ASSERT_TRUE(can_skip(make_filter(WHITE_OP_LT, col, null_param), row_count, provider));
+}
+
+TEST_F(TestExternalTablePushdownFilter, missing_stats)
+{
+  ObExpr *col = add_col_expr(ObIntType, CS_TYPE_BINARY);
+  MockStatProvider provider;
+  const int64_t row_count = 100;
+  // neither min max nor null count
+  provider.stats_.push_back(ObExternalColumnStat());
+  ASSERT_FALSE(can_skip(make_int_filter(WHITE_OP_EQ, col, {0}), row_count, provider));
+  ASSERT_FALSE(can_skip(make_int_filter(WHITE_OP_NU, col, {}), row_count, provider));
+  ASSERT_FALSE(can_skip(make_int_filter(WHITE_OP_NN, col, {}), row_count, provider));
+  // null count only
+  provider.stats_[0].null_count_ = 0;
+  ASSERT_FALSE(can_skip(make_int_filter(WHITE_OP_EQ, col, {0}), row_count, provider));
+  ASSERT_TRUE(can_skip(make_int_filter(WHITE_OP_NU, col, {}), row_count, provider));
+  // min max only
+  provider.stats_[0] = int_stat(10, 20, -1);
+  ASSERT_TRUE(can_skip(make_int_filter(WHITE_OP_EQ, col, {0}), row_count, provider));
+  ASSERT_FALSE(can_skip(make_int_filter(WHITE_OP_NU, col, {}), row_count, provider));
+  ASSERT_FALSE(can_skip(make_int_filter(WHITE_OP_NN, col, {}), row_count, provider));
+
+  ObWhiteFilterExecutor *filter = make_int_filter(WHITE_OP_EQ, col, {0});
+  bool skip = true;
+  // the column is converted after reading, the statistics of the file column do not apply
+  {
+    ObExternalTablePushdownFilter pd_filter;
+    init_pd_filter(pd_filter, filter);
+    pd_filter.file_col_idxs_.at(0) = -1;
+    ASSERT_EQ(OB_SUCCESS, pd_filter.can_skip(row_count, provider, skip));
+    ASSERT_FALSE(skip);
+  }
+  // not inited or nothing pushed down
+  {
+    ObExternalTablePushdownFilter pd_filter;
+    skip = true;
+    ASSERT_EQ(OB_SUCCESS, pd_filter.can_skip(row_count, provider, skip));
+    ASSERT_FALSE(skip);
+    init_pd_filter(pd_filter, nullptr);
+    skip = true;
+    ASSERT_EQ(OB_SUCCESS, pd_filter.can_skip(row_count, provider, skip));
+    ASSERT_FALSE(skip);
+  }
+  // empty group
+  ASSERT_FALSE(can_skip(filter, 0, provider));
+}
+
+TEST_F(TestExternalTablePushdownFilter, truncated_varbinary_bounds)
+{
+  // writers may keep a prefix of the min and a prefix of the max with its last byte increased, the
+  // bounds are still a lower and an upper bound of the values, e.g. "ab" and "ac" for the values
+  // between "abc0000" and "abz9999"
+  ObExpr *col = add_col_expr(ObVarcharType, CS_TYPE_BINARY);
+  MockStatProvider provider;
+  const int64_t row_count = 100;
+  provider.stats_.push_back(bin_stat("ab", "ac", 0));
+  ASSERT_FALSE(can_skip(make_bin_filter(WHITE_OP_EQ, col, {"abc0000"}), row_count, provider));
+  ASSERT_FALSE(can_skip(make_bin_filter(WHITE_OP_EQ, col, {"ab"}), row_count, provider));
+  ASSERT_FALSE(can_skip(make_bin_filter(WHITE_OP_EQ, col, {"ac"}), row_count, provider));
+  ASSERT_TRUE(can_skip(make_bin_filter(WHITE_OP_EQ, col, {"aa"}), row_count, provider));
+  ASSERT_TRUE(can_skip(make_bin_filter(WHITE_OP_EQ, col, {"a"}), row_count, provider));
+  ASSERT_TRUE(can_skip(make_bin_filter(WHITE_OP_EQ, col, {"ac0"}), row_count, provider));
+  ASSERT_TRUE(can_skip(make_bin_filter(WHITE_OP_LT, col, {"ab"}), row_count, provider));
+  ASSERT_FALSE(can_skip(make_bin_filter(WHITE_OP_LT, col, {"ab0"}), row_count, provider));
+  ASSERT_TRUE(can_skip(make_bin_filter(WHITE_OP_GT, col, {"ac"}), row_count, provider));
+  ASSERT_FALSE(can_skip(make_bin_filter(WHITE_OP_GT, col, {"abz"}), row_count, provider));
+  ASSERT_TRUE(can_skip(make_bin_filter(WHITE_OP_IN, col, {"a", "ad"}), row_count, provider));
+  ASSERT_FALSE(can_skip(make_bin_filter(WHITE_OP_IN, col, {"a", "abc"}), row_count, provider));
+  // bytes compare unsigned
+  provider.stats_[0] = bin_stat("\x7f", "\xff", 0);
+  ASSERT_FALSE(can_skip(make_bin_filter(WHITE_OP_EQ, col, {"\x80"}), row_count, provider));
+  ASSERT_TRUE(can_skip(make_bin_filter(WHITE_OP_EQ, col, {"\x01"}), row_count, provider));
+}
+
+TEST_F(TestExternalTablePushdownFilter, parquet_row_group_stat)
+{
+  write_parquet_file();
+  ObArrayWrap<int> column_indexs;
+  ExprFixedArray file_column_exprs(allocator_);
+  ObExternalColumnStat stat;
+  ASSERT_EQ(OB_SUCCESS, column_indexs.allocate_array(allocator_, PQ_COL_CNT));
+  ASSERT_EQ(OB_SUCCESS, file_column_exprs.init(PQ_COL_CNT));
+  for (int64_t i = 0; i < PQ_COL_CNT; ++i) {
+    column_indexs.at(i) = static_cast<int>(i);
+  }
+  ASSERT_EQ(OB_SUCCESS, file_column_exprs.push_back(add_col_expr(ObIntType, CS_TYPE_BINARY)));
+  ASSERT_EQ(OB_SUCCESS, file_column_exprs.push_back(add_col_expr(ObUInt64Type, CS_TYPE_BINARY)));
+  ASSERT_EQ(OB_SUCCESS, file_column_exprs.push_back(add_col_expr(ObIntType, CS_TYPE_BINARY)));
+  ASSERT_EQ(OB_SUCCESS, file_column_exprs.push_back(add_col_expr(ObVarcharType, CS_TYPE_BINARY)));
+  ASSERT_EQ(OB_SUCCESS, file_column_exprs.push_back(add_col_expr(ObInt32Type, CS_TYPE_BINARY)));
+  ASSERT_EQ(OB_SUCCESS, file_column_exprs.push_back(add_col_expr(ObInt32Type, CS_TYPE_BINARY)));
+  for (int64_t rg = 0; rg < 2; ++rg) {
+    std::unique_ptr<parquet::RowGroupMetaData> rg_meta = pq_reader_->metadata()->RowGroup(rg);
+    ObParquetTableRowIterator::RowGroupStatProvider provider(*rg_meta, column_indexs,
+                                                             file_column_exprs, ObMemAttr());
+    const int64_t first_row = rg * PQ_ROW_GROUP_ROWS;
+    const int64_t last_row = first_row + PQ_ROW_GROUP_ROWS - 1;
+    char min_key[16];
+    char max_key[16];
+    snprintf(min_key, sizeof(min_key), "key%03ld", first_row);
+    snprintf(max_key, sizeof(max_key), "key%03ld", last_row);
+
+    ASSERT_EQ(OB_SUCCESS, provider.get_column_stat(PQ_I32_COL, stat));
+    ASSERT_TRUE(stat.has_min_max_);
+    ASSERT_EQ(0, stat.null_count_);
+    ASSERT_EQ(ObIntType, stat.min_.get_type());
+    ASSERT_EQ(first_row - PQ_ROW_GROUP_ROWS, stat.min_.get_int());
+    ASSERT_EQ(last_row - PQ_ROW_GROUP_ROWS, stat.max_.get_int());
+    // unsigned values beyond INT64_MAX keep their order
+    ASSERT_EQ(OB_SUCCESS, provider.get_column_stat(PQ_U64_COL, stat));
+    ASSERT_TRUE(stat.has_min_max_);
+    ASSERT_EQ(ObUInt64Type, stat.min_.get_type());
+    ASSERT_EQ(PQ_U64_BASE + first_row, stat.min_.get_uint64());
+    ASSERT_EQ(PQ_U64_BASE + last_row, stat.max_.get_uint64());
+    ASSERT_EQ(OB_SUCCESS, provider.get_column_stat(PQ_I64_COL, stat));
+    ASSERT_TRUE(stat.has_min_max_);
+    ASSERT_EQ(first_row * 1000, stat.min_.get_int());
+    ASSERT_EQ(last_row * 1000, stat.max_.get_int());
+    ASSERT_EQ(OB_SUCCESS, provider.get_column_stat(PQ_BIN_COL, stat));
+    ASSERT_TRUE(stat.has_min_max_);
+    ASSERT_EQ(CS_TYPE_BINARY, stat.min_.get_collation_type());
+    ASSERT_TRUE(ObString(min_key) == stat.min_.get_string());
+    ASSERT_TRUE(ObString(max_key) == stat.max_.get_string());
+    ASSERT_EQ(OB_SUCCESS, provider.get_column_stat(PQ_NULL_COL, stat));
+    ASSERT_FALSE(stat.has_min_max_);
+    ASSERT_EQ(PQ_ROW_GROUP_ROWS, stat.null_count_);
+    ASSERT_EQ(OB_SUCCESS, provider.get_column_stat(PQ_NO_STAT_COL, stat));
+    ASSERT_FALSE(stat.has_min_max_);
+    ASSERT_EQ(-1, stat.null_count_);
+    ASSERT_EQ(OB_INVALID_ARGUMENT, provider.get_column_stat(PQ_COL_CNT, stat));
+    ASSERT_EQ(OB_INVALID_ARGUMENT, provider.get_column_stat(-1, stat));
+  }
+
+  // the sign of the file column and the ob type differ, the order of min max is unknown
+  file_column_exprs.at(PQ_I32_COL)->datum_meta_.type_ = ObUInt64Type;
+  file_column_exprs.at(PQ_U64_COL)->datum_meta_.type_ = ObIntType;
+  // parquet orders byte arrays as unsigned bytes, which is not the order of the other collations
+  file_column_exprs.at(PQ_BIN_COL)->datum_meta_.cs_type_ = CS_TYPE_UTF8MB4_GENERAL_CI;
+  std::unique_ptr<parquet::RowGroupMetaData> rg_meta = pq_reader_->metadata()->RowGroup(0);
+  ObParquetTableRowIterator::RowGroupStatProvider provider(*rg_meta, column_indexs,
+                                                           file_column_exprs, ObMemAttr());
+  ASSERT_EQ(OB_SUCCESS, provider.get_column_stat(PQ_I32_COL, stat));
+  ASSERT_FALSE(stat.has_min_max_);
+  ASSERT_EQ(0, stat.null_count_);
+  ASSERT_EQ(OB_SUCCESS, provider.get_column_stat(PQ_U64_COL, stat));
+  ASSERT_FALSE(stat.has_min_max_);
+  ASSERT_EQ(OB_SUCCESS, provider.get_column_stat(PQ_BIN_COL, stat));
+  ASSERT_FALSE(stat.has_min_max_);
+}
+
+TEST_F(TestExternalTablePushdownFilter, parquet_check_row_group_skippable)
+{
+  write_parquet_file();
+  ObParquetTableRowIterator iter;
+  ASSERT_EQ(OB_SUCCESS, iter.column_indexs_.allocate_array(iter.allocator_, PQ_COL_CNT));
+  ASSERT_EQ(OB_SUCCESS, iter.file_column_exprs_.init(PQ_COL_CNT));
+  for (int64_t i = 0; i < PQ_COL_CNT; ++i) {
+    iter.column_indexs_.at(i) = static_cast<int>(i);
+  }
+  ObExpr *i32_col = add_col_expr(ObIntType, CS_TYPE_BINARY);
+  ObExpr *u64_col = add_col_expr(ObUInt64Type, CS_TYPE_BINARY);
+  add_col_expr(ObIntType, CS_TYPE_BINARY);
+  ObExpr *bin_col = add_col_expr(ObVarcharType, CS_TYPE_BINARY);
+  ObExpr *null_col = add_col_expr(ObInt32Type, CS_TYPE_BINARY);
+  ObExpr *no_stat_col = add_col_expr(ObInt32Type, CS_TYPE_BINARY);
+  for (int64_t i = 0; i < PQ_COL_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, iter.file_column_exprs_.push_back(col_exprs_.at(i)));
+  }
+  iter.file_meta_ = pq_reader_->metadata();
+
+  struct Case {
+    ObWhiteFilterExecutor *filter_;
+    bool skip_[2];
+  };
+  std::vector<ObObj> u64_param(1);
+  u64_param[0].set_uint64(PQ_U64_BASE + PQ_ROW_GROUP_ROWS);
+  std::vector<Case> cases = {
+    {make_int_filter(WHITE_OP_EQ, i32_col, {5}), {true, false}},
+    {make_int_filter(WHITE_OP_LT, i32_col, {0}), {false, true}},
+    {make_filter(WHITE_OP_GE, u64_col, u64_param), {true, false}},
+    {make_bin_filter(WHITE_OP_EQ, bin_col, {"key150"}), {true, false}},
+    {make_bin_filter(WHITE_OP_IN, bin_col, {"key050", "key999"}), {false, true}},
+    {make_int_filter(WHITE_OP_NN, null_col, {}), {true, true}},
+    {make_int_filter(WHITE_OP_EQ, no_stat_col, {-1}), {false, false}},
+  };
+  for (size_t i = 0; i < cases.size(); ++i) {
+    init_pd_filter(iter.pd_filter_, cases[i].filter_);
+    iter.state_.cur_line_number_ = 0;
+    int64_t skipped_rows = 0;
+    for (int64_t rg = 0; rg < 2; ++rg) {
+      bool skip = false;
+      ASSERT_EQ(OB_SUCCESS, iter.check_row_group_skippable(rg, skip));
+      ASSERT_EQ(cases[i].skip_[rg], skip) << "case " << i << " row group " << rg;
+      skipped_rows += skip ? PQ_ROW_GROUP_ROWS : 0;
+    }
+    // skipped row groups still count in the line numbers
+    ASSERT_EQ(skipped_rows, iter.state_.cur_line_number_) << "case " << i;
+  }
+}
+
+TEST_F(TestExternalTablePushdownFilter, orc_stripe_stat)
+{
+  write_orc_file();
+  std::unique_ptr<orc::StripeStatistics> stripe_stats = orc_reader_->getStripeStatistics(0);
+  ASSERT_TRUE(nullptr != stripe_stats);
+  ObArrayWrap<int> column_indexs;
+  ExprFixedArray file_column_exprs(allocator_);
+  ObExternalColumnStat stat;
+  // the last column is not in the file
+  ASSERT_EQ(OB_SUCCESS, column_indexs.allocate_array(allocator_, ORC_COL_CNT + 1));
+  ASSERT_EQ(OB_SUCCESS, file_column_exprs.init(ORC_COL_CNT + 1));
+  for (int64_t i = 0; i < ORC_COL_CNT + 1; ++i) {
+    column_indexs.at(i) = static_cast<int>(i + 1);
+  }
+  column_indexs.at(ORC_COL_CNT) = 100;
+  ASSERT_EQ(OB_SUCCESS, file_column_exprs.push_back(add_col_expr(ObIntType, CS_TYPE_BINARY)));
+  ASSERT_EQ(OB_SUCCESS, file_column_exprs.push_back(add_col_expr(ObVarcharType, CS_TYPE_BINARY)));
+  ASSERT_EQ(OB_SUCCESS, file_column_exprs.push_back(add_col_expr(ObInt32Type, CS_TYPE_BINARY)));
+  ASSERT_EQ(OB_SUCCESS, file_column_exprs.push_back(add_col_expr(ObIntType, CS_TYPE_BINARY)));
+  {
+    ObOrcTableRowIterator::StripeStatProvider provider(*stripe_stats, column_indexs, file_column_exprs,
+                                                       ORC_ROW_CNT, ObMemAttr());
+    ASSERT_EQ(OB_SUCCESS, provider.get_column_stat(0, stat));
+    ASSERT_TRUE(stat.has_min_max_);
+    ASSERT_EQ(0, stat.null_count_);
+    ASSERT_EQ(-ORC_ROW_CNT / 2, stat.min_.get_int());
+    ASSERT_EQ(ORC_ROW_CNT / 2 - 1, stat.max_.get_int());
+    ASSERT_EQ(OB_SUCCESS, provider.get_column_stat(1, stat));
+    ASSERT_TRUE(stat.has_min_max_);
+    ASSERT_EQ(0, stat.null_count_);
+    ASSERT_EQ(CS_TYPE_BINARY, stat.min_.get_collation_type());
+    ASSERT_TRUE(ObString("key000") == stat.min_.get_string());
+    ASSERT_TRUE(ObString("key099") == stat.max_.get_string());
+    // null only
+    ASSERT_EQ(OB_SUCCESS, provider.get_column_stat(2, stat));
+    ASSERT_FALSE(stat.has_min_max_);
+    ASSERT_EQ(ORC_ROW_CNT, stat.null_count_);
+    // no statistics of the column
+    ASSERT_EQ(OB_SUCCESS, provider.get_column_stat(3, stat));
+    ASSERT_FALSE(stat.has_min_max_);
+    ASSERT_EQ(-1, stat.null_count_);
+    ASSERT_EQ(OB_INVALID_ARGUMENT, provider.get_column_stat(4, stat));
+  }
+  {
+    // a row count that does not match the number of values is not trusted
+    ObOrcTableRowIterator::StripeStatProvider provider(*stripe_stats, column_indexs, file_column_exprs,
+                                                       ORC_ROW_CNT / 2, ObMemAttr());
+    ASSERT_EQ(OB_SUCCESS, provider.get_column_stat(0, stat));
+    ASSERT_EQ(-1, stat.null_count_);
+    ASSERT_TRUE(stat.has_min_max_);
+  }
+  // orc integers are signed, unsigned ob types are not pruned, nor the strings of the collations
+  // other than binary
+  file_column_exprs.at(0)->datum_meta_.type_ = ObUInt64Type;
+  file_column_exprs.at(1)->datum_meta_.cs_type_ = CS_TYPE_UTF8MB4_GENERAL_CI;
+  {
+    ObOrcTableRowIterator::StripeStatProvider provider(*stripe_stats, column_indexs, file_column_exprs,
+                                                       ORC_ROW_CNT, ObMemAttr());
+    ASSERT_EQ(OB_SUCCESS, provider.get_column_stat(0, stat));
+    ASSERT_FALSE(stat.has_min_max_);
+    ASSERT_EQ(0, stat.null_count_);
+    ASSERT_EQ(OB_SUCCESS, provider.get_column_stat(1, stat));
+    ASSERT_FALSE(stat.has_min_max_);
+    ASSERT_EQ(0, stat.null_count_);
+  }
+}
+
+TEST_F(TestExternalTablePushdownFilter, orc_check_stripe_skippable)
+{
+  write_orc_file();
+  ObOrcTableRowIterator iter;
+  ASSERT_EQ(OB_SUCCESS, iter.column_indexs_.allocate_array(iter.allocator_, ORC_COL_CNT));
+  ASSERT_EQ(OB_SUCCESS, iter.file_column_exprs_.init(ORC_COL_CNT));
+  ASSERT_EQ(OB_SUCCESS, iter.stripes_.allocate_array(iter.allocator_, 2));
+  for (int64_t i = 0; i < ORC_COL_CNT; ++i) {
+    iter.column_indexs_.at(i) = static_cast<int>(i + 1);
+  }
+  ObExpr *i_col = add_col_expr(ObIntType, CS_TYPE_BINARY);
+  ObExpr *s_col = add_col_expr(ObVarcharType, CS_TYPE_BINARY);
+  ObExpr *n_col = add_col_expr(ObInt32Type, CS_TYPE_BINARY);
+  for (int64_t i = 0; i < ORC_COL_CNT; ++i) {
+    ASSERT_EQ(OB_SUCCESS, iter.file_column_exprs_.push_back(col_exprs_.at(i)));
+  }
+  iter.stripes_.at(0).num_rows = ORC_ROW_CNT;
+  iter.stripes_.at(0).first_row_id = 0;
+  // a stripe without stripe statistics
+  iter.stripes_.at(1).num_rows = ORC_ROW_CNT;
+  iter.stripes_.at(1).first_row_id = ORC_ROW_CNT;
+  iter.reader_ = std::move(orc_reader_);
+
+  struct Case {
+    ObWhiteFilterExecutor *filter_;
+    bool skip_;
+  };
+  std::vector<Case> cases = {
+    {make_int_filter(WHITE_OP_EQ, i_col, {ORC_ROW_CNT}), true},
+    {make_int_filter(WHITE_OP_EQ, i_col, {0}), false},
+    {make_int_filter(WHITE_OP_BT, i_col, {-ORC_ROW_CNT, -ORC_ROW_CNT / 2 - 1}), true},
+    {make_bin_filter(WHITE_OP_GT, s_col, {"key099"}), true},
+    {make_bin_filter(WHITE_OP_LE, s_col, {"key000"}), false},
+    {make_int_filter(WHITE_OP_EQ, n_col, {0}), true},
+    {make_int_filter(WHITE_OP_NU, n_col, {}), false},
+  };
+  for (size_t i = 0; i < cases.size(); ++i) {
+    bool skip = false;
+    init_pd_filter(iter.pd_filter_, cases[i].filter_);
+    iter.state_.cur_line_number_ = 0;
+    ASSERT_EQ(OB_SUCCESS, iter.check_stripe_skippable(0, skip));
+    ASSERT_EQ(cases[i].skip_, skip) << "case " << i;
+    ASSERT_EQ(skip ? ORC_ROW_CNT : 0, iter.state_.cur_line_number_) << "case " << i;
+    ASSERT_EQ(OB_SUCCESS, iter.check_stripe_skippable(1, skip));
+    ASSERT_FALSE(skip) << "case " << i;
+  }
+}
+
+} // namespace sql
+} // namespace oceanbase
+
+int main(int argc, char** argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define USING_LOG_PREFIX SQL
+#include <gtest/gtest.h>
+#include <parquet/api/reader.h>
+#define private public
+#include "sql/engine/table/ob_parquet_table_row_iter.h"
+#undef private
+
+namespace oceanbase
+{
+using namespace common;
+namespace sql
+{
+
+typedef ObParquetTableRowIterator::ListColumnBuffer ListColumnBuffer;
+static const int64_t DEFAULT_LEVEL_CNT = ListColumnBuffer::DEFAULT_LEVEL_CNT;
+
+static const char *TEST_FILE = "test_parquet_list_column.parquet";
+
+struct TestListRow
+{
+  TestListRow() : is_null_(false) {}
+  static TestListRow null_row() { TestListRow row; row.is_null_ = true; return row; }
+  TestListRow &add(const float value) { elems_.push_back(value); elem_nulls_.push_back(false); return *this; }
+  TestListRow &add_null() { elems_.push_back(0); elem_nulls_.push_back(true); return *this; }
+  bool operator==(const TestListRow &other) const
+  {
+    return is_null_ == other.is_null_ && elems_ == other.elems_ && elem_nulls_ == other.elem_nulls_;
+  }
+  bool is_null_;
+  std::vector<float> elems_;
+  std::vector<bool> elem_nulls_;
+};
+
+class TestParquetListColumn : public ::testing::Test
+{
+public:
+  TestParquetListColumn() : allocator_("ParquetListTest") {}
+  virtual ~TestParquetListColumn() {}
+  virtual void TearDown()
+  {
+    reader_.reset();
+    file_reader_.reset();
+    ::remove(TEST_FILE);
+    allocator_.reset();
+  }
+  // write rows as a list<float> column, small pages so that the lists span pages
+  void write_file(const std::vector<TestListRow> &rows)
+  {
+    reader_.reset();
+    file_reader_.reset();
+    arrow::MemoryPool *pool = arrow::default_memory_pool();
+    std::shared_ptr<arrow::FloatBuilder> value_builder = std::make_shared<arrow::FloatBuilder>(pool);
+    arrow::ListBuilder list_builder(pool, value_builder);
+    for (size_t i = 0; i < rows.size(); i++) {
+      if (rows[i].is_null_) {
+        ASSERT_TRUE(list_builder.AppendNull().ok());
+      } else {
+        ASSERT_TRUE(list_builder.Append().ok());
+        for (size_t j = 0; j < rows[i].elems_.size(); j++) {
+          if (rows[i].elem_nulls_[j]) {
+            ASSERT_TRUE(value_builder->AppendNull().ok());
+          } else {
+            ASSERT_TRUE(value_builder->Append(rows[i].elems_[j]).ok());
+          }
+        }
+      }
+    }
+    std::shared_ptr<arrow::Array> array;
+    ASSERT_TRUE(list_builder.Finish(&array).ok());
+    std::shared_ptr<arrow::Schema> schema = arrow::schema({arrow::field("vec", array->type())});
+    std::shared_ptr<arrow::Table> table = arrow::Table::Make(schema, {array});
+    std::shared_ptr<arrow::io::FileOutputStream> outfile;
+    PARQUET_ASSIGN_OR_THROW(outfile, arrow::io::FileOutputStream::Open(TEST_FILE));
+    std::shared_ptr<parquet::WriterProperties> props =
+        parquet::WriterProperties::Builder().data_pagesize(1024)->write_batch_size(64)->build();
+    PARQUET_THROW_NOT_OK(parquet::arrow::WriteTable(*table, pool, outfile, rows.size() + 1, props));
+    PARQUET_THROW_NOT_OK(outfile->Close());
+  }
+  void open_file(ListColumnBuffer &buf, const bool is_vector, const uint32_t dim)
+  {
+    file_reader_ = parquet::ParquetFileReader::OpenFile(TEST_FILE);
+    ASSERT_EQ(1, file_reader_->metadata()->num_row_groups());
+    const parquet::ColumnDescriptor *col_desc = file_reader_->metadata()->schema()->Column(0);
+    ASSERT_EQ(1, col_desc->max_repetition_level());
+    max_def_level_ = col_desc->max_definition_level();
+    reader_ = file_reader_->RowGroup(0)->Column(0);
+    ASSERT_EQ(OB_SUCCESS, buf.init(col_desc, sizeof(float), is_vector, dim));
+  }
+  // the same loop as DataLoader::load_list_col, rows are loaded in batches of batch_size
+  int load_rows(ListColumnBuffer &buf, const int64_t batch_size, std::vector<TestListRow> &rows)
+  {
+    int ret = OB_SUCCESS;
+    bool iter_end = false;
+    while (OB_SUCC(ret) && !iter_end) {
+      int64_t row_count = 0;
+      while (OB_SUCC(ret) && row_count < batch_size) {
+        ListColumnBuffer::ListRow row;
+        if (OB_FAIL(buf.get_next_row(max_def_level_, reader_->HasNext(), row))) {
+          if (OB_EAGAIN == ret) {
+            ret = buf.read_levels<float, parquet::FloatReader>(reader_.get());
+          } else if (OB_ITER_END == ret) {
+            ret = OB_SUCCESS;
+            iter_end = true;
+            break;
+          }
+        } else {
+          TestListRow res;
+          res.is_null_ = row.is_null_;
+          const float *values = reinterpret_cast<const float *>(row.values_);
+          for (int64_t i = 0, j = 0; i < row.elem_cnt_; i++) {
+            if (row.def_levels_[i] < max_def_level_) {
+              res.add_null();
+            } else {
+              res.add(values[j++]);
+            }
+          }
+          rows.push_back(res);
+          buf.consume_row(row);
+          row_count++;
+        }
+      }
+    }
+    return ret;
+  }
+  void check_rows(const std::vector<TestListRow> &expected, const std::vector<TestListRow> &rows)
+  {
+    ASSERT_EQ(expected.size(), rows.size());
+    for (size_t i = 0; i < rows.size(); i++) {
+      ASSERT_TRUE(expected[i] == rows[i]) << "row " << i;
+    }
+  }
+
+protected:
+  ObArenaAllocator allocator_;
+  std::unique_ptr<parquet::ParquetFileReader> file_reader_;
+  std::shared_ptr<parquet::ColumnReader> reader_;
+  int16_t max_def_level_;
+};
+
+TEST_F(TestParquetListColumn, array_rows)
+{
+  std::vector<TestListRow> expected;
+  expected.push_back(TestListRow().add(1).add(2).add(3));
+  expected.push_back(TestListRow::null_row());
+  expected.push_back(TestListRow());
+  expected.push_back(TestListRow().add_null().add(5).add(6));
+  expected.push_back(TestListRow().add_null());
+  expected.push_back(TestListRow().add(7));
+  expected.push_back(TestListRow::null_row());
+  expected.push_back(TestListRow());
+  write_file(expected);
+
+  for (int64_t batch_size = 1; batch_size <= 8; batch_size++) {
+    ListColumnBuffer buf(allocator_);
+    std::vector<TestListRow> rows;
+    open_file(buf, false, 0);
+    ASSERT_EQ(OB_SUCCESS, load_rows(buf, batch_size, rows));
+    check_rows(expected, rows);
+    ASSERT_FALSE(buf.has_buffered());
+  }
+}
+
+TEST_F(TestParquetListColumn, rows_span_reads_and_batches)
+{
+  // 3 does not divide the buffer size, so the reads end in the middle of a row
+  const int64_t row_cnt = 3 * DEFAULT_LEVEL_CNT / 2;
+  std::vector<TestListRow> expected;
+  for (int64_t i = 0; i < row_cnt; i++) {
+    expected.push_back(TestListRow().add(i).add(i + 0.5).add(-i));
+  }
+  write_file(expected);
+  ListColumnBuffer buf(allocator_);
+  std::vector<TestListRow> rows;
+  open_file(buf, true, 3);
+  ASSERT_EQ(OB_SUCCESS, load_rows(buf, 256, rows));
+  check_rows(expected, rows);
+  // no row is longer than the buffer
+  ASSERT_EQ(DEFAULT_LEVEL_CNT, buf.capacity_);
+}
+
+TEST_F(TestParquetListColumn, row_longer_than_buffer)
+{
+  std::vector<TestListRow> expected;
+  expected.push_back(TestListRow().add(1));
+  TestListRow long_row;
+  for (int64_t i = 0; i < 2 * DEFAULT_LEVEL_CNT + 7; i++) {
+    if (0 == i % 100) {
+      long_row.add_null();
+    } else {
+      long_row.add(i);
+    }
+  }
+  expected.push_back(long_row);
+  expected.push_back(TestListRow::null_row());
+  expected.push_back(TestListRow().add(2).add(3));
+  write_file(expected);
+  ListColumnBuffer buf(allocator_);
+  std::vector<TestListRow> rows;
+  open_file(buf, false, 0);
+  ASSERT_EQ(OB_SUCCESS, load_rows(buf, 2, rows));
+  check_rows(expected, rows);
+  ASSERT_GT(buf.capacity_, DEFAULT_LEVEL_CNT);
+}
+
+TEST_F(TestParquetListColumn, vector_rows)
+{
+  // a null list is a null vector
+  std::vector<TestListRow> expected;
+  expected.push_back(TestListRow().add(1).add(2));
+  expected.push_back(TestListRow::null_row());
+  expected.push_back(TestListRow().add(3).add(4));
+  write_file(expected);
+  {
+    ListColumnBuffer buf(allocator_);
+    std::vector<TestListRow> rows;
+    open_file(buf, true, 2);
+    ASSERT_EQ(OB_SUCCESS, load_rows(buf, 2, rows));
+    check_rows(expected, rows);
+  }
+  // wrong dimension
+  {
+    ListColumnBuffer buf(allocator_);
+    std::vector<TestListRow> rows;
+    open_file(buf, true, 3);
+    ASSERT_EQ(OB_ERR_INVALID_VECTOR_DIM, load_rows(buf, 2, rows));
+    ASSERT_TRUE(rows.empty());
+  }
+  // an empty list is a vector of wrong dimension
+  std::vector<TestListRow> empty_rows;
+  empty_rows.push_back(TestListRow().add(1).add(2));
+  empty_rows.push_back(TestListRow());
+  write_file(empty_rows);
+  {
+    ListColumnBuffer buf(allocator_);
+    std::vector<TestListRow> rows;
+    open_file(buf, true, 2);
+    ASSERT_EQ(OB_ERR_INVALID_VECTOR_DIM, load_rows(buf, 2, rows));
+    ASSERT_EQ(1U, rows.size());
+  }
+  // a null element
+  std::vector<TestListRow> null_elem_rows;
+  null_elem_rows.push_back(TestListRow().add(1).add(2));
+  null_elem_rows.push_back(TestListRow().add(1).add_null());
+  write_file(null_elem_rows);
+  {
+    ListColumnBuffer buf(allocator_);
+    std::vector<TestListRow> rows;
+    open_file(buf, true, 2);
+    ASSERT_EQ(OB_ERR_NULL_VALUE, load_rows(buf, 2, rows));
+    ASSERT_EQ(1U, rows.size());
+  }
+}
+
+} // namespace sql
+} // namespace oceanbase
+
+int main(int argc, char** argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
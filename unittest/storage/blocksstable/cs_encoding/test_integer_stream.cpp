@@ -184,7 +184,7 @@ public:
     if (ctx.meta_.is_use_base()) {
       ctx.meta_.set_base_value(min);
     }
-    ctx.build_stream_encoder_info(false, false, &encoding_opt, nullptr, -1, compress_type, &alloctor);
+    ctx.build_stream_encoder_info(false, false, &encoding_opt, nullptr, -1, compress_type, DATA_CURRENT_VERSION, &alloctor);
 
     ObIntegerStreamEncoder encoder;
     uint32_t *data = nullptr;
@@ -238,6 +238,80 @@ public:
     orig_data = nullptr;
   }
 
+  template<class T, class FloatT>
+  void test_and_check_alp_encoding(const int64_t size, const bool use_base, const int64_t max_decimal)
+  {
+    LOG_INFO("test_and_check_alp_encoding", K(size), K(use_base), K(sizeof(T)), K(max_decimal));
+    typedef typename std::make_signed<T>::type SignedT;
+    // fixed seed so that a failure can be replayed
+    std::mt19937_64 rng(size);
+    std::uniform_int_distribution<int64_t> distribution(-max_decimal, max_decimal);
+    T *data = reinterpret_cast<T *>(allocator_.alloc(sizeof(T) * size));
+    T *orig_data = reinterpret_cast<T *>(allocator_.alloc(sizeof(T) * size));
+    for (int64_t i = 0; i < size; i++) {
+      FloatT value = static_cast<FloatT>(distribution(rng) / 100.0);
+      if (i % 97 == 0) {
+        value = -0.0;
+      } else if (i % 101 == 0) {
+        value = NAN;
+      } else if (i % 103 == 0) {
+        value = INFINITY;
+      }
+      MEMCPY(&data[i], &value, sizeof(T));
+      if (i % 107 == 0) {
+        data[i] = static_cast<T>(rng()); // not a decimal
+      }
+    }
+    MEMCPY(orig_data, data, sizeof(T) * size);
+
+    ObIntegerStreamEncoderCtx ctx;
+    ObCSEncodingOpt encoding_opt;
+    ObArenaAllocator allocator;
+    const ObCompressorType compress_type = ObCompressorType::ZSTD_1_3_8_COMPRESSOR;
+    uint64_t range = 0;
+    if (use_base) {
+      // float and double of int store class, negative values make the stream hold bits - min
+      SignedT min = static_cast<SignedT>(data[0]);
+      SignedT max = min;
+      for (int64_t i = 1; i < size; i++) {
+        min = MIN(min, static_cast<SignedT>(data[i]));
+        max = MAX(max, static_cast<SignedT>(data[i]));
+      }
+      ASSERT_EQ(OB_SUCCESS, ctx.build_signed_stream_meta(min, max, false, 0, 0, false, DATA_CURRENT_VERSION, range));
+    } else {
+      ASSERT_EQ(OB_SUCCESS, ctx.build_unsigned_stream_meta(*std::min_element(data, data + size),
+          *std::max_element(data, data + size), false, 0, false, DATA_CURRENT_VERSION, range));
+    }
+    // -0.0 is always there, so the signed min is negative
+    ASSERT_EQ(use_base, ctx.meta_.is_use_base());
+    ASSERT_EQ(sizeof(T), ctx.meta_.get_uint_width_size());
+    ctx.meta_.set_encoding_type(ObIntegerStream::ALP_FIXED_PFOR);
+    ctx.build_stream_encoder_info(false, false, &encoding_opt, nullptr, -1, compress_type, DATA_CURRENT_VERSION, &allocator);
+    ctx.info_.float_value_size_ = sizeof(FloatT);
+
+    ObIntegerStreamEncoder encoder;
+    ObMicroBufferWriter writer;
+    ASSERT_EQ(OB_SUCCESS, writer.init(OB_DEFAULT_MACRO_BLOCK_SIZE, OB_DEFAULT_MACRO_BLOCK_SIZE));
+    ASSERT_EQ(OB_SUCCESS, encoder.encode(ctx, data, size, writer));
+    LOG_INFO("alp encoded", K(size), K(writer.length()), K(ctx));
+
+    ObStreamData stream_data(writer.data(), writer.length());
+    ObIntegerStreamDecoderCtx decode_ctx;
+    ObStreamData raw_stream_data;
+    buid_raw_integer_stream_data(stream_data, size, compress_type, decode_ctx, raw_stream_data);
+    ASSERT_EQ(sizeof(T), decode_ctx.meta_.get_uint_width_size());
+
+    int32_t *row_ids = reinterpret_cast<int32_t *>(allocator_.alloc(sizeof(int32_t) * size));
+    for (int32_t i = 0; i < size; i++) {
+      row_ids[i] = i;
+    }
+    char *dst_array_buf = reinterpret_cast<char *>(allocator_.alloc(sizeof(T) * size));
+    decode_raw_array(raw_stream_data, decode_ctx, row_ids, size, dst_array_buf);
+    for (int64_t i = 0; i < size; i++) {
+      ASSERT_EQ(orig_data[i], reinterpret_cast<T *>(dst_array_buf)[i]) << "i=" << i;
+    }
+  }
+
   template<class T>
   void test_and_check_int_datums_all_encoding_type(
       uint8_t attribute,
@@ -302,7 +376,7 @@ public:
     if (ctx.meta_.is_use_null_replace_value()) {
       ctx.meta_.set_null_replaced_value(null_replace_value);
     }
-    ctx.build_stream_encoder_info(has_null, false, &encoding_opt, nullptr, -1, compress_type, &allocator);
+    ctx.build_stream_encoder_info(has_null, false, &encoding_opt, nullptr, -1, compress_type, DATA_CURRENT_VERSION, &allocator);
 
     ObIntegerStreamEncoder encoder;
     ObColDatums *datums = new ObColDatums(allocator);
@@ -820,6 +894,48 @@ TEST_F(TestIntegerStream, test_rle)
   }
 }
 
+TEST_F(TestIntegerStream, test_alp_encoding)
+{
+  for (int64_t i = 1; i < 100000; i = i * 7) {
+    test_and_check_alp_encoding<uint64_t, double>(i, false, 10000000);
+    test_and_check_alp_encoding<uint64_t, double>(i, true, 10000000);
+    test_and_check_alp_encoding<uint32_t, float>(i, false, 100000);
+    test_and_check_alp_encoding<uint32_t, float>(i, true, 100000);
+  }
+
+  // decimals of double must be much smaller than raw, and alp is only detected once
+  // the major working version can decode it
+  ObCSEncodingOpt encoding_opt;
+  ObArenaAllocator allocator;
+  const int64_t size = 10000;
+  uint64_t *data = reinterpret_cast<uint64_t *>(allocator.alloc(sizeof(uint64_t) * size));
+  const int64_t versions[] = {DATA_VERSION_1_0_0_0, DATA_CURRENT_VERSION};
+  for (int64_t i = 0; i < ARRAYSIZEOF(versions); i++) {
+    for (int64_t j = 0; j < size; j++) {
+      const double value = (j * 7919 % 1000000) / 100.0;
+      MEMCPY(&data[j], &value, sizeof(double));
+    }
+    ObIntegerStreamEncoderCtx ctx;
+    uint64_t range = 0;
+    ASSERT_EQ(OB_SUCCESS, ctx.build_unsigned_stream_meta(*std::min_element(data, data + size),
+        *std::max_element(data, data + size), false, 0, false, versions[i], range));
+    ASSERT_EQ(sizeof(uint64_t), ctx.meta_.get_uint_width_size());
+    ctx.build_stream_encoder_info(false, false, &encoding_opt, nullptr, -1, ObCompressorType::NONE_COMPRESSOR,
+        versions[i], &allocator);
+    ctx.info_.float_value_size_ = sizeof(double);
+    ObIntegerStreamEncoder encoder;
+    ObMicroBufferWriter writer;
+    ASSERT_EQ(OB_SUCCESS, writer.init(OB_DEFAULT_MACRO_BLOCK_SIZE, OB_DEFAULT_MACRO_BLOCK_SIZE));
+    ASSERT_EQ(OB_SUCCESS, encoder.encode(ctx, data, size, writer));
+    if (DATA_CURRENT_VERSION == versions[i]) {
+      ASSERT_EQ(ObIntegerStream::ALP_FIXED_PFOR, ctx.meta_.get_encoding_type());
+      ASSERT_LT(writer.length(), size * sizeof(uint64_t) / 2);
+    } else {
+      ASSERT_NE(ObIntegerStream::ALP_FIXED_PFOR, ctx.meta_.get_encoding_type());
+    }
+  }
+}
+
 } // end namespace blocksstable
 } // end namespace oceanbase
 
@@ -20,10 +20,12 @@
 #define protected public
 #define private public
 #include "storage/blocksstable/index_block/ob_index_block_aggregator.h"
+#include "share/datum/ob_datum_funcs.h"
 #include "storage/blocksstable/cs_encoding/ob_micro_block_cs_encoder.h"
 #include "storage/blocksstable/encoding/ob_micro_block_encoder.h"
 #include "storage/test_schema_prepare.h"
 #include "ob_row_generate.h"
+#include "lib/random/ob_random.h"
 
 
 namespace oceanbase
@@ -1321,6 +1323,423 @@ TEST_F(TestIndexBlockAggregator, test_inv_idx_agg)
   ASSERT_EQ(data_agg_row->agg_row_.storage_datums_[doc_len_idx].get_int(), 100);
 }
 
+TEST_F(TestIndexBlockAggregator, test_hll)
+{
+  static const int64_t test_column_cnt = 3;
+  const int64_t extra_rowkey_cnt = ObMultiVersionRowkeyHelpper::get_extra_rowkey_col_cnt();
+  ObObjType col_obj_types[test_column_cnt];
+  col_obj_types[0] = ObIntType;
+  col_obj_types[1] = ObIntType;
+  col_obj_types[2] = ObVarcharType;
+  init_schema(test_column_cnt, 1, col_obj_types);
+  for (int64_t i = rowkey_count_; i < test_column_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, full_agg_metas_.push_back(ObSkipIndexColMeta(i + extra_rowkey_cnt, SK_IDX_HLL)));
+  }
+  data_version_ = DATA_CURRENT_VERSION;
+
+  // sketches are only built for major
+  ObSkipIndexDataAggregator data_aggregator;
+  ASSERT_EQ(OB_NOT_SUPPORTED, data_aggregator.init(false, full_agg_metas_, col_descs_, data_version_, allocator_));
+  data_aggregator.reset();
+
+  const bool is_major = true;
+  const int64_t row_cnts[] = {20, 1000};
+  for (int64_t round = 0; round < 2; ++round) {
+    const int64_t test_row_cnt = row_cnts[round];
+    ObSkipIndexIndexAggregator index_aggregator;
+    ASSERT_EQ(OB_SUCCESS, data_aggregator.init(is_major, full_agg_metas_, col_descs_, data_version_, allocator_));
+    ASSERT_EQ(OB_SUCCESS, index_aggregator.init(is_major, full_agg_metas_, col_descs_, data_version_, allocator_));
+    ObDatumRow generate_row;
+    ASSERT_EQ(OB_SUCCESS, generate_row.init(full_column_count_));
+    for (int64_t i = 0; i < test_row_cnt; ++i) {
+      generate_row_by_seed(i, generate_row);
+      ASSERT_EQ(OB_SUCCESS, data_aggregator.eval(generate_row));
+    }
+    const ObSkipIndexAggResult *data_agg_row = nullptr;
+    const ObSkipIndexAggResult *index_agg_row = nullptr;
+    ASSERT_EQ(OB_SUCCESS, data_aggregator.get_aggregated_row(data_agg_row));
+    const char *row_buf = nullptr;
+    int64_t row_size = 0;
+    serialize_agg_row(*data_agg_row, row_buf, row_size);
+    ASSERT_EQ(OB_SUCCESS, index_aggregator.ObISkipIndexAggregator::eval(row_buf, row_size, test_row_cnt));
+    ASSERT_EQ(OB_SUCCESS, index_aggregator.get_aggregated_row(index_agg_row));
+    serialize_agg_row(*index_agg_row, row_buf, row_size);
+
+    ObAggRowReader reader;
+    ASSERT_EQ(OB_SUCCESS, reader.init(row_buf, row_size));
+    for (int64_t j = rowkey_count_; j < test_column_cnt; ++j) {
+      ObStorageDatum datum;
+      ObSkipIndexHLL hll;
+      ASSERT_EQ(OB_SUCCESS, reader.read(ObSkipIndexColMeta(j + extra_rowkey_cnt, SK_IDX_HLL), datum));
+      ASSERT_EQ(OB_SUCCESS, hll.from_datum(datum));
+      const int64_t ndv = hll.estimate();
+      STORAGE_LOG(INFO, "hll estimate", K(j), K(ndv), K(test_row_cnt));
+      ASSERT_LE(std::abs(ndv - test_row_cnt), test_row_cnt * 0.4);
+    }
+    data_aggregator.reset();
+    index_aggregator.reset();
+  }
+
+  // an older major working version can not read the sketch, nothing is stored
+  data_version_ = DATA_VERSION_1_0_0_0;
+  ASSERT_EQ(OB_SUCCESS, data_aggregator.init(is_major, full_agg_metas_, col_descs_, data_version_, allocator_));
+  ObDatumRow generate_row;
+  ASSERT_EQ(OB_SUCCESS, generate_row.init(full_column_count_));
+  for (int64_t i = 0; i < 20; ++i) {
+    generate_row_by_seed(i, generate_row);
+    ASSERT_EQ(OB_SUCCESS, data_aggregator.eval(generate_row));
+  }
+  const ObSkipIndexAggResult *data_agg_row = nullptr;
+  ASSERT_EQ(OB_SUCCESS, data_aggregator.get_aggregated_row(data_agg_row));
+  for (int64_t i = 0; i < full_agg_metas_.count(); ++i) {
+    ASSERT_TRUE(data_agg_row->get_agg_datum_row().storage_datums_[i].is_nop());
+  }
+}
+
+TEST_F(TestIndexBlockAggregator, test_ngram_bloom_filter)
+{
+  ObColDesc col_desc;
+  col_desc.col_type_.set_varchar();
+  col_desc.col_type_.set_collation_type(CS_TYPE_UTF8MB4_BIN);
+  ObStorageDatum result;
+  ObSkipIndexDatumAttr result_attr;
+  ObColNgramBloomFilterAggregator aggregator;
+  ASSERT_EQ(OB_NOT_SUPPORTED, aggregator.init(false, col_desc, DATA_CURRENT_VERSION, result, result_attr));
+  aggregator.reset();
+  ASSERT_EQ(OB_SUCCESS, aggregator.init(true, col_desc, DATA_CURRENT_VERSION, result, result_attr));
+
+  const ObSkipIndexDatumAttr raw_attr(true, false);
+  const char *strs[] = {"hello_world", "foo_bar"};
+  for (int64_t i = 0; i < 2; ++i) {
+    ObStorageDatum datum;
+    datum.set_string(ObString(strs[i]));
+    ASSERT_EQ(OB_SUCCESS, aggregator.eval(datum, raw_attr));
+  }
+  ObStorageDatum null_datum;
+  null_datum.set_null();
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(null_datum, raw_attr));
+  const ObStorageDatum *agg_datum = nullptr;
+  ASSERT_EQ(OB_SUCCESS, aggregator.get_result(agg_datum));
+  ASSERT_FALSE(agg_datum->is_nop());
+
+  // merge the filter of the block into an upper level one
+  ObStorageDatum upper_result;
+  ObSkipIndexDatumAttr upper_result_attr;
+  ObColNgramBloomFilterAggregator upper_aggregator;
+  ASSERT_EQ(OB_SUCCESS, upper_aggregator.init(true, col_desc, DATA_CURRENT_VERSION, upper_result, upper_result_attr));
+  ASSERT_EQ(OB_SUCCESS, upper_aggregator.eval(*agg_datum, ObSkipIndexDatumAttr()));
+  ASSERT_EQ(OB_SUCCESS, upper_aggregator.get_result(agg_datum));
+
+  ObSkipIndexBloomFilter ngram_filter;
+  ASSERT_EQ(OB_SUCCESS, ngram_filter.from_datum(*agg_datum));
+  ASSERT_TRUE(ngram_filter.may_match_like_pattern(ObString("%llo%"), ObString("\\")));
+  ASSERT_TRUE(ngram_filter.may_match_like_pattern(ObString("he%ld"), ObString("\\")));
+  ASSERT_TRUE(ngram_filter.may_match_like_pattern(ObString("%o\\_w%"), ObString("\\")));
+  ASSERT_TRUE(ngram_filter.may_match_like_pattern(ObString("foo%bar"), ObString("\\")));
+  // too short to be checked
+  ASSERT_TRUE(ngram_filter.may_match_like_pattern(ObString("%zz%"), ObString("\\")));
+  ASSERT_FALSE(ngram_filter.may_match_like_pattern(ObString("%xyz%"), ObString("\\")));
+  // multi-byte escape is not handled
+  ASSERT_TRUE(ngram_filter.may_match_like_pattern(ObString("%xyz%"), ObString("ab")));
+
+  // too many distinct trigrams
+  aggregator.reuse();
+  char buf[16];
+  for (int64_t i = 0; i < 100; ++i) {
+    snprintf(buf, sizeof(buf), "%08ld", i * 7919);
+    ObStorageDatum datum;
+    datum.set_string(ObString(buf));
+    ASSERT_EQ(OB_SUCCESS, aggregator.eval(datum, raw_attr));
+  }
+  ASSERT_EQ(OB_SUCCESS, aggregator.get_result(agg_datum));
+  ASSERT_TRUE(agg_datum->is_nop());
+
+  // trigrams of bytes do not agree with a case insensitive LIKE
+  ObColDesc ci_col_desc = col_desc;
+  ci_col_desc.col_type_.set_collation_type(CS_TYPE_UTF8MB4_GENERAL_CI);
+  aggregator.reset();
+  ASSERT_EQ(OB_SUCCESS, aggregator.init(true, ci_col_desc, DATA_CURRENT_VERSION, result, result_attr));
+  ObStorageDatum datum;
+  datum.set_string(ObString(strs[0]));
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(datum, raw_attr));
+  ASSERT_EQ(OB_SUCCESS, aggregator.get_result(agg_datum));
+  ASSERT_TRUE(agg_datum->is_nop());
+
+  // an older major working version can not read the sketch
+  aggregator.reset();
+  ASSERT_EQ(OB_SUCCESS, aggregator.init(true, col_desc, DATA_VERSION_1_0_0_0, result, result_attr));
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(datum, raw_attr));
+  ASSERT_EQ(OB_SUCCESS, aggregator.get_result(agg_datum));
+  ASSERT_TRUE(agg_datum->is_nop());
+}
+
+TEST_F(TestIndexBlockAggregator, test_value_bloom_filter)
+{
+  ObColDesc col_desc;
+  col_desc.col_type_.set_int();
+  const sql::ObExprBasicFuncs *basic_funcs = ObDatumFuncs::get_basic_func(ObIntType, CS_TYPE_BINARY);
+  ASSERT_NE(nullptr, basic_funcs);
+  ObStorageDatum result;
+  ObSkipIndexDatumAttr result_attr;
+  ObColValueBloomFilterAggregator aggregator;
+  ASSERT_EQ(OB_NOT_SUPPORTED, aggregator.init(false, col_desc, DATA_CURRENT_VERSION, result, result_attr));
+  aggregator.reset();
+  ASSERT_EQ(OB_SUCCESS, aggregator.init(true, col_desc, DATA_CURRENT_VERSION, result, result_attr));
+
+  const ObSkipIndexDatumAttr raw_attr(true, false);
+  ObSkipIndexValueBloomFilter filters[2];
+  const int64_t distinct_cnts[] = {10, 300};
+  for (int64_t round = 0; round < 2; ++round) {
+    aggregator.reuse();
+    for (int64_t i = 0; i < distinct_cnts[round]; ++i) {
+      ObStorageDatum datum;
+      datum.set_int(round * 100000 + i * 7);
+      // duplicates do not fill the filter
+      ASSERT_EQ(OB_SUCCESS, aggregator.eval(datum, raw_attr));
+      ASSERT_EQ(OB_SUCCESS, aggregator.eval(datum, raw_attr));
+    }
+    const ObStorageDatum *agg_datum = nullptr;
+    ASSERT_EQ(OB_SUCCESS, aggregator.get_result(agg_datum));
+    ASSERT_FALSE(agg_datum->is_nop());
+    ASSERT_EQ(OB_SUCCESS, filters[round].from_datum(*agg_datum));
+  }
+  // the filter is folded to the distinct values of the block
+  ASSERT_LT(filters[0].get_data_size(), filters[1].get_data_size());
+  ASSERT_EQ(ObSkipIndexValueBloomFilter::MAX_SIZE, filters[1].get_data_size());
+  ASSERT_LE(filters[0].get_set_bit_cnt(), filters[0].get_data_size() * 8 / 2);
+
+  // merge the filters of the two blocks into an upper level one at the smaller size
+  ObStorageDatum upper_result;
+  ObSkipIndexDatumAttr upper_result_attr;
+  ObColValueBloomFilterAggregator upper_aggregator;
+  ASSERT_EQ(OB_SUCCESS, upper_aggregator.init(true, col_desc, DATA_CURRENT_VERSION, upper_result, upper_result_attr));
+  for (int64_t round = 0; round < 2; ++round) {
+    ObStorageDatum datum;
+    datum.set_string(filters[round].get_data(), filters[round].get_data_size());
+    ASSERT_EQ(OB_SUCCESS, upper_aggregator.eval(datum, ObSkipIndexDatumAttr()));
+  }
+  const ObStorageDatum *upper_datum = nullptr;
+  ASSERT_EQ(OB_SUCCESS, upper_aggregator.get_result(upper_datum));
+  ObSkipIndexValueBloomFilter upper_filter;
+  if (!upper_datum->is_nop()) {
+    ASSERT_EQ(OB_SUCCESS, upper_filter.from_datum(*upper_datum));
+    ASSERT_LE(upper_filter.get_data_size(), filters[0].get_data_size());
+  }
+
+  // no false negative at any size, few false positives on the block of 300 values
+  int64_t false_positive_cnt = 0;
+  for (int64_t round = 0; round < 2; ++round) {
+    for (int64_t i = 0; i < distinct_cnts[round]; ++i) {
+      ObStorageDatum datum;
+      uint64_t hash = 0;
+      datum.set_int(round * 100000 + i * 7);
+      ASSERT_EQ(OB_SUCCESS, basic_funcs->murmur_hash_v2_(datum, ObSkipIndexValueBloomFilter::VALUE_HASH_SEED, hash));
+      ASSERT_TRUE(filters[round].may_contain(hash));
+      ASSERT_TRUE(upper_datum->is_nop() || upper_filter.may_contain(hash));
+    }
+  }
+  for (int64_t i = 0; i < 1000; ++i) {
+    ObStorageDatum datum;
+    uint64_t hash = 0;
+    datum.set_int(-1 - i);
+    ASSERT_EQ(OB_SUCCESS, basic_funcs->murmur_hash_v2_(datum, ObSkipIndexValueBloomFilter::VALUE_HASH_SEED, hash));
+    false_positive_cnt += filters[1].may_contain(hash) ? 1 : 0;
+  }
+  STORAGE_LOG(INFO, "value bloom filter false positives", K(false_positive_cnt), K(filters[1]));
+  ASSERT_LT(false_positive_cnt, 150);
+
+  // too many distinct values
+  aggregator.reuse();
+  for (int64_t i = 0; i < 2000; ++i) {
+    ObStorageDatum datum;
+    datum.set_int(i);
+    ASSERT_EQ(OB_SUCCESS, aggregator.eval(datum, raw_attr));
+  }
+  const ObStorageDatum *agg_datum = nullptr;
+  ASSERT_EQ(OB_SUCCESS, aggregator.get_result(agg_datum));
+  ASSERT_TRUE(agg_datum->is_nop());
+
+  // an older major working version can not read the sketch
+  aggregator.reset();
+  ASSERT_EQ(OB_SUCCESS, aggregator.init(true, col_desc, DATA_VERSION_1_0_0_0, result, result_attr));
+  ObStorageDatum datum;
+  datum.set_int(1);
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(datum, raw_attr));
+  ASSERT_EQ(OB_SUCCESS, aggregator.get_result(agg_datum));
+  ASSERT_TRUE(agg_datum->is_nop());
+}
+
+TEST_F(TestIndexBlockAggregator, test_value_bloom_filter_agg_row)
+{
+  static const int64_t test_column_cnt = 3;
+  const int64_t extra_rowkey_cnt = ObMultiVersionRowkeyHelpper::get_extra_rowkey_col_cnt();
+  ObObjType col_obj_types[test_column_cnt];
+  col_obj_types[0] = ObIntType;
+  col_obj_types[1] = ObIntType;
+  col_obj_types[2] = ObVarcharType;
+  init_schema(test_column_cnt, 1, col_obj_types);
+  for (int64_t i = rowkey_count_; i < test_column_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, full_agg_metas_.push_back(ObSkipIndexColMeta(i + extra_rowkey_cnt, SK_IDX_BLOOM_FILTER)));
+  }
+  data_version_ = DATA_CURRENT_VERSION;
+
+  // a filter larger than a datum buffer goes through the agg row of the block and its upper level
+  const bool is_major = true;
+  const int64_t test_row_cnt = 300;
+  ObSkipIndexDataAggregator data_aggregator;
+  ObSkipIndexIndexAggregator index_aggregator;
+  ASSERT_EQ(OB_SUCCESS, data_aggregator.init(is_major, full_agg_metas_, col_descs_, data_version_, allocator_));
+  ASSERT_EQ(OB_SUCCESS, index_aggregator.init(is_major, full_agg_metas_, col_descs_, data_version_, allocator_));
+  ObDatumRow generate_row;
+  ASSERT_EQ(OB_SUCCESS, generate_row.init(full_column_count_));
+  for (int64_t i = 0; i < test_row_cnt; ++i) {
+    generate_row_by_seed(i, generate_row);
+    ASSERT_EQ(OB_SUCCESS, data_aggregator.eval(generate_row));
+  }
+  const ObSkipIndexAggResult *data_agg_row = nullptr;
+  const ObSkipIndexAggResult *index_agg_row = nullptr;
+  ASSERT_EQ(OB_SUCCESS, data_aggregator.get_aggregated_row(data_agg_row));
+  const char *row_buf = nullptr;
+  int64_t row_size = 0;
+  serialize_agg_row(*data_agg_row, row_buf, row_size);
+  ASSERT_EQ(OB_SUCCESS, index_aggregator.ObISkipIndexAggregator::eval(row_buf, row_size, test_row_cnt));
+  ASSERT_EQ(OB_SUCCESS, index_aggregator.get_aggregated_row(index_agg_row));
+  serialize_agg_row(*index_agg_row, row_buf, row_size);
+
+  ObAggRowReader reader;
+  ASSERT_EQ(OB_SUCCESS, reader.init(row_buf, row_size));
+  for (int64_t j = rowkey_count_; j < test_column_cnt; ++j) {
+    ObStorageDatum datum;
+    ObSkipIndexValueBloomFilter bloom_filter;
+    ASSERT_EQ(OB_SUCCESS, reader.read(ObSkipIndexColMeta(j + extra_rowkey_cnt, SK_IDX_BLOOM_FILTER), datum));
+    ASSERT_EQ(OB_SUCCESS, bloom_filter.from_datum(datum));
+    ASSERT_GT(bloom_filter.get_data_size(), ObSkipIndexColMeta::MAX_SKIP_INDEX_COL_LENGTH);
+    const sql::ObExprBasicFuncs *basic_funcs = ObDatumFuncs::get_basic_func(
+        col_descs_.at(j + extra_rowkey_cnt).col_type_.get_type(),
+        col_descs_.at(j + extra_rowkey_cnt).col_type_.get_collation_type());
+    for (int64_t i = 0; i < test_row_cnt; ++i) {
+      uint64_t hash = 0;
+      generate_row_by_seed(i, generate_row);
+      ASSERT_EQ(OB_SUCCESS, basic_funcs->murmur_hash_v2_(generate_row.storage_datums_[j + extra_rowkey_cnt],
+          ObSkipIndexValueBloomFilter::VALUE_HASH_SEED, hash));
+      ASSERT_TRUE(bloom_filter.may_contain(hash));
+    }
+  }
+}
+
+TEST_F(TestIndexBlockAggregator, test_vector_bound)
+{
+  static const int64_t dim = 10;
+  static const int64_t vector_cnt = 100;
+  ObColDesc col_desc;
+  col_desc.col_type_.set_type(ObCollectionSQLType);
+  col_desc.col_type_.set_collation_type(CS_TYPE_BINARY);
+  ObStorageDatum result;
+  ObSkipIndexDatumAttr result_attr;
+  ObColVectorBoundAggregator aggregator;
+  ASSERT_EQ(OB_NOT_SUPPORTED, aggregator.init(false, col_desc, DATA_CURRENT_VERSION, result, result_attr));
+  aggregator.reset();
+  ASSERT_EQ(OB_SUCCESS, aggregator.init(true, col_desc, DATA_CURRENT_VERSION, result, result_attr));
+
+  float vectors[vector_cnt][dim];
+  char lob_buf[sizeof(ObLobCommon) + sizeof(float) * dim];
+  const ObSkipIndexDatumAttr raw_attr(true, false);
+  for (int64_t i = 0; i < vector_cnt; ++i) {
+    for (int64_t j = 0; j < dim; ++j) {
+      vectors[i][j] = static_cast<float>(ObRandom::rand(-1000, 1000)) / 100;
+    }
+    ObLobCommon *lob_data = new (lob_buf) ObLobCommon();
+    MEMCPY(lob_data->buffer_, vectors[i], sizeof(float) * dim);
+    ObStorageDatum datum;
+    datum.set_lob_data(*lob_data, lob_data->get_handle_size(sizeof(float) * dim));
+    ASSERT_EQ(OB_SUCCESS, aggregator.eval(datum, raw_attr));
+  }
+  ObStorageDatum null_datum;
+  null_datum.set_null();
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(null_datum, raw_attr));
+  const ObStorageDatum *agg_datum = nullptr;
+  ASSERT_EQ(OB_SUCCESS, aggregator.get_result(agg_datum));
+  ASSERT_EQ(ObSkipIndexVectorBound::VECTOR_BOUND_SIZE, agg_datum->len_);
+
+  // merge the bound of the block into an upper level one
+  ObStorageDatum upper_result;
+  ObSkipIndexDatumAttr upper_result_attr;
+  ObColVectorBoundAggregator upper_aggregator;
+  ASSERT_EQ(OB_SUCCESS, upper_aggregator.init(true, col_desc, DATA_CURRENT_VERSION, upper_result, upper_result_attr));
+  ASSERT_EQ(OB_SUCCESS, upper_aggregator.eval(*agg_datum, ObSkipIndexDatumAttr()));
+  ASSERT_EQ(OB_SUCCESS, upper_aggregator.get_result(agg_datum));
+
+  // the col type of vector bound only fits in the wide type bitmap, which older observers can not read
+  ObSkipIndexAggResult agg_result;
+  ASSERT_EQ(OB_SUCCESS, agg_result.init(1, allocator_));
+  agg_result.get_agg_datum_row().storage_datums_[0] = *agg_datum;
+  full_agg_metas_.reset();
+  ASSERT_EQ(OB_SUCCESS, full_agg_metas_.push_back(ObSkipIndexColMeta(0, SK_IDX_VECTOR_BOUND)));
+  ObAggRowWriter writer;
+  ASSERT_EQ(OB_ERR_UNEXPECTED, writer.init(full_agg_metas_, agg_result, DATA_VERSION_1_0_0_0, allocator_));
+  data_version_ = DATA_CURRENT_VERSION;
+  const char *row_buf = nullptr;
+  int64_t row_size = 0;
+  serialize_agg_row(agg_result, row_buf, row_size);
+  const int64_t wide_bitmap_size = ObAggRowHeader::AGG_COL_TYPE_WIDE_BITMAP_SIZE;
+  ASSERT_EQ(wide_bitmap_size, reinterpret_cast<const ObAggRowHeader *>(row_buf)->bitmap_size_);
+  ObAggRowReader reader;
+  ObStorageDatum read_datum;
+  ASSERT_EQ(OB_SUCCESS, reader.init(row_buf, row_size));
+  ASSERT_EQ(OB_SUCCESS, reader.read(ObSkipIndexColMeta(0, SK_IDX_VECTOR_BOUND), read_datum));
+  ASSERT_EQ(ObSkipIndexVectorBound::VECTOR_BOUND_SIZE, read_datum.len_);
+  // a nop vector bound keeps the 1 byte bitmap
+  agg_result.get_agg_datum_row().storage_datums_[0].set_nop();
+  writer.reset();
+  ASSERT_EQ(OB_SUCCESS, writer.init(full_agg_metas_, agg_result, DATA_VERSION_1_0_0_0, allocator_));
+
+  // an older major working version can not read the sketch
+  ObStorageDatum old_result;
+  ObSkipIndexDatumAttr old_result_attr;
+  ObColVectorBoundAggregator old_aggregator;
+  ASSERT_EQ(OB_SUCCESS, old_aggregator.init(true, col_desc, DATA_VERSION_1_0_0_0, old_result, old_result_attr));
+  ASSERT_EQ(OB_SUCCESS, old_aggregator.eval(null_datum, raw_attr));
+  const ObStorageDatum *old_agg_datum = nullptr;
+  ASSERT_EQ(OB_SUCCESS, old_aggregator.get_result(old_agg_datum));
+  ASSERT_TRUE(old_agg_datum->is_nop());
+
+  ObSkipIndexVectorBound vector_bound;
+  ASSERT_EQ(OB_SUCCESS, vector_bound.from_datum(*agg_datum));
+  ASSERT_FALSE(vector_bound.is_empty());
+  ASSERT_TRUE(vector_bound.has_null());
+  for (int64_t round = 0; round < 100; ++round) {
+    float query[dim];
+    for (int64_t j = 0; j < dim; ++j) {
+      query[j] = static_cast<float>(ObRandom::rand(-5000, 5000)) / 100;
+    }
+    double min_distance = DBL_MAX;
+    for (int64_t i = 0; i < vector_cnt; ++i) {
+      double square = 0;
+      for (int64_t j = 0; j < dim; ++j) {
+        square += (static_cast<double>(query[j]) - vectors[i][j]) * (static_cast<double>(query[j]) - vectors[i][j]);
+      }
+      min_distance = MIN(min_distance, std::sqrt(square));
+    }
+    ASSERT_LE(vector_bound.get_l2_distance_lower_bound(query, dim), min_distance);
+  }
+  // all elements are in [-10, 10]
+  float far_query[dim];
+  for (int64_t j = 0; j < dim; ++j) {
+    far_query[j] = 100;
+  }
+  ASSERT_GT(vector_bound.get_l2_distance_lower_bound(far_query, dim), 90 * std::sqrt(static_cast<double>(dim)) * 0.99);
+
+  // nan can not be bounded
+  aggregator.reuse();
+  vectors[0][0] = NAN;
+  ObLobCommon *lob_data = new (lob_buf) ObLobCommon();
+  MEMCPY(lob_data->buffer_, vectors[0], sizeof(float) * dim);
+  ObStorageDatum nan_datum;
+  nan_datum.set_lob_data(*lob_data, lob_data->get_handle_size(sizeof(float) * dim));
+  ASSERT_EQ(OB_SUCCESS, aggregator.eval(nan_datum, raw_attr));
+  ASSERT_EQ(OB_SUCCESS, aggregator.get_result(agg_datum));
+  ASSERT_TRUE(agg_datum->is_nop());
+}
 
 }
 }
@@ -1396,6 +1396,33 @@ TEST_F(TestSkipIndexFilter, test_has_null)
 }
 
 
+TEST_F(TestSkipIndexFilter, test_vector_column_dim)
+{
+  // the vector bound is only probed by query vectors of the same dim as the column
+  sql::ObExecContext exec_ctx(allocator_);
+  sql::ObEvalCtx eval_ctx(exec_ctx);
+  ASSERT_EQ(OB_SUCCESS, exec_ctx.create_physical_plan_ctx());
+  ObPhysicalPlanCtx *plan_ctx = exec_ctx.get_physical_plan_ctx();
+  uint16_t vector_subschema_id = 0;
+  uint16_t array_subschema_id = 0;
+  ASSERT_EQ(OB_SUCCESS, plan_ctx->get_subschema_id_by_type_string(ObString("VECTOR(4)"), vector_subschema_id));
+  ASSERT_EQ(OB_SUCCESS, plan_ctx->get_subschema_id_by_type_string(ObString("ARRAY(FLOAT)"), array_subschema_id));
+
+  ObExpr col_expr;
+  col_expr.type_ = T_REF_COLUMN;
+  int64_t dim = -1;
+  col_expr.obj_meta_.set_collection(vector_subschema_id);
+  ASSERT_EQ(OB_SUCCESS, ObSkipIndexFilterExecutor::get_vector_column_dim(col_expr, eval_ctx, dim));
+  ASSERT_EQ(4, dim);
+  col_expr.obj_meta_.set_collection(array_subschema_id);
+  ASSERT_EQ(OB_SUCCESS, ObSkipIndexFilterExecutor::get_vector_column_dim(col_expr, eval_ctx, dim));
+  ASSERT_EQ(0, dim);
+  col_expr.obj_meta_.set_int();
+  ASSERT_EQ(OB_SUCCESS, ObSkipIndexFilterExecutor::get_vector_column_dim(col_expr, eval_ctx, dim));
+  ASSERT_EQ(0, dim);
+}
+
+
 }//end namespace unittest
 }//end namespace oceanbase
 
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2025 OceanBase.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define USING_LOG_PREFIX STORAGE_FTS
+#include <gtest/gtest.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "lib/file/file_directory_utils.h"
+#include "storage/ob_file_system_router.h"
+#define private public
+#include "storage/fts/dict/ob_ft_dict_image.h"
+#undef private
+#include "storage/fts/dict/ob_ft_cache_dict.h"
+
+namespace oceanbase
+{
+namespace storage
+{
+
+static const char *TEST_DATA_DIR = "./test_ft_dict_image_data";
+
+class TestFTDictImage : public ::testing::Test
+{
+public:
+  TestFTDictImage()
+      : desc_("quan_dict", ObFTDictType::DICT_IK_QUAN, ObCharsetType::CHARSET_UTF8MB4,
+              ObCollationType::CS_TYPE_UTF8MB4_BIN),
+        allocator_("FTDictImgTest")
+  {}
+  ~TestFTDictImage() {}
+  static void SetUpTestCase()
+  {
+    char clog_dir[common::MAX_PATH_SIZE] = {0};
+    snprintf(clog_dir, sizeof(clog_dir), "%s/clog/", TEST_DATA_DIR);
+    (void)common::FileDirectoryUtils::delete_directory_rec(TEST_DATA_DIR);
+    ASSERT_EQ(OB_SUCCESS, common::FileDirectoryUtils::create_full_path(clog_dir));
+    ASSERT_EQ(OB_SUCCESS, ObFileSystemRouter::get_instance().init(TEST_DATA_DIR, clog_dir));
+  }
+  static void TearDownTestCase()
+  {
+    (void)common::FileDirectoryUtils::delete_directory_rec(TEST_DATA_DIR);
+  }
+  virtual void SetUp()
+  {
+    const char *name = nullptr;
+    ASSERT_EQ(OB_SUCCESS, ObFTDictImage::get_raw_dict(desc_.type_, raw_dict_, name));
+    ASSERT_EQ(OB_SUCCESS, ObFTDictImage::get_image_path(name, path_, sizeof(path_)));
+    word_checksum_ = ObFTDictImage::calc_word_checksum(raw_dict_);
+    ::unlink(path_);
+  }
+  ino_t get_inode()
+  {
+    struct stat st;
+    return 0 == ::stat(path_, &st) ? st.st_ino : 0;
+  }
+  void overwrite(const int64_t offset, const void *data, const int64_t size)
+  {
+    int fd = ::open(path_, O_WRONLY);
+    ASSERT_GE(fd, 0);
+    ASSERT_EQ(size, ::pwrite(fd, data, size, offset));
+    ::close(fd);
+  }
+  // map the image as it is, without rebuilding it
+  int map_image()
+  {
+    ObFTDictImage image;
+    return image.map(path_, desc_.type_, raw_dict_.array_size_, word_checksum_);
+  }
+  // the image is rebuilt by load and can be used again
+  void check_rebuild(const ino_t old_inode)
+  {
+    ObFTDictImage image;
+    ASSERT_EQ(OB_SUCCESS, image.load(desc_));
+    ASSERT_NE(old_inode, get_inode());
+    ASSERT_EQ(OB_SUCCESS, map_image());
+  }
+
+protected:
+  ObFTDictDesc desc_;
+  ObArenaAllocator allocator_;
+  ObIKDictLoader::RawDict raw_dict_;
+  char path_[common::MAX_PATH_SIZE];
+  int64_t word_checksum_;
+
+private:
+  DISALLOW_COPY_AND_ASSIGN(TestFTDictImage);
+};
+
+TEST_F(TestFTDictImage, build_and_map)
+{
+  ObFTDictImage image;
+  ASSERT_EQ(OB_SUCCESS, image.load(desc_));
+  ASSERT_TRUE(image.is_loaded());
+  ASSERT_TRUE(image.header_.is_valid());
+  ASSERT_EQ(raw_dict_.array_size_, image.header_.word_count_);
+  ASSERT_GT(image.header_.range_count_, 0);
+  const ino_t inode = get_inode();
+  ASSERT_NE(0, inode);
+
+  ObFTCacheRangeContainer container(allocator_);
+  ASSERT_EQ(OB_SUCCESS, image.fill_container(desc_, container));
+  ASSERT_EQ(image.header_.range_count_, container.get_handles().size());
+
+  // every built-in word is found in the dat of its range
+  int64_t found_cnt = 0;
+  for (int64_t i = 0; i < raw_dict_.array_size_; ++i) {
+    const ObString word(raw_dict_.data_[i]);
+    bool is_match = false;
+    for (ObList<ObFTCacheRangeHandle *, ObIAllocator>::const_iterator iter = container.get_handles().begin();
+         !is_match && iter != container.get_handles().end();
+         iter++) {
+      ObFTCacheDict dict(desc_.coll_type_, (*iter)->value_->dat_block_);
+      ASSERT_EQ(OB_SUCCESS, dict.match(word, is_match));
+    }
+    found_cnt += word.empty() || is_match;
+  }
+  ASSERT_EQ(raw_dict_.array_size_, found_cnt);
+  bool is_match = true;
+  ObFTCacheDict dict(desc_.coll_type_, (*container.get_handles().begin())->value_->dat_block_);
+  ASSERT_EQ(OB_SUCCESS, dict.match(ObString("zzzzzz"), is_match));
+  ASSERT_FALSE(is_match);
+
+  // another dict type is rejected
+  ObFTDictDesc stop_desc("stopword", ObFTDictType::DICT_IK_STOP, ObCharsetType::CHARSET_UTF8MB4,
+                         ObCollationType::CS_TYPE_UTF8MB4_BIN);
+  ASSERT_EQ(OB_INVALID_ARGUMENT, image.fill_container(stop_desc, container));
+
+  // the next load maps the same file
+  ObFTDictImage image2;
+  ASSERT_EQ(OB_SUCCESS, image2.load(desc_));
+  ASSERT_EQ(inode, get_inode());
+  ASSERT_EQ(image.header_.data_checksum_, image2.header_.data_checksum_);
+  image.destroy();
+  ASSERT_FALSE(image.is_loaded());
+  ASSERT_EQ(OB_NOT_INIT, image.fill_container(desc_, container));
+}
+
+TEST_F(TestFTDictImage, stale_image)
+{
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, map_image());
+  {
+    ObFTDictImage image;
+    ASSERT_EQ(OB_SUCCESS, image.load(desc_));
+  }
+  // a valid image built from other words
+  ObFTDictImageHeader header;
+  int fd = ::open(path_, O_RDONLY);
+  ASSERT_GE(fd, 0);
+  ASSERT_EQ(sizeof(header), ::pread(fd, &header, sizeof(header), 0));
+  ::close(fd);
+  header.init(desc_.type_, header.word_count_ + 1, header.word_checksum_, header.range_count_,
+              header.data_size_, header.data_checksum_);
+  overwrite(0, &header, sizeof(header));
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, map_image());
+  check_rebuild(get_inode());
+}
+
+TEST_F(TestFTDictImage, corrupt_image)
+{
+  {
+    ObFTDictImage image;
+    ASSERT_EQ(OB_SUCCESS, image.load(desc_));
+  }
+  struct stat st;
+  ASSERT_EQ(0, ::stat(path_, &st));
+
+  // flipped byte in the data
+  char byte = 0;
+  int fd = ::open(path_, O_RDONLY);
+  ASSERT_EQ(1, ::pread(fd, &byte, 1, ObFTDictImageHeader::DATA_OFFSET + 1));
+  ::close(fd);
+  byte = ~byte;
+  overwrite(ObFTDictImageHeader::DATA_OFFSET + 1, &byte, 1);
+  ASSERT_EQ(OB_CHECKSUM_ERROR, map_image());
+  check_rebuild(get_inode());
+
+  // changed field in the header
+  const int64_t data_size = 0x7f;
+  overwrite(offsetof(ObFTDictImageHeader, data_size_), &data_size, sizeof(data_size));
+  ASSERT_EQ(OB_INVALID_DATA, map_image());
+  check_rebuild(get_inode());
+
+  // torn file
+  ASSERT_EQ(0, ::truncate(path_, st.st_size - 1));
+  ASSERT_EQ(OB_INVALID_DATA, map_image());
+  check_rebuild(get_inode());
+
+  // empty file
+  ASSERT_EQ(0, ::truncate(path_, 0));
+  ASSERT_EQ(OB_INVALID_DATA, map_image());
+  check_rebuild(get_inode());
+}
+
+} // namespace storage
+} // namespace oceanbase
+
+int main(int argc, char** argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -34,6 +34,8 @@
 #include "storage/fts/ik/ob_ik_char_util.h"
 #include "storage/fts/ik/ob_ik_token.h"
 #include "storage/fts/ob_ik_ft_parser.h"
+#include "storage/fts/ob_whitespace_ft_parser.h"
+#include "storage/fts/utils/ob_ft_char_utils.h"
 #include "storage/fts/utils/ob_ft_ngram_impl.h"
 
 #include <alloca.h>
@@ -581,6 +583,94 @@ TEST_F(FTParserTest, test_char_util)
   ObFTCharUtil::classify_first_char(common::CS_TYPE_UTF8MB4_BIN, eng, 1, type);
 }
 
+TEST_F(FTParserTest, test_ascii_char_util)
+{
+  ASSERT_TRUE(ObFTAsciiCharUtil::is_ascii_compatible(
+      common::ObCharset::get_charset(common::CS_TYPE_UTF8MB4_BIN)));
+  ASSERT_TRUE(ObFTAsciiCharUtil::is_ascii_compatible(
+      common::ObCharset::get_charset(common::CS_TYPE_GBK_CHINESE_CI)));
+  ASSERT_FALSE(ObFTAsciiCharUtil::is_ascii_compatible(
+      common::ObCharset::get_charset(common::CS_TYPE_UTF16_BIN)));
+
+  // the vectorized scans stop at the same bytes as the byte by byte ones
+  const char alphabet[] = "aZ09_ -,.\t\n\x80\xe4";
+  char buf[100];
+  srand(20251017);
+  for (int64_t round = 0; round < 1000; ++round) {
+    const int64_t len = rand() % sizeof(buf);
+    for (int64_t i = 0; i < len; ++i) {
+      buf[i] = alphabet[rand() % (sizeof(alphabet) - 1)];
+    }
+    const char *end = buf + len;
+    const char *delimiter_end = buf;
+    while (delimiter_end < end && ObFTAsciiCharUtil::is_ascii(*delimiter_end)
+           && !ObFTAsciiCharUtil::is_ascii_word_char(*delimiter_end)) {
+      ++delimiter_end;
+    }
+    const char *word_end = buf;
+    while (word_end < end && ObFTAsciiCharUtil::is_ascii_word_char(*word_end)) {
+      ++word_end;
+    }
+    ASSERT_EQ(delimiter_end, ObFTAsciiCharUtil::skip_ascii_delimiters(buf, end));
+    ASSERT_EQ(word_end, ObFTAsciiCharUtil::skip_ascii_word_chars(buf, end));
+  }
+}
+
+TEST_F(FTParserTest, test_space_parser_token_batch)
+{
+  const char *text = "  The quick,brown fox\tjumps \xe4\xb8\xad\xe6\x96\x87 over the lazy_dog 42 ";
+  ObFTParserParam param;
+  param.cs_ = common::ObCharset::get_charset(common::CS_TYPE_UTF8MB4_GENERAL_CI);
+  param.fulltext_ = text;
+  param.ft_length_ = STRLEN(text);
+
+  std::vector<std::string> expect_words;
+  std::vector<int64_t> expect_char_cnts;
+  ObSpaceFTParser parser;
+  ASSERT_EQ(OB_SUCCESS, parser.init(&param));
+  int ret = OB_SUCCESS;
+  while (OB_SUCC(ret)) {
+    const char *word = nullptr;
+    int64_t word_len = 0;
+    int64_t char_cnt = 0;
+    int64_t word_freq = 0;
+    if (OB_FAIL(parser.get_next_token(word, word_len, char_cnt, word_freq))) {
+      ASSERT_EQ(OB_ITER_END, ret);
+    } else {
+      expect_words.push_back(std::string(word, word_len));
+      expect_char_cnts.push_back(char_cnt);
+    }
+  }
+  const int64_t word_cnt = expect_words.size();
+  ASSERT_GE(word_cnt, 9);
+  ASSERT_EQ("The", expect_words[0]);
+  ASSERT_EQ("lazy_dog", expect_words[word_cnt - 2]);
+  ASSERT_EQ("42", expect_words[word_cnt - 1]);
+
+  // a batch stops at the capacity and at the end of the text, the tokens are the same
+  for (int64_t capacity = 1; capacity <= 12; ++capacity) {
+    ObSpaceFTParser batch_parser;
+    ObFTToken tokens[12];
+    int64_t count = 0;
+    int64_t total_cnt = 0;
+    ASSERT_EQ(OB_SUCCESS, batch_parser.init(&param));
+    ASSERT_EQ(OB_INVALID_ARGUMENT, batch_parser.get_next_tokens(tokens, 0, count));
+    while (OB_SUCC(batch_parser.get_next_tokens(tokens, capacity, count))) {
+      ASSERT_GT(count, 0);
+      ASSERT_LE(count, capacity);
+      for (int64_t i = 0; i < count; ++i, ++total_cnt) {
+        ASSERT_LT(total_cnt, word_cnt);
+        ASSERT_EQ(expect_words[total_cnt], std::string(tokens[i].word_, tokens[i].word_len_));
+        ASSERT_EQ(expect_char_cnts[total_cnt], tokens[i].char_cnt_);
+        ASSERT_EQ(1, tokens[i].word_freq_);
+      }
+    }
+    ASSERT_EQ(OB_ITER_END, ret);
+    ASSERT_EQ(0, count);
+    ASSERT_EQ(word_cnt, total_cnt);
+  }
+}
+
 TEST_F(FTParserTest, test_lex_container)
 {
   char buf[] = "abcdefghijklmnopqrstuvwxyz";